@@ -23,6 +23,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -49,6 +50,7 @@
 #include <AzCore/IO/SystemFile.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 
 #include <AzCore/Math/PolygonPrism.h>
@@ -654,6 +656,12 @@ namespace AZ
 
         Sfmt::Create();
 
+        if (!AllocatorInstance<FrameAllocator>::IsReady())
+        {
+            AllocatorInstance<FrameAllocator>::Create();
+            m_isFrameAllocatorOwner = true;
+        }
+
         CreateReflectionManager();
 
         if (m_startupParameters.m_createEditContext)
@@ -768,6 +776,12 @@ namespace AZ
 
         Sfmt::Destroy();
 
+        if (m_isFrameAllocatorOwner)
+        {
+            AllocatorInstance<FrameAllocator>::Destroy();
+            m_isFrameAllocatorOwner = false;
+        }
+
         // delete all descriptors left for application clean up
         EBUS_EVENT(ComponentDescriptorBus, ReleaseDescriptor);
 
@@ -1413,6 +1427,12 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        if (m_isFrameAllocatorOwner)
+        {
+            // Frame memory from the tick before last expires, memory from the last tick stays valid during this one
+            static_cast<FrameAllocator&>(AllocatorInstance<FrameAllocator>::GetAllocator()).AdvanceFrame();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -1425,6 +1445,11 @@ namespace AZ
             AZ::TickBus::Broadcast(&TickEvents::OnTick, deltaTimeSeconds, GetTimeAtCurrentTick());
         }
 
+        if (auto profilerSystem = AZ::Debug::ProfilerSystemInterface::Get(); profilerSystem && profilerSystem->IsActive())
+        {
+            NameDictionary::Instance().RecordStatistics();
+        }
+
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
     }
 
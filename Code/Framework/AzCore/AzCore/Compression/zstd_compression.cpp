@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/std/algorithm.h>
 #include <limits>
 
 #include <AzCore/Compression/zstd_compression.h>
@@ -175,6 +176,190 @@ bool ZStd::IsDecompressorStarted() const
     return m_streamDecompression != nullptr;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Block framed data
+
+namespace ZStdInternal
+{
+    static constexpr AZ::u32 SkippableFrameMagic = 0x184D2A5E;
+    static constexpr AZ::u32 SeekTableMagic = 0x8F92EAB1;
+    static constexpr size_t SkippableFrameHeaderSize = 8;  // Magic and frame size.
+    static constexpr size_t SeekTableEntrySize = 8;        // Compressed and decompressed size.
+    static constexpr size_t SeekTableChecksumSize = 4;     // Optional per block checksum, read past but not verified.
+    static constexpr size_t SeekTableFooterSize = 9;       // Number of blocks, descriptor and magic.
+    static constexpr AZ::u8 SeekTableChecksumFlag = 0x80;
+
+    // The seek table is always stored as little endian.
+    static void WriteU32(AZ::u8* destination, AZ::u32 value)
+    {
+        destination[0] = static_cast<AZ::u8>(value);
+        destination[1] = static_cast<AZ::u8>(value >> 8);
+        destination[2] = static_cast<AZ::u8>(value >> 16);
+        destination[3] = static_cast<AZ::u8>(value >> 24);
+    }
+
+    static AZ::u32 ReadU32(const AZ::u8* source)
+    {
+        return static_cast<AZ::u32>(source[0]) | (static_cast<AZ::u32>(source[1]) << 8) |
+            (static_cast<AZ::u32>(source[2]) << 16) | (static_cast<AZ::u32>(source[3]) << 24);
+    }
+
+    static size_t GetNumBlocks(size_t dataSize, size_t blockSize)
+    {
+        // Empty data is still stored as a single empty frame.
+        return dataSize == 0 ? 1 : (dataSize + blockSize - 1) / blockSize;
+    }
+
+    static size_t GetSeekTableSize(size_t numBlocks)
+    {
+        return SkippableFrameHeaderSize + numBlocks * SeekTableEntrySize + SeekTableFooterSize;
+    }
+}
+
+size_t ZStd::GetMinBlockFramedBufferSize(size_t sourceDataSize, size_t blockSize)
+{
+    AZ_Assert(blockSize > 0, "Block size for block framed zstd data can't be zero.");
+    size_t numFullBlocks = sourceDataSize / blockSize;
+    size_t lastBlockSize = sourceDataSize - numFullBlocks * blockSize;
+    size_t size = numFullBlocks * ZSTD_compressBound(blockSize);
+    if (lastBlockSize > 0 || numFullBlocks == 0)
+    {
+        size += ZSTD_compressBound(lastBlockSize);
+    }
+    return size + ZStdInternal::GetSeekTableSize(ZStdInternal::GetNumBlocks(sourceDataSize, blockSize));
+}
+
+size_t ZStd::CompressBlockFramed(const void* data, size_t dataSize, void* compressedData, size_t compressedDataSize,
+    int compressionLevel, size_t blockSize)
+{
+    AZ_Assert(blockSize > 0 && blockSize <= std::numeric_limits<AZ::u32>::max(),
+        "Block size for block framed zstd data has to be between 1 byte and 4GB, but got %zu.", blockSize);
+
+    ZSTD_customMem customAlloc;
+    customAlloc.customAlloc = reinterpret_cast<ZSTD_allocFunction>(&ZStd::AllocateMem);
+    customAlloc.customFree = &ZStd::FreeMem;
+    customAlloc.opaque = &AllocatorInstance<SystemAllocator>::Get();
+    ZSTD_CCtx* context = ZSTD_createCCtx_advanced(customAlloc);
+    AZ_Assert(context, "ZStandard internal error - failed to create compression context\n");
+
+    const AZ::u8* source = reinterpret_cast<const AZ::u8*>(data);
+    AZ::u8* destination = reinterpret_cast<AZ::u8*>(compressedData);
+    const size_t numBlocks = ZStdInternal::GetNumBlocks(dataSize, blockSize);
+    // The sizes are kept until the seek table is written after the last block.
+    AZStd::vector<AZ::u32> blockSizes;
+    blockSizes.reserve(numBlocks * 2);
+
+    size_t compressedSize = 0;
+    size_t offset = 0;
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+        size_t uncompressedBlockSize = AZStd::min(blockSize, dataSize - offset);
+        size_t result = ZSTD_compressCCtx(context, destination + compressedSize, compressedDataSize - compressedSize,
+            source + offset, uncompressedBlockSize, compressionLevel);
+        if (ZSTD_isError(result))
+        {
+            AZ_Error("ZStd", false, "Error compressing block %zu of %zu using zstd: %s", i, numBlocks, ZSTD_getErrorName(result));
+            ZSTD_freeCCtx(context);
+            return 0;
+        }
+        blockSizes.push_back(azlossy_cast<AZ::u32>(result));
+        blockSizes.push_back(azlossy_cast<AZ::u32>(uncompressedBlockSize));
+        compressedSize += result;
+        offset += uncompressedBlockSize;
+    }
+    ZSTD_freeCCtx(context);
+
+    const size_t seekTableSize = ZStdInternal::GetSeekTableSize(numBlocks);
+    if (compressedDataSize - compressedSize < seekTableSize)
+    {
+        AZ_Error("ZStd", false, "Not enough room in the compression buffer to store the seek table of the %zu zstd blocks.", numBlocks);
+        return 0;
+    }
+
+    AZ::u8* seekTable = destination + compressedSize;
+    ZStdInternal::WriteU32(seekTable, ZStdInternal::SkippableFrameMagic);
+    ZStdInternal::WriteU32(seekTable + 4, azlossy_cast<AZ::u32>(seekTableSize - ZStdInternal::SkippableFrameHeaderSize));
+    seekTable += ZStdInternal::SkippableFrameHeaderSize;
+    for (AZ::u32 size : blockSizes)
+    {
+        ZStdInternal::WriteU32(seekTable, size);
+        seekTable += 4;
+    }
+    ZStdInternal::WriteU32(seekTable, azlossy_cast<AZ::u32>(numBlocks));
+    seekTable[4] = 0; // Descriptor, no checksums are stored.
+    ZStdInternal::WriteU32(seekTable + 5, ZStdInternal::SeekTableMagic);
+
+    return compressedSize + seekTableSize;
+}
+
+bool ZStd::ReadBlockTable(const void* compressedData, size_t compressedDataSize, BlockTable& blocks)
+{
+    using namespace ZStdInternal;
+
+    blocks.clear();
+    if (compressedDataSize < SkippableFrameHeaderSize + SeekTableFooterSize)
+    {
+        return false;
+    }
+
+    const AZ::u8* data = reinterpret_cast<const AZ::u8*>(compressedData);
+    const AZ::u8* footer = data + compressedDataSize - SeekTableFooterSize;
+    if (ReadU32(footer + 5) != SeekTableMagic)
+    {
+        return false;
+    }
+
+    const AZ::u64 numBlocks = ReadU32(footer);
+    const size_t entrySize = (footer[4] & SeekTableChecksumFlag) ? SeekTableEntrySize + SeekTableChecksumSize : SeekTableEntrySize;
+    const AZ::u64 seekTableSize = SkippableFrameHeaderSize + numBlocks * entrySize + SeekTableFooterSize;
+    if (numBlocks == 0 || seekTableSize > compressedDataSize)
+    {
+        return false;
+    }
+
+    const AZ::u8* seekTable = data + compressedDataSize - seekTableSize;
+    if (ReadU32(seekTable) != SkippableFrameMagic || ReadU32(seekTable + 4) != seekTableSize - SkippableFrameHeaderSize)
+    {
+        return false;
+    }
+
+    blocks.reserve(numBlocks);
+    const AZ::u8* entry = seekTable + SkippableFrameHeaderSize;
+    AZ::u64 compressedOffset = 0;
+    AZ::u64 uncompressedOffset = 0;
+    for (AZ::u64 i = 0; i < numBlocks; ++i)
+    {
+        Block block;
+        block.m_compressedOffset = compressedOffset;
+        block.m_uncompressedOffset = uncompressedOffset;
+        block.m_compressedSize = ReadU32(entry);
+        block.m_uncompressedSize = ReadU32(entry + 4);
+        blocks.push_back(block);
+
+        compressedOffset += block.m_compressedSize;
+        uncompressedOffset += block.m_uncompressedSize;
+        entry += entrySize;
+    }
+
+    // The blocks have to exactly fill the data in front of the seek table, otherwise it's not a seek table that belongs to this data.
+    if (compressedOffset != compressedDataSize - seekTableSize)
+    {
+        blocks.clear();
+        return false;
+    }
+    return true;
+}
+
+size_t ZStd::FindBlock(const BlockTable& blocks, AZ::u64 uncompressedOffset)
+{
+    auto it = AZStd::upper_bound(blocks.begin(), blocks.end(), uncompressedOffset,
+        [](AZ::u64 offset, const Block& block)
+        {
+            return offset < block.m_uncompressedOffset;
+        });
+    return it == blocks.begin() ? 0 : static_cast<size_t>(AZStd::distance(blocks.begin(), it) - 1);
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 #endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
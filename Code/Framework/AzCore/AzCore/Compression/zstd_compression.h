@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #define ZSTD_STATIC_LINKING_ONLY
@@ -69,6 +70,37 @@ namespace AZ
         // Decompressor
         unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* outputData, unsigned int outputDataSize, size_t* sizeOfNextBlock);
         //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // Block framed data
+        /*
+        Block framed data follows the zstd seekable format:
+        https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+
+        The data is split in blocks that are compressed as independent frames, followed by a skippable frame with a
+        seek table that lists the sizes of all blocks. Regular zstd decompression reads the frames back to back and skips
+        the seek table, while block aware readers can decompress the blocks in parallel or only the blocks covering a range.
+        */
+        struct Block
+        {
+            AZ::u64 m_compressedOffset;     ///< Offset of the block's frame in the compressed data.
+            AZ::u64 m_uncompressedOffset;   ///< Offset of the block in the uncompressed data.
+            AZ::u32 m_compressedSize;
+            AZ::u32 m_uncompressedSize;
+        };
+        using BlockTable = AZStd::vector<Block>;
+
+        static constexpr size_t DefaultBlockSize = 1024 * 1024;
+
+        static size_t GetMinBlockFramedBufferSize(size_t sourceDataSize, size_t blockSize = DefaultBlockSize);
+        /// Compresses data as block framed data. Returns the compressed size or 0 if the data couldn't be compressed.
+        static size_t CompressBlockFramed(const void* data, size_t dataSize, void* compressedData, size_t compressedDataSize,
+            int compressionLevel = 1, size_t blockSize = DefaultBlockSize);
+        /// Reads the seek table at the end of block framed data. Returns false if the data isn't block framed.
+        static bool ReadBlockTable(const void* compressedData, size_t compressedDataSize, BlockTable& blocks);
+        /// Returns the index of the block that contains the uncompressed offset.
+        static size_t FindBlock(const BlockTable& blocks, AZ::u64 uncompressedOffset);
+        //////////////////////////////////////////////////////////////////////////
     private:
         static void* AllocateMem(void* userData, size_t size);
         static void  FreeMem(void* userData, void* address);
@@ -20,6 +20,7 @@
 
 #include <AzCore/EBus/Internal/BusContainer.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Instrumentation.h>
 #include <AzCore/EBus/Policies.h>
 
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -183,6 +184,7 @@ namespace AZ
             static constexpr bool EnableEventQueue = Traits::EnableEventQueue;
             static constexpr bool EventQueueingActiveByDefault = Traits::EventQueueingActiveByDefault;
             static constexpr bool EnableQueuedReferences = Traits::EnableQueuedReferences;
+            static constexpr bool LocklessEventQueue = Traits::LocklessEventQueue;
 
             /**
              * True if the EBus supports more than one address. Otherwise, false.
@@ -571,7 +573,148 @@ namespace AZ
 
         // This alias is required because you're not allowed to inherit from a nested type.
         template <typename Bus, typename Traits>
-        using EventDispatcher = typename Traits::BusesContainer::template Dispatcher<Bus>;
+        using ContainerDispatcher = typename Traits::BusesContainer::template Dispatcher<Bus>;
+
+#if AZ_EBUS_INSTRUMENTATION
+        /**
+         * Records every dispatch in the EBus instrumentation before forwarding it to the dispatcher of the bus container.
+         * The functions of the Event family are available on buses without addresses too, but fail to compile when used, like before.
+         * @tparam Bus       The EBus type.
+         * @tparam Traits    A class that inherits from EBusTraits and configures the EBus.
+         */
+        template <typename Bus, typename Traits>
+        struct EBusInstrumentedDispatcher
+            : public ContainerDispatcher<Bus, Traits>
+        {
+            using Base = ContainerDispatcher<Bus, Traits>;
+
+            template <typename Function>
+            static AZ::Internal::EBusDispatchScope RecordDispatch(const Function& func, const char* eventText = nullptr)
+            {
+                using FunctionType = AZStd::decay_t<Function>;
+                return AZ::Internal::EBusDispatchScope(Bus::GetName(), AZ::Internal::GetEBusEventSignature<FunctionType>(), AZ::Internal::GetEBusEventKey<FunctionType>(func), eventText);
+            }
+
+            template <typename IdOrPtr, typename Function, typename... ArgsT>
+            static void Event(const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                NamedEvent(nullptr, idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename IdOrPtr, typename Function, typename... ArgsT>
+            static void EventResult(Results& results, const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                NamedEventResult(nullptr, results, idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename IdOrPtr, typename Function, typename... ArgsT>
+            static void EventReverse(const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                NamedEventReverse(nullptr, idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename IdOrPtr, typename Function, typename... ArgsT>
+            static void EventResultReverse(Results& results, const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                NamedEventResultReverse(nullptr, results, idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+
+            template <typename Function, typename... ArgsT>
+            static void Broadcast(Function&& func, ArgsT&&... args)
+            {
+                NamedBroadcast(nullptr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
+            {
+                NamedBroadcastResult(nullptr, results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Function, typename... ArgsT>
+            static void BroadcastReverse(Function&& func, ArgsT&&... args)
+            {
+                NamedBroadcastReverse(nullptr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
+            {
+                NamedBroadcastResultReverse(nullptr, results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+
+            //! The functions below dispatch like the functions above, and report the event under the name found in eventText.
+            //! They are called by the EBUS_EVENT macros, which pass the text of the event they were given.
+            template <typename IdOrPtr, typename Function, typename... ArgsT>
+            static void NamedEvent(const char* eventText, const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::Event(idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename IdOrPtr, typename Function, typename... ArgsT>
+            static void NamedEventResult(const char* eventText, Results& results, const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::EventResult(results, idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename IdOrPtr, typename Function, typename... ArgsT>
+            static void NamedEventReverse(const char* eventText, const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::EventReverse(idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename IdOrPtr, typename Function, typename... ArgsT>
+            static void NamedEventResultReverse(const char* eventText, Results& results, const IdOrPtr& idOrPtr, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::EventResultReverse(results, idOrPtr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+
+            template <typename Function, typename... ArgsT>
+            static void NamedBroadcast(const char* eventText, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::Broadcast(AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void NamedBroadcastResult(const char* eventText, Results& results, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::BroadcastResult(results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Function, typename... ArgsT>
+            static void NamedBroadcastReverse(const char* eventText, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::BroadcastReverse(AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void NamedBroadcastResultReverse(const char* eventText, Results& results, Function&& func, ArgsT&&... args)
+            {
+                auto dispatchScope = RecordDispatch(func, eventText);
+                Base::BroadcastResultReverse(results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+            }
+
+            template <typename Callback>
+            static void EnumerateHandlers(Callback&& callback)
+            {
+                auto dispatchScope = RecordDispatch(callback);
+                Base::EnumerateHandlers(AZStd::forward<Callback>(callback));
+            }
+            template <typename Id, typename Callback>
+            static void EnumerateHandlersId(const Id& id, Callback&& callback)
+            {
+                auto dispatchScope = RecordDispatch(callback);
+                Base::EnumerateHandlersId(id, AZStd::forward<Callback>(callback));
+            }
+            template <typename Ptr, typename Callback>
+            static void EnumerateHandlersPtr(const Ptr& ptr, Callback&& callback)
+            {
+                auto dispatchScope = RecordDispatch(callback);
+                Base::EnumerateHandlersPtr(ptr, AZStd::forward<Callback>(callback));
+            }
+        };
+
+        template <typename Bus, typename Traits>
+        using EventDispatcher = EBusInstrumentedDispatcher<Bus, Traits>;
+#else
+        template <typename Bus, typename Traits>
+        using EventDispatcher = ContainerDispatcher<Bus, Traits>;
+#endif // AZ_EBUS_INSTRUMENTATION
 
         /**
          * Base class that provides eventing, queueing, and enumeration functionality
@@ -831,13 +974,11 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
+                context.m_queue.QueueMessage(
                     [func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
-                },
-                    typename Traits::AllocatorType()));
+                });
             }
             else
             {
@@ -178,6 +178,24 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Specifies whether the event queue is a lock free queue with a single consumer.
+         * Queueing a message doesn't take the #EventQueueMutexType lock or allocate for small closures,
+         * which makes it suited for buses that many threads queue messages on.
+         * `<BusName>::ExecuteQueuedEvents()` and `<BusName>::ClearQueuedEvents()` must not be called concurrently.
+         * Messages queued while #LocklessEventQueueCapacity messages are pending take the #EventQueueMutexType lock,
+         * or an AZStd::mutex when neither #EventQueueMutexType nor #MutexType is specified.
+         * Used only when #EnableEventQueue is true.
+         */
+        static constexpr bool LocklessEventQueue = false;
+
+        /**
+         * Number of messages the lock free event queue holds without taking a lock, must be a power of two.
+         * Each message takes 64 bytes of the bus context.
+         * Used only when #LocklessEventQueue is true.
+         */
+        static constexpr size_t LocklessEventQueueCapacity = 1024;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -451,7 +469,9 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = AZStd::conditional_t<Traits::EnableEventQueue && Traits::LocklessEventQueue,
+            EBusLocklessQueuePolicy<ThisType, EventQueueMutexType>,
+            EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -768,41 +788,48 @@ namespace AZ
     // The macros below correspond to functions in BusImpl.h.
     // The macros enable you to write shorter code, but don't work as well for code completion.
 
+#if AZ_EBUS_INSTRUMENTATION
+    // Passes the text of the event to the instrumentation, which reports the event under its name, see AzCore/EBus/Instrumentation.h.
+#   define AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, _Function, _EventText, ...) _EBUS::Named##_Function(_EventText, __VA_ARGS__)
+#else
+#   define AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, _Function, _EventText, ...) _EBUS::_Function(__VA_ARGS__)
+#endif
+
     /// Dispatches an event to handlers at a cached address.
-#   define EBUS_EVENT_PTR(_BusPtr, _EBUS, /*EventName,*/ ...)  _EBUS::Event(_BusPtr, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_PTR(_BusPtr, _EBUS, /*EventName,*/ ...)  AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, Event, #__VA_ARGS__, _BusPtr, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a cached address and receives results.
-#   define EBUS_EVENT_PTR_RESULT(_Result, _BusPtr, _EBUS, /*EventName,*/ ...) _EBUS::EventResult(_Result, _BusPtr, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_PTR_RESULT(_Result, _BusPtr, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, EventResult, #__VA_ARGS__, _Result, _BusPtr, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a specific address.
-#   define EBUS_EVENT_ID(_BusId, _EBUS, /*EventName,*/ ...)    _EBUS::Event(_BusId, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_ID(_BusId, _EBUS, /*EventName,*/ ...)    AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, Event, #__VA_ARGS__, _BusId, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a specific address and receives results.
-#   define EBUS_EVENT_ID_RESULT(_Result, _BusId, _EBUS, /*EventName,*/ ...) _EBUS::EventResult(_Result, _BusId, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_ID_RESULT(_Result, _BusId, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, EventResult, #__VA_ARGS__, _Result, _BusId, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to all handlers.
-#   define EBUS_EVENT(_EBUS, /*EventName,*/ ...) _EBUS::Broadcast(&_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT(_EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, Broadcast, #__VA_ARGS__, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to all handlers and receives results.
-#   define EBUS_EVENT_RESULT(_Result, _EBUS, /*EventName,*/ ...) _EBUS::BroadcastResult(_Result, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_RESULT(_Result, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, BroadcastResult, #__VA_ARGS__, _Result, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a cached address in reverse order.
-#   define EBUS_EVENT_PTR_REVERSE(_BusPtr, _EBUS, /*EventName,*/ ...)  _EBUS::EventReverse(_BusPtr, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_PTR_REVERSE(_BusPtr, _EBUS, /*EventName,*/ ...)  AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, EventReverse, #__VA_ARGS__, _BusPtr, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a cached address in reverse order and receives results.
-#   define EBUS_EVENT_PTR_RESULT_REVERSE(_Result, _BusPtr, _EBUS, /*EventName,*/ ...) _EBUS::EventResultReverse(_Result, _BusPtr, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_PTR_RESULT_REVERSE(_Result, _BusPtr, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, EventResultReverse, #__VA_ARGS__, _Result, _BusPtr, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a specific address in reverse order.
-#   define EBUS_EVENT_ID_REVERSE(_BusId, _EBUS, /*EventName,*/ ...) _EBUS::EventReverse(_BusId, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_ID_REVERSE(_BusId, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, EventReverse, #__VA_ARGS__, _BusId, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to handlers at a specific address in reverse order and receives results.
-#   define EBUS_EVENT_ID_RESULT_REVERSE(_Result, _BusId, _EBUS, /*EventName,*/ ...) _EBUS::EventReverse(_Result, _BusId, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_ID_RESULT_REVERSE(_Result, _BusId, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, EventReverse, #__VA_ARGS__, _Result, _BusId, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to all handlers in reverse order.
-#   define EBUS_EVENT_REVERSE(_EBUS, /*EventName,*/ ...) _EBUS::BroadcastReverse(&_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_REVERSE(_EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, BroadcastReverse, #__VA_ARGS__, &_EBUS::Events::__VA_ARGS__)
 
     /// Dispatches an event to all handlers in reverse order and receives results.
-#   define EBUS_EVENT_RESULT_REVERSE(_Result, _EBUS, /*EventName,*/ ...) _EBUS::BroadcastResultReverse(_Result, &_EBUS::Events::__VA_ARGS__)
+#   define EBUS_EVENT_RESULT_REVERSE(_Result, _EBUS, /*EventName,*/ ...) AZ_INTERNAL_EBUS_MACRO_DISPATCH(_EBUS, BroadcastResultReverse, #__VA_ARGS__, _Result, &_EBUS::Events::__VA_ARGS__)
 
     /// Enqueues an asynchronous event to dispatch to all handlers.
 #   define EBUS_QUEUE_EVENT(_EBUS, /*EventName,*/ ...)                _EBUS::QueueBroadcast(&_EBUS::Events::__VA_ARGS__)
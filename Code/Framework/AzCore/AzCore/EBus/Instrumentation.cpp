@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/Instrumentation.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/EBus/Environment.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+#include <cctype>
+
+namespace AZ::EBusInstrumentation
+{
+    namespace
+    {
+        //! The names of one event of a bus, shared by the counters of all threads. Written and read with the registry mutex held.
+        struct EventNames
+        {
+            //! Names the event by the type of its function, until a dispatch names the event.
+            const char* m_typeName;
+            //! The name captured at a call site, nullptr until the event is dispatched by name.
+            const char* m_name = nullptr;
+        };
+    } // namespace
+} // namespace AZ::EBusInstrumentation
+
+namespace AZ::Internal
+{
+    //! The counters of one event, written by a single thread and read by GetStats.
+    struct EBusEventCounters
+    {
+        EBusEventCounters(const char* busName, AZ::EBusInstrumentation::EventNames* eventNames)
+            : m_busName(busName)
+            , m_eventNames(eventNames)
+        {
+        }
+
+        const char* m_busName;
+        AZ::EBusInstrumentation::EventNames* m_eventNames;
+        AZStd::atomic<u64> m_dispatchCount{ 0 };
+        AZStd::atomic<u64> m_handlerCallCount{ 0 };
+        AZStd::atomic<u64> m_inclusiveTicks{ 0 };
+    };
+} // namespace AZ::Internal
+
+namespace AZ::EBusInstrumentation
+{
+    namespace
+    {
+        // The instrumentation can run before the memory allocators are created and after they are destroyed, just like the EBuses.
+        using Allocator = AZ::Internal::EBusEnvironmentAllocator;
+        using String = AZStd::basic_string<char, AZStd::char_traits<char>, Allocator>;
+        using EBusEventCounters = AZ::Internal::EBusEventCounters;
+
+        //! The counters of all events dispatched by one thread of one module.
+        //! Only the owning thread adds counters, the mutex keeps GetStats from walking the container while it grows.
+        struct ThreadCounters
+        {
+            AZStd::mutex m_mutex;
+            AZStd::deque<EBusEventCounters, Allocator> m_counters;
+            AZStd::atomic_bool m_isThreadRunning{ true };
+        };
+
+        //! Shared by all modules through the environment, so that the report covers every module.
+        struct Registry
+        {
+            ~Registry()
+            {
+                for (ThreadCounters* threadCounters : m_threads)
+                {
+                    DestroyThreadCounters(threadCounters);
+                }
+            }
+
+            ThreadCounters* CreateThreadCounters()
+            {
+                void* memory = Allocator().allocate(sizeof(ThreadCounters), alignof(ThreadCounters));
+                ThreadCounters* threadCounters = new (memory) ThreadCounters();
+                AZStd::scoped_lock lock(m_mutex);
+                m_threads.push_back(threadCounters);
+                return threadCounters;
+            }
+
+            static void DestroyThreadCounters(ThreadCounters* threadCounters)
+            {
+                threadCounters->~ThreadCounters();
+                Allocator().deallocate(threadCounters, sizeof(ThreadCounters), alignof(ThreadCounters));
+            }
+
+            //! Returns a copy of the name that lives as long as the registry, equal names share the same copy.
+            const char* Intern(AZStd::string_view name)
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                return InternLocked(name);
+            }
+
+            const char* InternLocked(AZStd::string_view name)
+            {
+                auto nameIt = m_names.find(name);
+                if (nameIt == m_names.end())
+                {
+                    m_nameStorage.emplace_back(name.data(), name.size());
+                    const String& storedName = m_nameStorage.back();
+                    nameIt = m_names.emplace(storedName.c_str(), storedName.size()).first;
+                }
+                return nameIt->data();
+            }
+
+            //! Returns the names of an event, the type name and the key tell apart the events of a bus.
+            EventNames* FindOrAddEvent(const char* busName, const char* typeName, u64 eventKey)
+            {
+                AZStd::scoped_lock lock(m_mutex);
+                const EventIdentity identity{ busName, typeName, eventKey };
+                if (auto eventIt = m_events.find(identity); eventIt != m_events.end())
+                {
+                    return &eventIt->second;
+                }
+
+                // Events of the same type that are not named yet are numbered, so that they can be told apart in the report.
+                const size_t typeCount = ++m_eventTypeCounts[EventIdentity{ busName, typeName, 0 }];
+                const char* name = typeName;
+                if (typeCount > 1)
+                {
+                    char suffix[32];
+                    azsnprintf(suffix, AZ_ARRAY_SIZE(suffix), " #%zu", typeCount);
+                    String numberedName(typeName);
+                    numberedName.append(suffix);
+                    name = InternLocked(numberedName);
+                }
+                return &m_events.emplace(identity, EventNames{ name }).first->second;
+            }
+
+            //! The name of an event is the first identifier of the text at the call site, the text may be followed by the arguments.
+            void SetEventName(EventNames& eventNames, AZStd::string_view eventText)
+            {
+                size_t start = 0;
+                while (start < eventText.size() && isspace(static_cast<unsigned char>(eventText[start])))
+                {
+                    ++start;
+                }
+                size_t end = start;
+                while (end < eventText.size() && (isalnum(static_cast<unsigned char>(eventText[end])) || eventText[end] == '_'))
+                {
+                    ++end;
+                }
+                if (end == start)
+                {
+                    return;
+                }
+
+                AZStd::scoped_lock lock(m_mutex);
+                eventNames.m_name = InternLocked(eventText.substr(start, end - start));
+            }
+
+            struct EventIdentity
+            {
+                const char* m_busName;
+                const char* m_typeName;
+                u64 m_eventKey;
+
+                bool operator==(const EventIdentity& other) const
+                {
+                    return m_busName == other.m_busName && m_typeName == other.m_typeName && m_eventKey == other.m_eventKey;
+                }
+            };
+
+            struct EventIdentityHash
+            {
+                size_t operator()(const EventIdentity& identity) const
+                {
+                    size_t hash = reinterpret_cast<size_t>(identity.m_busName);
+                    AZStd::hash_combine(hash, identity.m_typeName);
+                    AZStd::hash_combine(hash, identity.m_eventKey);
+                    return hash;
+                }
+            };
+
+            AZStd::mutex m_mutex;
+            AZStd::vector<ThreadCounters*, Allocator> m_threads;
+            AZStd::deque<String, Allocator> m_nameStorage;
+            AZStd::unordered_set<AZStd::string_view, AZStd::hash<AZStd::string_view>, AZStd::equal_to<AZStd::string_view>, Allocator> m_names;
+            AZStd::unordered_map<EventIdentity, EventNames, EventIdentityHash, AZStd::equal_to<EventIdentity>, Allocator> m_events;
+            AZStd::unordered_map<EventIdentity, size_t, EventIdentityHash, AZStd::equal_to<EventIdentity>, Allocator> m_eventTypeCounts;
+            AZStd::atomic_bool m_isProfilerRegionsEnabled{ false };
+        };
+
+        Registry& GetRegistry()
+        {
+            static AZ::EnvironmentVariable<Registry> s_registry = AZ::Environment::CreateVariable<Registry>("EBusInstrumentationRegistry");
+            return *s_registry;
+        }
+
+        //! A call site that names its event has counters of its own, so that the first dispatch from it names the event.
+        struct EventKey
+        {
+            const char* m_busSignature;
+            const char* m_eventSignature;
+            u64 m_eventKey;
+            const char* m_eventText;
+
+            bool operator==(const EventKey& other) const
+            {
+                return m_busSignature == other.m_busSignature && m_eventSignature == other.m_eventSignature && m_eventKey == other.m_eventKey &&
+                    m_eventText == other.m_eventText;
+            }
+        };
+
+        struct EventKeyHash
+        {
+            size_t operator()(const EventKey& key) const
+            {
+                size_t hash = reinterpret_cast<size_t>(key.m_busSignature);
+                AZStd::hash_combine(hash, key.m_eventSignature);
+                AZStd::hash_combine(hash, key.m_eventKey);
+                AZStd::hash_combine(hash, key.m_eventText);
+                return hash;
+            }
+        };
+
+        //! The state of the calling thread in this module. The signatures are unique per module, so are the lookups.
+        struct ThreadState
+        {
+            ~ThreadState()
+            {
+                if (m_counters)
+                {
+                    // The counters stay in the report until they are reset.
+                    m_counters->m_isThreadRunning = false;
+                }
+            }
+
+            ThreadCounters* m_counters = nullptr;
+            AZStd::unordered_map<EventKey, EBusEventCounters*, EventKeyHash, AZStd::equal_to<EventKey>, Allocator> m_lookup;
+            AZ::Internal::EBusDispatchScope* m_currentScope = nullptr;
+            bool m_isInProfiler = false;
+        };
+
+        thread_local ThreadState t_threadState;
+
+        //! Returns the text of the template argument that starts at the given position, up to the separator that ends it.
+        AZStd::string_view ReadTemplateArgument(AZStd::string_view signature, size_t start)
+        {
+            int depth = 0;
+            size_t end = start;
+            for (; end < signature.size(); ++end)
+            {
+                const char c = signature[end];
+                if (c == '<' || c == '(' || c == '[')
+                {
+                    ++depth;
+                }
+                else if (c == '>' || c == ')' || c == ']')
+                {
+                    if (depth == 0)
+                    {
+                        break;
+                    }
+                    --depth;
+                }
+                else if ((c == ',' || c == ';') && depth == 0)
+                {
+                    break;
+                }
+            }
+
+            return signature.substr(start, end - start);
+        }
+
+        //! Removes the spaces around the name of a type and the keywords MSVC puts in front of it.
+        AZStd::string_view TrimTypeName(AZStd::string_view argument)
+        {
+            while (!argument.empty() && argument.front() == ' ')
+            {
+                argument.remove_prefix(1);
+            }
+            while (!argument.empty() && argument.back() == ' ')
+            {
+                argument.remove_suffix(1);
+            }
+            for (AZStd::string_view keyword : { AZStd::string_view("class "), AZStd::string_view("struct ") })
+            {
+                if (argument.starts_with(keyword))
+                {
+                    argument.remove_prefix(keyword.size());
+                }
+            }
+            return argument;
+        }
+
+        //! Finds a template argument in a function signature. Clang and GCC list the arguments by name after the function,
+        //! MSVC lists them in place.
+        AZStd::string_view FindTemplateArgument(AZStd::string_view signature, AZStd::string_view parameterName, AZStd::string_view templateName, size_t index)
+        {
+            if (size_t position = signature.find(parameterName); position != AZStd::string_view::npos)
+            {
+                return TrimTypeName(ReadTemplateArgument(signature, position + parameterName.size()));
+            }
+
+            size_t position = signature.find(templateName);
+            if (position == AZStd::string_view::npos)
+            {
+                return signature;
+            }
+            position += templateName.size();
+            for (size_t skipped = 0; skipped < index; ++skipped)
+            {
+                position += ReadTemplateArgument(signature, position).size() + 1;
+            }
+            return TrimTypeName(ReadTemplateArgument(signature, position));
+        }
+
+        String GetBusName(const char* busSignature)
+        {
+            const AZStd::string_view interfaceName = FindTemplateArgument(busSignature, "Interface = ", "EBus<", 0);
+            const AZStd::string_view traitsName = FindTemplateArgument(busSignature, "Traits = ", "EBus<", 1);
+            String name(interfaceName.data(), interfaceName.size());
+            if (traitsName != interfaceName)
+            {
+                name.append(", ");
+                name.append(traitsName.data(), traitsName.size());
+            }
+            return name;
+        }
+
+        AZStd::string_view GetEventTypeName(const char* eventSignature)
+        {
+            return FindTemplateArgument(eventSignature, "Function = ", "GetEBusEventSignature<", 0);
+        }
+
+        EBusEventCounters* FindOrAddCounters(const char* busSignature, const char* eventSignature, u64 eventKey, const char* eventText)
+        {
+            ThreadState& threadState = t_threadState;
+            const EventKey key{ busSignature, eventSignature, eventKey, eventText };
+            if (auto counterIt = threadState.m_lookup.find(key); counterIt != threadState.m_lookup.end())
+            {
+                return counterIt->second;
+            }
+
+            Registry& registry = GetRegistry();
+            if (!threadState.m_counters)
+            {
+                threadState.m_counters = registry.CreateThreadCounters();
+            }
+
+            // The member function pointer only tells the events apart, the names come from the type and from the call sites.
+            const char* busName = registry.Intern(GetBusName(busSignature));
+            EventNames* eventNames = registry.FindOrAddEvent(busName, registry.Intern(GetEventTypeName(eventSignature)), eventKey);
+            if (eventText)
+            {
+                registry.SetEventName(*eventNames, eventText);
+            }
+
+            EBusEventCounters* counters;
+            {
+                AZStd::scoped_lock lock(threadState.m_counters->m_mutex);
+                threadState.m_counters->m_counters.emplace_back(busName, eventNames);
+                counters = &threadState.m_counters->m_counters.back();
+            }
+            threadState.m_lookup.emplace(key, counters);
+            return counters;
+        }
+
+        u64 TicksToNanoseconds(u64 ticks, AZStd::sys_time_t ticksPerSecond)
+        {
+            return static_cast<u64>(static_cast<double>(ticks) * 1000000000.0 / static_cast<double>(ticksPerSecond));
+        }
+    } // namespace
+
+    AZStd::vector<BusStats> GetStats()
+    {
+        AZStd::vector<BusStats> stats;
+        const AZStd::sys_time_t ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+
+        Registry& registry = GetRegistry();
+        AZStd::scoped_lock registryLock(registry.m_mutex);
+        for (ThreadCounters* threadCounters : registry.m_threads)
+        {
+            AZStd::scoped_lock threadLock(threadCounters->m_mutex);
+            for (const EBusEventCounters& counters : threadCounters->m_counters)
+            {
+                const u64 dispatchCount = counters.m_dispatchCount.load(AZStd::memory_order_relaxed);
+                if (dispatchCount == 0)
+                {
+                    continue;
+                }
+
+                // The names are interned, so the same bus and event from different threads and modules share their pointers.
+                auto busIt = AZStd::find_if(stats.begin(), stats.end(), [&counters](const BusStats& bus)
+                {
+                    return bus.m_busName == counters.m_busName;
+                });
+                if (busIt == stats.end())
+                {
+                    busIt = stats.emplace(stats.end());
+                    busIt->m_busName = counters.m_busName;
+                }
+
+                // An event named by any call site is reported under that name, including its dispatches from other call sites.
+                const EventNames& eventNames = *counters.m_eventNames;
+                const char* eventName = eventNames.m_name ? eventNames.m_name : eventNames.m_typeName;
+                auto eventIt = AZStd::find_if(busIt->m_events.begin(), busIt->m_events.end(), [eventName](const EventStats& event)
+                {
+                    return event.m_eventName == eventName;
+                });
+                if (eventIt == busIt->m_events.end())
+                {
+                    eventIt = busIt->m_events.emplace(busIt->m_events.end());
+                    eventIt->m_eventName = eventName;
+                }
+
+                const u64 handlerCallCount = counters.m_handlerCallCount.load(AZStd::memory_order_relaxed);
+                const u64 inclusiveTimeNs = TicksToNanoseconds(counters.m_inclusiveTicks.load(AZStd::memory_order_relaxed), ticksPerSecond);
+                eventIt->m_dispatchCount += dispatchCount;
+                eventIt->m_handlerCallCount += handlerCallCount;
+                eventIt->m_inclusiveTimeNs += inclusiveTimeNs;
+                busIt->m_dispatchCount += dispatchCount;
+                busIt->m_handlerCallCount += handlerCallCount;
+                busIt->m_inclusiveTimeNs += inclusiveTimeNs;
+            }
+        }
+
+        auto byInclusiveTime = [](const auto& lhs, const auto& rhs)
+        {
+            return lhs.m_inclusiveTimeNs > rhs.m_inclusiveTimeNs;
+        };
+        for (BusStats& bus : stats)
+        {
+            AZStd::sort(bus.m_events.begin(), bus.m_events.end(), byInclusiveTime);
+        }
+        AZStd::sort(stats.begin(), stats.end(), byInclusiveTime);
+        return stats;
+    }
+
+    void ResetStats()
+    {
+        Registry& registry = GetRegistry();
+        AZStd::scoped_lock registryLock(registry.m_mutex);
+        for (auto threadIt = registry.m_threads.begin(); threadIt != registry.m_threads.end();)
+        {
+            ThreadCounters* threadCounters = *threadIt;
+            if (!threadCounters->m_isThreadRunning)
+            {
+                Registry::DestroyThreadCounters(threadCounters);
+                threadIt = registry.m_threads.erase(threadIt);
+                continue;
+            }
+
+            AZStd::scoped_lock threadLock(threadCounters->m_mutex);
+            for (EBusEventCounters& counters : threadCounters->m_counters)
+            {
+                counters.m_dispatchCount.store(0, AZStd::memory_order_relaxed);
+                counters.m_handlerCallCount.store(0, AZStd::memory_order_relaxed);
+                counters.m_inclusiveTicks.store(0, AZStd::memory_order_relaxed);
+            }
+            ++threadIt;
+        }
+    }
+
+    void PrintReport([[maybe_unused]] size_t maxBuses, [[maybe_unused]] size_t maxEventsPerBus)
+    {
+        if (!IsEnabled())
+        {
+            AZ_Printf("EBusInstrumentation", "EBus instrumentation is disabled, build with LY_EBUS_INSTRUMENTATION_ENABLED to enable it.\n");
+            return;
+        }
+
+        const AZStd::vector<BusStats> stats = GetStats();
+        AZ_Printf("EBusInstrumentation", "%zu buses dispatched, the %zu with the highest inclusive time:\n", stats.size(), AZStd::min(maxBuses, stats.size()));
+        for (size_t busIndex = 0; busIndex < stats.size() && busIndex < maxBuses; ++busIndex)
+        {
+            [[maybe_unused]] const BusStats& bus = stats[busIndex];
+            AZ_Printf("EBusInstrumentation", "%8.3f ms %10llu calls %8.2f handlers/call  %s\n",
+                static_cast<double>(bus.m_inclusiveTimeNs) / 1000000.0, static_cast<unsigned long long>(bus.m_dispatchCount),
+                static_cast<double>(bus.m_handlerCallCount) / static_cast<double>(bus.m_dispatchCount), bus.m_busName);
+            for (size_t eventIndex = 0; eventIndex < bus.m_events.size() && eventIndex < maxEventsPerBus; ++eventIndex)
+            {
+                [[maybe_unused]] const EventStats& event = bus.m_events[eventIndex];
+                AZ_Printf("EBusInstrumentation", "    %8.3f ms %10llu calls %8.2f handlers/call  %s\n",
+                    static_cast<double>(event.m_inclusiveTimeNs) / 1000000.0, static_cast<unsigned long long>(event.m_dispatchCount),
+                    static_cast<double>(event.m_handlerCallCount) / static_cast<double>(event.m_dispatchCount), event.m_eventName);
+            }
+        }
+    }
+
+    void SetProfilerRegionsEnabled(bool enabled)
+    {
+        GetRegistry().m_isProfilerRegionsEnabled = enabled;
+    }
+
+    bool IsProfilerRegionsEnabled()
+    {
+        return GetRegistry().m_isProfilerRegionsEnabled;
+    }
+
+    static void EBusInstrumentationReport(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t maxBuses = 20;
+        size_t maxEventsPerBus = 5;
+        if (arguments.size() > 0)
+        {
+            maxBuses = AZStd::stoull(AZStd::string(arguments[0]));
+        }
+        if (arguments.size() > 1)
+        {
+            maxEventsPerBus = AZStd::stoull(AZStd::string(arguments[1]));
+        }
+        PrintReport(maxBuses, maxEventsPerBus);
+    }
+    AZ_CONSOLEFREEFUNC(EBusInstrumentationReport, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Parameters: [maxBuses=20] [maxEventsPerBus=5], Prints the EBuses with the highest dispatch time since the last reset");
+
+    static void EBusInstrumentationReset([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        ResetStats();
+    }
+    AZ_CONSOLEFREEFUNC(EBusInstrumentationReset, AZ::ConsoleFunctorFlags::DontReplicate, "Clears the recorded EBus dispatch statistics");
+
+    static void EBusInstrumentationProfilerRegions(const AZ::ConsoleCommandContainer& arguments)
+    {
+        SetProfilerRegionsEnabled(arguments.empty() || arguments[0] == "1" || arguments[0] == "true");
+    }
+    AZ_CONSOLEFREEFUNC(EBusInstrumentationProfilerRegions, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Parameter: [enable=1], Reports every EBus dispatch as a profiler region named after the bus");
+} // namespace AZ::EBusInstrumentation
+
+namespace AZ::Internal
+{
+    EBusDispatchScope::EBusDispatchScope(const char* busSignature, const char* eventSignature, u64 eventKey, const char* eventText)
+        : m_counters(EBusInstrumentation::FindOrAddCounters(busSignature, eventSignature, eventKey, eventText))
+        , m_parent(EBusInstrumentation::t_threadState.m_currentScope)
+        , m_startTicks(AZStd::GetTimeNowTicks())
+    {
+        EBusInstrumentation::ThreadState& threadState = EBusInstrumentation::t_threadState;
+        threadState.m_currentScope = this;
+
+        // The profiler may use EBuses itself, those dispatches are only counted.
+        m_isProfilerRegion = !threadState.m_isInProfiler && EBusInstrumentation::GetRegistry().m_isProfilerRegionsEnabled.load(AZStd::memory_order_relaxed);
+        if (m_isProfilerRegion)
+        {
+            threadState.m_isInProfiler = true;
+            AZ::Debug::ProfileScope::BeginRegion(AZ_BUDGET_GETTER(AzCore)(), m_counters->m_busName);
+            threadState.m_isInProfiler = false;
+        }
+    }
+
+    EBusDispatchScope::~EBusDispatchScope()
+    {
+        EBusInstrumentation::ThreadState& threadState = EBusInstrumentation::t_threadState;
+        if (m_isProfilerRegion)
+        {
+            threadState.m_isInProfiler = true;
+            AZ::Debug::ProfileScope::EndRegion(AZ_BUDGET_GETTER(AzCore)());
+            threadState.m_isInProfiler = false;
+        }
+
+        // The counters are owned by this thread, so the atomics are never contended, they only keep a reset from getting lost.
+        const u64 elapsedTicks = static_cast<u64>(AZStd::GetTimeNowTicks() - m_startTicks);
+        m_counters->m_dispatchCount.fetch_add(1, AZStd::memory_order_relaxed);
+        m_counters->m_handlerCallCount.fetch_add(m_handlerCallCount, AZStd::memory_order_relaxed);
+        m_counters->m_inclusiveTicks.fetch_add(elapsedTicks, AZStd::memory_order_relaxed);
+
+        threadState.m_currentScope = m_parent;
+    }
+
+    void EBusDispatchScope::OnHandlerCall()
+    {
+        if (EBusDispatchScope* scope = EBusInstrumentation::t_threadState.m_currentScope)
+        {
+            ++scope->m_handlerCallCount;
+        }
+    }
+} // namespace AZ::Internal
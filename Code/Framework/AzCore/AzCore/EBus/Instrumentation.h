@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+/**
+ * @file
+ * Optional instrumentation of EBus dispatches.
+ * When AZ_EBUS_INSTRUMENTATION is set to 1 (LY_EBUS_INSTRUMENTATION_ENABLED in CMake), every Event, Broadcast and
+ * EnumerateHandlers call records its call count, the number of handlers it reached and its inclusive time into
+ * counters owned by the calling thread. The counters of all threads and modules are summed up by GetStats.
+ * When disabled the dispatch code is unchanged and nothing is recorded.
+ *
+ * Events are reported by name. A member function pointer does not carry the name of the function, so the name is
+ * captured where the event is dispatched: the EBUS_EVENT macros pass the text of the event to the dispatch. Once an event
+ * was dispatched by name, the dispatches of the same event from code that calls Broadcast or Event directly are reported
+ * under that name as well. Events that were never dispatched by name are listed by their function type.
+ */
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/typetraits/is_member_function_pointer.h>
+
+#if !defined(AZ_EBUS_INSTRUMENTATION)
+#   define AZ_EBUS_INSTRUMENTATION 0
+#endif
+
+namespace AZ
+{
+    namespace EBusInstrumentation
+    {
+        //! Dispatch statistics of one event of a bus, summed over all threads.
+        struct EventStats
+        {
+            const char* m_eventName = nullptr;
+            u64 m_dispatchCount = 0;
+            u64 m_handlerCallCount = 0;
+            u64 m_inclusiveTimeNs = 0;
+        };
+
+        //! Dispatch statistics of a bus, the totals of all of its events.
+        struct BusStats
+        {
+            const char* m_busName = nullptr;
+            u64 m_dispatchCount = 0;
+            u64 m_handlerCallCount = 0;
+            u64 m_inclusiveTimeNs = 0;
+            AZStd::vector<EventStats> m_events;
+        };
+
+        //! Returns true when the engine was compiled with AZ_EBUS_INSTRUMENTATION enabled.
+        constexpr bool IsEnabled()
+        {
+            return AZ_EBUS_INSTRUMENTATION != 0;
+        }
+
+        //! Returns the statistics of every bus dispatched since the last reset.
+        //! The buses and the events of each bus are sorted by inclusive time, the most expensive first.
+        AZStd::vector<BusStats> GetStats();
+
+        //! Clears the counters of all threads.
+        void ResetStats();
+
+        //! Prints the buses with the highest inclusive time and their most expensive events.
+        void PrintReport(size_t maxBuses, size_t maxEventsPerBus);
+
+        //! When enabled, every dispatch is also reported as a region named after the bus to the registered AZ::Debug::Profiler,
+        //! so the dispatches show up in the captures of the profiler.
+        void SetProfilerRegionsEnabled(bool enabled);
+        bool IsProfilerRegionsEnabled();
+    } // namespace EBusInstrumentation
+
+    namespace Internal
+    {
+        struct EBusEventCounters;
+
+        /**
+         * Records a dispatch for as long as it is in scope.
+         * Created around every dispatch when AZ_EBUS_INSTRUMENTATION is enabled. Handlers called by the dispatch
+         * are counted by the EBusEventProcessingPolicy, custom processing policies should call OnHandlerCall as well.
+         */
+        class EBusDispatchScope
+        {
+        public:
+            //! @param busSignature The name of the bus, as returned by EBus::GetName.
+            //! @param eventSignature The function signature of GetEBusEventSignature for the type of the dispatched function.
+            //! @param eventKey Tells apart events of the same type, see GetEBusEventKey.
+            //! @param eventText The text of the event at the call site, its name optionally followed by the arguments,
+            //!                  as passed by the EBUS_EVENT macros. nullptr when the call site did not name the event.
+            EBusDispatchScope(const char* busSignature, const char* eventSignature, u64 eventKey, const char* eventText = nullptr);
+            ~EBusDispatchScope();
+
+            EBusDispatchScope(const EBusDispatchScope&) = delete;
+            EBusDispatchScope& operator=(const EBusDispatchScope&) = delete;
+
+            //! Counts a handler call for the innermost dispatch on the calling thread.
+            static void OnHandlerCall();
+
+        private:
+            EBusEventCounters* m_counters;
+            EBusDispatchScope* m_parent;
+            s64 m_startTicks;
+            u64 m_handlerCallCount = 0;
+            bool m_isProfilerRegion;
+        };
+
+        //! The signature of this function names the type of the dispatched function.
+        template <class Function>
+        const char* GetEBusEventSignature()
+        {
+            return AZ_FUNCTION_SIGNATURE;
+        }
+
+        //! Events are member functions, which share their type when their parameters match, so the value of the member function
+        //! pointer is part of the key. Any other callable is identified by its type alone.
+        template <class Function>
+        u64 GetEBusEventKey([[maybe_unused]] const Function& func)
+        {
+            u64 key = 0;
+            if constexpr (AZStd::is_member_function_pointer_v<Function>)
+            {
+                memcpy(&key, &func, sizeof(func) < sizeof(key) ? sizeof(func) : sizeof(key));
+            }
+            return key;
+        }
+    } // namespace Internal
+} // namespace AZ
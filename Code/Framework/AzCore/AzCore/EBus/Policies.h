@@ -13,16 +13,24 @@
  * These are internal policies. Do not include this file directly.
  */
 
+#include <AzCore/EBus/Instrumentation.h>
+
 // Includes for the event queue.
 #include <AzCore/std/functional.h>
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
 
 
 namespace AZ
 {
+    struct NullMutex;
+
     /**
      * Defines how many addresses exist on the EBus.
      */
@@ -247,6 +255,13 @@ namespace AZ
         MessageQueueType            m_messages;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
+        template <class Function>
+        void QueueMessage(Function&& message)
+        {
+            AZStd::scoped_lock lock(m_messagesMutex);
+            m_messages.push(BusMessageCall(AZStd::forward<Function>(message), typename Bus::AllocatorType()));
+        }
+
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
@@ -296,6 +311,232 @@ namespace AZ
         }
     };
 
+    /**
+     * Event queue used when the bus traits enable #LocklessEventQueue.
+     * Messages are stored in a ring of #LocklessEventQueueCapacity slots which producers claim with a compare and swap
+     * on the enqueue position, so queueing from any number of threads never takes a lock.
+     * Each slot has inline storage for the closure of the message, only closures that don't fit are allocated with the bus allocator.
+     * When the ring is full, messages go to an overflow queue guarded by the event queue mutex until the next Execute drains it.
+     * The producers can be on any thread, so the overflow queue uses an AZStd::mutex when the bus doesn't specify a mutex.
+     * There is a single consumer: Execute, Clear and SetActive(false) must not run concurrently with each other.
+     */
+    template <class Bus, class MutexType>
+    struct EBusLocklessQueuePolicy
+    {
+        typedef AZStd::function<void()> BusMessageCall;
+
+        typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
+        typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
+
+        static constexpr size_t Capacity = Bus::Traits::LocklessEventQueueCapacity;
+        static constexpr size_t InlineStorageSize = 48;
+        static constexpr size_t InlineStorageAlignment = 16;
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "LocklessEventQueueCapacity must be a power of two.");
+
+        using OverflowMutexType = AZStd::conditional_t<AZStd::is_same_v<MutexType, NullMutex>, AZStd::mutex, MutexType>;
+
+        EBusLocklessQueuePolicy()
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+            {
+                m_slots[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+            }
+        }
+
+        ~EBusLocklessQueuePolicy()
+        {
+            Clear();
+        }
+
+        EBusLocklessQueuePolicy(const EBusLocklessQueuePolicy&) = delete;
+        EBusLocklessQueuePolicy& operator=(const EBusLocklessQueuePolicy&) = delete;
+
+        template <class Function>
+        void QueueMessage(Function&& message)
+        {
+            // Once a message overflowed, everything goes to the overflow queue until it is drained, to keep the order per producer.
+            if (!m_overflowActive.load(AZStd::memory_order_acquire))
+            {
+                size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                for (;;)
+                {
+                    Slot& slot = m_slots[position & (Capacity - 1)];
+                    const size_t sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+                    const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+                    if (difference == 0)
+                    {
+                        if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                        {
+                            StoreMessage(slot, AZStd::forward<Function>(message));
+                            slot.m_sequence.store(position + 1, AZStd::memory_order_release);
+                            return;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        // The slot still holds a message from the previous lap, the ring is full.
+                        break;
+                    }
+                    else
+                    {
+                        position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                    }
+                }
+            }
+
+            AZStd::scoped_lock lock(m_overflowMutex);
+            m_overflowMessages.push(BusMessageCall(AZStd::forward<Function>(message), typename Bus::AllocatorType()));
+            m_overflowActive.store(true, AZStd::memory_order_release);
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive.load(AZStd::memory_order_relaxed), "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+
+            // Only the messages queued before this call run now, the ones queued by the handlers run on the next call.
+            DrainRing(m_enqueuePosition.load(AZStd::memory_order_acquire), true);
+
+            if (m_overflowActive.load(AZStd::memory_order_acquire))
+            {
+                MessageQueueType overflowMessages;
+                size_t overflowPosition;
+                {
+                    AZStd::scoped_lock lock(m_overflowMutex);
+                    // Messages that made it into the ring before the overflowed ones were queued have to run first.
+                    overflowPosition = m_enqueuePosition.load(AZStd::memory_order_acquire);
+                    AZStd::swap(overflowMessages, m_overflowMessages);
+                    m_overflowActive.store(false, AZStd::memory_order_release);
+                }
+
+                DrainRing(overflowPosition, true);
+                while (!overflowMessages.empty())
+                {
+                    const BusMessageCall& overflowMessage = overflowMessages.front();
+                    overflowMessage();
+                    overflowMessages.pop();
+                }
+            }
+        }
+
+        void Clear()
+        {
+            DrainRing(m_enqueuePosition.load(AZStd::memory_order_acquire), false);
+
+            AZStd::scoped_lock lock(m_overflowMutex);
+            m_overflowMessages = {};
+            m_overflowActive.store(false, AZStd::memory_order_release);
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive.store(isActive, AZStd::memory_order_release);
+            if (!isActive)
+            {
+                Clear();
+            }
+        }
+
+        bool IsActive()
+        {
+            return m_isActive.load(AZStd::memory_order_acquire);
+        }
+
+        size_t Count()
+        {
+            // Includes the messages of producers that claimed a slot but are still storing their message.
+            const size_t dequeuePosition = m_dequeuePosition.load(AZStd::memory_order_acquire);
+            const size_t enqueuePosition = m_enqueuePosition.load(AZStd::memory_order_acquire);
+            const size_t ringCount = enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+
+            AZStd::scoped_lock lock(m_overflowMutex);
+            return ringCount + m_overflowMessages.size();
+        }
+
+    private:
+        //! Runs the message stored in the slot when invoke is true, then destroys it.
+        using SlotCall = void(*)(void* storage, bool invoke);
+
+        struct Slot
+        {
+            //! Equal to the position of the slot when it's free and one past it once the message is stored.
+            AZStd::atomic<size_t> m_sequence;
+            SlotCall m_call = nullptr;
+            AZStd::aligned_storage_t<InlineStorageSize, InlineStorageAlignment> m_storage;
+        };
+
+        template <class Closure>
+        static void CallInline(void* storage, bool invoke)
+        {
+            Closure* closure = reinterpret_cast<Closure*>(storage);
+            if (invoke)
+            {
+                (*closure)();
+            }
+            closure->~Closure();
+        }
+
+        template <class Closure>
+        static void CallAllocated(void* storage, bool invoke)
+        {
+            Closure* closure = *reinterpret_cast<Closure**>(storage);
+            if (invoke)
+            {
+                (*closure)();
+            }
+            closure->~Closure();
+            typename Bus::AllocatorType().deallocate(closure, sizeof(Closure), alignof(Closure));
+        }
+
+        template <class Function>
+        static void StoreMessage(Slot& slot, Function&& message)
+        {
+            using Closure = AZStd::decay_t<Function>;
+            if constexpr (sizeof(Closure) <= InlineStorageSize && alignof(Closure) <= InlineStorageAlignment)
+            {
+                new (&slot.m_storage) Closure(AZStd::forward<Function>(message));
+                slot.m_call = &CallInline<Closure>;
+            }
+            else
+            {
+                void* memory = typename Bus::AllocatorType().allocate(sizeof(Closure), alignof(Closure));
+                *reinterpret_cast<Closure**>(&slot.m_storage) = new (memory) Closure(AZStd::forward<Function>(message));
+                slot.m_call = &CallAllocated<Closure>;
+            }
+        }
+
+        //! Runs or destroys the messages in the ring up to the given position.
+        void DrainRing(size_t endPosition, bool invoke)
+        {
+            // The position is advanced before running a message, so that a handler calling Execute doesn't run it again.
+            size_t position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+            while (position < endPosition)
+            {
+                Slot& slot = m_slots[position & (Capacity - 1)];
+
+                // The slot was claimed before the end position was read, its producer only has to finish storing the message.
+                AZStd::exponential_backoff backoff;
+                while (slot.m_sequence.load(AZStd::memory_order_acquire) != position + 1)
+                {
+                    backoff.wait();
+                }
+
+                m_dequeuePosition.store(position + 1, AZStd::memory_order_release);
+                slot.m_call(&slot.m_storage, invoke);
+                slot.m_sequence.store(position + Capacity, AZStd::memory_order_release);
+
+                position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        Slot m_slots[Capacity];
+        AZStd::atomic<size_t> m_enqueuePosition{ 0 };
+        AZStd::atomic<size_t> m_dequeuePosition{ 0 };
+        AZStd::atomic_bool m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        AZStd::atomic_bool m_overflowActive{ false };
+        MessageQueueType m_overflowMessages;
+        OverflowMutexType m_overflowMutex; ///< Only taken once the ring is full. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
+    };
+
     /// @endcond
 
     ////////////////////////////////////////////////////////////
@@ -428,12 +669,18 @@ namespace AZ
         template<class Results, class Function, class Interface, class... InputArgs>
         static void CallResult(Results& results, Function&& func, Interface&& iface, InputArgs&&... args)
         {
+#if AZ_EBUS_INSTRUMENTATION
+            AZ::Internal::EBusDispatchScope::OnHandlerCall();
+#endif
             results = AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<Interface>(iface), AZStd::forward<InputArgs>(args)...);
         }
 
         template<class Function, class Interface, class... InputArgs>
         static void Call(Function&& func, Interface&& iface, InputArgs&&... args)
         {
+#if AZ_EBUS_INSTRUMENTATION
+            AZ::Internal::EBusDispatchScope::OnHandlerCall();
+#endif
             AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<Interface>(iface), AZStd::forward<InputArgs>(args)...);
         }
     };
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& rhs)
+        : m_data(rhs.m_data)
+        , m_size(rhs.m_size)
+    {
+        rhs.m_data = nullptr;
+        rhs.m_size = 0;
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Close();
+            m_data = AZStd::exchange(rhs.m_data, nullptr);
+            m_size = AZStd::exchange(rhs.m_size, 0);
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const char* fileName)
+    {
+        Close();
+        if (fileName == nullptr || fileName[0] == 0)
+        {
+            return false;
+        }
+        return PlatformOpen(fileName);
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            PlatformClose();
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
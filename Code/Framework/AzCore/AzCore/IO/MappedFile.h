@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    /**
+     * Read only memory mapping of an entire file.
+     * The mapped pages are backed by the OS file cache, so processes that map the same file share
+     * its memory instead of each reading a private copy of the data onto their heap.
+     * The file must not be truncated or rewritten while it's mapped.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& rhs);
+        MappedFile& operator=(MappedFile&& rhs);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// Maps the file with the given path. Fails for files that can't be opened and for empty files.
+        bool Open(const char* fileName);
+        /// Unmaps the file, if no file is mapped it has no effect.
+        void Close();
+        bool IsOpen() const { return m_data != nullptr; }
+
+        /// Returns the start of the mapped file or nullptr if no file is mapped.
+        const void* GetData() const { return m_data; }
+        /// Returns the size of the mapped file in bytes.
+        AZ::u64 GetSize() const { return m_size; }
+
+    private:
+        bool PlatformOpen(const char* fileName);
+        void PlatformClose();
+
+        const void* m_data = nullptr;
+        AZ::u64 m_size = 0;
+    };
+}
@@ -17,6 +17,7 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
@@ -27,7 +28,7 @@ namespace AZ::IO
         const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
     {
         auto stackEntry = AZStd::make_shared<FullFileDecompressor>(
-            m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_maxNumThreads);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -37,9 +38,10 @@ namespace AZ::IO
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
             serializeContext->Class<FullFileDecompressorConfig, IStreamerStackConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("MaxNumReads", &FullFileDecompressorConfig::m_maxNumReads)
-                ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs);
+                ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs)
+                ->Field("MaxNumThreads", &FullFileDecompressorConfig::m_maxNumThreads);
         }
     }
 
@@ -53,7 +55,7 @@ namespace AZ::IO
         return !!m_compressedData;
     }
 
-    FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+    FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 maxNumThreads)
         : StreamStackEntry("Full file decompressor")
         , m_maxNumReads(maxNumReads)
         , m_maxNumJobs(maxNumJobs)
@@ -61,7 +63,7 @@ namespace AZ::IO
     {
         JobManagerDesc jobDesc;
             jobDesc.m_jobManagerName = "Full File Decompressor";
-        u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
+        u32 numThreads = AZ::GetMin(AZ::GetMax(maxNumJobs, maxNumThreads), AZStd::thread::hardware_concurrency());
         for (u32 i = 0; i < numThreads; ++i)
         {
             jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
@@ -621,7 +623,7 @@ namespace AZ::IO
                 {
                     auto job = [this, &info]()
                     {
-                        FullDecompression(m_context, info);
+                        FullDecompression(m_context, *m_decompressionJobManager->GetCurrentJob(), info);
                     };
                     decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                 }
@@ -630,7 +632,7 @@ namespace AZ::IO
                     m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
                     auto job = [this, &info]()
                     {
-                        PartialDecompression(m_context, info);
+                        PartialDecompression(m_context, *m_decompressionJobManager->GetCurrentJob(), info);
                     };
                     decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                 }
@@ -688,7 +690,7 @@ namespace AZ::IO
         return;
     }
 
-    void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info)
+    void FullFileDecompressor::FullDecompression(StreamerContext* context, Job& job, DecompressionInformation& info)
     {
         info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -705,15 +707,26 @@ namespace AZ::IO
             "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
             request->m_readSize, compressionInfo.m_uncompressedSize);
 
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-            compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+        const u8* compressedData = info.m_compressedData + info.m_alignmentOffset;
+        bool success;
+        ZStd::BlockTable blocks;
+        if (ReadBlockTable(compressionInfo, compressedData, blocks))
+        {
+            success = DecompressBlocks(job, compressionInfo, compressedData, blocks, 0, compressionInfo.m_uncompressedSize,
+                reinterpret_cast<u8*>(request->m_output));
+        }
+        else
+        {
+            success = compressionInfo.m_decompressor(compressionInfo, compressedData,
+                compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+        }
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
 
         context->MarkRequestAsCompleted(info.m_waitRequest);
         context->WakeUpSchedulingThread();
     }
 
-    void FullFileDecompressor::PartialDecompression(StreamerContext* context, DecompressionInformation& info)
+    void FullFileDecompressor::PartialDecompression(StreamerContext* context, Job& job, DecompressionInformation& info)
     {
         info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -724,14 +737,101 @@ namespace AZ::IO
         CompressionInfo& compressionInfo = request->m_compressionInfo;
         AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-        AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-            compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
-        info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+        const u8* compressedData = info.m_compressedData + info.m_alignmentOffset;
+        ZStd::BlockTable blocks;
+        if (ReadBlockTable(compressionInfo, compressedData, blocks))
+        {
+            // Only the blocks that overlap with the requested range need to be decompressed.
+            bool success = DecompressBlocks(job, compressionInfo, compressedData, blocks, request->m_readOffset, request->m_readSize,
+                reinterpret_cast<u8*>(request->m_output));
+            info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+        }
+        else
+        {
+            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
+            bool success = compressionInfo.m_decompressor(compressionInfo, compressedData,
+                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+            info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
 
-        memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+        }
 
         context->MarkRequestAsCompleted(info.m_waitRequest);
         context->WakeUpSchedulingThread();
     }
+
+    bool FullFileDecompressor::ReadBlockTable(const CompressionInfo& compressionInfo, const u8* compressedData, ZStd::BlockTable& blocks)
+    {
+        if (!compressionInfo.m_isCompressed || !ZStd::ReadBlockTable(compressedData, compressionInfo.m_compressedSize, blocks))
+        {
+            return false;
+        }
+        // A single block has nothing to gain from being split up and a table that doesn't add up to the file size can't be trusted.
+        const ZStd::Block& lastBlock = blocks.back();
+        return blocks.size() > 1 && lastBlock.m_uncompressedOffset + lastBlock.m_uncompressedSize == compressionInfo.m_uncompressedSize;
+    }
+
+    bool FullFileDecompressor::DecompressBlocks(Job& job, const CompressionInfo& compressionInfo, const u8* compressedData,
+        const ZStd::BlockTable& blocks, u64 readOffset, u64 readSize, u8* output)
+    {
+        if (readSize == 0)
+        {
+            return true;
+        }
+
+        AZStd::atomic_bool success{ true };
+        const u64 readEnd = readOffset + readSize;
+        const size_t firstBlock = ZStd::FindBlock(blocks, readOffset);
+        const size_t lastBlock = ZStd::FindBlock(blocks, readEnd - 1);
+        for (size_t i = firstBlock; i <= lastBlock; ++i)
+        {
+            auto decompressBlock = [&compressionInfo, &success, &block = blocks[i], compressedData, readOffset, readEnd, output]()
+            {
+                if (!success)
+                {
+                    return;
+                }
+
+                const u64 blockEnd = block.m_uncompressedOffset + block.m_uncompressedSize;
+                const u8* blockData = compressedData + block.m_compressedOffset;
+                if (block.m_uncompressedOffset >= readOffset && blockEnd <= readEnd)
+                {
+                    // The entire block is requested so it can be decompressed directly into the output.
+                    if (!compressionInfo.m_decompressor(compressionInfo, blockData, block.m_compressedSize,
+                        output + (block.m_uncompressedOffset - readOffset), block.m_uncompressedSize))
+                    {
+                        success = false;
+                    }
+                }
+                else
+                {
+                    AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[block.m_uncompressedSize]);
+                    if (compressionInfo.m_decompressor(compressionInfo, blockData, block.m_compressedSize,
+                        decompressionBuffer.get(), block.m_uncompressedSize))
+                    {
+                        const u64 copyStart = AZStd::max(block.m_uncompressedOffset, readOffset);
+                        const u64 copyEnd = AZStd::min(blockEnd, readEnd);
+                        memcpy(output + (copyStart - readOffset), decompressionBuffer.get() + (copyStart - block.m_uncompressedOffset),
+                            copyEnd - copyStart);
+                    }
+                    else
+                    {
+                        success = false;
+                    }
+                }
+            };
+
+            if (i == lastBlock)
+            {
+                // Decompress the last block on this thread while the other workers pick up the remaining blocks.
+                decompressBlock();
+            }
+            else
+            {
+                job.StartAsChild(AZ::CreateJobFunction(decompressBlock, true, job.GetContext()));
+            }
+        }
+        job.WaitForChildren();
+        return success;
+    }
 } // namespace AZ::IO
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/Compression/zstd_compression.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -36,6 +37,9 @@ namespace AZ::IO
         u32 m_maxNumReads{ 2 };
         //! Maximum number of decompression jobs that can run simultaneously.
         u32 m_maxNumJobs{ 2 };
+        //! Maximum number of threads used for decompression. Files that are stored as independently compressed blocks
+        //! spread their blocks over all threads. The number of decompression jobs is used if this is lower.
+        u32 m_maxNumThreads{ 4 };
     };
 
     //! Entry in the streaming stack that decompresses files from an archive that are stored
@@ -47,11 +51,13 @@ namespace AZ::IO
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Files that are stored as block framed zstd data (see ZStd::CompressBlockFramed) are the exception. Their
+    //! blocks are decompressed in parallel and partial reads only decompress the blocks covering the requested range.
     class FullFileDecompressor
         : public StreamStackEntry
     {
     public:
-        FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+        FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 maxNumThreads = 0);
         ~FullFileDecompressor() override = default;
 
         void PrepareRequest(FileRequest* request) override;
@@ -99,8 +105,11 @@ namespace AZ::IO
         bool StartDecompressions();
         void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
 
-        static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
-        static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+        static void FullDecompression(StreamerContext* context, Job& job, DecompressionInformation& info);
+        static void PartialDecompression(StreamerContext* context, Job& job, DecompressionInformation& info);
+        static bool ReadBlockTable(const CompressionInfo& compressionInfo, const u8* compressedData, ZStd::BlockTable& blocks);
+        static bool DecompressBlocks(Job& job, const CompressionInfo& compressionInfo, const u8* compressedData,
+            const ZStd::BlockTable& blocks, u64 readOffset, u64 readSize, u8* output);
 
         AZStd::deque<FileRequest*> m_pendingReads;
         AZStd::deque<FileRequest*> m_pendingFileExistChecks;
@@ -18,6 +18,7 @@
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/TracePrefetcher.h>
 #include <AzCore/IO/Streamer/ReadSplitter.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -200,6 +201,7 @@ namespace AZ
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
+        TracePrefetcherConfig::Reflect(context);
         ReflectNative(context);
     }
 
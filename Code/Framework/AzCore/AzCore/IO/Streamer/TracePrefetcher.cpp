@@ -0,0 +1,553 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/TracePrefetcher.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> TracePrefetcherConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<TracePrefetcher>(m_traceFolder, m_maxPrefetchMemoryMib * 1_mib, m_maxNumPrefetches,
+            aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void TracePrefetcherConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<TracePrefetcherConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("TraceFolder", &TracePrefetcherConfig::m_traceFolder)
+                ->Field("MaxPrefetchMemoryMib", &TracePrefetcherConfig::m_maxPrefetchMemoryMib)
+                ->Field("MaxNumPrefetches", &TracePrefetcherConfig::m_maxNumPrefetches);
+        }
+    }
+
+    static constexpr char PrefetchHitRateName[] = "Prefetch hit rate";
+    static constexpr char WastedPrefetchesName[] = "Wasted prefetches";
+    static constexpr char PrefetchMemoryName[] = "Prefetch memory";
+
+    namespace TracePrefetcherInternal
+    {
+        static constexpr char TraceFileExtension[] = ".streamtrace";
+        static constexpr char TraceFileMagic[4] = { 'A', 'Z', 'S', 'T' };
+        static constexpr u32 TraceFileVersion = 1;
+        //! Number of entries in the trace that are checked when a request doesn't match any of the prefetches.
+        static constexpr size_t SkipAheadWindow = 64;
+        //! Upper limit on the number of reads in a trace. Traces are typically stopped when a level unloads, so this keeps
+        //! the trace from growing with the reads done while playing.
+        static constexpr size_t MaxNumTraceEntries = 64 * 1024;
+
+        struct TraceFileHeader
+        {
+            char m_magic[4];
+            u32 m_version;
+            u32 m_numPaths;
+            u32 m_numEntries;
+        };
+    }
+
+    TracePrefetcher::TracePrefetcher(AZStd::string traceFolder, u64 maxPrefetchMemory, u32 maxNumPrefetches, u32 alignment)
+        : StreamStackEntry("Trace prefetcher")
+        , m_traceFolder(AZStd::move(traceFolder))
+        , m_maxPrefetchMemory(maxPrefetchMemory)
+        , m_maxNumPrefetches(maxNumPrefetches)
+        , m_alignment(AZStd::max(alignment, 1u))
+    {
+    }
+
+    TracePrefetcher::~TracePrefetcher()
+    {
+        AZ_Assert(m_numInFlightPrefetches == 0, "TracePrefetcher destroyed while there are still %u prefetches in flight.",
+            m_numInFlightPrefetches);
+        for (Prefetch& prefetch : m_prefetches)
+        {
+            ReleasePrefetch(prefetch);
+        }
+    }
+
+    void TracePrefetcher::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                ReadFile(request, args);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CustomData>)
+            {
+                if (auto startTrace = AZStd::any_cast<StartTraceCommand>(&args.m_data); startTrace != nullptr)
+                {
+                    StartTrace(startTrace->m_name);
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return;
+                }
+                else if (AZStd::any_cast<StopTraceCommand>(&args.m_data) != nullptr)
+                {
+                    StopTrace();
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushPrefetches(&args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushPrefetches(nullptr);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool TracePrefetcher::ExecuteRequests()
+    {
+        bool nextResult = StreamStackEntry::ExecuteRequests();
+        // Speculative reads are queued after the rest of the stack had a chance to process the actual requests.
+        bool queuedPrefetches = QueuePrefetches();
+        return nextResult || queuedPrefetches;
+    }
+
+    void TracePrefetcher::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_numInFlightPrefetches == 0;
+    }
+
+    void TracePrefetcher::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(m_name, PrefetchHitRateName, CalculateHitRatePercentage()));
+        statistics.push_back(Statistic::CreateInteger(m_name, WastedPrefetchesName, aznumeric_caster(m_numWastedPrefetches)));
+        statistics.push_back(Statistic::CreateInteger(m_name, PrefetchMemoryName, aznumeric_caster(m_prefetchMemoryUsage)));
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool TracePrefetcher::SaveTrace(const char* filePath, const Trace& trace)
+    {
+        using namespace TracePrefetcherInternal;
+
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to open '%s' to store the recorded access trace.", filePath);
+            return false;
+        }
+
+        TraceFileHeader header;
+        memcpy(header.m_magic, TraceFileMagic, sizeof(header.m_magic));
+        header.m_version = TraceFileVersion;
+        header.m_numPaths = aznumeric_caster(trace.m_paths.size());
+        header.m_numEntries = aznumeric_caster(trace.m_entries.size());
+
+        bool result = file.Write(&header, sizeof(header)) == sizeof(header);
+        for (const AZStd::string& path : trace.m_paths)
+        {
+            u32 length = aznumeric_caster(path.size());
+            result = result && file.Write(&length, sizeof(length)) == sizeof(length);
+            result = result && file.Write(path.data(), length) == length;
+        }
+        const size_t entriesSize = trace.m_entries.size() * sizeof(TraceEntry);
+        result = result && file.Write(trace.m_entries.data(), entriesSize) == entriesSize;
+        AZ_Warning("Streamer", result, "Failed to write the recorded access trace to '%s'.", filePath);
+        return result;
+    }
+
+    bool TracePrefetcher::LoadTrace(const char* filePath, Trace& trace)
+    {
+        using namespace TracePrefetcherInternal;
+
+        trace.m_paths.clear();
+        trace.m_entries.clear();
+
+        SystemFile file;
+        if (!SystemFile::Exists(filePath) || !file.Open(filePath, SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        TraceFileHeader header;
+        if (file.Read(sizeof(header), &header) != sizeof(header) ||
+            memcmp(header.m_magic, TraceFileMagic, sizeof(header.m_magic)) != 0 || header.m_version != TraceFileVersion)
+        {
+            AZ_Warning("Streamer", false, "'%s' isn't a supported access trace file.", filePath);
+            return false;
+        }
+
+        const SystemFile::SizeType fileSize = file.Length();
+        trace.m_paths.reserve(header.m_numPaths);
+        for (u32 i = 0; i < header.m_numPaths; ++i)
+        {
+            u32 length = 0;
+            if (file.Read(sizeof(length), &length) != sizeof(length) || length > fileSize)
+            {
+                AZ_Warning("Streamer", false, "Access trace '%s' is truncated or corrupted.", filePath);
+                trace.m_paths.clear();
+                return false;
+            }
+            AZStd::string& path = trace.m_paths.emplace_back(length, '\0');
+            if (file.Read(length, path.data()) != length)
+            {
+                AZ_Warning("Streamer", false, "Access trace '%s' is truncated or corrupted.", filePath);
+                trace.m_paths.clear();
+                return false;
+            }
+        }
+
+        const size_t entriesSize = header.m_numEntries * sizeof(TraceEntry);
+        if (fileSize - file.Tell() != entriesSize)
+        {
+            AZ_Warning("Streamer", false, "Access trace '%s' is truncated or corrupted.", filePath);
+            trace.m_paths.clear();
+            return false;
+        }
+        trace.m_entries.resize_no_construct(header.m_numEntries);
+        if (file.Read(entriesSize, trace.m_entries.data()) != entriesSize ||
+            AZStd::any_of(trace.m_entries.begin(), trace.m_entries.end(),
+                [numPaths = header.m_numPaths](const TraceEntry& entry) { return entry.m_pathIndex >= numPaths; }))
+        {
+            AZ_Warning("Streamer", false, "Access trace '%s' is truncated or corrupted.", filePath);
+            trace.m_paths.clear();
+            trace.m_entries.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void TracePrefetcher::StartTrace(const AZStd::string& name)
+    {
+        StopTrace();
+
+        m_traceName = name;
+        m_isTracing = true;
+
+        AZStd::string traceFilePath = GetTraceFilePath(name);
+        if (LoadTrace(traceFilePath.c_str(), m_replay))
+        {
+            m_replayPaths.reserve(m_replay.m_paths.size());
+            for (const AZStd::string& path : m_replay.m_paths)
+            {
+                auto requestPath = AZStd::make_shared<RequestPath>();
+                requestPath->InitFromAbsolutePath(path);
+                m_replayPaths.push_back(AZStd::move(requestPath));
+            }
+        }
+    }
+
+    void TracePrefetcher::StopTrace()
+    {
+        if (!m_isTracing)
+        {
+            return;
+        }
+
+        if (!m_recording.m_entries.empty())
+        {
+            SaveTrace(GetTraceFilePath(m_traceName).c_str(), m_recording);
+        }
+        m_recording.m_paths.clear();
+        m_recording.m_entries.clear();
+        m_recordedPathIndices.clear();
+
+        // Anything that was read ahead but not requested by now is no longer needed.
+        FlushPrefetches(nullptr);
+        m_replay.m_paths.clear();
+        m_replay.m_entries.clear();
+        m_replayPaths.clear();
+        m_nextReplayIndex = 0;
+
+        m_traceName.clear();
+        m_isTracing = false;
+    }
+
+    AZStd::string TracePrefetcher::GetTraceFilePath(const AZStd::string& name) const
+    {
+        // The trace name is used as the file name, so it can't contain any folders.
+        AZStd::string fileName = name;
+        AZStd::replace_if(fileName.begin(), fileName.end(), [](char c) { return c == '/' || c == '\\' || c == ':'; }, '_');
+
+        char resolvedFolder[AZ_MAX_PATH_LEN];
+        FileIOBase* fileIO = FileIOBase::GetInstance();
+        if (fileIO && fileIO->ResolvePath(m_traceFolder.c_str(), resolvedFolder, AZ_ARRAY_SIZE(resolvedFolder)))
+        {
+            return AZStd::string::format("%s/%s%s", resolvedFolder, fileName.c_str(), TracePrefetcherInternal::TraceFileExtension);
+        }
+        return AZStd::string::format("%s/%s%s", m_traceFolder.c_str(), fileName.c_str(), TracePrefetcherInternal::TraceFileExtension);
+    }
+
+    void TracePrefetcher::RecordRead(const FileRequest::ReadData& data)
+    {
+        if (data.m_size > AZStd::numeric_limits<u32>::max() ||
+            m_recording.m_entries.size() >= TracePrefetcherInternal::MaxNumTraceEntries)
+        {
+            return;
+        }
+
+        auto [pathIndex, inserted] = m_recordedPathIndices.emplace(data.m_path.GetAbsolutePath(), 0);
+        if (inserted)
+        {
+            pathIndex->second = aznumeric_caster(m_recording.m_paths.size());
+            m_recording.m_paths.push_back(pathIndex->first);
+        }
+
+        TraceEntry entry;
+        entry.m_offset = data.m_offset;
+        entry.m_size = aznumeric_caster(data.m_size);
+        entry.m_pathIndex = pathIndex->second;
+        m_recording.m_entries.push_back(entry);
+    }
+
+    void TracePrefetcher::ReadFile(FileRequest* request, FileRequest::ReadData& data)
+    {
+        if (!m_next)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        if (m_isTracing)
+        {
+            RecordRead(data);
+        }
+
+        if (m_replay.m_entries.empty())
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        for (auto it = m_prefetches.begin(); it != m_prefetches.end(); ++it)
+        {
+            if (!it->m_isStale && *it->m_path == data.m_path &&
+                data.m_offset >= it->m_offset && data.m_offset + data.m_size <= it->m_offset + it->m_size)
+            {
+                m_numHits++;
+                size_t traceIndex = it->m_traceIndex;
+                if (it->m_read)
+                {
+                    it->m_waitingRequests.push_back(request);
+                }
+                else
+                {
+                    ServeRequest(request, *it);
+                    ReleasePrefetch(*it);
+                    m_prefetches.erase(it);
+                }
+                ReleaseStalePrefetches(traceIndex);
+                return;
+            }
+        }
+
+        m_numMisses++;
+        SkipAheadInTrace(data);
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void TracePrefetcher::SkipAheadInTrace(const FileRequest::ReadData& data)
+    {
+        // If the requests got ahead of the prefetches, continue prefetching from the request's position in the trace
+        // instead of reading data that has already been requested.
+        size_t end = AZStd::min(m_nextReplayIndex + TracePrefetcherInternal::SkipAheadWindow, m_replay.m_entries.size());
+        for (size_t i = m_nextReplayIndex; i < end; ++i)
+        {
+            const TraceEntry& entry = m_replay.m_entries[i];
+            if (*m_replayPaths[entry.m_pathIndex] == data.m_path &&
+                data.m_offset >= entry.m_offset && data.m_offset + data.m_size <= entry.m_offset + entry.m_size)
+            {
+                m_nextReplayIndex = i + 1;
+                ReleaseStalePrefetches(i);
+                return;
+            }
+        }
+    }
+
+    void TracePrefetcher::ServeRequest(FileRequest* request, const Prefetch& prefetch)
+    {
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Request served by the TracePrefetcher doesn't contain read data.");
+        memcpy(data->m_output, prefetch.m_buffer + (data->m_offset - prefetch.m_offset), data->m_size);
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    bool TracePrefetcher::QueuePrefetches()
+    {
+        if (!m_next || m_nextReplayIndex >= m_replay.m_entries.size() || m_numInFlightPrefetches >= m_maxNumPrefetches)
+        {
+            return false;
+        }
+
+        // Speculative reads have a lower priority than actual requests, so only read ahead if the rest of the stack
+        // has room for more requests.
+        Status status;
+        StreamStackEntry::UpdateStatus(status);
+        s32 numAvailableSlots = status.m_numAvailableSlots;
+
+        bool queuedPrefetches = false;
+        while (numAvailableSlots > 0 && m_numInFlightPrefetches < m_maxNumPrefetches &&
+            m_nextReplayIndex < m_replay.m_entries.size())
+        {
+            const TraceEntry& entry = m_replay.m_entries[m_nextReplayIndex];
+            u64 bufferSize = AZ_SIZE_ALIGN_UP(aznumeric_cast<u64>(entry.m_size), aznumeric_cast<u64>(m_alignment));
+            if (bufferSize > m_maxPrefetchMemory)
+            {
+                // This read will never fit in the budget, so leave it to the actual request.
+                m_nextReplayIndex++;
+                continue;
+            }
+            if (m_prefetchMemoryUsage + bufferSize > m_maxPrefetchMemory)
+            {
+                break;
+            }
+
+            m_prefetches.emplace_back();
+            Prefetch& prefetch = m_prefetches.back();
+            prefetch.m_path = m_replayPaths[entry.m_pathIndex];
+            prefetch.m_offset = entry.m_offset;
+            prefetch.m_size = entry.m_size;
+            prefetch.m_traceIndex = m_nextReplayIndex;
+            prefetch.m_bufferSize = bufferSize;
+            prefetch.m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                bufferSize, m_alignment, 0, "AZ::IO::Streamer TracePrefetcher", __FILE__, __LINE__));
+            m_prefetchMemoryUsage += bufferSize;
+
+            prefetch.m_read = m_context->GetNewInternalRequest();
+            prefetch.m_read->CreateRead(nullptr, prefetch.m_buffer, bufferSize, *prefetch.m_path, entry.m_offset, entry.m_size, true);
+            prefetch.m_read->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    FinishPrefetch(request);
+                });
+            m_next->QueueRequest(prefetch.m_read);
+
+            m_numInFlightPrefetches++;
+            m_nextReplayIndex++;
+            numAvailableSlots--;
+            queuedPrefetches = true;
+        }
+        return queuedPrefetches;
+    }
+
+    void TracePrefetcher::FinishPrefetch(FileRequest& read)
+    {
+        AZ_Assert(m_numInFlightPrefetches > 0, "TracePrefetcher received a completed prefetch, but there are no prefetches in flight.");
+        m_numInFlightPrefetches--;
+
+        auto it = AZStd::find_if(m_prefetches.begin(), m_prefetches.end(),
+            [&read](const Prefetch& prefetch) { return prefetch.m_read == &read; });
+        AZ_Assert(it != m_prefetches.end(), "TracePrefetcher received a completed prefetch that it doesn't know about.");
+        it->m_read = nullptr;
+
+        if (read.GetStatus() == IStreamerTypes::RequestStatus::Completed)
+        {
+            for (FileRequest* request : it->m_waitingRequests)
+            {
+                ServeRequest(request, *it);
+            }
+        }
+        else
+        {
+            // The speculative read failed or was canceled, so let the requests read the data themselves.
+            for (FileRequest* request : it->m_waitingRequests)
+            {
+                StreamStackEntry::QueueRequest(request);
+            }
+        }
+
+        if (!it->m_waitingRequests.empty() || it->m_isStale || read.GetStatus() != IStreamerTypes::RequestStatus::Completed)
+        {
+            if (it->m_waitingRequests.empty())
+            {
+                m_numWastedPrefetches++;
+            }
+            ReleasePrefetch(*it);
+            m_prefetches.erase(it);
+        }
+    }
+
+    void TracePrefetcher::ReleasePrefetch(Prefetch& prefetch)
+    {
+        if (prefetch.m_buffer)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(prefetch.m_buffer, prefetch.m_bufferSize, m_alignment);
+            prefetch.m_buffer = nullptr;
+            m_prefetchMemoryUsage -= prefetch.m_bufferSize;
+        }
+    }
+
+    void TracePrefetcher::ReleaseStalePrefetches(size_t traceIndex)
+    {
+        // Requests generally come in the order of the trace, so data that was read ahead for earlier entries is unlikely to be requested.
+        for (auto it = m_prefetches.begin(); it != m_prefetches.end();)
+        {
+            if (it->m_isStale || it->m_traceIndex >= traceIndex)
+            {
+                ++it;
+            }
+            else if (it->m_read)
+            {
+                // Still in flight, so the buffer can only be released once the read completes.
+                it->m_isStale = true;
+                ++it;
+            }
+            else
+            {
+                m_numWastedPrefetches++;
+                ReleasePrefetch(*it);
+                it = m_prefetches.erase(it);
+            }
+        }
+    }
+
+    void TracePrefetcher::FlushPrefetches(const RequestPath* path)
+    {
+        for (auto it = m_prefetches.begin(); it != m_prefetches.end();)
+        {
+            if (path && *it->m_path != *path)
+            {
+                ++it;
+            }
+            else if (it->m_read)
+            {
+                it->m_isStale = true;
+                ++it;
+            }
+            else
+            {
+                m_numWastedPrefetches++;
+                ReleasePrefetch(*it);
+                it = m_prefetches.erase(it);
+            }
+        }
+    }
+
+    double TracePrefetcher::CalculateHitRatePercentage() const
+    {
+        size_t numRequests = m_numHits + m_numMisses;
+        return numRequests > 0 ? (aznumeric_cast<double>(m_numHits) / aznumeric_cast<double>(numRequests)) : 0.0;
+    }
+} // namespace AZ::IO
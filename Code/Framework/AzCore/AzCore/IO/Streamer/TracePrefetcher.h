@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    struct TracePrefetcherConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::TracePrefetcherConfig, "{BCF183FE-E76F-439B-B327-1BEFF016ECF0}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(TracePrefetcherConfig, AZ::SystemAllocator, 0);
+
+        ~TracePrefetcherConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The folder the access traces are stored in. Aliases are resolved when a trace starts.
+        AZStd::string m_traceFolder{ "@user@/Streamer/Traces" };
+        //! Maximum amount of memory in megabytes used to hold data that was read ahead of the requests for it.
+        u32 m_maxPrefetchMemoryMib{ 16 };
+        //! Maximum number of speculative reads that are kept in flight.
+        u32 m_maxNumPrefetches{ 2 };
+    };
+
+    //! Entry in the streaming stack that learns the order in which data is read, for instance during a level load.
+    //! A trace is started and stopped with the StartTraceCommand and StopTraceCommand, which are sent with IStreamer::Custom.
+    //! While a trace is active all reads that pass through are recorded and when the trace stops they're stored in a trace
+    //! file named after the trace. The next time a trace with the same name starts, the recorded reads are replayed as
+    //! speculative reads ahead of the actual requests. These are only issued when the rest of the stack has room for more
+    //! requests and are limited by a memory budget. Requests that match a speculative read are served from its memory.
+    //! This entry needs to be placed below entries that convert requests, such as the FullFileDecompressor, so it sees
+    //! the reads that actually go to storage.
+    class TracePrefetcher
+        : public StreamStackEntry
+    {
+    public:
+        //! Starts recording reads and, if a trace with the same name was stored before, replays it.
+        //! Starting a trace while another trace is active stops the active trace first.
+        struct StartTraceCommand
+        {
+            AZ_TYPE_INFO(AZ::IO::TracePrefetcher::StartTraceCommand, "{F760CF3A-63A9-4EBE-A0F2-1D69F067C7D8}");
+            AZStd::string m_name;
+        };
+
+        //! Stops the active trace and stores the recorded reads.
+        struct StopTraceCommand
+        {
+            AZ_TYPE_INFO(AZ::IO::TracePrefetcher::StopTraceCommand, "{92B1A151-C0A7-4D99-9D31-4E084F48FB88}");
+        };
+
+        struct TraceEntry
+        {
+            u64 m_offset;
+            u32 m_size;
+            u32 m_pathIndex;
+        };
+
+        //! The reads recorded during a trace. Paths are stored once and referenced by index to keep the trace files compact.
+        struct Trace
+        {
+            AZStd::vector<AZStd::string> m_paths;
+            AZStd::vector<TraceEntry> m_entries;
+        };
+
+        TracePrefetcher(AZStd::string traceFolder, u64 maxPrefetchMemory, u32 maxNumPrefetches, u32 alignment);
+        ~TracePrefetcher() override;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        static bool SaveTrace(const char* filePath, const Trace& trace);
+        static bool LoadTrace(const char* filePath, Trace& trace);
+
+    private:
+        struct Prefetch
+        {
+            //! Shared with the replayed trace so the path outlives the trace if the read is still in flight when the trace stops.
+            AZStd::shared_ptr<RequestPath> m_path;
+            AZStd::vector<FileRequest*> m_waitingRequests; //!< Requests that matched this prefetch while it was still in flight.
+            FileRequest* m_read{ nullptr }; //!< The speculative read while it's in flight, otherwise null.
+            u8* m_buffer{ nullptr };
+            u64 m_bufferSize{ 0 };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            size_t m_traceIndex{ 0 };
+            bool m_isStale{ false }; //!< The requests have moved past this prefetch or it was flushed while in flight.
+        };
+
+        void StartTrace(const AZStd::string& name);
+        void StopTrace();
+        AZStd::string GetTraceFilePath(const AZStd::string& name) const;
+
+        void RecordRead(const FileRequest::ReadData& data);
+        void ReadFile(FileRequest* request, FileRequest::ReadData& data);
+        void SkipAheadInTrace(const FileRequest::ReadData& data);
+        void ServeRequest(FileRequest* request, const Prefetch& prefetch);
+
+        bool QueuePrefetches();
+        void FinishPrefetch(FileRequest& read);
+        void ReleasePrefetch(Prefetch& prefetch);
+        void ReleaseStalePrefetches(size_t traceIndex);
+        void FlushPrefetches(const RequestPath* path);
+
+        double CalculateHitRatePercentage() const;
+
+        AZStd::string m_traceFolder;
+        AZStd::string m_traceName;
+
+        Trace m_recording;
+        AZStd::unordered_map<AZStd::string, u32> m_recordedPathIndices;
+
+        Trace m_replay;
+        //! Paths from the replayed trace. Reads reference their path, so these are created once per trace.
+        AZStd::vector<AZStd::shared_ptr<RequestPath>> m_replayPaths;
+        //! Prefetches in the order they appear in the trace.
+        AZStd::deque<Prefetch> m_prefetches;
+        size_t m_nextReplayIndex{ 0 };
+
+        u64 m_maxPrefetchMemory;
+        u64 m_prefetchMemoryUsage{ 0 };
+        size_t m_numHits{ 0 };
+        size_t m_numMisses{ 0 };
+        size_t m_numWastedPrefetches{ 0 };
+        u32 m_maxNumPrefetches;
+        u32 m_numInFlightPrefetches{ 0 };
+        u32 m_alignment;
+        bool m_isTracing{ false };
+    };
+} // namespace AZ::IO
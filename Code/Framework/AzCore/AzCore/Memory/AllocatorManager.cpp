@@ -574,6 +574,18 @@ AllocatorManager::DumpAllocators()
         m_dumpInfo[i].m_reserved = reservedBytes;
         m_dumpInfo[i].m_consumed = consumedBytes;
         AZ_Printf(TAG, "%d,%s,%.2f,%.2f,%.2f\n", i, name, usedBytes / 1024.0f, reservedBytes / 1024.0f, consumedBytes / 1024.0f);
+
+        if (consumedBytes)
+        {
+            size_t threadCacheHits = 0;
+            size_t threadCacheMisses = 0;
+            source->GetThreadCacheHitCounts(threadCacheHits, threadCacheMisses);
+            if (threadCacheHits + threadCacheMisses > 0)
+            {
+                AZ_Printf(TAG, "-,%s thread cache hit rate,%.2f%% (%zu hits / %zu misses)\n", name,
+                    100.0 * threadCacheHits / (threadCacheHits + threadCacheMisses), threadCacheHits, threadCacheMisses);
+            }
+        }
     }
 
     AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
@@ -633,7 +645,11 @@ void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacit
 
         if (outStats)
         {
-            outStats->emplace(outStats->end(), allocator->GetName(), alias ? alias->GetName() : allocator->GetDescription(), sourceAllocatedBytes, sourceCapacityBytes, alias != nullptr);
+            AllocatorStats& stats = *outStats->emplace(outStats->end(), allocator->GetName(), alias ? alias->GetName() : allocator->GetDescription(), sourceAllocatedBytes, sourceCapacityBytes, alias != nullptr);
+            if (!alias)
+            {
+                source->GetThreadCacheHitCounts(stats.m_threadCacheHits, stats.m_threadCacheMisses);
+            }
         }
 
         if (!alias)
@@ -126,6 +126,8 @@ namespace AZ
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
             bool   m_isAlias;
+            size_t m_threadCacheHits = 0;   ///< Allocations served from per thread caches, 0 for aliases and allocators without them
+            size_t m_threadCacheMisses = 0; ///< Allocations that had to refill a per thread cache
         };
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/FrameSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /*!
+     * Frame allocator
+     * Thread safe linear allocator for temporary data that only lives for a frame, see \ref FrameSchema.
+     * Memory allocated during a frame is valid until the end of the next frame. The ComponentApplication
+     * advances the frame at the start of every tick, before the TickBus is ticked.
+     * Allocations are not tracked by the allocation records, and freeing memory is optional.
+     */
+    class FrameAllocator final
+        : public SimpleSchemaAllocator<FrameSchemaHelper<FrameAllocator>, FrameSchema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameAllocator, SystemAllocator, 0);
+        AZ_TYPE_INFO(FrameAllocator, "{D66A0DF3-88C7-4585-8A58-910B74F7ECFB}");
+
+        using Base = SimpleSchemaAllocator<FrameSchemaHelper<FrameAllocator>, FrameSchema::Descriptor, false, true>;
+
+        FrameAllocator()
+            : Base("FrameAllocator", "Per thread linear allocator for memory that lives until the end of the next frame")
+        {
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            // Memory is released in bulk when a frame expires, so tracking individual allocations would report them all as leaks
+            return AllocatorDebugConfig().ExcludeFromDebugging();
+        }
+
+        /// Starts a new frame, memory allocated before the previous frame expires.
+        void AdvanceFrame()
+        {
+            static_cast<FrameSchema*>(m_schema)->AdvanceFrame();
+        }
+
+        /// Returns the current frame.
+        AZ::u64 GetFrame() const
+        {
+            return static_cast<const FrameSchema*>(m_schema)->GetFrame();
+        }
+    };
+
+    typedef AZStdAlloc<FrameAllocator> FrameStdAllocator;
+
+    //! Vector for temporary data that only lives until the end of the next frame.
+    template<class T>
+    using FrameVector = AZStd::vector<T, FrameStdAllocator>;
+}
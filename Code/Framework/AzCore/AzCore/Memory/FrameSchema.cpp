@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+
+namespace AZ
+{
+    namespace
+    {
+        // 0 is never used so thread local storage that was never set doesn't match any schema
+        AZStd::atomic<AZ::u64> s_nextFrameSchemaId{ 1 };
+
+        constexpr AZ::u64 InvalidFrame = ~AZ::u64(0);
+        constexpr unsigned char PoisonByte = 0xfa;
+        constexpr size_t ChunkAlignment = 16;
+    }
+
+    struct FrameSchema::FrameChunk
+    {
+        FrameChunk* m_next;
+        size_t m_size; // including this header
+
+        char* Begin() { return reinterpret_cast<char*>(this + 1); }
+        char* End() { return reinterpret_cast<char*>(this) + m_size; }
+    };
+
+    struct FrameSchema::FrameArena
+    {
+        FrameChunk* m_chunks = nullptr;         // the chunk allocations are currently made from is first
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;       // the most recent allocation, which can still be freed or resized
+        char* m_lastAllocationBegin = nullptr;  // where m_current was before the most recent allocation
+        AZ::u64 m_frame = InvalidFrame;
+    };
+
+    // Stored in front of every allocation when use after frame detection is enabled
+    struct FrameAllocationHeader
+    {
+        AZ::u64 m_frame;
+        AZ::u64 m_size;
+    };
+
+    struct FrameThreadData
+    {
+        AZ_CLASS_ALLOCATOR(FrameThreadData, SystemAllocator, 0)
+
+        FrameSchema::FrameArena m_arenas[2]; // indexed by the parity of the frame
+        // chunks from reset arenas, oldest first so poisoned memory stays poisoned for as long as possible
+        FrameSchema::FrameChunk* m_freeChunks = nullptr;
+        FrameSchema::FrameChunk* m_freeChunksTail = nullptr;
+
+        // only written by the owning thread, read when gathering statistics
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+        AZStd::atomic<size_t> m_capacityBytes{ 0 };
+        size_t m_arenaAllocatedBytes[2] = { 0, 0 };
+
+        // null once the schema was destroyed, the thread then deletes the data when it exits
+        FrameSchema* m_owner = nullptr;
+        // the next data of the thread that uses this data, see FrameThreadRegistry
+        FrameThreadData* m_nextInThread = nullptr;
+        // true while a thread's registry holds this data
+        bool m_hasThread = false;
+        // the frame in which the thread that used this data exited
+        AZ::u64 m_releasedFrame = InvalidFrame;
+    };
+
+    // The frame thread data created by one thread, released to their schemas when the thread exits
+    struct FrameThreadRegistry
+    {
+        ~FrameThreadRegistry();
+
+        static AZStd::mutex& GetMutex();
+
+        FrameThreadData* m_threadData = nullptr;
+        bool m_isDestroyed = false;
+    };
+
+    static thread_local FrameThreadRegistry s_frameThreadRegistry;
+
+    FrameThreadRegistry::~FrameThreadRegistry()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(GetMutex());
+        FrameThreadData* threadData = m_threadData;
+        while (threadData)
+        {
+            // the data can be taken over by another thread as soon as it's released
+            FrameThreadData* next = threadData->m_nextInThread;
+            if (threadData->m_owner)
+            {
+                threadData->m_owner->ReleaseThreadData(*threadData);
+            }
+            else
+            {
+                delete threadData;
+            }
+            threadData = next;
+        }
+        m_threadData = nullptr;
+        // thread data created by later thread local destructors is freed with its schema
+        m_isDestroyed = true;
+    }
+
+    AZStd::mutex& FrameThreadRegistry::GetMutex()
+    {
+        // Never destroyed, schemas and threads can release their data during static destruction
+        static AZStd::aligned_storage<sizeof(AZStd::mutex), alignof(AZStd::mutex)>::type s_mutexStorage;
+        static AZStd::mutex* s_mutex = new (&s_mutexStorage) AZStd::mutex();
+        return *s_mutex;
+    }
+
+    FrameSchema::FrameSchema(const Descriptor& desc, GetFrameThreadData getThreadData, SetFrameThreadData setThreadData)
+        : m_desc(desc)
+        , m_chunkAllocator(desc.m_chunkAllocator)
+        , m_schemaId(s_nextFrameSchemaId++)
+        , m_threadDataGetter(getThreadData)
+        , m_threadDataSetter(setThreadData)
+    {
+        if (m_chunkAllocator == nullptr)
+        {
+            m_chunkAllocator = &AllocatorInstance<SystemAllocator>::Get();  // use the SystemAllocator if no chunk allocator is provided
+        }
+        AZ_Assert(m_desc.m_chunkSize > sizeof(FrameChunk), "Frame allocator chunks must be bigger than %zu bytes", sizeof(FrameChunk));
+    }
+
+    FrameSchema::~FrameSchema()
+    {
+        // IMPORTANT: We assume that no thread is allocating anymore, all allocators are singletons that are destroyed on shut down.
+        // Threads that still point to their data ignore it as it was set for a different schema id.
+        AZStd::lock_guard<AZStd::mutex> registryLock(FrameThreadRegistry::GetMutex());
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        for (FrameThreadData* threadData : m_threads)
+        {
+            FreeThreadChunks(*threadData);
+            if (threadData->m_hasThread)
+            {
+                // the thread still references the data and deletes it when it exits
+                threadData->m_owner = nullptr;
+            }
+            else
+            {
+                delete threadData;
+            }
+        }
+        m_threads.clear();
+        m_releasedThreads.clear();
+        m_threadDataSetter(nullptr, 0);
+    }
+
+    FrameSchema::pointer_type FrameSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        alignment = AZStd::GetMax<size_type>(alignment, sizeof(void*));
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be a power of 2!");
+
+        FrameThreadData* threadData = GetThreadData();
+        if (!threadData)
+        {
+            return nullptr;
+        }
+        FrameArena& arena = GetArena(*threadData);
+
+        const size_t headerSize = m_desc.m_isUseAfterFrameDetection ? sizeof(FrameAllocationHeader) : 0;
+        char* address = arena.m_current ? AZ::PointerAlignUp(arena.m_current + headerSize, alignment) : nullptr;
+        if (!address || address > arena.m_end || byteSize > static_cast<size_t>(arena.m_end - address))
+        {
+            if (!AddChunk(*threadData, arena, headerSize + alignment + byteSize))
+            {
+                return nullptr;
+            }
+            address = AZ::PointerAlignUp(arena.m_current + headerSize, alignment);
+        }
+
+        if (m_desc.m_isUseAfterFrameDetection)
+        {
+            FrameAllocationHeader* header = reinterpret_cast<FrameAllocationHeader*>(address) - 1;
+            header->m_frame = arena.m_frame;
+            header->m_size = byteSize;
+        }
+
+        const size_t usedBytes = (address + byteSize) - arena.m_current;
+        arena.m_lastAllocationBegin = arena.m_current;
+        arena.m_lastAllocation = address;
+        arena.m_current = address + byteSize;
+        threadData->m_arenaAllocatedBytes[arena.m_frame & 1] += usedBytes;
+        threadData->m_allocatedBytes.store(threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed) + usedBytes, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    void FrameSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        if (m_desc.m_isUseAfterFrameDetection)
+        {
+            CheckAllocation(ptr, "Freed");
+        }
+
+        // Frame memory is released in bulk when its arena is reset, only the most recent allocation can be given back early
+        if (FrameArena* arena = FindLastAllocationArena(ptr))
+        {
+            FrameThreadData* threadData = m_threadDataGetter(m_schemaId);
+            const size_t releasedBytes = arena->m_current - arena->m_lastAllocationBegin;
+            arena->m_current = arena->m_lastAllocationBegin;
+            arena->m_lastAllocation = nullptr;
+            threadData->m_arenaAllocatedBytes[arena->m_frame & 1] -= releasedBytes;
+            threadData->m_allocatedBytes.store(threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed) - releasedBytes, AZStd::memory_order_relaxed);
+        }
+    }
+
+    FrameSchema::size_type FrameSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        if (m_desc.m_isUseAfterFrameDetection)
+        {
+            CheckAllocation(ptr, "Resized");
+        }
+
+        FrameArena* arena = FindLastAllocationArena(ptr);
+        char* address = reinterpret_cast<char*>(ptr);
+        if (!arena || newSize > static_cast<size_t>(arena->m_end - address))
+        {
+            return 0;
+        }
+
+        FrameThreadData* threadData = m_threadDataGetter(m_schemaId);
+        const size_t oldSize = arena->m_current - address;
+        arena->m_current = address + newSize;
+        threadData->m_arenaAllocatedBytes[arena->m_frame & 1] += newSize - oldSize;
+        threadData->m_allocatedBytes.store(threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed) + newSize - oldSize, AZStd::memory_order_relaxed);
+        if (m_desc.m_isUseAfterFrameDetection)
+        {
+            (reinterpret_cast<FrameAllocationHeader*>(address) - 1)->m_size = newSize;
+        }
+        return newSize;
+    }
+
+    FrameSchema::pointer_type FrameSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        (void)ptr;
+        (void)newSize;
+        (void)newAlignment;
+        AZ_Assert(false, "Not supported!");
+        return nullptr;
+    }
+
+    FrameSchema::size_type FrameSchema::AllocationSize(pointer_type ptr)
+    {
+        if (ptr && m_desc.m_isUseAfterFrameDetection)
+        {
+            return (reinterpret_cast<FrameAllocationHeader*>(ptr) - 1)->m_size;
+        }
+        return 0;
+    }
+
+    FrameSchema::size_type FrameSchema::NumAllocatedBytes() const
+    {
+        size_type allocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        for (const FrameThreadData* threadData : m_threads)
+        {
+            allocatedBytes += threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+
+    FrameSchema::size_type FrameSchema::Capacity() const
+    {
+        size_type capacityBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        for (const FrameThreadData* threadData : m_threads)
+        {
+            capacityBytes += threadData->m_capacityBytes.load(AZStd::memory_order_relaxed);
+        }
+        return capacityBytes;
+    }
+
+    FrameSchema::size_type FrameSchema::GetMaxContiguousAllocationSize() const
+    {
+        return AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    IAllocatorAllocate* FrameSchema::GetSubAllocator()
+    {
+        return m_chunkAllocator;
+    }
+
+    void FrameSchema::GarbageCollect()
+    {
+        FrameThreadData* threadData = m_threadDataGetter(m_schemaId);
+        if (!threadData)
+        {
+            return;
+        }
+        while (FrameChunk* chunk = threadData->m_freeChunks)
+        {
+            threadData->m_freeChunks = chunk->m_next;
+            FreeChunk(*threadData, chunk);
+        }
+        threadData->m_freeChunksTail = nullptr;
+    }
+
+    void FrameSchema::AdvanceFrame()
+    {
+        const AZ::u64 frame = m_frame.fetch_add(1, AZStd::memory_order_release) + 1;
+
+        // Free the chunks of exited threads once everything they allocated has expired, unless a new thread took them over
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        for (FrameThreadData* threadData : m_releasedThreads)
+        {
+            if (threadData->m_releasedFrame + 2 <= frame && threadData->m_capacityBytes.load(AZStd::memory_order_relaxed) != 0)
+            {
+                FreeThreadChunks(*threadData);
+            }
+        }
+    }
+
+    AZ::u64 FrameSchema::GetFrame() const
+    {
+        return m_frame.load(AZStd::memory_order_acquire);
+    }
+
+    FrameThreadData* FrameSchema::GetThreadData()
+    {
+        FrameThreadData* threadData = m_threadDataGetter(m_schemaId);
+        if (threadData == nullptr)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+                if (!m_releasedThreads.empty())
+                {
+                    // Take over the data of an exited thread. Its arenas are reset lazily like those of any other thread, so
+                    // memory the exited thread allocated stays valid for as long as it would have otherwise.
+                    threadData = m_releasedThreads.back();
+                    m_releasedThreads.pop_back();
+                    threadData->m_releasedFrame = InvalidFrame;
+                }
+                else
+                {
+                    threadData = aznew FrameThreadData();
+                    threadData->m_owner = this;
+                    m_threads.push_back(threadData);
+                }
+            }
+
+            FrameThreadRegistry& registry = s_frameThreadRegistry;
+            if (!registry.m_isDestroyed)
+            {
+                threadData->m_hasThread = true;
+                threadData->m_nextInThread = registry.m_threadData;
+                registry.m_threadData = threadData;
+            }
+            m_threadDataSetter(threadData, m_schemaId);
+        }
+        return threadData;
+    }
+
+    void FrameSchema::ReleaseThreadData(FrameThreadData& threadData)
+    {
+        // Later allocations by this thread, from thread local destructors, create new data
+        if (m_threadDataGetter(m_schemaId) == &threadData)
+        {
+            m_threadDataSetter(nullptr, 0);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        threadData.m_hasThread = false;
+        threadData.m_nextInThread = nullptr;
+        threadData.m_releasedFrame = m_frame.load(AZStd::memory_order_acquire);
+        m_releasedThreads.push_back(&threadData);
+    }
+
+    void FrameSchema::FreeThreadChunks(FrameThreadData& threadData)
+    {
+        for (FrameArena& arena : threadData.m_arenas)
+        {
+            while (FrameChunk* chunk = arena.m_chunks)
+            {
+                arena.m_chunks = chunk->m_next;
+                FreeChunk(threadData, chunk);
+            }
+            arena = FrameArena{};
+        }
+        while (FrameChunk* chunk = threadData.m_freeChunks)
+        {
+            threadData.m_freeChunks = chunk->m_next;
+            FreeChunk(threadData, chunk);
+        }
+        threadData.m_freeChunksTail = nullptr;
+        threadData.m_arenaAllocatedBytes[0] = 0;
+        threadData.m_arenaAllocatedBytes[1] = 0;
+        threadData.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    FrameSchema::FrameArena& FrameSchema::GetArena(FrameThreadData& threadData)
+    {
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_acquire);
+        FrameArena& arena = threadData.m_arenas[frame & 1];
+        if (arena.m_frame != frame)
+        {
+            // The arena was last used two or more frames ago, so nothing allocated from it is valid anymore
+            ResetArena(threadData, arena, frame);
+        }
+        return arena;
+    }
+
+    FrameSchema::FrameArena* FrameSchema::FindLastAllocationArena(pointer_type ptr)
+    {
+        FrameThreadData* threadData = m_threadDataGetter(m_schemaId);
+        if (!threadData || !ptr)
+        {
+            return nullptr;
+        }
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_acquire);
+        FrameArena& arena = threadData->m_arenas[frame & 1];
+        return (arena.m_frame == frame && arena.m_lastAllocation == ptr) ? &arena : nullptr;
+    }
+
+    void FrameSchema::ResetArena(FrameThreadData& threadData, FrameArena& arena, AZ::u64 frame)
+    {
+        while (FrameChunk* chunk = arena.m_chunks)
+        {
+            arena.m_chunks = chunk->m_next;
+            if (chunk->m_size != m_desc.m_chunkSize)
+            {
+                // chunks for big allocations are not kept around
+                FreeChunk(threadData, chunk);
+                continue;
+            }
+
+            if (m_desc.m_isUseAfterFrameDetection)
+            {
+                memset(chunk->Begin(), PoisonByte, chunk->End() - chunk->Begin());
+            }
+            chunk->m_next = nullptr;
+            if (threadData.m_freeChunksTail)
+            {
+                threadData.m_freeChunksTail->m_next = chunk;
+            }
+            else
+            {
+                threadData.m_freeChunks = chunk;
+            }
+            threadData.m_freeChunksTail = chunk;
+        }
+
+        const size_t releasedBytes = threadData.m_arenaAllocatedBytes[frame & 1];
+        threadData.m_arenaAllocatedBytes[frame & 1] = 0;
+        threadData.m_allocatedBytes.store(threadData.m_allocatedBytes.load(AZStd::memory_order_relaxed) - releasedBytes, AZStd::memory_order_relaxed);
+
+        arena.m_current = nullptr;
+        arena.m_end = nullptr;
+        arena.m_lastAllocation = nullptr;
+        arena.m_lastAllocationBegin = nullptr;
+        arena.m_frame = frame;
+    }
+
+    bool FrameSchema::AddChunk(FrameThreadData& threadData, FrameArena& arena, size_t minByteSize)
+    {
+        FrameChunk* chunk = nullptr;
+        const size_t chunkSize = sizeof(FrameChunk) + minByteSize;
+        if (chunkSize <= m_desc.m_chunkSize && threadData.m_freeChunks)
+        {
+            chunk = threadData.m_freeChunks;
+            threadData.m_freeChunks = chunk->m_next;
+            if (!threadData.m_freeChunks)
+            {
+                threadData.m_freeChunksTail = nullptr;
+            }
+
+            if (m_desc.m_isUseAfterFrameDetection)
+            {
+                for (const char* byte = chunk->Begin(); byte != chunk->End(); ++byte)
+                {
+                    if (static_cast<unsigned char>(*byte) != PoisonByte)
+                    {
+                        AZ_Error("FrameAllocator", false, "Frame memory at %p was written to after the frame it was allocated in ended. "
+                            "Frame memory is only valid until the end of the frame after the one it was allocated in.", byte);
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            const size_t allocationSize = AZStd::GetMax(chunkSize, m_desc.m_chunkSize);
+            void* memory = m_chunkAllocator->Allocate(allocationSize, ChunkAlignment, 0, "AZSystem::FrameSchema::Chunk", __FILE__, __LINE__);
+            if (!memory)
+            {
+                return false;
+            }
+            chunk = reinterpret_cast<FrameChunk*>(memory);
+            chunk->m_size = allocationSize;
+            threadData.m_capacityBytes.store(threadData.m_capacityBytes.load(AZStd::memory_order_relaxed) + allocationSize, AZStd::memory_order_relaxed);
+        }
+
+        chunk->m_next = arena.m_chunks;
+        arena.m_chunks = chunk;
+        arena.m_current = chunk->Begin();
+        arena.m_end = chunk->End();
+        return true;
+    }
+
+    void FrameSchema::FreeChunk(FrameThreadData& threadData, FrameChunk* chunk)
+    {
+        threadData.m_capacityBytes.store(threadData.m_capacityBytes.load(AZStd::memory_order_relaxed) - chunk->m_size, AZStd::memory_order_relaxed);
+        m_chunkAllocator->DeAllocate(chunk, chunk->m_size, ChunkAlignment);
+    }
+
+    void FrameSchema::CheckAllocation(pointer_type ptr, const char* operation) const
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        // An expired allocation either has a frame that is too old or was already poisoned when its arena was reset
+        const FrameAllocationHeader* header = reinterpret_cast<const FrameAllocationHeader*>(ptr) - 1;
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_acquire);
+        AZ_Error("FrameAllocator", header->m_frame <= frame && header->m_frame + 1 >= frame,
+            "%s frame memory at %p after it expired (allocated in frame %llu, current frame %llu). "
+            "Frame memory is only valid until the end of the frame after the one it was allocated in.",
+            operation, ptr, static_cast<unsigned long long>(header->m_frame), static_cast<unsigned long long>(frame));
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    struct FrameThreadData;
+
+    /**
+     * Linear (bump) allocation schema for memory that only lives for a frame.
+     * Every thread allocates from its own pair of arenas, one for even and one for odd frames, so allocating never takes a lock.
+     * Memory allocated during a frame stays valid until the end of the next frame, then the arena it came from is reset and reused.
+     * Freeing memory is not required, but freeing (or resizing) the most recent allocation of the calling thread gives the memory back.
+     * Frames are advanced with AdvanceFrame, usually once per tick by the application.
+     * When a thread exits its arenas are handed to the next thread that starts allocating, and if no thread takes them over
+     * their chunks are freed once the memory allocated by the exited thread has expired.
+     */
+    class FrameSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        // Functions for getting an instance of a FrameThreadData when using thread local storage.
+        // The schema instance id keeps threads from using the data of a destroyed schema.
+        typedef FrameThreadData* (* GetFrameThreadData)(AZ::u64 schemaId);
+        typedef void(* SetFrameThreadData)(FrameThreadData*, AZ::u64 schemaId);
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(64 * 1024)
+#if defined(AZ_DEBUG_BUILD)
+                , m_isUseAfterFrameDetection(true)
+#else
+                , m_isUseAfterFrameDetection(false)
+#endif
+                , m_chunkAllocator(nullptr)
+            {}
+
+            size_t                  m_chunkSize;                ///< Size of the memory chunks threads allocate from, bigger allocations get a chunk of their own.
+            bool                    m_isUseAfterFrameDetection; ///< Tags allocations with their frame and poisons expired memory to catch frame memory that is used after it expired. (default: true in debug builds)
+            IAllocatorAllocate*     m_chunkAllocator;           ///< Allocator for the chunks, if NULL the SystemAllocator is used.
+        };
+
+        FrameSchema(const Descriptor& desc, GetFrameThreadData getThreadData, SetFrameThreadData setThreadData);
+        ~FrameSchema() override;
+
+        pointer_type    Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void            DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Only the most recent allocation of the calling thread can be resized, for any other pointer 0 is returned.
+        size_type       Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type    ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        /// Returns 0 unless use after frame detection is enabled, as allocation sizes are not stored otherwise.
+        size_type       AllocationSize(pointer_type ptr) override;
+
+        size_type       NumAllocatedBytes() const override;
+        size_type       Capacity() const override;
+        size_type       GetMaxContiguousAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+        /// Returns the calling thread's spare chunks to the chunk allocator. Other threads keep theirs as they may be allocating.
+        void            GarbageCollect() override;
+
+        /// Starts a new frame. Memory allocated two frames ago becomes invalid and is reused by the next allocations.
+        void            AdvanceFrame();
+        /// Returns the current frame.
+        AZ::u64         GetFrame() const;
+
+    private:
+        friend struct FrameThreadData;
+        friend struct FrameThreadRegistry;
+
+        FrameSchema(const FrameSchema&) = delete;
+        FrameSchema& operator=(const FrameSchema&) = delete;
+
+        struct FrameChunk;
+        struct FrameArena;
+
+        FrameThreadData* GetThreadData();
+        /// Called on the exiting thread. Its data is kept for the next new thread until the memory allocated with it expires.
+        void ReleaseThreadData(FrameThreadData& threadData);
+        void FreeThreadChunks(FrameThreadData& threadData);
+        FrameArena& GetArena(FrameThreadData& threadData);
+        FrameArena* FindLastAllocationArena(pointer_type ptr);
+        void ResetArena(FrameThreadData& threadData, FrameArena& arena, AZ::u64 frame);
+        bool AddChunk(FrameThreadData& threadData, FrameArena& arena, size_t minByteSize);
+        void FreeChunk(FrameThreadData& threadData, FrameChunk* chunk);
+        void CheckAllocation(pointer_type ptr, const char* operation) const;
+
+        Descriptor m_desc;
+        IAllocatorAllocate* m_chunkAllocator;
+        AZ::u64 m_schemaId;
+        AZStd::atomic<AZ::u64> m_frame{ 0 };
+
+        GetFrameThreadData m_threadDataGetter;
+        SetFrameThreadData m_threadDataSetter;
+        mutable AZStd::mutex m_threadsMutex;
+        AZStd::vector<FrameThreadData*> m_threads;  ///< All thread data, used to gather statistics and free the chunks.
+        AZStd::vector<FrameThreadData*> m_releasedThreads;  ///< Thread data of exited threads, reused by new threads.
+    };
+
+    /**
+     * Helper class to allow multiple frame allocators that operate independent from each other.
+     * Your frame allocator should use it as its schema, as we need a unique thread local variable for each allocator.
+     */
+    template<class Allocator>
+    class FrameSchemaHelper
+        : public FrameSchema
+    {
+    public:
+        FrameSchemaHelper(const Descriptor& desc = Descriptor())
+            : FrameSchema(desc, &GetFrameThreadData, &SetFrameThreadData)
+        {
+        }
+
+    protected:
+        static FrameThreadData* GetFrameThreadData(AZ::u64 schemaId)
+        {
+            return m_threadDataSchemaId == schemaId ? m_threadData : nullptr;
+        }
+
+        static void SetFrameThreadData(FrameThreadData* data, AZ::u64 schemaId)
+        {
+            m_threadData = data;
+            m_threadDataSchemaId = schemaId;
+        }
+
+        static AZ_THREAD_LOCAL FrameThreadData* m_threadData;
+        static AZ_THREAD_LOCAL AZ::u64 m_threadDataSchemaId;
+    };
+
+    template<class Allocator>
+    AZ_THREAD_LOCAL FrameThreadData* FrameSchemaHelper<Allocator>::m_threadData = nullptr;
+    template<class Allocator>
+    AZ_THREAD_LOCAL AZ::u64 FrameSchemaHelper<Allocator>::m_threadDataSchemaId = 0;
+}
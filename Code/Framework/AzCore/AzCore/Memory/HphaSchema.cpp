@@ -11,6 +11,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_set.h>
@@ -468,6 +469,55 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+        // Thread caches keep a few free blocks per bucket for every thread that uses the allocator, so most small
+        // allocations and frees don't touch the bucket locks. Blocks move between a cache and the buckets in batches.
+        // A cache is only ever used by the thread that created it, other threads only touch it under thread_cache_mutex().
+        static const size_t THREAD_CACHE_BIN_BYTES = 1024;
+        static const unsigned THREAD_CACHE_MIN_BIN_COUNT = 4;
+        static const unsigned THREAD_CACHE_MAX_BIN_COUNT = 64;
+        static const unsigned MAX_THREAD_CACHES_PER_THREAD = 8;
+        struct thread_cache
+        {
+            struct bin
+            {
+                free_link* mHead = nullptr;
+                unsigned mCount = 0;
+            };
+            // null once the owner was destroyed or the cache was detached, the thread then frees the cache lazily
+            AZStd::atomic<HpAllocator*> mOwner{ nullptr };
+            thread_cache* mPrev = nullptr;
+            thread_cache* mNext = nullptr;
+            // set by other threads to ask the thread to return its blocks on its next allocation or free
+            AZStd::atomic<bool> mFlushRequested{ false };
+            // only written by the thread using the cache, read when gathering statistics
+            AZStd::atomic<size_t> mHits{ 0 };
+            AZStd::atomic<size_t> mMisses{ 0 };
+            AZStd::atomic<size_t> mCachedBytes{ 0 };
+            bin mBins[NUM_BUCKETS];
+        };
+        // the caches created by one thread, returned to their allocators when the thread exits
+        struct thread_cache_registry
+        {
+            ~thread_cache_registry();
+            thread_cache* mCaches[MAX_THREAD_CACHES_PER_THREAD] = {};
+            bool mIsDestroyed = false;
+        };
+        static thread_local thread_cache_registry s_threadCacheRegistry;
+        static AZStd::mutex& thread_cache_mutex();
+        static unsigned thread_cache_bin_capacity(unsigned bi);
+        static void thread_cache_destroy(thread_cache* cache);
+        thread_cache* thread_cache_find();
+        thread_cache* thread_cache_get();
+        void* thread_cache_alloc(thread_cache& cache, unsigned bi);
+        void thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        void thread_cache_refill(thread_cache& cache, unsigned bi);
+        void thread_cache_release(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_flush(thread_cache& cache);
+        void thread_cache_flush_all();
+        void thread_cache_detach(thread_cache& cache);
+        void thread_cache_detach_all();
+        size_t thread_cache_bytes() const;
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -719,6 +769,11 @@ namespace AZ {
 
 #endif // DEBUG_ALLOCATOR
 
+        // guarded by thread_cache_mutex()
+        thread_cache* mThreadCaches = nullptr;
+        size_t mRetiredThreadCacheHits = 0;
+        size_t mRetiredThreadCacheMisses = 0;
+
         size_t mTotalAllocatedSizeBuckets = 0;
         size_t mTotalCapacitySizeBuckets = 0;
         size_t mTotalAllocatedSizeTree = 0;
@@ -1047,6 +1102,8 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Blocks sitting in thread caches keep their pages alive
+            thread_cache_flush_all();
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1063,9 +1120,12 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            // blocks held by thread caches are free as far as the user is concerned
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_bytes();
         }
 
+        void    GetThreadCacheHitCounts(size_t& hits, size_t& misses) const;
+
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
         size_t  AllocationSize(void* ptr);
         size_t  GetMaxAllocationSize() const;
@@ -1081,6 +1141,7 @@ namespace AZ {
         const size_t m_treePageAlignment;
         const size_t m_poolPageSize;
         bool         m_isPoolAllocations;
+        bool         m_isThreadCacheEnabled;
         IAllocatorAllocate* m_subAllocator;
 
 #if !defined (USE_MUTEX_PER_BUCKET)
@@ -1151,6 +1212,7 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+        m_isThreadCacheEnabled = desc.m_isPoolAllocations && desc.m_isThreadCacheEnabled;
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1176,6 +1238,8 @@ namespace AZ {
 
     HpAllocator::~HpAllocator()
     {
+        thread_cache_detach_all();
+
 #ifdef DEBUG_ALLOCATOR
         // Check if there are not-freed allocations
         report();
@@ -1344,6 +1408,13 @@ namespace AZ {
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (m_isThreadCacheEnabled)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                return thread_cache_alloc(*cache, bi);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1372,6 +1443,13 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (m_isThreadCacheEnabled)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                return thread_cache_alloc(*cache, bi);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1439,6 +1517,13 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (m_isThreadCacheEnabled)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                return thread_cache_free(*cache, ptr, bi);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1457,6 +1542,13 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (m_isThreadCacheEnabled)
+        {
+            if (thread_cache* cache = thread_cache_get())
+            {
+                return thread_cache_free(*cache, ptr, bi);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1571,6 +1663,332 @@ namespace AZ {
         }
     }
 
+    thread_local HpAllocator::thread_cache_registry HpAllocator::s_threadCacheRegistry;
+
+    HpAllocator::thread_cache_registry::~thread_cache_registry()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (thread_cache*& cache : mCaches)
+        {
+            if (cache)
+            {
+                if (HpAllocator* owner = cache->mOwner.load(AZStd::memory_order_relaxed))
+                {
+                    owner->thread_cache_detach(*cache);
+                }
+                thread_cache_destroy(cache);
+                cache = nullptr;
+            }
+        }
+        // allocations made by later thread local destructors go straight to the buckets
+        mIsDestroyed = true;
+    }
+
+    AZStd::mutex& HpAllocator::thread_cache_mutex()
+    {
+        // Never destroyed, allocators and threads can release their caches during static destruction
+        static AZStd::aligned_storage<sizeof(AZStd::mutex), alignof(AZStd::mutex)>::type s_mutexStorage;
+        static AZStd::mutex* s_mutex = new (&s_mutexStorage) AZStd::mutex();
+        return *s_mutex;
+    }
+
+    unsigned HpAllocator::thread_cache_bin_capacity(unsigned bi)
+    {
+        const size_t count = THREAD_CACHE_BIN_BYTES / bucket_spacing_function_inverse(bi);
+        return static_cast<unsigned>(AZStd::GetMax<size_t>(THREAD_CACHE_MIN_BIN_COUNT, AZStd::GetMin<size_t>(count, THREAD_CACHE_MAX_BIN_COUNT)));
+    }
+
+    void HpAllocator::thread_cache_destroy(thread_cache* cache)
+    {
+        // caches live in OS memory so they can outlive the allocator they cache for
+        cache->~thread_cache();
+        AZ_OS_FREE(cache);
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_find()
+    {
+        for (thread_cache* cache : s_threadCacheRegistry.mCaches)
+        {
+            if (cache && cache->mOwner.load(AZStd::memory_order_relaxed) == this)
+            {
+                return cache;
+            }
+        }
+        return nullptr;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get()
+    {
+        thread_cache_registry& registry = s_threadCacheRegistry;
+        thread_cache** freeSlot = nullptr;
+        for (thread_cache*& cache : registry.mCaches)
+        {
+            if (!cache || !cache->mOwner.load(AZStd::memory_order_relaxed))
+            {
+                freeSlot = freeSlot ? freeSlot : &cache;
+            }
+            else if (cache->mOwner.load(AZStd::memory_order_relaxed) == this)
+            {
+                return cache;
+            }
+        }
+
+        // if the thread already caches for too many allocators, allocate from the buckets directly
+        if (!freeSlot || registry.mIsDestroyed)
+        {
+            return nullptr;
+        }
+        if (*freeSlot)
+        {
+            // the allocator this cache belonged to is gone, nobody else references it anymore
+            thread_cache_destroy(*freeSlot);
+            *freeSlot = nullptr;
+        }
+
+        void* memory = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+        if (!memory)
+        {
+            return nullptr;
+        }
+        thread_cache* cache = new (memory) thread_cache();
+        cache->mOwner.store(this, AZStd::memory_order_relaxed);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+            cache->mNext = mThreadCaches;
+            if (mThreadCaches)
+            {
+                mThreadCaches->mPrev = cache;
+            }
+            mThreadCaches = cache;
+        }
+        *freeSlot = cache;
+        return cache;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        if (cache.mFlushRequested.load(AZStd::memory_order_relaxed))
+        {
+            thread_cache_flush(cache);
+        }
+
+        thread_cache::bin& bin = cache.mBins[bi];
+        if (bin.mHead)
+        {
+            cache.mHits.store(cache.mHits.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+        }
+        else
+        {
+            cache.mMisses.store(cache.mMisses.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+            thread_cache_refill(cache, bi);
+            if (!bin.mHead)
+            {
+                return nullptr;
+            }
+        }
+
+        free_link* lnk = bin.mHead;
+        bin.mHead = lnk->mNext;
+        bin.mCount--;
+        cache.mCachedBytes.store(cache.mCachedBytes.load(AZStd::memory_order_relaxed) - bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        return lnk;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi)
+    {
+        if (cache.mFlushRequested.load(AZStd::memory_order_relaxed))
+        {
+            thread_cache_flush(cache);
+        }
+
+        thread_cache::bin& bin = cache.mBins[bi];
+        const unsigned capacity = thread_cache_bin_capacity(bi);
+        if (bin.mCount >= capacity)
+        {
+            // keep half so alternating allocations and frees don't bounce blocks to the bucket
+            thread_cache_release(cache, bi, capacity / 2);
+        }
+
+        free_link* lnk = (free_link*)ptr;
+        lnk->mNext = bin.mHead;
+        bin.mHead = lnk;
+        bin.mCount++;
+        cache.mCachedBytes.store(cache.mCachedBytes.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi)
+    {
+        thread_cache::bin& bin = cache.mBins[bi];
+        const unsigned batchCount = thread_cache_bin_capacity(bi) / 2;
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        unsigned count = 0;
+        {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+            for (; count < batchCount; ++count)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* lnk = (free_link*)mBuckets[bi].alloc(p);
+                lnk->mNext = bin.mHead;
+                bin.mHead = lnk;
+            }
+            mTotalAllocatedSizeBuckets += count * elemSize;
+        }
+        bin.mCount += count;
+        cache.mCachedBytes.store(cache.mCachedBytes.load(AZStd::memory_order_relaxed) + count * elemSize, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        thread_cache::bin& bin = cache.mBins[bi];
+        HPPA_ASSERT(count <= bin.mCount);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        // update the cached bytes first so allocated() never sees the blocks counted as free twice
+        cache.mCachedBytes.store(cache.mCachedBytes.load(AZStd::memory_order_relaxed) - count * elemSize, AZStd::memory_order_relaxed);
+        bin.mCount -= count;
+
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        for (unsigned i = 0; i < count; ++i)
+        {
+            free_link* lnk = bin.mHead;
+            bin.mHead = lnk->mNext;
+            mBuckets[bi].free(ptr_get_page(lnk), lnk);
+        }
+        mTotalAllocatedSizeBuckets -= count * elemSize;
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache& cache)
+    {
+        cache.mFlushRequested.store(false, AZStd::memory_order_relaxed);
+        for (unsigned bi = 0; bi < NUM_BUCKETS; bi++)
+        {
+            if (cache.mBins[bi].mCount)
+            {
+                thread_cache_release(cache, bi, cache.mBins[bi].mCount);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_flush_all()
+    {
+        if (!m_isThreadCacheEnabled)
+        {
+            return;
+        }
+
+        // The calling thread returns its own blocks right away, other threads can't be touched while they may be
+        // using their caches so they are asked to return theirs on their next allocation or free
+        thread_cache* currentCache = thread_cache_find();
+        if (currentCache)
+        {
+            thread_cache_flush(*currentCache);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            if (cache != currentCache)
+            {
+                cache->mFlushRequested.store(true, AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_detach(thread_cache& cache)
+    {
+        // thread_cache_mutex() must be held
+        thread_cache_flush(cache);
+        mRetiredThreadCacheHits += cache.mHits.load(AZStd::memory_order_relaxed);
+        mRetiredThreadCacheMisses += cache.mMisses.load(AZStd::memory_order_relaxed);
+
+        if (cache.mPrev)
+        {
+            cache.mPrev->mNext = cache.mNext;
+        }
+        else
+        {
+            mThreadCaches = cache.mNext;
+        }
+        if (cache.mNext)
+        {
+            cache.mNext->mPrev = cache.mPrev;
+        }
+        cache.mPrev = nullptr;
+        cache.mNext = nullptr;
+        cache.mOwner.store(nullptr, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_detach_all()
+    {
+        if (!m_isThreadCacheEnabled)
+        {
+            return;
+        }
+
+        // No other thread may use the allocator anymore, so their caches can be flushed from here. The caches themselves
+        // are freed by their threads.
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        while (mThreadCaches)
+        {
+            thread_cache_detach(*mThreadCaches);
+        }
+    }
+
+    size_t HpAllocator::thread_cache_bytes() const
+    {
+        if (!m_isThreadCacheEnabled)
+        {
+            return 0;
+        }
+
+        size_t cachedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            cachedBytes += cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return cachedBytes;
+    }
+
+    void HpAllocator::GetThreadCacheHitCounts(size_t& hits, size_t& misses) const
+    {
+        hits = 0;
+        misses = 0;
+        if (!m_isThreadCacheEnabled)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        hits = mRetiredThreadCacheHits;
+        misses = mRetiredThreadCacheMisses;
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            hits += cache->mHits.load(AZStd::memory_order_relaxed);
+            misses += cache->mMisses.load(AZStd::memory_order_relaxed);
+        }
+    }
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
@@ -2698,6 +3116,15 @@ namespace AZ {
         return m_allocator->GetUnAllocatedMemory(isPrint);
     }
 
+    //=========================================================================
+    // GetThreadCacheHitCounts
+    //=========================================================================
+    void
+    HphaSchema::GetThreadCacheHitCounts(size_type& hits, size_type& misses) const
+    {
+        m_allocator->GetThreadCacheHitCounts(hits, misses);
+    }
+
     //=========================================================================
     // GarbageCollect
     // [2/22/2011]
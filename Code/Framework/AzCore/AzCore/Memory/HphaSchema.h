@@ -39,6 +39,7 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_isThreadCacheEnabled(false)
             {}
 
             unsigned int            m_fixedMemoryBlockAlignment;
@@ -50,6 +51,7 @@ namespace AZ
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            bool                    m_isThreadCacheEnabled;                 ///< True to keep per thread caches of free small blocks in front of the pools. Cached blocks are flushed on thread exit and GarbageCollect.
         };
 
 
@@ -68,6 +70,7 @@ namespace AZ
         size_type       GetMaxAllocationSize() const override;
         size_type       GetMaxContiguousAllocationSize() const override;
         size_type       GetUnAllocatedMemory(bool isPrint = false) const override;
+        void            GetThreadCacheHitCounts(size_type& hits, size_type& misses) const override;
         IAllocatorAllocate* GetSubAllocator() override                       { return m_desc.m_subAllocator; }
 
         /// Return unused memory to the OS (if we don't use fixed block). Don't call this unless you really need free memory, it is slow.
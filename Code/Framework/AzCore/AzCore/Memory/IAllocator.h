@@ -70,6 +70,8 @@ namespace AZ
          * that will be reported.
          */
         virtual size_type               GetUnAllocatedMemory(bool isPrint = false) const { (void)isPrint; return 0; }
+        /// Returns how many allocations were served by (hits) or had to refill (misses) per thread caches, 0 for allocators without thread caches.
+        virtual void                    GetThreadCacheHitCounts(size_type& hits, size_type& misses) const { hits = 0; misses = 0; }
         /// Returns a pointer to a sub-allocator or NULL.
         virtual IAllocatorAllocate*     GetSubAllocator() = 0;
     };
@@ -188,6 +188,11 @@ namespace AZ
         { 
             return m_schema->GetUnAllocatedMemory(isPrint);
         }
+
+        void GetThreadCacheHitCounts(size_type& hits, size_type& misses) const override
+        {
+            m_schema->GetThreadCacheHitCounts(hits, misses);
+        }
         
         IAllocatorAllocate* GetSubAllocator() override
         {
@@ -116,6 +116,7 @@ SystemAllocator::Create(const Descriptor& desc)
         }
         heapDesc.m_subAllocator = desc.m_heap.m_subAllocator;
         heapDesc.m_isPoolAllocations = desc.m_heap.m_isPoolAllocations;
+        heapDesc.m_isThreadCacheEnabled = desc.m_heap.m_isThreadCacheEnabled;
         // Fix SystemAllocator from growing in small chunks
         heapDesc.m_systemChunkSize = desc.m_heap.m_systemChunkSize;
 #elif AZCORE_SYSTEM_ALLOCATOR == AZCORE_SYSTEM_ALLOCATOR_MALLOC
@@ -62,6 +62,7 @@ namespace AZ
                     , m_numFixedMemoryBlocks(0)
                     , m_subAllocator(nullptr)
                     , m_systemChunkSize(0)
+                    , m_isThreadCacheEnabled(false)
                 {}
                 static const int        m_defaultPageSize = AZ_TRAIT_OS_DEFAULT_PAGE_SIZE;
                 static const int        m_defaultPoolPageSize = 4 * 1024;
@@ -75,6 +76,7 @@ namespace AZ
                 size_t                  m_fixedMemoryBlocksByteSize[m_maxNumFixedBlocks]; ///< Sizes of different memory blocks (MUST be multiple of m_pageSize), if m_memoryBlock is 0 the block will be allocated for you with the System Allocator.
                 IAllocatorAllocate*     m_subAllocator;                             ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
                 size_t                  m_systemChunkSize;                          ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
+                bool                    m_isThreadCacheEnabled;                     ///< True to serve small allocations from per thread caches before taking the pool locks, speeds up allocation heavy threads. (default false)
             }                           m_heap;
             bool                        m_allocationRecords;    ///< True if we want to track memory allocations, otherwise false.
             unsigned char               m_stackRecordLevels;    ///< If stack recording is enabled, how many stack levels to record.
@@ -105,6 +107,7 @@ namespace AZ
         size_type       GetMaxAllocationSize() const override    { return m_allocator->GetMaxAllocationSize(); }
         size_type       GetMaxContiguousAllocationSize() const override { return m_allocator->GetMaxContiguousAllocationSize(); }
         size_type       GetUnAllocatedMemory(bool isPrint = false) const override    { return m_allocator->GetUnAllocatedMemory(isPrint); }
+        void            GetThreadCacheHitCounts(size_type& hits, size_type& misses) const override { m_allocator->GetThreadCacheHitCounts(hits, misses); }
         IAllocatorAllocate*  GetSubAllocator() override          { return m_isCustom ? m_allocator : m_allocator->GetSubAllocator(); }
 
         //////////////////////////////////////////////////////////////////////////
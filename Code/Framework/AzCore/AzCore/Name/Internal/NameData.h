@@ -40,6 +40,10 @@ namespace AZ
             void add_ref();
             void release();
 
+            //! Takes a reference without holding a dictionary lock. Fails if the name data has been released by
+            //! the dictionary, in which case it may be waiting to be reused for another name.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
@@ -8,6 +8,7 @@
 
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
@@ -87,34 +88,97 @@ namespace AZ
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (const Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
-            else
+
+            for (Internal::NameData* nameData : shard.m_freeNameData)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                delete nameData;
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    void NameDictionary::Shard::LockShared() const
+    {
+        if (!m_sharedMutex.try_lock_shared())
+        {
+            m_contendedReads.fetch_add(1, AZStd::memory_order_relaxed);
+            m_sharedMutex.lock_shared();
+        }
+    }
+
+    void NameDictionary::Shard::Lock()
+    {
+        if (!m_sharedMutex.try_lock())
+        {
+            m_contendedWrites.fetch_add(1, AZStd::memory_order_relaxed);
+            m_sharedMutex.lock();
+        }
+    }
+
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash >> (32 - ShardBitCount)];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash >> (32 - ShardBitCount)];
+    }
+
+    Name NameDictionary::FindCachedName(const Shard& shard, Name::Hash hash) const
+    {
+        Internal::NameData* nameData = shard.m_lookupCache[hash & (LookupCacheSize - 1)].load(AZStd::memory_order_acquire);
+        // The entry may have been released and reused for another name since it was loaded, so it can only be
+        // inspected after successfully taking a reference, which keeps it from being released again.
+        if (nameData && nameData->TryAddRef())
+        {
+            Name name(nameData);
+            nameData->release(); // The reference is now held by name
+            if (name.GetHash() == hash)
+            {
+                return name;
+            }
+        }
+        return Name();
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        if (Name name = FindCachedName(shard, hash); !name.IsEmpty())
         {
+            return name;
+        }
+
+        shard.LockShared();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
+        {
+            // Entries can only be released while the shard is exclusively locked, so the entry can't be released while
+            // it's being added to the cache.
+            shard.m_lookupCache[hash & (LookupCacheSize - 1)].store(iter->second, AZStd::memory_order_release);
             return Name(iter->second);
         }
         return Name();
@@ -131,28 +195,49 @@ namespace AZ
         Name::Hash hash = CalcHash(nameString);
 
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
+        // This path is faster than the loop below because FindName() usually finds the name without
+        // locking, or otherwise takes a shared_lock, whereas the loop requires a unique_lock to modify the dictionary.
         Name name = FindName(hash);
         if (name.GetStringView() == nameString)
         {
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock and add it. Entries that are skipped
+        // because of a hash collision are never removed, so it's safe to lock only one shard at a time while
+        // probing the following hashes.
         bool collisionDetected = false;
         while (true)
         {
+            Shard& shard = GetShard(hash);
+            shard.Lock();
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+
+            auto iter = shard.m_dictionary.find(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
-                nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
-                return Name(nameData);
+                Internal::NameData* nameData = nullptr;
+                if (!shard.m_freeNameData.empty())
+                {
+                    // Readers without a lock can't take a reference while the use count is negative, so the released
+                    // entry can be updated before it's made available again by resetting the use count.
+                    nameData = shard.m_freeNameData.back();
+                    shard.m_freeNameData.pop_back();
+                    nameData->m_name = nameString;
+                    nameData->m_hash = hash;
+                    nameData->m_hashCollision = collisionDetected;
+                    nameData->m_useCount.store(0, AZStd::memory_order_release);
+                }
+                else
+                {
+                    nameData = aznew Internal::NameData(nameString, hash);
+                    nameData->m_hashCollision = collisionDetected;
+                }
+                shard.m_dictionary.emplace(hash, nameData);
+                Name name(nameData);
+                shard.m_lookupCache[hash & (LookupCacheSize - 1)].store(nameData, AZStd::memory_order_release);
+                return name;
             }
             // Found the desired entry, return it
             else if (iter->second->GetName() == nameString)
@@ -165,7 +250,6 @@ namespace AZ
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -184,40 +268,51 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
         {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
-            return;
-        }
+            Shard& shard = GetShard(hash);
+            shard.Lock();
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+
+            auto dictIt = shard.m_dictionary.find(hash);
+            if (dictIt == shard.m_dictionary.end())
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
 
-        Internal::NameData* nameData = dictIt->second;
+            Internal::NameData* nameData = dictIt->second;
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
-        {
-            return;
-        }
+            // Check m_hashCollision inside the shard's lock because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.m_dictionary.erase(nameData->GetHash());
+
+                // Readers without a lock may still be looking at the entry, so instead of deleting it, it's kept for
+                // reuse. The string is released as it's not needed anymore.
+                Internal::NameData* expectedCacheEntry = nameData;
+                shard.m_lookupCache[hash & (LookupCacheSize - 1)].compare_exchange_strong(expectedCacheEntry, nullptr);
+                AZStd::string().swap(nameData->m_name);
+                shard.m_freeNameData.push_back(nameData);
+            }
         }
 
+        // Reporting looks at all shards, so it's done after releasing the lock
         ReportStats();
     }
 
@@ -236,34 +331,41 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            for (const Shard& shard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
-
-                if (!longestName || longestName->m_name.size() < nameLength)
+                shard.LockShared();
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+                nameCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = iter.second;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = iter.second;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = iter.second;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -286,6 +388,30 @@ namespace AZ
 #endif // AZ_DEBUG_BUILD
     }
 
+    NameDictionary::Statistics NameDictionary::GetStatistics() const
+    {
+        Statistics statistics;
+        for (const Shard& shard : m_shards)
+        {
+            {
+                shard.LockShared();
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+                statistics.m_nameCount += shard.m_dictionary.size();
+            }
+            statistics.m_contendedReads += shard.m_contendedReads.load(AZStd::memory_order_relaxed);
+            statistics.m_contendedWrites += shard.m_contendedWrites.load(AZStd::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
+    void NameDictionary::RecordStatistics() const
+    {
+        [[maybe_unused]] const Statistics statistics = GetStatistics();
+        AZ_PROFILE_DATAPOINT(AzCore, statistics.m_nameCount, "NameDictionary/Names");
+        AZ_PROFILE_DATAPOINT(AzCore, statistics.m_contendedReads, "NameDictionary/Contended reads");
+        AZ_PROFILE_DATAPOINT(AzCore, statistics.m_contendedWrites, "NameDictionary/Contended writes");
+    }
+
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
         // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
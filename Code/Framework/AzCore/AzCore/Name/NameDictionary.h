@@ -9,8 +9,10 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -43,6 +45,10 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! The dictionary is split into shards by hash, each with its own lock, so threads creating or
+    //! looking up different names rarely wait on each other. Names that already exist are usually
+    //! found without taking a lock at all, see Shard::m_lookupCache.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -75,12 +81,53 @@ namespace AZ
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
 
+        struct Statistics
+        {
+            //! The number of unique names in the dictionary.
+            size_t m_nameCount = 0;
+            //! The number of times a thread had to wait to look up a name.
+            uint64_t m_contendedReads = 0;
+            //! The number of times a thread had to wait to add or release a name.
+            uint64_t m_contendedWrites = 0;
+        };
+
+        //! Returns the number of names and how often threads had to wait for each other since the dictionary was created.
+        Statistics GetStatistics() const;
+
+        //! Sends the dictionary statistics to the active profiler.
+        void RecordStatistics() const;
+
     private:
+        static constexpr uint32_t ShardBitCount = 6;
+        static constexpr uint32_t ShardCount = 1 << ShardBitCount;
+        static constexpr uint32_t LookupCacheSize = 256;
+
+        // Each shard starts on its own cache line so threads using different shards don't interfere.
+        struct alignas(64) Shard
+        {
+            void LockShared() const;
+            void Lock();
+
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            // Direct mapped cache of dictionary entries, indexed by the lower bits of the hash, that is read without
+            // locking. Released entries are never deleted while the dictionary exists, but are kept in m_freeNameData
+            // and reused for new names in this shard. A reader that loaded a stale entry can therefore always safely
+            // try to take a reference to it, and checks the hash once it holds one.
+            mutable AZStd::atomic<Internal::NameData*> m_lookupCache[LookupCacheSize] = {};
+            AZStd::vector<Internal::NameData*> m_freeNameData;
+            mutable AZStd::shared_mutex m_sharedMutex;
+            mutable AZStd::atomic<uint64_t> m_contendedReads{ 0 };
+            AZStd::atomic<uint64_t> m_contendedWrites{ 0 };
+        };
+
         NameDictionary();
         ~NameDictionary();
 
         void ReportStats() const;
 
+        // Looks up the hash in the lock-free cache. Returns an empty name if it isn't cached.
+        Name FindCachedName(const Shard& shard, Name::Hash hash) const;
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
@@ -94,7 +141,11 @@ namespace AZ
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
 
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        // Shards are selected by the upper bits of the hash, so names that are moved to the next hash to resolve
+        // a collision almost always stay in the same shard.
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        Shard m_shards[ShardCount];
     };
 }
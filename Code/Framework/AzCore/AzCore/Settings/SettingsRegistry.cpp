@@ -94,6 +94,34 @@ namespace AZ
         return index < m_names.size() ? m_names[index] : AZStd::string_view();
     }
 
+    SettingsRegistryInterface::Key::Key(AZStd::string_view path)
+        : m_path(path)
+    {
+    }
+
+    SettingsRegistryInterface::Key::Key(const Key& rhs)
+        : m_path(rhs.m_path)
+        , m_handle(rhs.m_handle.load(AZStd::memory_order_relaxed))
+    {
+    }
+
+    auto SettingsRegistryInterface::Key::operator=(const Key& rhs) -> Key&
+    {
+        m_path = rhs.m_path;
+        m_handle.store(rhs.m_handle.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        return *this;
+    }
+
+    AZStd::string_view SettingsRegistryInterface::Key::GetPath() const
+    {
+        return m_path;
+    }
+
+    AZStd::atomic<u64>& SettingsRegistryInterface::Key::GetHandle() const
+    {
+        return m_handle;
+    }
+
     SettingsRegistryInterface::CommandLineArgumentSettings::CommandLineArgumentSettings()
     {
         m_delimiterFunc = [](AZStd::string_view line) -> JsonPathValue
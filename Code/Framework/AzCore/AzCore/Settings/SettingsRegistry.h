@@ -16,6 +16,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -83,6 +84,31 @@ namespace AZ
             AZStd::fixed_vector<size_t, MaxCount> m_hashes;
         };
 
+        //! A path that is parsed once and then reused for every lookup made with it.
+        //! Create keys for paths that are queried repeatedly, for instance every frame, and keep them around.
+        //! Lookups of boolean, integer and floating point values through a key don't take the lock of the registry
+        //! as long as the registry hasn't been modified since the value was last read through a key with the same path.
+        //! A key can be shared between threads and binds to the registry it was last used with.
+        class Key
+        {
+        public:
+            Key() = default;
+            //! The path is copied, so it doesn't need to outlive the key.
+            explicit Key(AZStd::string_view path);
+            Key(const Key& rhs);
+            Key& operator=(const Key& rhs);
+
+            AZStd::string_view GetPath() const;
+
+            //! Identifies the resolved path within the registry the key was last used with.
+            //! Only meaningful to the Settings Registry implementation.
+            AZStd::atomic<u64>& GetHandle() const;
+
+        private:
+            FixedValueString m_path;
+            mutable AZStd::atomic<u64> m_handle{ 0 };
+        };
+
         //! Type of the store value, or None if there's no value stored.
         enum class Type
         {
@@ -259,6 +285,18 @@ namespace AZ
         template<typename T>
         bool GetObject(T& result, AZStd::string_view path) const { return GetObject(&result, azrtti_typeid(result), path); }
 
+        //! Gets the value at the path of the key, see Key.
+        //! The default implementations look up the path of the key as a string.
+        //! @param result The target to write the result to.
+        //! @param key The key for the path to the value.
+        //! @return Whether or not the value was retrieved. An invalid path or type-mismatch will return false;
+        virtual bool Get(bool& result, const Key& key) const { return Get(result, key.GetPath()); }
+        virtual bool Get(s64& result, const Key& key) const { return Get(result, key.GetPath()); }
+        virtual bool Get(u64& result, const Key& key) const { return Get(result, key.GetPath()); }
+        virtual bool Get(double& result, const Key& key) const { return Get(result, key.GetPath()); }
+        virtual bool Get(AZStd::string& result, const Key& key) const { return Get(result, key.GetPath()); }
+        virtual bool Get(FixedValueString& result, const Key& key) const { return Get(result, key.GetPath()); }
+
         //! Sets or replaces the boolean value at the provided path.
         //! @param path The path to the value.
         //! @param value The new value to store.
@@ -13,6 +13,7 @@
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/JSON/error/en.h>
+#include <AzCore/Module/Environment.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
@@ -47,6 +48,15 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    // Returns a new id for a registry, starting at 1 so a default constructed key never matches a registry. The last id is stored in
+    // the environment, so registries created by modules with their own copy of AzCore never get the same id.
+    static AZ::u32 MakeKeyRegistryId()
+    {
+        static AZ::EnvironmentVariable<AZStd::atomic<AZ::u32>> s_lastKeyRegistryId =
+            AZ::Environment::CreateVariable<AZStd::atomic<AZ::u32>>("SettingsRegistryLastKeyRegistryId", 0u);
+        return ++(*s_lastKeyRegistryId);
+    }
 }
 
 namespace AZ
@@ -88,6 +98,7 @@ namespace AZ
                 static_assert(!AZStd::is_same_v<T, T>, "SettingsRegistryImpl::SetValueInternal called with unsupported type.");
             }
 
+            IncrementSettingsGeneration();
             return true;
         }
         return false;
@@ -155,7 +166,100 @@ namespace AZ
         return false;
     }
 
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, const Key& key) const
+    {
+        if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+        {
+            // Strings aren't cached, but the path is only parsed once
+            AZStd::scoped_lock lock(m_settingMutex);
+            const KeySlot* slot = ResolveKeySlot(key);
+            if (!slot)
+            {
+                return GetValueInternal(result, key.GetPath());
+            }
+            const rapidjson::Value* value = slot->m_pointer.IsValid() ? slot->m_pointer.Get(m_settings) : nullptr;
+            if (value && value->IsString())
+            {
+                result.append(value->GetString(), value->GetStringLength());
+                return true;
+            }
+            return false;
+        }
+        else
+        {
+            u32 flags = 0;
+            u64 bits = 0;
+            bool isCached = false;
+            if (const KeySlot* slot = FindKeySlot(key); slot)
+            {
+                const u64 generation = m_settingsGeneration.load(AZStd::memory_order_acquire);
+                const u32 sequence = slot->m_sequence.load(AZStd::memory_order_acquire);
+                if ((sequence & 1) == 0)
+                {
+                    flags = slot->m_flags.load(AZStd::memory_order_relaxed);
+                    bits = slot->m_value.load(AZStd::memory_order_relaxed);
+                    const u64 slotGeneration = slot->m_generation.load(AZStd::memory_order_relaxed);
+                    AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                    isCached = slot->m_sequence.load(AZStd::memory_order_relaxed) == sequence && slotGeneration == generation;
+                }
+            }
+
+            if (!isCached)
+            {
+                AZStd::scoped_lock lock(m_settingMutex);
+                KeySlot* slot = ResolveKeySlot(key);
+                if (!slot)
+                {
+                    return GetValueInternal(result, key.GetPath());
+                }
+                UpdateKeySlot(*slot);
+                flags = slot->m_flags.load(AZStd::memory_order_relaxed);
+                bits = slot->m_value.load(AZStd::memory_order_relaxed);
+            }
+
+            if constexpr (AZStd::is_same_v<T, bool>)
+            {
+                if (flags & KeySlot::IsBool)
+                {
+                    result = bits != 0;
+                    return true;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<T, s64>)
+            {
+                if (flags & KeySlot::IsInt64)
+                {
+                    result = static_cast<s64>(bits);
+                    return true;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<T, u64>)
+            {
+                if (flags & KeySlot::IsUint64)
+                {
+                    result = bits;
+                    return true;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<T, double>)
+            {
+                if (flags & KeySlot::IsDouble)
+                {
+                    memcpy(&result, &bits, sizeof(result));
+                    return true;
+                }
+            }
+            else
+            {
+                static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
+            }
+            return false;
+        }
+    }
+
     SettingsRegistryImpl::SettingsRegistryImpl()
+        : m_keyRegistryId(SettingsRegistryImplInternal::MakeKeyRegistryId())
     {
         m_serializationSettings.m_keepDefaults = true;
 
@@ -437,6 +541,134 @@ namespace AZ
         return false;
     }
 
+    bool SettingsRegistryImpl::Get(bool& result, const Key& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(s64& result, const Key& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(u64& result, const Key& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(double& result, const Key& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(AZStd::string& result, const Key& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(FixedValueString& result, const Key& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    auto SettingsRegistryImpl::FindKeySlot(const Key& key) const -> const KeySlot*
+    {
+        // The handle stores the id of the registry that resolved the key in the upper half and the slot index + 1 in the lower half
+        const u64 handle = key.GetHandle().load(AZStd::memory_order_acquire);
+        if (static_cast<u32>(handle >> 32) != m_keyRegistryId)
+        {
+            return nullptr;
+        }
+        const size_t index = static_cast<u32>(handle) - 1;
+        const KeySlotBlock* block = m_keySlotBlocks[index / KeySlotsPerBlock].load(AZStd::memory_order_acquire);
+        return &(*block)[index % KeySlotsPerBlock];
+    }
+
+    auto SettingsRegistryImpl::ResolveKeySlot(const Key& key) const -> KeySlot*
+    {
+        if (const KeySlot* slot = FindKeySlot(key); slot)
+        {
+            // Slots are only modified while m_settingMutex is locked, which the caller holds
+            return const_cast<KeySlot*>(slot);
+        }
+
+        size_t index = 0;
+        if (auto indexIt = m_keySlotIndices.find(AZStd::string(key.GetPath())); indexIt != m_keySlotIndices.end())
+        {
+            index = indexIt->second;
+        }
+        else
+        {
+            index = m_keySlotIndices.size();
+            if (index >= KeySlotsPerBlock * MaxKeySlotBlocks)
+            {
+                AZ_Warning("Settings Registry", false, R"(Too many keys to cache "%.*s", the key will be looked up by its path instead.)",
+                    AZ_STRING_ARG(key.GetPath()));
+                return nullptr;
+            }
+
+            if (index % KeySlotsPerBlock == 0)
+            {
+                m_keySlotStorage.emplace_back(AZStd::make_unique<KeySlotBlock>());
+                m_keySlotBlocks[index / KeySlotsPerBlock].store(m_keySlotStorage.back().get(), AZStd::memory_order_release);
+            }
+
+            AZStd::string_view path = key.GetPath().empty() ? AZStd::string_view("") : key.GetPath();
+            KeySlot& slot = (*m_keySlotStorage[index / KeySlotsPerBlock])[index % KeySlotsPerBlock];
+            slot.m_pointer = rapidjson::Pointer(path.data(), path.length());
+            m_keySlotIndices.emplace(AZStd::string(key.GetPath()), aznumeric_cast<u32>(index));
+        }
+
+        key.GetHandle().store((static_cast<u64>(m_keyRegistryId) << 32) | (index + 1), AZStd::memory_order_release);
+        return &(*m_keySlotStorage[index / KeySlotsPerBlock])[index % KeySlotsPerBlock];
+    }
+
+    void SettingsRegistryImpl::UpdateKeySlot(KeySlot& slot) const
+    {
+        const u64 generation = m_settingsGeneration.load(AZStd::memory_order_relaxed);
+        if (slot.m_generation.load(AZStd::memory_order_relaxed) == generation)
+        {
+            return;
+        }
+
+        u32 flags = 0;
+        u64 bits = 0;
+        if (const rapidjson::Value* value = slot.m_pointer.IsValid() ? slot.m_pointer.Get(m_settings) : nullptr; value)
+        {
+            if (value->IsBool())
+            {
+                flags = KeySlot::IsBool;
+                bits = value->GetBool() ? 1 : 0;
+            }
+            else if (value->IsDouble())
+            {
+                flags = KeySlot::IsDouble;
+                const double doubleValue = value->GetDouble();
+                memcpy(&bits, &doubleValue, sizeof(bits));
+            }
+            else if (value->IsNumber())
+            {
+                // Values between 0 and INT64_MAX are both, in which case both representations are the same
+                flags = (value->IsInt64() ? KeySlot::IsInt64 : 0) | (value->IsUint64() ? KeySlot::IsUint64 : 0);
+                bits = value->IsUint64() ? value->GetUint64() : static_cast<u64>(value->GetInt64());
+            }
+        }
+
+        // Write the value under the sequence lock, so readers without the lock never see a partially updated slot
+        const u32 sequence = slot.m_sequence.load(AZStd::memory_order_relaxed);
+        slot.m_sequence.store(sequence + 1, AZStd::memory_order_relaxed);
+        AZStd::atomic_thread_fence(AZStd::memory_order_release);
+        slot.m_flags.store(flags, AZStd::memory_order_relaxed);
+        slot.m_value.store(bits, AZStd::memory_order_relaxed);
+        slot.m_generation.store(generation, AZStd::memory_order_relaxed);
+        slot.m_sequence.store(sequence + 2, AZStd::memory_order_release);
+    }
+
+    void SettingsRegistryImpl::IncrementSettingsGeneration()
+    {
+        m_settingsGeneration.fetch_add(1, AZStd::memory_order_release);
+    }
+
     bool SettingsRegistryImpl::Set(AZStd::string_view path, bool value)
     {
         if (AZStd::scoped_lock lock(m_settingMutex); !SetValueInternal(path, value))
@@ -516,6 +748,7 @@ namespace AZ
                     rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                     setting = AZStd::move(store);
                     anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(setting);
+                    IncrementSettingsGeneration();
                 }
                 SignalNotifier(path, anchorType);
                 return true;
@@ -540,7 +773,12 @@ namespace AZ
         }
 
         AZStd::scoped_lock lock(m_settingMutex);
-        return pointerPath.Erase(m_settings);
+        if (!pointerPath.Erase(m_settings))
+        {
+            return false;
+        }
+        IncrementSettingsGeneration();
+        return true;
     }
 
     bool SettingsRegistryImpl::MergeCommandLineArgument(AZStd::string_view argument, AZStd::string_view rootKey,
@@ -673,6 +911,7 @@ namespace AZ
                     .AddMember(rapidjson::StringRef("Path"),
                     rapidjson::Value(anchorKey.data(), aznumeric_caster(anchorKey.size()), m_settings.GetAllocator()),
                     m_settings.GetAllocator());
+                IncrementSettingsGeneration();
                 return false;
             }
         }
@@ -685,6 +924,7 @@ namespace AZ
 
             JsonSerializationResult::ResultCode mergeResult =
                 JsonSerialization::ApplyPatch(anchorRoot, m_settings.GetAllocator(), jsonPatch, mergeApproach);
+            IncrementSettingsGeneration();
             if (mergeResult.GetProcessing() != JsonSerializationResult::Processing::Completed)
             {
                 AZ_Error("Settings Registry", false, "Failed to fully merge data into registry.");
@@ -736,6 +976,7 @@ namespace AZ
                 pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                     .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                     .AddMember(StringRef("Path"), AZStd::move(pathValue), m_settings.GetAllocator());
+                IncrementSettingsGeneration();
                 return false;
             }
             AZ::IO::FixedMaxPathString filePath(path);
@@ -781,6 +1022,7 @@ namespace AZ
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Folder path for the Setting Registry is too long."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path.data(), aznumeric_caster(path.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
+            IncrementSettingsGeneration();
             return false;
         }
 
@@ -802,6 +1044,7 @@ namespace AZ
         pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
             .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.Native().size()), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
+        IncrementSettingsGeneration();
 
 
         auto CreateSettingsFindCallback = [this, &fileList, &specializations, &pointer, &folderPath](bool isPlatformFile)
@@ -818,6 +1061,7 @@ namespace AZ
                             .AddMember(StringRef("Error"), StringRef("Too many files in registry folder."), m_settings.GetAllocator())
                             .AddMember(StringRef("Path"), Value(folderPath.c_str(), aznumeric_caster(folderPath.Native().size()), m_settings.GetAllocator()), m_settings.GetAllocator())
                             .AddMember(StringRef("File"), Value(filename.data(), aznumeric_caster(filename.size()), m_settings.GetAllocator()), m_settings.GetAllocator());
+                        IncrementSettingsGeneration();
                         return false;
                     }
 
@@ -1082,6 +1326,7 @@ namespace AZ
                 Value(folderPath.data(), aznumeric_caster(folderPath.length()), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("File1"), Value(lhs.m_relativePath.c_str(), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("File2"), Value(rhs.m_relativePath.c_str(), m_settings.GetAllocator()), m_settings.GetAllocator());
+        IncrementSettingsGeneration();
         return false;
     }
 
@@ -1186,6 +1431,7 @@ namespace AZ
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+            IncrementSettingsGeneration();
             return false;
         }
 
@@ -1197,6 +1443,7 @@ namespace AZ
                 .SetObject()
                 .AddMember(StringRef("Error"), StringRef("registry file is 0 bytes."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+            IncrementSettingsGeneration();
             return false;
         }
 
@@ -1208,6 +1455,7 @@ namespace AZ
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+            IncrementSettingsGeneration();
             return false;
         }
         scratchBuffer[fileSize] = 0;
@@ -1242,6 +1490,7 @@ namespace AZ
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator())
                 .AddMember(StringRef("Message"), StringRef(GetParseError_En(jsonPatch.GetParseError())), m_settings.GetAllocator())
                 .AddMember(StringRef("Offset"), aznumeric_cast<uint64_t>(jsonPatch.GetErrorOffset()), m_settings.GetAllocator());
+            IncrementSettingsGeneration();
             return false;
         }
 
@@ -1268,6 +1517,7 @@ namespace AZ
                         " an empty root key and a merge approach of JsonMergePatch. Otherwise the Settings Registry would be overridden."
                         " See RFC 7386 for more information"), m_settings.GetAllocator())
                     .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+                IncrementSettingsGeneration();
                 return false;
             }
             break;
@@ -1284,6 +1534,7 @@ namespace AZ
         {
             AZStd::scoped_lock lock(m_settingMutex);
             mergeResult = JsonSerialization::ApplyPatch(m_settings, m_settings.GetAllocator(), jsonPatch, mergeApproach, m_applyPatchSettings);
+            IncrementSettingsGeneration();
             anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(m_settings);
         }
         else
@@ -1294,6 +1545,7 @@ namespace AZ
                 AZStd::scoped_lock lock(m_settingMutex);
                 Value& rootValue = root.Create(m_settings, m_settings.GetAllocator());
                 mergeResult = JsonSerialization::ApplyPatch(rootValue, m_settings.GetAllocator(), jsonPatch, mergeApproach, m_applyPatchSettings);
+                IncrementSettingsGeneration();
                 anchorType = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(rootValue);
             }
             else
@@ -1304,6 +1556,7 @@ namespace AZ
                 pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                     .AddMember(StringRef("Error"), StringRef("Invalid root key."), m_settings.GetAllocator())
                     .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+                IncrementSettingsGeneration();
                 return false;
             }
         }
@@ -1314,12 +1567,14 @@ namespace AZ
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Failed to fully merge registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+            IncrementSettingsGeneration();
             return false;
         }
 
         {
             AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetString(path, m_settings.GetAllocator());
+            IncrementSettingsGeneration();
         }
 
         SignalNotifier(rootKey, anchorType);
@@ -14,9 +14,13 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
@@ -66,6 +70,13 @@ namespace AZ
         bool Get(SettingsRegistryInterface::FixedValueString& result, AZStd::string_view path) const override;
         bool GetObject(void* result, Uuid resultTypeID, AZStd::string_view path) const override;
 
+        bool Get(bool& result, const Key& key) const override;
+        bool Get(s64& result, const Key& key) const override;
+        bool Get(u64& result, const Key& key) const override;
+        bool Get(double& result, const Key& key) const override;
+        bool Get(AZStd::string& result, const Key& key) const override;
+        bool Get(SettingsRegistryInterface::FixedValueString& result, const Key& key) const override;
+
         bool Set(AZStd::string_view path, bool value) override;
         bool Set(AZStd::string_view path, s64 value) override;
         bool Set(AZStd::string_view path, u64 value) override;
@@ -104,6 +115,8 @@ namespace AZ
         bool SetValueInternal(AZStd::string_view path, T value);
         template<typename T>
         bool GetValueInternal(T& result, AZStd::string_view path) const;
+        template<typename T>
+        bool GetValueInternal(T& result, const Key& key) const;
         VisitResponse Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
             const rapidjson::Value& value) const;
 
@@ -114,6 +127,38 @@ namespace AZ
         bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
 
         void SignalNotifier(AZStd::string_view jsonPath, Type type);
+
+        //! The parsed path shared by all keys with the same path, and a copy of the scalar value it pointed to when last read.
+        struct KeySlot
+        {
+            enum ValueFlags : u32
+            {
+                IsBool = 1 << 0,
+                IsInt64 = 1 << 1,
+                IsUint64 = 1 << 2,
+                IsDouble = 1 << 3,
+            };
+
+            rapidjson::Pointer m_pointer;
+            // Sequence lock for the cached value, odd while the value is being updated. Only updated under m_settingMutex.
+            AZStd::atomic<u32> m_sequence{ 0 };
+            AZStd::atomic<u32> m_flags{ 0 };
+            //! The value of m_settingsGeneration when the value was cached.
+            AZStd::atomic<u64> m_generation{ 0 };
+            AZStd::atomic<u64> m_value{ 0 };
+        };
+        static constexpr size_t KeySlotsPerBlock = 256;
+        static constexpr size_t MaxKeySlotBlocks = 256;
+        using KeySlotBlock = AZStd::array<KeySlot, KeySlotsPerBlock>;
+
+        //! Returns the slot of a key that was already resolved by this registry, without locking.
+        const KeySlot* FindKeySlot(const Key& key) const;
+        //! Returns the slot for the path of the key, creating it if needed. Must be called with m_settingMutex locked.
+        KeySlot* ResolveKeySlot(const Key& key) const;
+        //! Caches the current scalar value of the slot. Must be called with m_settingMutex locked.
+        void UpdateKeySlot(KeySlot& slot) const;
+        //! Invalidates the values cached by the keys. Must be called with m_settingMutex locked after every change to m_settings.
+        void IncrementSettingsGeneration();
         
         mutable AZStd::recursive_mutex m_settingMutex;
         mutable AZStd::recursive_mutex m_notifierMutex;
@@ -135,6 +180,16 @@ namespace AZ
         AZStd::atomic_int m_signalCount{};
 
         rapidjson::Document m_settings;
+
+        // Incremented on every change to m_settings, the key slots cached for an older generation are out of date.
+        AZStd::atomic<u64> m_settingsGeneration{ 1 };
+        // Tells keys resolved by this registry apart from keys resolved by other registries.
+        const u32 m_keyRegistryId;
+        // Key slots are allocated in blocks that are published through m_keySlotBlocks, so they can be read without locking.
+        mutable AZStd::array<AZStd::atomic<KeySlotBlock*>, MaxKeySlotBlocks> m_keySlotBlocks{};
+        // Guarded by m_settingMutex.
+        mutable AZStd::vector<AZStd::unique_ptr<KeySlotBlock>> m_keySlotStorage;
+        mutable AZStd::unordered_map<AZStd::string, u32> m_keySlotIndices;
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         JsonApplyPatchSettings m_applyPatchSettings;
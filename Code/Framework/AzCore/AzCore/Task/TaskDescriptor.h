@@ -42,6 +42,11 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // Relative cost of running a task of this kind, used to compute the critical path of a task graph. Among ready
+        // tasks of the same priority, tasks with the longest remaining (cost weighted) path to the end of the graph are
+        // preferred. The default cost of 1 weights every task equally
+        uint16_t cost = 1;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
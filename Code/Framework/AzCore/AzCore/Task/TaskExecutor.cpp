@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
@@ -16,6 +17,7 @@
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Module/Environment.h>
 
@@ -52,7 +54,85 @@ namespace AZ
                 }
             }
 
-            // TODO: Check for dependency cycles
+            // Order the tasks topologically to check for dependency cycles. Tasks that are left with unresolved
+            // dependencies are either part of a cycle or depend on a task that is.
+            const uint32_t taskCount = aznumeric_cast<uint32_t>(m_tasks.size());
+            AZStd::vector<uint32_t> order;
+            order.reserve(taskCount);
+            AZStd::vector<uint32_t> dependencyCounts(taskCount);
+            for (uint32_t i = 0; i != taskCount; ++i)
+            {
+                dependencyCounts[i] = m_tasks[i].m_inboundLinkCount;
+                if (dependencyCounts[i] == 0)
+                {
+                    order.push_back(i);
+                }
+            }
+
+            for (size_t i = 0; i != order.size(); ++i)
+            {
+                const Task& task = m_tasks[order[i]];
+                for (uint32_t j = 0; j != task.m_outboundLinkCount; ++j)
+                {
+                    uint32_t successor = static_cast<uint32_t>(m_successors[task.m_successorOffset + j] - m_tasks.data());
+                    if (--dependencyCounts[successor] == 0)
+                    {
+                        order.push_back(successor);
+                    }
+                }
+            }
+
+            if (order.size() != taskCount)
+            {
+                m_hasDependencyCycle = true;
+                for (uint32_t i = 0; i != taskCount; ++i)
+                {
+                    if (dependencyCounts[i] != 0)
+                    {
+                        AZ_Error(
+                            "TaskGraph", false,
+                            "TaskGraph contains a dependency cycle. %zu tasks are part of or depend on a cycle, including task \"%s\".",
+                            taskCount - order.size(), m_tasks[i].m_descriptor.taskName ? m_tasks[i].m_descriptor.taskName : "");
+                        break;
+                    }
+                }
+                return;
+            }
+
+            // The critical path of a task is its own cost plus the longest critical path of any of its successors, which
+            // is computed by visiting the tasks in reverse topological order.
+            AZStd::vector<uint64_t> criticalPaths(taskCount);
+            for (auto it = order.rbegin(); it != order.rend(); ++it)
+            {
+                const Task& task = m_tasks[*it];
+                uint64_t longestSuccessorPath = 0;
+                for (uint32_t j = 0; j != task.m_outboundLinkCount; ++j)
+                {
+                    size_t successor = m_successors[task.m_successorOffset + j] - m_tasks.data();
+                    longestSuccessorPath = AZStd::max(longestSuccessorPath, criticalPaths[successor]);
+                }
+                criticalPaths[*it] = task.m_descriptor.cost + longestSuccessorPath;
+            }
+
+            // Sort the roots and the successors of every task so tasks on the longest remaining path are released first.
+            // Ties are broken by the order in which tasks were added to keep the scheduling order deterministic.
+            auto longerCriticalPath = [this, &criticalPaths](const Task* lhs, const Task* rhs)
+            {
+                uint64_t lhsPath = criticalPaths[lhs - m_tasks.data()];
+                uint64_t rhsPath = criticalPaths[rhs - m_tasks.data()];
+                return lhsPath != rhsPath ? lhsPath > rhsPath : lhs < rhs;
+            };
+
+            for (Task& task : m_tasks)
+            {
+                if (task.IsRoot())
+                {
+                    m_roots.push_back(&task);
+                }
+                Task** successors = m_successors.data() + task.m_successorOffset;
+                AZStd::sort(successors, successors + task.m_outboundLinkCount, longerCriticalPath);
+            }
+            AZStd::sort(m_roots.begin(), m_roots.end(), longerCriticalPath);
         }
 
         uint32_t CompiledTaskGraph::Release()
@@ -112,7 +192,11 @@ namespace AZ
             TaskQueue& operator=(const TaskQueue&) = delete;
 
             void Enqueue(Task* task);
+            // Dequeues the task with the highest priority
             Task* TryDequeue();
+            Task* TryDequeue(uint8_t priority);
+            // Can be called from any thread, the result is only a snapshot
+            bool HasTasks() const;
 
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
@@ -161,32 +245,149 @@ namespace AZ
 
         Task* TaskQueue::TryDequeue()
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                if (Task* task = TryDequeue(priority); task)
+                {
+                    return task;
+                }
+            }
+
+            return nullptr;
+        }
+
+        Task* TaskQueue::TryDequeue(uint8_t priority)
+        {
+            QueueStatus& status = m_status[priority];
+            while (true)
+            {
+                uint16_t head = status.head.load();
+                uint16_t tail = status.tail.load();
+                if (head == tail)
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
+                    // Queue empty
+                    return nullptr;
+                }
+                else
+                {
+                    Task* task = m_queues[priority][head];
+                    if (status.head.compare_exchange_weak(head, head + 1))
                     {
-                        // Queue empty
-                        break;
+                        return task;
                     }
-                    else
+                }
+            }
+        }
+
+        bool TaskQueue::HasTasks() const
+        {
+            for (const QueueStatus& status : m_status)
+            {
+                if (status.head.load(AZStd::memory_order_relaxed) != status.tail.load(AZStd::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Chase-Lev work stealing deque with a fixed capacity. Only the owning worker pushes and pops tasks at the
+        // bottom of the deque, while other workers steal tasks from the top. This keeps tasks released by a finishing
+        // task on the same worker (and likely in the same caches) while the only contention is between thieves and,
+        // for the last remaining task, the owner.
+        // Based on "Correct and Efficient Work-Stealing for Weak Memory Models" by Le, Pop, Cohen and Zappa Nardelli.
+        class WorkStealingDeque final
+        {
+        public:
+            constexpr static int64_t Capacity = 1024;
+            static_assert((Capacity & (Capacity - 1)) == 0, "The capacity of the work stealing deque needs to be a power of two.");
+
+            WorkStealingDeque() = default;
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            // Can only be called by the owning worker. Returns false if the deque is full.
+            bool Push(Task* task);
+            // Can only be called by the owning worker.
+            Task* Pop();
+            // Can be called from any thread. Returns nullptr if the deque is empty or if another thread won the race for
+            // the last task.
+            Task* Steal();
+            // Can be called from any thread, the result is only a snapshot.
+            bool IsEmpty() const;
+
+        private:
+            alignas(64) AZStd::atomic<int64_t> m_top{ 0 };
+            alignas(64) AZStd::atomic<int64_t> m_bottom{ 0 };
+            AZStd::atomic<Task*> m_tasks[Capacity] = {};
+        };
+
+        bool WorkStealingDeque::Push(Task* task)
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            if (bottom - top >= Capacity)
+            {
+                return false;
+            }
+
+            m_tasks[bottom & (Capacity - 1)].store(task, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        Task* WorkStealingDeque::Pop()
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+            if (top <= bottom)
+            {
+                Task* task = m_tasks[bottom & (Capacity - 1)].load(AZStd::memory_order_relaxed);
+                if (top == bottom)
+                {
+                    // This is the last task so race against any thieves for it.
+                    if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
+                        task = nullptr;
                     }
+                    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
                 }
+                return task;
             }
+            else
+            {
+                // Deque was empty
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                return nullptr;
+            }
+        }
 
+        Task* WorkStealingDeque::Steal()
+        {
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+            if (top < bottom)
+            {
+                Task* task = m_tasks[top & (Capacity - 1)].load(AZStd::memory_order_relaxed);
+                if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    return task;
+                }
+            }
             return nullptr;
         }
 
+        bool WorkStealingDeque::IsEmpty() const
+        {
+            return m_top.load(AZStd::memory_order_relaxed) >= m_bottom.load(AZStd::memory_order_relaxed);
+        }
+
         class TaskWorker
         {
         public:
@@ -195,6 +396,8 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
+                m_stealSeed = id + 1;
 
                 AZStd::string threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -241,53 +444,191 @@ namespace AZ
             {
                 m_queue.Enqueue(task);
 
+                ClearIdle();
                 m_semaphore.release();
             }
 
+            // Returns true if tasks are waiting for this worker, in which case newly enqueued tasks have to wait for them
+            bool HasPendingTasks() const
+            {
+                if (m_queue.HasTasks())
+                {
+                    return true;
+                }
+                for (const WorkStealingDeque& localQueue : m_localQueues)
+                {
+                    if (!localQueue.IsEmpty())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Wakes the worker if it's waiting for work. Returns false if the worker is busy or has already been woken up.
+            bool TryWake()
+            {
+                if (ClearIdle())
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
+
         private:
             void Run()
             {
-                while (m_active)
+                while (true)
                 {
-                    m_semaphore.acquire();
+                    Task* task = TryAcquireTask();
+                    if (!task && m_executor->m_workStealing)
+                    {
+                        // Advertise that this worker is idle before looking for work one final time. A worker that pushes
+                        // a task after this final check is guaranteed to see this worker as idle and wake it up.
+                        m_idle.store(true);
+                        ++m_executor->m_idleWorkerCount;
+                        task = TryAcquireTask();
+                        if (task)
+                        {
+                            // If another worker cleared the idle flag in the meantime it also released the semaphore, which
+                            // only causes an additional search for work the next time this worker runs out of tasks.
+                            ClearIdle();
+                        }
+                    }
 
-                    if (!m_active)
+                    if (task)
                     {
-                        return;
+                        Execute(*task);
+                    }
+                    else
+                    {
+                        m_semaphore.acquire();
+
+                        if (!m_active)
+                        {
+                            return;
+                        }
                     }
+                }
+            }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+            void Execute(Task& task)
+            {
+                task.Invoke();
+
+                // Decrement counts for all task successors. Successors are sorted by descending critical path. Tasks in the
+                // local deques are popped in LIFO order, so push them in reverse to have this worker continue with the
+                // successor on the longest remaining path. Submitted tasks are dequeued in FIFO order instead.
+                const bool pushLocally = m_executor->m_workStealing;
+                Task** successors = task.m_graph->m_successors.data() + task.m_successorOffset;
+                uint32_t readyCount = 0;
+                for (uint32_t j = 0; j != task.m_outboundLinkCount; ++j)
+                {
+                    Task* successor = successors[pushLocally ? task.m_outboundLinkCount - 1 - j : j];
+                    if (--successor->m_dependencyCount == 0)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        if (pushLocally && m_localQueues[successor->GetPriorityNumber()].Push(successor))
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
+                            // This worker will pick up one of the released tasks itself, so only wake up other workers
+                            // to steal the remaining tasks.
+                            if (readyCount++ != 0)
                             {
-                                m_executor->Submit(*successor);
+                                m_executor->WakeIdleWorker(m_id + 1);
                             }
                         }
+                        else
+                        {
+                            m_executor->Submit(*successor);
+                        }
+                    }
+                }
+
+                bool isRetained = task.m_graph->m_parent != nullptr;
+                if (task.m_graph->Release() == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
+            }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+            Task* TryAcquireTask()
+            {
+                // Tasks released by this worker are preferred over submitted tasks of the same priority, but tasks of a
+                // higher priority always go first.
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_localQueues[priority].Pop(); task)
+                    {
+                        return task;
+                    }
+                    if (Task* task = m_queue.TryDequeue(priority); task)
+                    {
+                        return task;
+                    }
+                }
+
+                return m_executor->m_workStealing ? TrySteal() : nullptr;
+            }
+
+            Task* TrySteal()
+            {
+                const uint32_t workerCount = m_executor->m_threadCount;
+                if (workerCount < 2)
+                {
+                    return nullptr;
+                }
+
+                // Start at a random worker so idle workers don't all contend on the same victim.
+                m_stealSeed ^= m_stealSeed << 13;
+                m_stealSeed ^= m_stealSeed >> 17;
+                m_stealSeed ^= m_stealSeed << 5;
+                const uint32_t start = m_stealSeed % workerCount;
+
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    for (uint32_t i = 0; i != workerCount; ++i)
+                    {
+                        TaskWorker& victim = m_executor->m_workers[(start + i) % workerCount];
+                        if (&victim == this)
                         {
-                            m_executor->ReleaseGraph();
+                            continue;
                         }
 
-                        task = m_queue.TryDequeue();
+                        if (Task* task = victim.m_localQueues[priority].Steal(); task)
+                        {
+                            return task;
+                        }
+                        if (Task* task = victim.m_queue.TryDequeue(priority); task)
+                        {
+                            return task;
+                        }
                     }
                 }
+                return nullptr;
+            }
+
+            bool ClearIdle()
+            {
+                bool expected = true;
+                if (m_idle.compare_exchange_strong(expected, false))
+                {
+                    --m_executor->m_idleWorkerCount;
+                    return true;
+                }
+                return false;
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_idle = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
+            uint32_t m_stealSeed = 1;
             TaskQueue m_queue;
+            WorkStealingDeque m_localQueues[TaskQueue::PriorityLevelCount];
             friend class ::AZ::TaskExecutor;
         };
 
@@ -318,18 +659,25 @@ namespace AZ
         }
     }
 
-    TaskExecutor::TaskExecutor(uint32_t threadCount)
+    TaskExecutor::TaskExecutor(uint32_t threadCount, bool enableWorkStealing)
+        : m_workStealing{ enableWorkStealing }
     {
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
 
-        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
+        m_workers = reinterpret_cast<Internal::TaskWorker*>(
+            azmalloc(m_threadCount * sizeof(Internal::TaskWorker), alignof(Internal::TaskWorker)));
 
         AZStd::semaphore initSemaphore;
 
+        // All workers need to exist before any of them start as idle workers look for work to steal from the others.
         for (uint32_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].Spawn(*this, i, initSemaphore, false);
         }
 
@@ -344,6 +692,10 @@ namespace AZ
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
+        }
+
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].~TaskWorker();
         }
 
@@ -369,13 +721,10 @@ namespace AZ
             event->m_executor = this; // Used to validate event is not waited for inside a job
         }
 
-        // Submit all tasks that have no inbound edges
-        for (Internal::Task& task : graph.Tasks())
+        // Submit all tasks that have no inbound edges, starting with the task on the longest path
+        for (Internal::Task* task : graph.Roots())
         {
-            if (task.IsRoot())
-            {
-                Submit(task);
-            }
+            Submit(*task);
         }
     }
 
@@ -392,7 +741,34 @@ namespace AZ
             nextWorker = ++m_lastSubmission % m_threadCount;
         }
 
-        m_workers[nextWorker].Enqueue(&task);
+        // If the worker already has tasks waiting, the new task would have to wait behind them, so also wake up an idle
+        // worker that can steal it.
+        Internal::TaskWorker& worker = m_workers[nextWorker];
+        const bool wakeStealer = m_workStealing && worker.HasPendingTasks();
+        worker.Enqueue(&task);
+        if (wakeStealer)
+        {
+            WakeIdleWorker(nextWorker + 1);
+        }
+    }
+
+    void TaskExecutor::WakeIdleWorker(uint32_t firstCandidate)
+    {
+        // Make sure the task that was just pushed is visible before checking for idle workers. This pairs with the
+        // idle workers advertising themselves before their final search for work.
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_idleWorkerCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[(firstCandidate + i) % m_threadCount].TryWake())
+            {
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
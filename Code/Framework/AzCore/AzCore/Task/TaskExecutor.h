@@ -39,6 +39,17 @@ namespace AZ
                 return m_tasks;
             }
 
+            // Tasks without dependencies, sorted by descending critical path length
+            AZStd::vector<Task*>& Roots() noexcept
+            {
+                return m_roots;
+            }
+
+            bool HasDependencyCycle() const noexcept
+            {
+                return m_hasDependencyCycle;
+            }
+
             // Indicate that a constituent task has finished and decrement a counter to determine if the
             // graph should be freed (returns the value after atomic decrement)
             uint32_t Release();
@@ -48,11 +59,14 @@ namespace AZ
             friend class TaskWorker;
 
             AZStd::vector<Task> m_tasks;
+            // The successors of each task are sorted by descending critical path length
             AZStd::vector<Task*> m_successors;
+            AZStd::vector<Task*> m_roots;
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
             TaskGraph* m_parent = nullptr;
             AZStd::atomic<uint32_t> m_remaining;
+            bool m_hasDependencyCycle = false;
         };
 
         class TaskWorker;
@@ -68,8 +82,11 @@ namespace AZ
         // Invoked by a system component on program launch
         static void SetInstance(TaskExecutor* executor);
 
-        // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
-        explicit TaskExecutor(uint32_t threadCount = 0);
+        // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency.
+        // With work stealing enabled, tasks released by a finishing task are pushed to the local deque of the worker
+        // that finished it and idle workers steal from busy workers. When disabled, every ready task is distributed
+        // round-robin over the workers' shared queues.
+        explicit TaskExecutor(uint32_t threadCount = 0, bool enableWorkStealing = true);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -85,10 +102,15 @@ namespace AZ
         Internal::TaskWorker* GetTaskWorker();
         void ReleaseGraph();
         void ReactivateTaskWorker();
+        // Wakes up a single worker that's waiting for work so it can steal tasks from busy workers. The search for
+        // an idle worker starts at the given worker index.
+        void WakeIdleWorker(uint32_t firstCandidate);
 
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        bool m_workStealing = true;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_idleWorkerCount{ 0 };
         AZStd::atomic<uint64_t> m_graphsRemaining;
     };
 } // namespace AZ
@@ -107,6 +107,20 @@ namespace AZ
         if (!m_compiledTaskGraph)
         {
             m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr);
+
+            if (m_compiledTaskGraph->HasDependencyCycle())
+            {
+                // The tasks in the cycle would never run, so discard the graph instead of submitting it. The event is still
+                // signaled as if the graph completed, so a caller waiting on it doesn't block forever.
+                Reset();
+                if (waitEvent)
+                {
+                    waitEvent->IncWaitCount();
+                    waitEvent->m_executor = &executor;
+                    waitEvent->Signal();
+                }
+                return;
+            }
         }
 
         m_compiledTaskGraph->m_waitEvent = waitEvent;
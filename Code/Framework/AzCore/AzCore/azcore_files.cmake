@@ -131,6 +131,8 @@ set(FILES
     EBus/EventSchedulerSystemComponent.cpp
     EBus/EventSchedulerSystemComponent.h
     EBus/IEventScheduler.h
+    EBus/Instrumentation.cpp
+    EBus/Instrumentation.h
     EBus/OrderedEvent.h
     EBus/OrderedEvent.inl
     EBus/Policies.h
@@ -162,6 +164,8 @@ set(FILES
     IO/FileReader.h
     IO/IOUtils.h
     IO/IOUtils.cpp
+    IO/MappedFile.cpp
+    IO/MappedFile.h
     IO/IStreamer.h
     IO/IStreamerTypes.h
     IO/IStreamerTypes.inl
@@ -210,6 +214,8 @@ set(FILES
     IO/Streamer/StreamerComponent.h
     IO/Streamer/StreamStackEntry.h
     IO/Streamer/StreamStackEntry.cpp
+    IO/Streamer/TracePrefetcher.h
+    IO/Streamer/TracePrefetcher.cpp
     IPC/SharedMemory.cpp
     IPC/SharedMemory.h
     Jobs/Algorithms.h
@@ -371,6 +377,9 @@ set(FILES
     Memory/BestFitExternalMapSchema.cpp
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
+    Memory/FrameAllocator.h
+    Memory/FrameSchema.cpp
+    Memory/FrameSchema.h
     Memory/dlmalloc.inl
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
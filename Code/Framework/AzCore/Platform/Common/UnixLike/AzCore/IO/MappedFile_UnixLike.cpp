@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace AZ::IO
+{
+    bool MappedFile::PlatformOpen(const char* fileName)
+    {
+        int fileDescriptor = open(fileName, O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat statResult;
+        if (fstat(fileDescriptor, &statResult) != 0 || statResult.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        // MAP_SHARED so the pages come straight from the page cache and are shared with every other process mapping the file
+        void* data = mmap(nullptr, statResult.st_size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        // the mapping keeps a reference to the file, the descriptor isn't needed anymore
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = data;
+        m_size = static_cast<AZ::u64>(statResult.st_size);
+        return true;
+    }
+
+    void MappedFile::PlatformClose()
+    {
+        munmap(const_cast<void*>(m_data), m_size);
+    }
+}
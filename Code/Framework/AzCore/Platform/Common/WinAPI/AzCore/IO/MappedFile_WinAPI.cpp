@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    bool MappedFile::PlatformOpen(const char* fileName)
+    {
+        AZStd::fixed_wstring<MaxPathLength> fileNameW;
+        AZStd::to_wstring(fileNameW, fileName);
+        HANDLE fileHandle = CreateFileW(fileNameW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* data = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        // the view keeps the mapping and the file alive, the handles aren't needed anymore
+        if (mappingHandle)
+        {
+            CloseHandle(mappingHandle);
+        }
+        CloseHandle(fileHandle);
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        m_data = data;
+        m_size = static_cast<AZ::u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::PlatformClose()
+    {
+        UnmapViewOfFile(m_data);
+    }
+}
@@ -0,0 +1,591 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/AsyncReadQueue_Linux.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::IO
+{
+    void AsyncReadStatus::Reset()
+    {
+        m_result = 0;
+        m_cancelRequested.store(false, AZStd::memory_order_relaxed);
+        m_completed.store(false, AZStd::memory_order_release);
+    }
+
+    //
+    // IoUringReadQueue
+    //
+
+    //! Read queue that uses io_uring to keep reads in flight without the need for additional threads to do the actual reading.
+    //! liburing is not used to avoid an additional third party dependency, so the rings are directly managed through the
+    //! io_uring system calls. The submission queue is only written to by the thread that owns the queue and the completion
+    //! queue is only read by the completion thread, so no locks are needed.
+    class IoUringReadQueue final
+        : public AsyncReadQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(IoUringReadQueue, SystemAllocator, 0);
+
+        explicit IoUringReadQueue(CompletionCallback onCompletion);
+        ~IoUringReadQueue() override;
+
+        bool Initialize(u32 queueDepth);
+
+        bool RegisterBuffers(const AZStd::vector<AZStd::pair<void*, size_t>>& buffers) override;
+        bool QueueRead(AsyncReadStatus& status, int fileDescriptor, void* output, u64 size, u64 offset,
+            s32 registeredBufferIndex) override;
+        void Submit() override;
+        void Cancel(AsyncReadStatus& status) override;
+
+        Backend GetBackend() const override { return Backend::IoUring; }
+        bool HasRegisteredBuffers() const override { return m_hasRegisteredBuffers; }
+
+    private:
+        // User data values that don't point to an AsyncReadStatus. Pointers to statuses are always aligned so these
+        // values will never collide.
+        inline static constexpr u64 CancelUserData = 0;
+        inline static constexpr u64 ShutdownUserData = 1;
+
+        static u32 LoadAcquire(const u32* value) { return __atomic_load_n(value, __ATOMIC_ACQUIRE); }
+        static void StoreRelease(u32* value, u32 newValue) { __atomic_store_n(value, newValue, __ATOMIC_RELEASE); }
+
+        bool IsOpcodeSupported(u8 opcode) const;
+        io_uring_sqe* GetNextSubmissionEntry();
+        void CommitSubmissionEntry();
+        void Thread_ProcessCompletions();
+
+        CompletionCallback m_onCompletion;
+        AZStd::thread m_completionThread;
+
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        u32 m_pendingSubmissions{ 0 };
+
+        int m_ringFileDescriptor{ -1 };
+        bool m_hasRegisteredBuffers{ false };
+    };
+
+    IoUringReadQueue::IoUringReadQueue(CompletionCallback onCompletion)
+        : m_onCompletion(AZStd::move(onCompletion))
+    {
+    }
+
+    IoUringReadQueue::~IoUringReadQueue()
+    {
+        if (m_completionThread.joinable())
+        {
+            // Wake up the completion thread by queuing a no-op that's marked as the shutdown signal.
+            io_uring_sqe* entry = GetNextSubmissionEntry();
+            while (entry == nullptr)
+            {
+                Submit();
+                AZStd::this_thread::yield();
+                entry = GetNextSubmissionEntry();
+            }
+            entry->opcode = IORING_OP_NOP;
+            entry->user_data = ShutdownUserData;
+            CommitSubmissionEntry();
+            Submit();
+            m_completionThread.join();
+        }
+
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringFileDescriptor >= 0)
+        {
+            ::close(m_ringFileDescriptor);
+        }
+    }
+
+    bool IoUringReadQueue::Initialize(u32 queueDepth)
+    {
+        // Reserve room for cancel requests and the shutdown signal on top of the reads. The completion queue will be twice the
+        // size of the submission queue, which is enough to hold the results of the reads and the cancel requests.
+        io_uring_params parameters{};
+        m_ringFileDescriptor = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, queueDepth * 2 + 1, &parameters));
+        if (m_ringFileDescriptor < 0)
+        {
+            AZ_TracePrintf("Streamer", "io_uring is not available (errno %i).\n", errno);
+            return false;
+        }
+
+        if (!IsOpcodeSupported(IORING_OP_READ) || !IsOpcodeSupported(IORING_OP_READ_FIXED) ||
+            !IsOpcodeSupported(IORING_OP_ASYNC_CANCEL))
+        {
+            AZ_TracePrintf("Streamer", "io_uring is available but the kernel doesn't support all the required operations.\n");
+            return false;
+        }
+
+        m_submissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(u32);
+        m_completionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFileDescriptor, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFileDescriptor, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFileDescriptor, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        u8* submissionRing = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submissionRing + parameters.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submissionRing + parameters.sq_off.tail);
+        m_submissionArray = reinterpret_cast<u32*>(submissionRing + parameters.sq_off.array);
+        m_submissionMask = *reinterpret_cast<u32*>(submissionRing + parameters.sq_off.ring_mask);
+        m_submissionEntryCount = *reinterpret_cast<u32*>(submissionRing + parameters.sq_off.ring_entries);
+
+        u8* completionRing = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completionRing + parameters.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completionRing + parameters.cq_off.tail);
+        m_completionMask = *reinterpret_cast<u32*>(completionRing + parameters.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRing + parameters.cq_off.cqes);
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Streamer io_uring completion";
+        m_completionThread = AZStd::thread(threadDesc, [this]()
+            {
+                Thread_ProcessCompletions();
+            });
+        return true;
+    }
+
+    bool IoUringReadQueue::IsOpcodeSupported(u8 opcode) const
+    {
+        constexpr size_t MaxOperations = 256;
+        constexpr size_t ProbeSize = sizeof(io_uring_probe) + MaxOperations * sizeof(io_uring_probe_op);
+        alignas(io_uring_probe) u8 probeBuffer[ProbeSize] = {};
+        auto probe = reinterpret_cast<io_uring_probe*>(probeBuffer);
+        if (::syscall(__NR_io_uring_register, m_ringFileDescriptor, IORING_REGISTER_PROBE, probe, MaxOperations) < 0)
+        {
+            // Probing was introduced in the same kernel version (5.6) as IORING_OP_READ, so if probing isn't supported
+            // neither are plain reads.
+            return false;
+        }
+        return opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) != 0;
+    }
+
+    bool IoUringReadQueue::RegisterBuffers(const AZStd::vector<AZStd::pair<void*, size_t>>& buffers)
+    {
+        AZ_Assert(!m_hasRegisteredBuffers, "Buffers have already been registered with the io_uring read queue.");
+        if (buffers.empty())
+        {
+            return false;
+        }
+
+        AZStd::vector<iovec> vectors;
+        vectors.reserve(buffers.size());
+        for (const auto& [address, size] : buffers)
+        {
+            vectors.push_back(iovec{ address, size });
+        }
+
+        if (::syscall(__NR_io_uring_register, m_ringFileDescriptor, IORING_REGISTER_BUFFERS, vectors.data(),
+            aznumeric_cast<unsigned int>(vectors.size())) < 0)
+        {
+            // The most common reason for this to fail is a too low RLIMIT_MEMLOCK, as the buffers get pinned in memory.
+            AZ_Warning("Streamer", false, "Unable to register %zu read buffers with io_uring (errno %i). Falling back to regular reads.\n",
+                buffers.size(), errno);
+            return false;
+        }
+        m_hasRegisteredBuffers = true;
+        return true;
+    }
+
+    io_uring_sqe* IoUringReadQueue::GetNextSubmissionEntry()
+    {
+        const u32 head = LoadAcquire(m_submissionHead);
+        const u32 tail = *m_submissionTail;
+        if (tail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = tail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        return entry;
+    }
+
+    void IoUringReadQueue::CommitSubmissionEntry()
+    {
+        // Publish the entry that was filled in after the call to GetNextSubmissionEntry. The kernel will pick it up on the next
+        // call to io_uring_enter.
+        StoreRelease(m_submissionTail, *m_submissionTail + 1);
+        m_pendingSubmissions++;
+    }
+
+    bool IoUringReadQueue::QueueRead(AsyncReadStatus& status, int fileDescriptor, void* output, u64 size, u64 offset,
+        s32 registeredBufferIndex)
+    {
+        io_uring_sqe* entry = GetNextSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+
+        status.Reset();
+        const bool useRegisteredBuffer = m_hasRegisteredBuffers && registeredBufferIndex != NoRegisteredBuffer;
+        entry->opcode = useRegisteredBuffer ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        entry->fd = fileDescriptor;
+        entry->addr = reinterpret_cast<u64>(output);
+        entry->len = aznumeric_cast<u32>(size);
+        entry->off = offset;
+        entry->buf_index = useRegisteredBuffer ? aznumeric_cast<u16>(registeredBufferIndex) : 0;
+        entry->user_data = reinterpret_cast<u64>(&status);
+        CommitSubmissionEntry();
+        return true;
+    }
+
+    void IoUringReadQueue::Submit()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        while (m_pendingSubmissions > 0)
+        {
+            long result = ::syscall(__NR_io_uring_enter, m_ringFileDescriptor, m_pendingSubmissions, 0, 0, nullptr, 0);
+            if (result >= 0)
+            {
+                m_pendingSubmissions -= aznumeric_cast<u32>(result);
+            }
+            else if (errno == EAGAIN || errno == EBUSY)
+            {
+                // The kernel is temporarily out of resources or the completion queue needs to be drained first. The
+                // remaining entries will be submitted on the next call.
+                break;
+            }
+            else if (errno != EINTR)
+            {
+                AZ_Error("Streamer", false, "Failed to submit %u reads to io_uring (errno %i).\n", m_pendingSubmissions, errno);
+                break;
+            }
+        }
+    }
+
+    void IoUringReadQueue::Cancel(AsyncReadStatus& status)
+    {
+        status.m_cancelRequested.store(true, AZStd::memory_order_release);
+        if (io_uring_sqe* entry = GetNextSubmissionEntry(); entry != nullptr)
+        {
+            entry->opcode = IORING_OP_ASYNC_CANCEL;
+            entry->addr = reinterpret_cast<u64>(&status);
+            entry->user_data = CancelUserData;
+            CommitSubmissionEntry();
+            Submit();
+        }
+    }
+
+    void IoUringReadQueue::Thread_ProcessCompletions()
+    {
+        bool isRunning = true;
+        while (isRunning)
+        {
+            bool hasCompletedReads = false;
+            u32 head = *m_completionHead;
+            const u32 tail = LoadAcquire(m_completionTail);
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe& entry = m_completionEntries[head & m_completionMask];
+                if (entry.user_data == ShutdownUserData)
+                {
+                    isRunning = false;
+                }
+                else if (entry.user_data != CancelUserData)
+                {
+                    auto status = reinterpret_cast<AsyncReadStatus*>(entry.user_data);
+                    status->m_result = entry.res;
+                    status->m_completed.store(true, AZStd::memory_order_release);
+                    hasCompletedReads = true;
+                }
+            }
+            StoreRelease(m_completionHead, head);
+
+            if (hasCompletedReads)
+            {
+                m_onCompletion();
+            }
+
+            if (isRunning)
+            {
+                // Sleep until at least one more entry is available in the completion queue.
+                ::syscall(__NR_io_uring_enter, m_ringFileDescriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            }
+        }
+    }
+
+    //
+    // ThreadPoolReadQueue
+    //
+
+    //! Read queue that uses a pool of threads to issue blocking reads. This is used on kernels that don't support io_uring or
+    //! environments where it has been disabled, such as containers with restrictive seccomp profiles.
+    class ThreadPoolReadQueue final
+        : public AsyncReadQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ThreadPoolReadQueue, SystemAllocator, 0);
+
+        ThreadPoolReadQueue(u32 threadCount, CompletionCallback onCompletion);
+        ~ThreadPoolReadQueue() override;
+
+        bool RegisterBuffers(const AZStd::vector<AZStd::pair<void*, size_t>>& buffers) override;
+        bool QueueRead(AsyncReadStatus& status, int fileDescriptor, void* output, u64 size, u64 offset,
+            s32 registeredBufferIndex) override;
+        void Submit() override;
+        void Cancel(AsyncReadStatus& status) override;
+
+        Backend GetBackend() const override { return Backend::ThreadPool; }
+        bool HasRegisteredBuffers() const override { return false; }
+
+    private:
+        struct PendingRead
+        {
+            AsyncReadStatus* m_status{ nullptr };
+            void* m_output{ nullptr };
+            u64 m_size{ 0 };
+            u64 m_offset{ 0 };
+            int m_fileDescriptor{ -1 };
+        };
+
+        static void ExecuteRead(PendingRead& read);
+        void Thread_ProcessReads();
+
+        CompletionCallback m_onCompletion;
+        AZStd::vector<AZStd::thread> m_workers;
+        // Reads that have been queued but not submitted. Only accessed from the thread that owns the queue.
+        AZStd::vector<PendingRead> m_queuedReads;
+
+        AZStd::mutex m_submittedReadsLock;
+        AZStd::condition_variable m_submittedReadsCondition;
+        AZStd::deque<PendingRead> m_submittedReads;
+        bool m_isRunning{ true };
+    };
+
+    ThreadPoolReadQueue::ThreadPoolReadQueue(u32 threadCount, CompletionCallback onCompletion)
+        : m_onCompletion(AZStd::move(onCompletion))
+    {
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Streamer IO worker";
+        m_workers.reserve(threadCount);
+        for (u32 i = 0; i < threadCount; ++i)
+        {
+            m_workers.emplace_back(threadDesc, [this]()
+                {
+                    Thread_ProcessReads();
+                });
+        }
+    }
+
+    ThreadPoolReadQueue::~ThreadPoolReadQueue()
+    {
+        {
+            AZStd::scoped_lock lock(m_submittedReadsLock);
+            m_isRunning = false;
+        }
+        m_submittedReadsCondition.notify_all();
+        for (AZStd::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    bool ThreadPoolReadQueue::RegisterBuffers([[maybe_unused]] const AZStd::vector<AZStd::pair<void*, size_t>>& buffers)
+    {
+        // There's no kernel mapping to avoid when using pread, so there's nothing to register.
+        return false;
+    }
+
+    bool ThreadPoolReadQueue::QueueRead(AsyncReadStatus& status, int fileDescriptor, void* output, u64 size, u64 offset,
+        [[maybe_unused]] s32 registeredBufferIndex)
+    {
+        status.Reset();
+        PendingRead read;
+        read.m_status = &status;
+        read.m_output = output;
+        read.m_size = size;
+        read.m_offset = offset;
+        read.m_fileDescriptor = fileDescriptor;
+        m_queuedReads.push_back(read);
+        return true;
+    }
+
+    void ThreadPoolReadQueue::Submit()
+    {
+        if (!m_queuedReads.empty())
+        {
+            {
+                AZStd::scoped_lock lock(m_submittedReadsLock);
+                m_submittedReads.insert(m_submittedReads.end(), m_queuedReads.begin(), m_queuedReads.end());
+            }
+            if (m_queuedReads.size() == 1)
+            {
+                m_submittedReadsCondition.notify_one();
+            }
+            else
+            {
+                m_submittedReadsCondition.notify_all();
+            }
+            m_queuedReads.clear();
+        }
+    }
+
+    void ThreadPoolReadQueue::Cancel(AsyncReadStatus& status)
+    {
+        // Reads that are already being processed by a worker will complete normally, but reads that haven't been picked up yet
+        // will be skipped.
+        status.m_cancelRequested.store(true, AZStd::memory_order_release);
+    }
+
+    void ThreadPoolReadQueue::ExecuteRead(PendingRead& read)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "ThreadPoolReadQueue::ExecuteRead");
+
+        if (read.m_status->m_cancelRequested.load(AZStd::memory_order_acquire))
+        {
+            read.m_status->m_result = -ECANCELED;
+            return;
+        }
+
+        u8* output = reinterpret_cast<u8*>(read.m_output);
+        u64 bytesRead = 0;
+        while (bytesRead < read.m_size)
+        {
+            ssize_t result = ::pread(read.m_fileDescriptor, output + bytesRead, read.m_size - bytesRead, read.m_offset + bytesRead);
+            if (result > 0)
+            {
+                bytesRead += result;
+            }
+            else if (result == 0)
+            {
+                // Reached the end of the file.
+                break;
+            }
+            else if (errno != EINTR)
+            {
+                read.m_status->m_result = -errno;
+                return;
+            }
+        }
+        read.m_status->m_result = aznumeric_cast<s64>(bytesRead);
+    }
+
+    void ThreadPoolReadQueue::Thread_ProcessReads()
+    {
+        while (true)
+        {
+            PendingRead read;
+            {
+                AZStd::unique_lock lock(m_submittedReadsLock);
+                m_submittedReadsCondition.wait(lock, [this]()
+                    {
+                        return !m_isRunning || !m_submittedReads.empty();
+                    });
+                if (m_submittedReads.empty())
+                {
+                    return;
+                }
+                read = m_submittedReads.front();
+                m_submittedReads.pop_front();
+            }
+
+            ExecuteRead(read);
+            read.m_status->m_completed.store(true, AZStd::memory_order_release);
+            m_onCompletion();
+        }
+    }
+
+    //
+    // AsyncReadQueue
+    //
+
+    AZStd::unique_ptr<AsyncReadQueue> AsyncReadQueue::Create(
+        u32 queueDepth, bool preferIoUring, u32 threadPoolSize, CompletionCallback onCompletion)
+    {
+        AZ_Assert(queueDepth > 0, "The queue depth for the AsyncReadQueue needs to be at least 1.");
+
+        if (preferIoUring)
+        {
+            auto ioUringQueue = AZStd::make_unique<IoUringReadQueue>(onCompletion);
+            if (ioUringQueue->Initialize(queueDepth))
+            {
+                return ioUringQueue;
+            }
+        }
+        return AZStd::make_unique<ThreadPoolReadQueue>(AZStd::max(threadPoolSize, 1u), AZStd::move(onCompletion));
+    }
+} // namespace AZ::IO
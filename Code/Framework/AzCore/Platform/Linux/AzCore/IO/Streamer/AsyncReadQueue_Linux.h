@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::IO
+{
+    //! Status of a single asynchronous read. The status is written by the thread that completes the read and
+    //! read by the thread that owns the read. m_result is only valid after m_completed has been set to true.
+    struct AsyncReadStatus
+    {
+        //! Set to true once the read has finished, failed or was canceled.
+        AZStd::atomic_bool m_completed{ false };
+        //! Set to true when the owner has requested the read to be canceled.
+        AZStd::atomic_bool m_cancelRequested{ false };
+        //! The number of bytes read or a negative errno value if the read failed.
+        s64 m_result{ 0 };
+
+        void Reset();
+    };
+
+    //! Queue that keeps multiple reads in flight for the Linux storage drive. Reads are submitted from a single
+    //! thread (the Streamer thread) and completed on a thread owned by the queue. Once a read completes the status
+    //! is updated and the completion callback is called, after which the owner is responsible for picking up the result.
+    class AsyncReadQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AsyncReadQueue, SystemAllocator, 0);
+
+        enum class Backend
+        {
+            IoUring,    //!< Reads are submitted to the kernel through an io_uring submission queue.
+            ThreadPool  //!< Reads are done with pread on a pool of worker threads.
+        };
+
+        //! Called from the thread that completed a read. Use this to wake up the thread that owns the reads.
+        using CompletionCallback = AZStd::function<void()>;
+
+        //! Index used to indicate that a read doesn't target one of the registered buffers.
+        inline static constexpr s32 NoRegisteredBuffer = -1;
+
+        virtual ~AsyncReadQueue() = default;
+
+        //! Creates a new queue.
+        //! @param queueDepth The maximum number of reads that will be in flight at the same time.
+        //! @param preferIoUring If true, an io_uring backed queue will be created if the kernel supports it. If not or
+        //!     if io_uring is not available a thread pool backed queue will be created instead.
+        //! @param threadPoolSize The number of worker threads used if the queue falls back to a thread pool.
+        //! @param onCompletion Callback that's called whenever a read completes.
+        static AZStd::unique_ptr<AsyncReadQueue> Create(
+            u32 queueDepth, bool preferIoUring, u32 threadPoolSize, CompletionCallback onCompletion);
+
+        //! Registers buffers with the kernel so they don't have to be mapped for every read. Buffers can only be registered
+        //! once and have to remain valid until the queue is destroyed.
+        //! @return True if the buffers were registered, otherwise false in which case reads can't use registered buffers.
+        virtual bool RegisterBuffers(const AZStd::vector<AZStd::pair<void*, size_t>>& buffers) = 0;
+        //! Queues a read. The read will not be started until Submit is called.
+        //! @param status The status of the read. This needs to remain valid until the read has completed.
+        //! @param fileDescriptor The file descriptor to read from.
+        //! @param output The address to write the data to. If a registered buffer is used this has to point into that buffer.
+        //! @param size The number of bytes to read.
+        //! @param offset The offset in the file to start reading at.
+        //! @param registeredBufferIndex The index of the registered buffer that output points into or NoRegisteredBuffer.
+        //! @return True if the read was queued or false if the queue is full.
+        virtual bool QueueRead(AsyncReadStatus& status, int fileDescriptor, void* output, u64 size, u64 offset,
+            s32 registeredBufferIndex) = 0;
+        //! Starts all reads that were queued since the last call to Submit.
+        virtual void Submit() = 0;
+        //! Requests a read to be canceled. The read will still complete, but if the cancel succeeded the result will be -ECANCELED.
+        virtual void Cancel(AsyncReadStatus& status) = 0;
+
+        virtual Backend GetBackend() const = 0;
+        virtual bool HasRegisteredBuffers() const = 0;
+    };
+} // namespace AZ::IO
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+        options.m_enableIoUring = m_enableIoUring;
+        options.m_enableRegisteredBuffers = m_enableRegisteredBuffers;
+        options.m_minimalReporting = m_minimalReporting;
+        const size_t stagingBufferSize = aznumeric_cast<size_t>(m_stagingBufferSizeKib) * 1_kib;
+
+        const DriveList* drives = AZStd::any_cast<DriveList>(&hardware.m_platformData);
+        if (drives && !drives->empty())
+        {
+            for (const DriveInformation& drive : *drives)
+            {
+                options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+
+                AZStd::vector<AZStd::string_view> drivePaths(drive.m_paths.begin(), drive.m_paths.end());
+                AZ_Assert(!drive.m_paths.empty(), "Expected at least one drive path.");
+                u32 queueDepth = drive.m_ioChannelCount != 0 ? AZStd::min(drive.m_ioChannelCount, m_maxQueueDepth) : m_maxQueueDepth;
+                auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                    AZStd::move(drivePaths), m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize, drive.m_logicalSectorSize,
+                    queueDepth, m_overcommit, stagingBufferSize, options);
+
+                stackEntry->SetNext(AZStd::move(parent));
+                parent = stackEntry;
+            }
+        }
+        else
+        {
+            // Information about the block devices isn't always available, for instance when running in a container on an
+            // overlay file system. In that case use a single drive for the entire file system with the generic hardware values.
+            AZ_Warning("Streamer", m_minimalReporting,
+                "No drive information found. Using a single storage drive for all paths with generic settings.\n");
+            AZStd::vector<AZStd::string_view> drivePaths{ "/" };
+            auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                AZStd::move(drivePaths), m_maxFileHandles, m_maxMetaDataCache, hardware.m_maxPhysicalSectorSize,
+                hardware.m_maxLogicalSectorSize, m_maxQueueDepth, m_overcommit, stagingBufferSize, options);
+
+            stackEntry->SetNext(AZStd::move(parent));
+            parent = stackEntry;
+        }
+        return parent;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("MaxQueueDepth", &LinuxStorageDriveConfig::m_maxQueueDepth)
+                ->Field("StagingBufferSizeKib", &LinuxStorageDriveConfig::m_stagingBufferSizeKib)
+                ->Field("EnableIoUring", &LinuxStorageDriveConfig::m_enableIoUring)
+                ->Field("EnableRegisteredBuffers", &LinuxStorageDriveConfig::m_enableRegisteredBuffers)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{A98FA5F2-2B03-4AC3-9419-2CDA4A957FC9}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator, 0);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_overcommit{ 8 };
+        //! The maximum number of reads in flight per drive. The actual number is limited by what the device reports.
+        AZ::u32 m_maxQueueDepth{ 32 };
+        //! Size of the aligned buffer each read slot keeps for reads that need to be realigned. Use 0 to disable.
+        AZ::u32 m_stagingBufferSizeKib{ 64 };
+        bool m_enableIoUring{ true };
+        bool m_enableRegisteredBuffers{ true };
+        bool m_enableUnbufferedReads{ true };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,1223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+    static constexpr char StagedReadsName[] = "Staged reads (pre-allocated buffer)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    // Upper limit for the number of threads that are created if the drive has to fall back to the thread pool because io_uring
+    // isn't available.
+    static constexpr u32 MaxReadThreads = 16;
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_enableIoUring(true)
+        , m_enableRegisteredBuffers(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput && !m_usesStagingBuffer)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles,
+        u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth, s32 overCommit,
+        size_t stagingBufferSize, ConstructionOptions options)
+        : m_maxFileHandles(maxFileHandles)
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_stagingBufferSize(stagingBufferSize)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        AZ_Assert(!drivePaths.empty(), "StorageDriveLinux requires at least one mount point to work.");
+
+        // Get mount points. The trailing slash is removed so the root mount point becomes an empty string which matches any
+        // absolute path.
+        m_drivePaths.reserve(drivePaths.size());
+        for (AZStd::string_view drivePath : drivePaths)
+        {
+            AZStd::string path(drivePath);
+            while (!path.empty() && path.back() == AZ_CORRECT_FILESYSTEM_SEPARATOR)
+            {
+                path.pop_back();
+            }
+            m_drivePaths.push_back(AZStd::move(path));
+        }
+
+        // Create name for statistics. The name will include all mount points on this physical device
+        // for instance "Storage drive (/,/home)".
+        m_name = "Storage drive (";
+        for (size_t i = 0; i < m_drivePaths.size(); ++i)
+        {
+            if (i != 0)
+            {
+                m_name += ',';
+            }
+            m_name += m_drivePaths[i].empty() ? AZStd::string_view("/") : AZStd::string_view(m_drivePaths[i]);
+        }
+        m_name += ')';
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Staging buffers need to be able to hold at least one sector.
+        if (m_stagingBufferSize != 0)
+        {
+            m_stagingBufferSize = AZ_SIZE_ALIGN_UP(m_stagingBufferSize, m_physicalSectorSize);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %zu", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // The kernel can still be writing into the output and staging buffers of reads that are in flight, so wait for all
+        // of them to be reaped before the read queue is destroyed and the buffers and file handles are released.
+        WaitForActiveReads();
+        m_readQueue.reset();
+        for (FileReadInformation& readInfo : m_readSlots_readInfo)
+        {
+            readInfo.Clear();
+        }
+
+        for (u8* buffer : m_readSlots_stagingBuffer)
+        {
+            azfree(buffer, AZ::SystemAllocator);
+        }
+        for (int file : m_fileCache_handles)
+        {
+            if (file != InvalidFileDescriptor)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(readRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingReadRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        if (!m_pendingReadRequests.empty())
+        {
+            // Fill up as many read slots as possible and submit them in a single batch so multiple reads are in flight.
+            while (!m_pendingReadRequests.empty())
+            {
+                FileRequest* request = m_pendingReadRequests.front();
+                if (ReadRequest(request))
+                {
+                    m_pendingReadRequests.pop_front();
+                    hasWorked = true;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+        else if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand());
+        }
+
+        if (m_readQueue)
+        {
+            m_readQueue->Submit();
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime + AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_compressionInfo.m_archiveFilename.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    void StorageDriveLinux::InitializeCaches()
+    {
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, InvalidFileDescriptor);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+        m_fileCache_isUnbuffered.resize(m_maxFileHandles, false);
+
+        m_readSlots_readInfo.resize(m_queueDepth);
+        m_readSlots_statusInfo = AZStd::make_unique<AsyncReadStatus[]>(m_queueDepth);
+        m_readSlots_active.resize(m_queueDepth);
+
+        StreamerContext* context = m_context;
+        m_readQueue = AsyncReadQueue::Create(m_queueDepth, m_constructionOptions.m_enableIoUring,
+            AZStd::min(m_queueDepth, MaxReadThreads), [context]()
+            {
+                context->WakeUpSchedulingThread();
+            });
+
+        // Staging buffers are only needed to correct alignment for unbuffered reads.
+        if (m_stagingBufferSize > 0 && m_constructionOptions.m_enableUnbufferedReads)
+        {
+            AZStd::vector<AZStd::pair<void*, size_t>> registeredBuffers;
+            registeredBuffers.reserve(m_queueDepth);
+            m_readSlots_stagingBuffer.reserve(m_queueDepth);
+            for (u32 i = 0; i < m_queueDepth; ++i)
+            {
+                u8* buffer = reinterpret_cast<u8*>(azmalloc(m_stagingBufferSize, m_physicalSectorSize, AZ::SystemAllocator));
+                m_readSlots_stagingBuffer.push_back(buffer);
+                registeredBuffers.emplace_back(buffer, m_stagingBufferSize);
+            }
+            if (m_constructionOptions.m_enableRegisteredBuffers && m_readQueue->GetBackend() == AsyncReadQueue::Backend::IoUring)
+            {
+                m_readQueue->RegisterBuffers(registeredBuffers);
+            }
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s is using %s with a queue depth of %u%s.\n", m_name.c_str(),
+                m_readQueue->GetBackend() == AsyncReadQueue::Backend::IoUring ? "io_uring" : "a read thread pool", m_queueDepth,
+                m_readQueue->HasRegisteredBuffers() ? " and registered staging buffers" : "");
+        }
+
+        m_cachesInitialized = true;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = InvalidFileDescriptor;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file != InvalidFileDescriptor, "Found the file '%s' in cache, but file handle is invalid.\n",
+                data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isUnbuffered = false;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+                    // Not all file systems support O_DIRECT, for instance tmpfs, in which case EINVAL is returned. In that
+                    // case fall back to a regular buffered read.
+                    isUnbuffered = file != InvalidFileDescriptor;
+                }
+                if (file == InvalidFileDescriptor)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file == InvalidFileDescriptor)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFile(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+            m_fileCache_isUnbuffered[cacheIndex] = isUnbuffered;
+        }
+
+        AZ_Assert(file != InvalidFileDescriptor, "While searching for file '%s' in StorageDriveLinux::OpenFile failed to detect a problem.",
+            data.m_path.GetRelativePath());
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeCaches();
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = InvalidFileDescriptor;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+        s32 registeredBufferIndex = AsyncReadQueue::NoRegisteredBuffer;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_isUnbuffered[fileCacheSlot])
+        {
+            // Check alignment of the file read information: size, offset, and address.
+            // If any are unaligned to the sector sizes, make adjustments and use an aligned buffer.
+            // See StorageDriveWin::ReadRequest for a detailed description of the adjustments.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            // Align the offset down to the next lowest sector and grow the size to compensate. The number of additional
+            // bytes is stored in the copyBackOffset so only the requested data is copied to the output.
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            // If the output buffer is large enough to absorb the additional bytes at the end, read directly into it.
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            bool isStaged = false;
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (readSize <= m_stagingBufferSize && !m_readSlots_stagingBuffer.empty())
+                {
+                    // Use the pre-allocated buffer for this slot, which avoids an allocation and, if registered, the kernel
+                    // having to map the buffer.
+                    readInfo.m_sectorAlignedOutput = m_readSlots_stagingBuffer[readSlot];
+                    readInfo.m_usesStagingBuffer = true;
+                    if (m_readQueue->HasRegisteredBuffers())
+                    {
+                        registeredBufferIndex = aznumeric_cast<s32>(readSlot);
+                    }
+                    isStaged = true;
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                }
+                output = readInfo.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            m_stagedReadsPercentageStat.PushSample(isStaged ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#else
+            AZ_UNUSED(isStaged);
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        readInfo.m_readOutput = output;
+        readInfo.m_readSize = readSize;
+        readInfo.m_readOffset = readOffs;
+        readInfo.m_registeredBufferIndex = registeredBufferIndex;
+        if (!m_readQueue->QueueRead(m_readSlots_statusInfo[readSlot], file, output, readSize, readOffs, registeredBufferIndex))
+        {
+            // The submission queue is full, so try again after the queued reads have been submitted.
+            readInfo.Clear();
+            return false;
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+        m_queueDepthStat.PushSample(aznumeric_cast<double>(m_activeReads_Count));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the read queue to cancel them.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                m_readQueue->Cancel(m_readSlots_statusInfo[readSlot]);
+            }
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        AZ_Assert(IsServicedByThisDrive(fileExists.m_path.GetAbsolutePath()),
+            "FileExistsRequest was queued on a StorageDriveLinux that doesn't service files on the given path '%s'.",
+            fileExists.m_path.GetRelativePath());
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &attributes) == 0)
+        {
+            if (S_ISREG(attributes.st_mode))
+            {
+                cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+                fileExists.m_found = true;
+
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != InvalidFileDescriptor,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &attributes) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePath(), &attributes) != 0 || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFile(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] != InvalidFileDescriptor)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = InvalidFileDescriptor;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+                m_fileCache_isUnbuffered[cacheIndex] = false;
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+                m_fileCache_isUnbuffered[cacheIndex] = false;
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        bool hasWorked = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot])
+            {
+                AsyncReadStatus& status = m_readSlots_statusInfo[readSlot];
+                if (m_readSlots_readInfo[readSlot].m_continuationPending)
+                {
+                    hasWorked = true;
+                    if (status.m_cancelRequested.load(AZStd::memory_order_acquire))
+                    {
+                        // Nothing is in flight for this slot, so the cancel can be completed immediately.
+                        FinalizeSingleRequest(readSlot, -ECANCELED);
+                    }
+                    else
+                    {
+                        ContinueRead(readSlot);
+                    }
+                }
+                else if (status.m_completed.load(AZStd::memory_order_acquire))
+                {
+                    hasWorked = true;
+                    FinalizeSingleRequest(readSlot, status.m_result);
+                }
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::ContinueRead(size_t readSlot)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        const u64 bytesRead = fileReadInfo.m_bytesRead;
+        fileReadInfo.m_continuationPending = !m_readQueue->QueueRead(m_readSlots_statusInfo[readSlot],
+            m_fileCache_handles[fileReadInfo.m_fileHandleIndex], reinterpret_cast<u8*>(fileReadInfo.m_readOutput) + bytesRead,
+            fileReadInfo.m_readSize - bytesRead, fileReadInfo.m_readOffset + bytesRead, fileReadInfo.m_registeredBufferIndex);
+    }
+
+    void StorageDriveLinux::WaitForActiveReads()
+    {
+        if (!m_readQueue)
+        {
+            return;
+        }
+
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && !m_readSlots_readInfo[readSlot].m_continuationPending)
+            {
+                m_readQueue->Cancel(m_readSlots_statusInfo[readSlot]);
+            }
+        }
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && !m_readSlots_readInfo[readSlot].m_continuationPending)
+            {
+                // Reads that couldn't be canceled still complete, so this only waits for as long as the read takes.
+                AsyncReadStatus& status = m_readSlots_statusInfo[readSlot];
+                while (!status.m_completed.load(AZStd::memory_order_acquire))
+                {
+                    m_readQueue->Submit();
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s64 result)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        AsyncReadStatus& status = m_readSlots_statusInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the asynchronous read did not contain a read request.");
+
+        const u64 numBytesTransferred = result > 0 ? aznumeric_cast<u64>(result) : 0;
+        m_activeReads_ByteCount += numBytesTransferred;
+        fileReadInfo.m_bytesRead += numBytesTransferred;
+        fileReadInfo.m_continuationPending = false;
+
+        // The request could be reading more due to alignment requirements. It should however never read less than the amount of
+        // requested data.
+        const u64 requiredBytes = readCommand->m_size + fileReadInfo.m_copyBackOffset;
+        if (numBytesTransferred > 0 && fileReadInfo.m_bytesRead < requiredBytes &&
+            !status.m_cancelRequested.load(AZStd::memory_order_acquire))
+        {
+            // io_uring is allowed to complete a read with fewer bytes than requested, for instance when it gets interrupted.
+            // Only reaching the end of the file is an error, so continue reading where the previous read stopped. Unbuffered
+            // reads need to stay sector aligned, so the part of a sector that was read is read again.
+            const u64 previousBytesRead = fileReadInfo.m_bytesRead - numBytesTransferred;
+            if (m_fileCache_isUnbuffered[fileReadInfo.m_fileHandleIndex])
+            {
+                fileReadInfo.m_bytesRead = AZ_SIZE_ALIGN_DOWN(fileReadInfo.m_bytesRead, m_physicalSectorSize);
+            }
+            if (fileReadInfo.m_bytesRead > previousBytesRead)
+            {
+                ContinueRead(readSlot);
+                return;
+            }
+        }
+
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        const bool isSuccess = result >= 0 && fileReadInfo.m_bytesRead >= requiredBytes;
+        // A canceled read can also complete partially, in which case it's reported as canceled as well.
+        const bool isCanceled = result == -ECANCELED || (!isSuccess && status.m_cancelRequested.load(AZStd::memory_order_acquire));
+        const bool encounteredError = result < 0 && !isCanceled;
+        AZ_Error("StorageDriveLinux", !encounteredError, "Async file read operation for '%s' failed with error code %lli\n",
+            readCommand->m_path.GetRelativePath(), -result);
+
+        if (fileReadInfo.m_sectorAlignedOutput && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_sectorAlignedOutput) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+
+        // There's now a slot available to queue the next request, if there is one. The read will be submitted at the end of
+        // ExecuteRequests together with any other reads.
+        if (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readSlot))
+            {
+                m_pendingReadRequests.pop_front();
+            }
+        }
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    bool StorageDriveLinux::IsServicedByThisDrive(const char* filePath) const
+    {
+        // Mount points that are nested on top of this drive's mount points and belong to other devices are not detected here.
+        // The stack configuration places drives with more specific mount points higher in the stack so they get first pick.
+        for (const AZStd::string& drivePath : m_drivePaths)
+        {
+            if (strncmp(filePath, drivePath.c_str(), drivePath.length()) == 0)
+            {
+                const char next = filePath[drivePath.length()];
+                if (next == AZ_CORRECT_FILESYSTEM_SEPARATOR || (next == 0 && !drivePath.empty()))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Reads in flight (avg.)", m_queueDepthStat.GetAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Uses io_uring",
+                m_readQueue->GetBackend() == AsyncReadQueue::Backend::IoUring ? 1 : 0));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Uses registered buffers", m_readQueue->HasRegisteredBuffers() ? 1 : 0));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, SeeksName, m_seekPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, StagedReadsName, m_stagedReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != InvalidFileDescriptor)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/AsyncReadQueue_Linux.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use unbuffered reads (O_DIRECT) for the fastest possible read speeds by bypassing the Linux page cache. This
+            //! results in a faster read the first time a file is read, but subsequent reads will possibly be slower as those
+            //! could have been serviced from the page cache. Unbuffered reads have alignment restrictions. If a file system
+            //! doesn't support unbuffered reads, the drive will fall back to buffered reads for the files on it.
+            u8 m_enableUnbufferedReads : 1;
+            //! Use io_uring to keep reads in flight. If io_uring is disabled or not supported by the kernel, reads will be
+            //! issued from a small pool of threads instead.
+            u8 m_enableIoUring : 1;
+            //! Register the per-slot staging buffers with io_uring. This avoids the kernel mapping the buffer for every read
+            //! that needs to be realigned, but requires the buffers to be locked in memory.
+            u8 m_enableRegisteredBuffers : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param drivePaths The mount points of the file systems that are stored on this device. A single device can have
+        //!     multiple mount points.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param queueDepth The maximum number of reads that will be in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param stagingBufferSize The size of the sector aligned buffer that each read slot keeps around for reads that
+        //!     don't meet the alignment requirements for unbuffered reads. Reads that don't fit will allocate a temporary buffer.
+        //!     If zero, no staging buffers are created.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+            size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth, s32 overCommit, size_t stagingBufferSize,
+            ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr int InvalidFileDescriptor = -1;
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            void* m_readOutput{ nullptr };             // The address the read was issued for, either the output or the aligned buffer.
+            u64 m_readSize{ 0 };                       // The size of the read, including any alignment adjustments.
+            u64 m_readOffset{ 0 };                     // The offset of the read, including any alignment adjustments.
+            u64 m_bytesRead{ 0 };                      // The number of bytes that were read by completed (partial) reads.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            s32 m_registeredBufferIndex{ AsyncReadQueue::NoRegisteredBuffer };
+            bool m_usesStagingBuffer{ false };
+            bool m_continuationPending{ false };       // A partial read needs to be continued, but the queue was full.
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        void InitializeCaches();
+        OpenFileResult OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(const char* filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void CloseFile(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s64 result);
+        void ContinueRead(size_t readSlot);
+        void WaitForActiveReads();
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AZ::Statistics::RunningStatistic m_queueDepthStat;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+        AZ::Statistics::RunningStatistic m_stagedReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::unique_ptr<AsyncReadQueue> m_readQueue;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::unique_ptr<AsyncReadStatus[]> m_readSlots_statusInfo;
+        AZStd::vector<bool> m_readSlots_active;
+        // Sector aligned buffers, one per read slot, for reads that can't be done directly into the output buffer. These are
+        // registered with io_uring if possible.
+        AZStd::vector<u8*> m_readSlots_stagingBuffer;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isUnbuffered;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_stagingBufferSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
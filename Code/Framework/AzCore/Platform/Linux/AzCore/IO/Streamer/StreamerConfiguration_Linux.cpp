@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace AZ::IO
+{
+    static bool ReadSysFileValue(const AZStd::string& path, u64& value)
+    {
+        FILE* file = ::fopen(path.c_str(), "r");
+        if (file)
+        {
+            unsigned long long result = 0;
+            bool success = ::fscanf(file, "%llu", &result) == 1;
+            ::fclose(file);
+            if (success)
+            {
+                value = result;
+            }
+            return success;
+        }
+        return false;
+    }
+
+    // Paths in /proc/self/mountinfo have spaces, tabs, new lines and backslashes escaped as octal numbers, e.g. "\040".
+    static AZStd::string DecodeMountInfoPath(AZStd::string_view path)
+    {
+        AZStd::string result;
+        result.reserve(path.size());
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+            if (path[i] == '\\' && i + 3 < path.size() &&
+                path[i + 1] >= '0' && path[i + 1] <= '7' &&
+                path[i + 2] >= '0' && path[i + 2] <= '7' &&
+                path[i + 3] >= '0' && path[i + 3] <= '7')
+            {
+                result += static_cast<char>(((path[i + 1] - '0') << 6) | ((path[i + 2] - '0') << 3) | (path[i + 3] - '0'));
+                i += 3;
+            }
+            else
+            {
+                result += path[i];
+            }
+        }
+        return result;
+    }
+
+    static void CollectDriveProfile(AZStd::string_view deviceName, DriveInformation& information, bool reportHardware)
+    {
+        if (deviceName.starts_with("nvme"))
+        {
+            information.m_profile = "Nvme";
+        }
+        else if (deviceName.starts_with("mmcblk"))
+        {
+            information.m_profile = "Mmc";
+        }
+        else if (deviceName.starts_with("vd") || deviceName.starts_with("xvd"))
+        {
+            information.m_profile = "Virtual";
+        }
+        else if (deviceName.starts_with("sd"))
+        {
+            information.m_profile = "Scsi";
+        }
+        else
+        {
+            information.m_profile = "Generic";
+        }
+        information.m_profile += information.m_hasSeekPenalty ? "_HDD" : "_SSD";
+
+        if (reportHardware)
+        {
+            AZ_Printf("Streamer",
+                "    Bus: %s\n"
+                "    Drive type: %s\n",
+                information.m_profile.c_str(), information.m_hasSeekPenalty ? "HDD" : "SSD");
+        }
+    }
+
+    static void CollectQueueInformation(const AZStd::string& queuePath, DriveInformation& information, bool reportHardware)
+    {
+        u64 value = 0;
+        if (ReadSysFileValue(queuePath + "/physical_block_size", value) && value != 0)
+        {
+            information.m_physicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysFileValue(queuePath + "/logical_block_size", value) && value != 0)
+        {
+            information.m_logicalSectorSize = aznumeric_caster(value);
+        }
+        // max_sectors_kb is the limit the block layer currently uses to split requests, which is at most max_hw_sectors_kb.
+        if (ReadSysFileValue(queuePath + "/max_sectors_kb", value))
+        {
+            information.m_maxTransfer = aznumeric_caster(value * 1_kib);
+        }
+        if (ReadSysFileValue(queuePath + "/nr_requests", value))
+        {
+            information.m_ioChannelCount = aznumeric_caster(value);
+        }
+        if (ReadSysFileValue(queuePath + "/rotational", value))
+        {
+            information.m_hasSeekPenalty = value != 0;
+        }
+
+        if (reportHardware)
+        {
+            AZ_Printf(
+                "Streamer",
+                "    Max transfer: %.3f kb\n"
+                "    Max requests: %u\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n"
+                "    Has seek penalty: %s\n",
+                (1.0f / 1024.0f) * information.m_maxTransfer,
+                information.m_ioChannelCount,
+                information.m_physicalSectorSize,
+                information.m_logicalSectorSize,
+                information.m_hasSeekPenalty ? "Yes" : "No");
+        }
+    }
+
+    static bool IsMountPointUsed(AZStd::string_view mountPoint)
+    {
+        struct PathVisitor : SettingsRegistryInterface::Visitor
+        {
+            ~PathVisitor() override = default;
+
+            AZStd::string_view m_mountPoint;
+            bool m_firstObject = true;
+            bool m_found = false;
+
+            SettingsRegistryInterface::VisitResponse Traverse([[maybe_unused]] AZStd::string_view path,
+                [[maybe_unused]] AZStd::string_view valueName, [[maybe_unused]] SettingsRegistryInterface::VisitAction action,
+                [[maybe_unused]] SettingsRegistryInterface::Type type) override
+            {
+                if (m_found)
+                {
+                    return SettingsRegistryInterface::VisitResponse::Done;
+                }
+
+                if (type == SettingsRegistryInterface::Type::Object)
+                {
+                    if (m_firstObject)
+                    {
+                        m_firstObject = false;
+                        return SettingsRegistryInterface::VisitResponse::Continue;
+                    }
+                    else
+                    {
+                        return SettingsRegistryInterface::VisitResponse::Skip;
+                    }
+                }
+
+                return type == SettingsRegistryInterface::Type::String ?
+                    SettingsRegistryInterface::VisitResponse::Continue : SettingsRegistryInterface::VisitResponse::Skip;
+            }
+
+            using SettingsRegistryInterface::Visitor::Visit;
+            void Visit([[maybe_unused]] AZStd::string_view path, [[maybe_unused]] AZStd::string_view valueName,
+                [[maybe_unused]] AZ::SettingsRegistryInterface::Type type, AZStd::string_view value) override
+            {
+                // Only accept matches on a folder boundary so "/mnt/data" doesn't match "/mnt/database".
+                if (value.starts_with(m_mountPoint) &&
+                    (value.size() == m_mountPoint.size() || value[m_mountPoint.size()] == AZ_CORRECT_FILESYSTEM_SEPARATOR))
+                {
+                    m_found = true;
+                }
+            }
+        };
+        PathVisitor visitor;
+        visitor.m_mountPoint = mountPoint;
+        if (!mountPoint.empty() && mountPoint.back() == AZ_CORRECT_FILESYSTEM_SEPARATOR)
+        {
+            visitor.m_mountPoint.remove_suffix(1);
+        }
+
+        auto settingsRegistry = SettingsRegistry::Get();
+        settingsRegistry->Visit(visitor, SettingsRegistryMergeUtils::FilePathsRootKey);
+
+        return visitor.m_found;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        FILE* mountInfo = ::fopen("/proc/self/mountinfo", "r");
+        if (!mountInfo)
+        {
+            return false;
+        }
+
+        // Mapping from the sysfs queue folder of the device to the information about the device, so partitions and multiple
+        // mounts of the same device are handled by the same drive.
+        AZStd::unordered_map<AZStd::string, DriveInformation> driveMappings;
+
+        char line[4096];
+        while (::fgets(line, sizeof(line), mountInfo))
+        {
+            // Each line has the format:
+            //  <mount id> <parent id> <major>:<minor> <root> <mount point> <options> [optional fields] - <fs type> <source> <super options>
+            AZStd::fixed_vector<AZStd::string_view, 6> fields;
+            AZ::StringFunc::TokenizeVisitor(line,
+                [&fields](AZStd::string_view field)
+                {
+                    if (fields.size() < fields.capacity())
+                    {
+                        fields.push_back(field);
+                    }
+                }, " \n");
+            if (fields.size() < 5)
+            {
+                continue;
+            }
+
+            AZStd::string mountPoint = DecodeMountInfoPath(fields[4]);
+            unsigned int major = 0;
+            unsigned int minor = 0;
+            AZStd::string deviceNumber(fields[2]);
+            if (::sscanf(deviceNumber.c_str(), "%u:%u", &major, &minor) != 2 || major == 0)
+            {
+                // Major number 0 is used for file systems that aren't backed by a block device such as proc, tmpfs and overlay.
+                continue;
+            }
+
+            // Partitions don't have a queue folder, in which case the queue of the parent device is used.
+            AZStd::string queuePath = AZStd::string::format("/sys/dev/block/%u:%u/queue", major, minor);
+            if (::access(queuePath.c_str(), R_OK) != 0)
+            {
+                queuePath = AZStd::string::format("/sys/dev/block/%u:%u/../queue", major, minor);
+            }
+            char resolvedQueuePath[PATH_MAX];
+            if (!::realpath(queuePath.c_str(), resolvedQueuePath))
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Skipping mount point '%s' because the device information can't be retrieved.\n",
+                        mountPoint.c_str());
+                }
+                continue;
+            }
+
+            if (!addAllDrives && !IsMountPointUsed(mountPoint))
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Skipping mount point '%s' because no paths make use of it.\n", mountPoint.c_str());
+                }
+                continue;
+            }
+
+            auto driveInformationEntry = driveMappings.find(resolvedQueuePath);
+            if (driveInformationEntry == driveMappings.end())
+            {
+                // The queue folder is stored in the folder named after the device, e.g. /sys/devices/.../block/nvme0n1/queue.
+                AZStd::string_view deviceName(resolvedQueuePath);
+                deviceName.remove_suffix(deviceName.size() - deviceName.rfind(AZ_CORRECT_FILESYSTEM_SEPARATOR));
+                deviceName.remove_prefix(deviceName.rfind(AZ_CORRECT_FILESYSTEM_SEPARATOR) + 1);
+
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Drive info for '%.*s' mounted at '%s':\n", AZ_STRING_ARG(deviceName), mountPoint.c_str());
+                }
+
+                DriveInformation driveInformation;
+                driveInformation.m_paths.push_back(AZStd::move(mountPoint));
+                CollectQueueInformation(resolvedQueuePath, driveInformation, reportHardware);
+                CollectDriveProfile(deviceName, driveInformation, reportHardware);
+
+                hardwareInfo.m_maxPhysicalSectorSize =
+                    AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+                hardwareInfo.m_maxLogicalSectorSize =
+                    AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+                hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+
+                driveMappings.emplace(resolvedQueuePath, AZStd::move(driveInformation));
+
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "\n");
+                }
+            }
+            else
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Mount point '%s' is on the same storage drive as '%s'.\n",
+                        mountPoint.c_str(), driveInformationEntry->second.m_paths[0].c_str());
+                }
+                driveInformationEntry->second.m_paths.push_back(AZStd::move(mountPoint));
+            }
+        }
+        ::fclose(mountInfo);
+
+        if (driveMappings.empty())
+        {
+            return false;
+        }
+
+        DriveList driveList;
+        driveList.reserve(driveMappings.size());
+        for (auto& drive : driveMappings)
+        {
+            driveList.push_back(AZStd::move(drive.second));
+        }
+        // Mount points can be nested, for instance "/home" can be on a different device than "/". Sort the drives so the ones
+        // with the deepest mount point come last, as those will end up higher in the stack and get the first chance to
+        // claim a file.
+        auto deepestMountPoint = [](const DriveInformation& drive)
+        {
+            size_t length = 0;
+            for (const AZStd::string& path : drive.m_paths)
+            {
+                length = AZStd::max(length, path.length());
+            }
+            return length;
+        };
+        AZStd::sort(driveList.begin(), driveList.end(),
+            [&deepestMountPoint](const DriveInformation& lhs, const DriveInformation& rhs)
+            {
+                return deepestMountPoint(lhs) < deepestMountPoint(rhs);
+            });
+
+        hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, aznumeric_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+        hardwareInfo.m_profile = driveList.size() == 1 ? driveList.front().m_profile : "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    struct DriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::DriveInformation, "{E09B2F77-6477-4381-9F16-CF7B21A848B4}");
+
+        //! The mount points of all file systems on the block device.
+        AZStd::vector<AZStd::string> m_paths;
+        AZStd::string m_profile;
+        size_t m_physicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_logicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_maxTransfer{ 0 };
+        //! The number of requests the block layer queues for the device.
+        u32 m_ioChannelCount{ 0 };
+        bool m_hasSeekPenalty{ true };
+    };
+
+    //! List of detected block devices. Devices are sorted so devices with deeper mount points come later.
+    using DriveList = AZStd::vector<DriveInformation>;
+} // namespace AZ::IO
@@ -35,6 +35,7 @@ set(FILES
     ../Common/WinAPI/AzCore/Debug/Trace_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
+    ../Common/WinAPI/AzCore/IO/MappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
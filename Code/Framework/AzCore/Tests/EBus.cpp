@@ -1848,6 +1848,235 @@ namespace UnitTest
 
     }
 
+    namespace LocklessQueueTest
+    {
+        class LocklessQueueEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            static const bool EnableEventQueue = true;
+            static const bool LocklessEventQueue = true;
+            static const size_t LocklessEventQueueCapacity = 64;
+            using EventQueueMutexType = AZStd::mutex;
+            //////////////////////////////////////////////////////////////////////////
+        };
+        using LocklessQueueBus = AZ::EBus<LocklessQueueEvents>;
+
+        //! Leaves the mutexes and the capacity at their defaults, the overflow queue still has to be locked.
+        class DefaultMutexLocklessQueueEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            static const bool EnableEventQueue = true;
+            static const bool LocklessEventQueue = true;
+            //////////////////////////////////////////////////////////////////////////
+        };
+        using DefaultMutexLocklessQueueBus = AZ::EBus<DefaultMutexLocklessQueueEvents>;
+
+        //! Tracks how often a message was run and destroyed, the padding makes it too large for the inline storage of a slot.
+        template <size_t PaddingSize>
+        struct TrackedMessage
+        {
+            TrackedMessage(int* runCount, int* destroyCount)
+                : m_runCount(runCount)
+                , m_destroyCount(destroyCount)
+            {
+            }
+            TrackedMessage(TrackedMessage&& other)
+                : m_runCount(other.m_runCount)
+                , m_destroyCount(other.m_destroyCount)
+            {
+                other.m_destroyCount = nullptr;
+            }
+            TrackedMessage(const TrackedMessage& other)
+                : m_runCount(other.m_runCount)
+                , m_destroyCount(other.m_destroyCount)
+            {
+            }
+            ~TrackedMessage()
+            {
+                if (m_destroyCount)
+                {
+                    ++(*m_destroyCount);
+                }
+            }
+            void operator()() const
+            {
+                ++(*m_runCount);
+            }
+
+            int* m_runCount;
+            int* m_destroyCount;
+            char m_padding[PaddingSize] = {};
+        };
+    }
+
+    TEST_F(QueueEbusTest, LocklessQueue_QueueFromManyThreads_RunsAllMessagesInProducerOrder)
+    {
+        using namespace LocklessQueueTest;
+
+        constexpr int numProducers = 8;
+        constexpr int numMessages = 2000;
+        AZStd::vector<int> lastMessage(numProducers, -1);
+        AZStd::atomic_int numRun{ 0 };
+        AZStd::atomic_bool inOrder{ true };
+
+        auto runMessage = [&](int producer, int message)
+        {
+            // Only the consumer thread runs messages, no need to synchronize lastMessage.
+            if (lastMessage[producer] + 1 != message)
+            {
+                inOrder = false;
+            }
+            lastMessage[producer] = message;
+            ++numRun;
+        };
+
+        AZStd::thread producers[numProducers];
+        for (int producer = 0; producer < numProducers; ++producer)
+        {
+            producers[producer] = AZStd::thread([producer, &runMessage]()
+            {
+                for (int message = 0; message < numMessages; ++message)
+                {
+                    LocklessQueueBus::QueueFunction(runMessage, producer, message);
+                }
+            });
+        }
+
+        // The producers outrun the small ring, so part of the messages go through the overflow queue.
+        while (numRun < numProducers * numMessages)
+        {
+            LocklessQueueBus::ExecuteQueuedEvents();
+            AZStd::this_thread::yield();
+        }
+
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        EXPECT_TRUE(inOrder);
+        EXPECT_EQ(numProducers * numMessages, numRun);
+        EXPECT_EQ(0, LocklessQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(QueueEbusTest, LocklessQueue_OverflowFromManyThreadsWithDefaultMutex_RunsAllMessagesInProducerOrder)
+    {
+        using namespace LocklessQueueTest;
+
+        constexpr int numProducers = 8;
+        constexpr int numMessages = 2000;
+        static_assert(static_cast<size_t>(numProducers * numMessages) > DefaultMutexLocklessQueueEvents::LocklessEventQueueCapacity,
+            "The producers have to overflow the ring.");
+        AZStd::vector<int> lastMessage(numProducers, -1);
+        int numRun = 0;
+        bool inOrder = true;
+
+        auto runMessage = [&](int producer, int message)
+        {
+            if (lastMessage[producer] + 1 != message)
+            {
+                inOrder = false;
+            }
+            lastMessage[producer] = message;
+            ++numRun;
+        };
+
+        // Nothing is executed until all producers are done, so they all queue into the overflow queue at the same time.
+        AZStd::thread producers[numProducers];
+        for (int producer = 0; producer < numProducers; ++producer)
+        {
+            producers[producer] = AZStd::thread([producer, &runMessage]()
+            {
+                for (int message = 0; message < numMessages; ++message)
+                {
+                    DefaultMutexLocklessQueueBus::QueueFunction(runMessage, producer, message);
+                }
+            });
+        }
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        EXPECT_EQ(numProducers * numMessages, DefaultMutexLocklessQueueBus::QueuedEventCount());
+        DefaultMutexLocklessQueueBus::ExecuteQueuedEvents();
+
+        EXPECT_TRUE(inOrder);
+        EXPECT_EQ(numProducers * numMessages, numRun);
+        EXPECT_EQ(0, DefaultMutexLocklessQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(QueueEbusTest, LocklessQueue_QueuePastCapacity_RunsAllMessagesInOrder)
+    {
+        using namespace LocklessQueueTest;
+
+        constexpr size_t numMessages = LocklessQueueEvents::LocklessEventQueueCapacity * 3;
+        AZStd::vector<size_t> messages;
+        for (size_t message = 0; message < numMessages; ++message)
+        {
+            LocklessQueueBus::QueueFunction([&messages](size_t value) { messages.push_back(value); }, message);
+        }
+        EXPECT_EQ(numMessages, LocklessQueueBus::QueuedEventCount());
+
+        LocklessQueueBus::ExecuteQueuedEvents();
+        ASSERT_EQ(numMessages, messages.size());
+        for (size_t message = 0; message < numMessages; ++message)
+        {
+            EXPECT_EQ(message, messages[message]);
+        }
+        EXPECT_EQ(0, LocklessQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(QueueEbusTest, LocklessQueue_QueueDuringExecute_RunsOnNextExecute)
+    {
+        using namespace LocklessQueueTest;
+
+        int numRun = 0;
+        auto requeue = [&numRun]()
+        {
+            ++numRun;
+            LocklessQueueBus::QueueFunction([&numRun]() { ++numRun; });
+        };
+        LocklessQueueBus::QueueFunction(requeue);
+
+        LocklessQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(1, numRun);
+        EXPECT_EQ(1, LocklessQueueBus::QueuedEventCount());
+
+        LocklessQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(2, numRun);
+        EXPECT_EQ(0, LocklessQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(QueueEbusTest, LocklessQueue_InlineAndAllocatedMessages_AreDestroyedOnce)
+    {
+        using namespace LocklessQueueTest;
+
+        int runCount = 0;
+        int destroyCount = 0;
+        LocklessQueueBus::QueueFunction(TrackedMessage<8>(&runCount, &destroyCount));
+        LocklessQueueBus::QueueFunction(TrackedMessage<256>(&runCount, &destroyCount));
+        LocklessQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(2, runCount);
+        EXPECT_EQ(2, destroyCount);
+
+        // Clearing destroys the messages without running them.
+        runCount = 0;
+        destroyCount = 0;
+        LocklessQueueBus::QueueFunction(TrackedMessage<8>(&runCount, &destroyCount));
+        LocklessQueueBus::QueueFunction(TrackedMessage<256>(&runCount, &destroyCount));
+        LocklessQueueBus::ClearQueuedEvents();
+        EXPECT_EQ(0, runCount);
+        EXPECT_EQ(2, destroyCount);
+        EXPECT_EQ(0, LocklessQueueBus::QueuedEventCount());
+    }
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
@@ -4686,6 +4915,85 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Multithreaded Queued Events
+    //////////////////////////////////////////////////////////////////////////
+
+    template <bool IsLockless>
+    class QueueThroughputEvents
+        : public AZ::EBusTraits
+    {
+    public:
+        static const bool EnableEventQueue = true;
+        static const bool LocklessEventQueue = IsLockless;
+        static const size_t LocklessEventQueueCapacity = 8192;
+        using EventQueueMutexType = AZStd::mutex;
+    };
+    using MutexQueueBus = AZ::EBus<QueueThroughputEvents<false>>;
+    using LocklessQueueBus = AZ::EBus<QueueThroughputEvents<true>>;
+
+    static void CountQueuedMessage(AZStd::atomic_int* numRun)
+    {
+        numRun->fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    // The benchmark thread executes the queued events while the number of producer threads in the argument queue them.
+    template <typename Bus>
+    static void BM_EBus_QueueFunction_Producers(::benchmark::State& state)
+    {
+        constexpr int messagesPerProducer = 256;
+        const int numProducers = static_cast<int>(state.range(0));
+        const int numMessages = numProducers * messagesPerProducer;
+
+        AZStd::atomic_int round{ 0 };
+        AZStd::atomic_int numRun{ 0 };
+        AZStd::atomic_bool done{ false };
+
+        AZStd::vector<AZStd::thread> producers;
+        producers.reserve(numProducers);
+        for (int producer = 0; producer < numProducers; ++producer)
+        {
+            producers.emplace_back([&]()
+            {
+                int producedRound = 0;
+                while (!done.load(AZStd::memory_order_acquire))
+                {
+                    if (round.load(AZStd::memory_order_acquire) == producedRound)
+                    {
+                        AZStd::this_thread::yield();
+                        continue;
+                    }
+                    ++producedRound;
+                    for (int message = 0; message < messagesPerProducer; ++message)
+                    {
+                        Bus::QueueFunction(&CountQueuedMessage, &numRun);
+                    }
+                }
+            });
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            numRun.store(0, AZStd::memory_order_relaxed);
+            round.fetch_add(1, AZStd::memory_order_release);
+            while (numRun.load(AZStd::memory_order_relaxed) < numMessages)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        }
+
+        done.store(true, AZStd::memory_order_release);
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+        Bus::ClearQueuedEvents();
+
+        state.SetItemsProcessed(state.iterations() * numMessages);
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_QueueFunction_Producers, MutexQueueBus)->RangeMultiplier(2)->Range(1, 32)->ArgName("Producers")->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_QueueFunction_Producers, LocklessQueueBus)->RangeMultiplier(2)->Range(1, 32)->ArgName("Producers")->UseRealTime();
 }
 
 #endif // HAVE_BENCHMARK
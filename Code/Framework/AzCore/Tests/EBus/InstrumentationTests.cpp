@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/Instrumentation.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class InstrumentationTestRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        virtual void First(int value) = 0;
+        virtual void Second(int value) = 0;
+    };
+    using InstrumentationTestRequestBus = AZ::EBus<InstrumentationTestRequests>;
+
+    class InstrumentationTestNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        virtual void OnNotify() = 0;
+    };
+    using InstrumentationTestNotificationBus = AZ::EBus<InstrumentationTestNotifications>;
+
+    // The names of the events outlive the stats, so the naming tests use a bus of their own.
+    class InstrumentationNamingTestRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        virtual void Named(int value) = 0;
+        virtual void Unnamed(int value) = 0;
+    };
+    using InstrumentationNamingTestRequestBus = AZ::EBus<InstrumentationNamingTestRequests>;
+
+    class EBusInstrumentationTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AZ::EBusInstrumentation::ResetStats();
+        }
+
+        void TearDown() override
+        {
+            AZ::EBusInstrumentation::ResetStats();
+            AllocatorsFixture::TearDown();
+        }
+
+    protected:
+        template <class Bus, class Function>
+        static AZ::Internal::EBusDispatchScope RecordDispatch(Function func, const char* eventText = nullptr)
+        {
+            return AZ::Internal::EBusDispatchScope(Bus::GetName(), AZ::Internal::GetEBusEventSignature<Function>(), AZ::Internal::GetEBusEventKey(func), eventText);
+        }
+
+        static const AZ::EBusInstrumentation::BusStats* FindBus(const AZStd::vector<AZ::EBusInstrumentation::BusStats>& stats, const char* name)
+        {
+            for (const AZ::EBusInstrumentation::BusStats& bus : stats)
+            {
+                if (strstr(bus.m_busName, name))
+                {
+                    return &bus;
+                }
+            }
+            return nullptr;
+        }
+
+        static const AZ::EBusInstrumentation::EventStats* FindEvent(const AZ::EBusInstrumentation::BusStats& bus, const char* name)
+        {
+            for (const AZ::EBusInstrumentation::EventStats& event : bus.m_events)
+            {
+                if (strcmp(event.m_eventName, name) == 0)
+                {
+                    return &event;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    TEST_F(EBusInstrumentationTests, DispatchScope_NestedDispatches_RecordCallsHandlersAndInclusiveTime)
+    {
+        for (int dispatch = 0; dispatch < 2; ++dispatch)
+        {
+            auto requestScope = RecordDispatch<InstrumentationTestRequestBus>(&InstrumentationTestRequests::First);
+            AZ::Internal::EBusDispatchScope::OnHandlerCall();
+            {
+                auto notificationScope = RecordDispatch<InstrumentationTestNotificationBus>(&InstrumentationTestNotifications::OnNotify);
+                AZ::Internal::EBusDispatchScope::OnHandlerCall();
+                AZ::Internal::EBusDispatchScope::OnHandlerCall();
+                AZ::Internal::EBusDispatchScope::OnHandlerCall();
+            }
+            // Handler calls after a nested dispatch count for the outer dispatch again.
+            AZ::Internal::EBusDispatchScope::OnHandlerCall();
+        }
+
+        const AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        ASSERT_EQ(2, stats.size());
+
+        const AZ::EBusInstrumentation::BusStats* requestBus = FindBus(stats, "InstrumentationTestRequests");
+        const AZ::EBusInstrumentation::BusStats* notificationBus = FindBus(stats, "InstrumentationTestNotifications");
+        ASSERT_NE(nullptr, requestBus);
+        ASSERT_NE(nullptr, notificationBus);
+
+        EXPECT_EQ(2, requestBus->m_dispatchCount);
+        EXPECT_EQ(4, requestBus->m_handlerCallCount);
+        EXPECT_EQ(2, notificationBus->m_dispatchCount);
+        EXPECT_EQ(6, notificationBus->m_handlerCallCount);
+
+        // The time is inclusive, so the outer dispatch took at least as long as the one nested in it, and sorts first.
+        EXPECT_GE(requestBus->m_inclusiveTimeNs, notificationBus->m_inclusiveTimeNs);
+        EXPECT_EQ(requestBus, &stats[0]);
+    }
+
+    TEST_F(EBusInstrumentationTests, DispatchScope_EventsOfTheSameType_AreRecordedSeparately)
+    {
+        for (int dispatch = 0; dispatch < 3; ++dispatch)
+        {
+            auto scope = RecordDispatch<InstrumentationTestRequestBus>(&InstrumentationTestRequests::First);
+        }
+        {
+            auto scope = RecordDispatch<InstrumentationTestRequestBus>(&InstrumentationTestRequests::Second);
+        }
+
+        const AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        ASSERT_EQ(1, stats.size());
+        EXPECT_EQ(4, stats[0].m_dispatchCount);
+        ASSERT_EQ(2, stats[0].m_events.size());
+        EXPECT_NE(stats[0].m_events[0].m_eventName, stats[0].m_events[1].m_eventName);
+        EXPECT_EQ(4, stats[0].m_events[0].m_dispatchCount + stats[0].m_events[1].m_dispatchCount);
+    }
+
+    TEST_F(EBusInstrumentationTests, DispatchScope_NamedCallSite_EventIsReportedByName)
+    {
+        {
+            auto scope = RecordDispatch<InstrumentationTestRequestBus>(&InstrumentationTestRequests::First, " First, value * 2");
+        }
+        {
+            auto scope = RecordDispatch<InstrumentationTestRequestBus>(&InstrumentationTestRequests::Second, "Second");
+        }
+
+        const AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        ASSERT_EQ(1u, stats.size());
+        ASSERT_EQ(2u, stats[0].m_events.size());
+        const AZ::EBusInstrumentation::EventStats* first = FindEvent(stats[0], "First");
+        const AZ::EBusInstrumentation::EventStats* second = FindEvent(stats[0], "Second");
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(1u, first->m_dispatchCount);
+        EXPECT_EQ(1u, second->m_dispatchCount);
+    }
+
+    TEST_F(EBusInstrumentationTests, DispatchScope_EventNamedAtAnotherCallSite_UnnamedDispatchesUseTheName)
+    {
+        // The unnamed dispatch comes first, it is renamed once a call site names the event.
+        {
+            auto scope = RecordDispatch<InstrumentationNamingTestRequestBus>(&InstrumentationNamingTestRequests::Named);
+        }
+        {
+            auto scope = RecordDispatch<InstrumentationNamingTestRequestBus>(&InstrumentationNamingTestRequests::Named, "Named, 1");
+        }
+        {
+            auto scope = RecordDispatch<InstrumentationNamingTestRequestBus>(&InstrumentationNamingTestRequests::Named);
+        }
+        {
+            auto scope = RecordDispatch<InstrumentationNamingTestRequestBus>(&InstrumentationNamingTestRequests::Unnamed);
+        }
+
+        const AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        ASSERT_EQ(1u, stats.size());
+        ASSERT_EQ(2u, stats[0].m_events.size());
+        const AZ::EBusInstrumentation::EventStats* named = FindEvent(stats[0], "Named");
+        ASSERT_NE(nullptr, named);
+        EXPECT_EQ(3u, named->m_dispatchCount);
+
+        // The event that was never named is listed by its type, without the value of the member function pointer.
+        const AZ::EBusInstrumentation::EventStats& unnamed = named == &stats[0].m_events[0] ? stats[0].m_events[1] : stats[0].m_events[0];
+        EXPECT_NE(nullptr, strstr(unnamed.m_eventName, "InstrumentationNamingTestRequests"));
+        EXPECT_EQ(nullptr, strstr(unnamed.m_eventName, "0x"));
+    }
+
+    TEST_F(EBusInstrumentationTests, DispatchScope_ManyThreads_StatsAreSummed)
+    {
+        constexpr int numThreads = 4;
+        constexpr int numDispatches = 100;
+
+        AZStd::thread threads[numThreads];
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([]()
+            {
+                for (int dispatch = 0; dispatch < numDispatches; ++dispatch)
+                {
+                    auto scope = RecordDispatch<InstrumentationTestNotificationBus>(&InstrumentationTestNotifications::OnNotify);
+                    AZ::Internal::EBusDispatchScope::OnHandlerCall();
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        ASSERT_EQ(1, stats.size());
+        EXPECT_EQ(numThreads * numDispatches, stats[0].m_dispatchCount);
+        EXPECT_EQ(numThreads * numDispatches, stats[0].m_handlerCallCount);
+        ASSERT_EQ(1, stats[0].m_events.size());
+
+        AZ::EBusInstrumentation::ResetStats();
+        stats = AZ::EBusInstrumentation::GetStats();
+        EXPECT_TRUE(stats.empty());
+    }
+
+#if AZ_EBUS_INSTRUMENTATION
+    class InstrumentationTestHandler
+        : public InstrumentationTestNotificationBus::Handler
+    {
+    public:
+        InstrumentationTestHandler() { BusConnect(); }
+        ~InstrumentationTestHandler() override { BusDisconnect(); }
+        void OnNotify() override {}
+    };
+
+    TEST_F(EBusInstrumentationTests, Broadcast_InstrumentationEnabled_RecordsFanOut)
+    {
+        InstrumentationTestHandler handlers[3];
+        InstrumentationTestNotificationBus::Broadcast(&InstrumentationTestNotifications::OnNotify);
+        InstrumentationTestNotificationBus::Broadcast(&InstrumentationTestNotifications::OnNotify);
+
+        const AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        const AZ::EBusInstrumentation::BusStats* notificationBus = FindBus(stats, "InstrumentationTestNotifications");
+        ASSERT_NE(nullptr, notificationBus);
+        EXPECT_EQ(2, notificationBus->m_dispatchCount);
+        EXPECT_EQ(6, notificationBus->m_handlerCallCount);
+    }
+
+    TEST_F(EBusInstrumentationTests, EventMacro_InstrumentationEnabled_RecordsEventName)
+    {
+        InstrumentationTestHandler handler;
+        EBUS_EVENT(InstrumentationTestNotificationBus, OnNotify);
+
+        const AZStd::vector<AZ::EBusInstrumentation::BusStats> stats = AZ::EBusInstrumentation::GetStats();
+        const AZ::EBusInstrumentation::BusStats* notificationBus = FindBus(stats, "InstrumentationTestNotifications");
+        ASSERT_NE(nullptr, notificationBus);
+        ASSERT_EQ(1u, notificationBus->m_events.size());
+        EXPECT_STREQ("OnNotify", notificationBus->m_events[0].m_eventName);
+    }
+#endif // AZ_EBUS_INSTRUMENTATION
+} // namespace UnitTest
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    class FrameAllocatorTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        static constexpr size_t ChunkSize = 1024;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::FrameAllocator::Descriptor desc;
+            desc.m_chunkSize = ChunkSize;
+            desc.m_isUseAfterFrameDetection = true;
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::FrameAllocator& GetFrameAllocator()
+        {
+            return static_cast<AZ::FrameAllocator&>(AZ::AllocatorInstance<AZ::FrameAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameAllocatorTests, Allocate_RespectsAlignmentAndDoesNotOverlap)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+        char* first = static_cast<char*>(allocator.Allocate(24, 8));
+        char* second = static_cast<char*>(allocator.Allocate(64, 64));
+        char* third = static_cast<char*>(allocator.Allocate(3 * ChunkSize, 16)); // bigger than a chunk
+
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        ASSERT_NE(nullptr, third);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) % 64);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(third) % 16);
+        EXPECT_TRUE(first + 24 <= second || second + 64 <= first);
+        EXPECT_EQ(24, allocator.AllocationSize(first));
+        EXPECT_GE(allocator.NumAllocatedBytes(), 24 + 64 + 3 * ChunkSize);
+    }
+
+    TEST_F(FrameAllocatorTests, AdvanceFrame_MemoryExpiresAfterTheNextFrame)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+        const AZ::u64 firstFrame = GetFrameAllocator().GetFrame();
+        void* first = allocator.Allocate(256, 8);
+        memset(first, 1, 256);
+
+        GetFrameAllocator().AdvanceFrame();
+        allocator.Allocate(256, 8);
+        // Memory from the previous frame is still valid and counted
+        EXPECT_GE(allocator.NumAllocatedBytes(), 512);
+        const size_t capacity = allocator.Capacity();
+
+        GetFrameAllocator().AdvanceFrame();
+        void* third = allocator.Allocate(256, 8);
+        EXPECT_EQ(firstFrame + 2, GetFrameAllocator().GetFrame());
+        // The first frame's arena was reset and its chunk is reused
+        EXPECT_LT(allocator.NumAllocatedBytes(), 1024);
+        EXPECT_EQ(capacity, allocator.Capacity());
+        EXPECT_EQ(first, third);
+    }
+
+    TEST_F(FrameAllocatorTests, DeAllocateAndResize_LastAllocation_GivesMemoryBack)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+        void* first = allocator.Allocate(128, 8);
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        // Only the most recent allocation can grow in place
+        void* second = allocator.Allocate(128, 8);
+        EXPECT_EQ(0, allocator.Resize(first, 256));
+        EXPECT_EQ(256, allocator.Resize(second, 256));
+        EXPECT_EQ(256, allocator.AllocationSize(second));
+
+        allocator.DeAllocate(second, 256);
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+        EXPECT_EQ(second, allocator.Allocate(128, 8));
+    }
+
+    TEST_F(FrameAllocatorTests, FrameVector_GrowsInPlace)
+    {
+        AZ::FrameVector<int> values;
+        for (int i = 0; i < 100; ++i)
+        {
+            values.push_back(i);
+        }
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+        // Growing in place means no copies of the old storage were left behind
+        EXPECT_LT(AZ::AllocatorInstance<AZ::FrameAllocator>::Get().NumAllocatedBytes(), values.capacity() * sizeof(int) + 64);
+    }
+
+    TEST_F(FrameAllocatorTests, Allocate_FromManyThreads_UsesSeparateArenas)
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationCount = 1000;
+        AZStd::array<AZStd::thread, ThreadCount> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([threadIndex]()
+            {
+                AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+                AZStd::vector<AZ::u32*> allocations;
+                for (size_t i = 0; i < AllocationCount; ++i)
+                {
+                    AZ::u32* value = static_cast<AZ::u32*>(allocator.Allocate(sizeof(AZ::u32), alignof(AZ::u32)));
+                    *value = static_cast<AZ::u32>(threadIndex * AllocationCount + i);
+                    allocations.push_back(value);
+                }
+                for (size_t i = 0; i < AllocationCount; ++i)
+                {
+                    EXPECT_EQ(threadIndex * AllocationCount + i, *allocations[i]);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_GE(AZ::AllocatorInstance<AZ::FrameAllocator>::Get().NumAllocatedBytes(), ThreadCount * AllocationCount * sizeof(AZ::u32));
+    }
+
+    TEST_F(FrameAllocatorTests, ThreadExit_NoNewThread_ChunksFreedAfterMemoryExpired)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+        const size_t initialCapacity = allocator.Capacity();
+
+        AZStd::thread thread([&allocator]()
+        {
+            allocator.Allocate(ChunkSize / 2, 8);
+        });
+        thread.join();
+        EXPECT_GT(allocator.Capacity(), initialCapacity);
+
+        // the memory of the exited thread is valid until the end of the next frame
+        GetFrameAllocator().AdvanceFrame();
+        EXPECT_GT(allocator.Capacity(), initialCapacity);
+        GetFrameAllocator().AdvanceFrame();
+        EXPECT_EQ(initialCapacity, allocator.Capacity());
+    }
+
+    TEST_F(FrameAllocatorTests, ThreadExit_NewThread_ReusesThreadData)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+
+        AZStd::thread firstThread([&allocator]()
+        {
+            allocator.Allocate(ChunkSize / 4, 8);
+        });
+        firstThread.join();
+        const size_t capacity = allocator.Capacity();
+
+        // the second thread continues in the chunk of the first one
+        AZStd::thread secondThread([&allocator]()
+        {
+            allocator.Allocate(ChunkSize / 4, 8);
+        });
+        secondThread.join();
+        EXPECT_EQ(capacity, allocator.Capacity());
+        EXPECT_GE(allocator.NumAllocatedBytes(), ChunkSize / 2);
+    }
+
+    TEST_F(FrameAllocatorTests, DeAllocate_AfterFrameExpired_ReportsError)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+        void* allocation = allocator.Allocate(64, 8);
+        GetFrameAllocator().AdvanceFrame();
+        GetFrameAllocator().AdvanceFrame();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        allocator.DeAllocate(allocation, 64);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(FrameAllocatorTests, Write_AfterFrameExpired_ReportsError)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameAllocator>::Get();
+        // Fill two chunks, reset chunks are reused oldest first so the chunk of the first allocation is reused last
+        char* expired = static_cast<char*>(allocator.Allocate(ChunkSize / 2, 8));
+        allocator.Allocate(ChunkSize / 2, 8);
+        GetFrameAllocator().AdvanceFrame();
+        GetFrameAllocator().AdvanceFrame();
+
+        allocator.Allocate(ChunkSize / 2, 8);
+        expired[0] = 1;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        allocator.Allocate(ChunkSize / 2, 8);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FrameAllocatorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::FrameAllocator::Descriptor desc;
+            desc.m_isUseAfterFrameDetection = false;
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Create(desc);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        template<class Allocator>
+        static void BM_FrameTemporaries(::benchmark::State& state)
+        {
+            AZ::FrameAllocator& frameAllocator = static_cast<AZ::FrameAllocator&>(AZ::AllocatorInstance<AZ::FrameAllocator>::GetAllocator());
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // A frame worth of short lived vectors, the way culling or replication gathers its candidates
+                for (int64_t vectorIndex = 0; vectorIndex < state.range(0); ++vectorIndex)
+                {
+                    AZStd::vector<AZ::u64, AZ::AZStdAlloc<Allocator>> values;
+                    for (AZ::u64 i = 0; i < 64; ++i)
+                    {
+                        values.push_back(i);
+                    }
+                    ::benchmark::DoNotOptimize(values.data());
+                }
+                frameAllocator.AdvanceFrame();
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+    };
+
+    BENCHMARK_DEFINE_F(FrameAllocatorBenchmarkFixture, FrameTemporaries_SystemAllocator)(::benchmark::State& state)
+    {
+        BM_FrameTemporaries<AZ::SystemAllocator>(state);
+    }
+    BENCHMARK_REGISTER_F(FrameAllocatorBenchmarkFixture, FrameTemporaries_SystemAllocator)->Arg(100)->Arg(1000);
+
+    BENCHMARK_DEFINE_F(FrameAllocatorBenchmarkFixture, FrameTemporaries_FrameAllocator)(::benchmark::State& state)
+    {
+        BM_FrameTemporaries<AZ::FrameAllocator>(state);
+    }
+    BENCHMARK_REGISTER_F(FrameAllocatorBenchmarkFixture, FrameTemporaries_FrameAllocator)->Arg(100)->Arg(1000);
+}
+#endif // HAVE_BENCHMARK
@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -111,6 +112,104 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_isThreadCacheEnabled = true;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+
+        static void AllocateAndFreeSmallBlocks(size_t rounds)
+        {
+            AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+            AZStd::array<void*, 100> allocations;
+            for (size_t round = 0; round < rounds; ++round)
+            {
+                for (size_t i = 0; i < allocations.size(); ++i)
+                {
+                    allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+                    EXPECT_NE(nullptr, allocations[i]);
+                }
+                for (size_t i = 0; i < allocations.size(); ++i)
+                {
+                    allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+                }
+            }
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadCache_SmallAllocations_HitCacheAndDoNotCountAsAllocated)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        AllocateAndFreeSmallBlocks(4);
+
+        size_t hits = 0;
+        size_t misses = 0;
+        allocator.GetThreadCacheHitCounts(hits, misses);
+        EXPECT_GT(misses, 0u);
+        EXPECT_GT(hits, misses);
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadCache_ThreadExit_ReturnsBlocksAndKeepsCounts)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        AZStd::array<AZStd::thread, 4> threads;
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread([]() { AllocateAndFreeSmallBlocks(4); });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        size_t hits = 0;
+        size_t misses = 0;
+        allocator.GetThreadCacheHitCounts(hits, misses);
+        EXPECT_GT(hits, 0u);
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadCache_FreeOnOtherThread_Succeeds)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        AZStd::array<void*, 100> allocations;
+        for (void*& allocation : allocations)
+        {
+            allocation = allocator.Allocate(32, 0);
+        }
+        AZStd::thread freeThread([&allocations]()
+        {
+            for (void* allocation : allocations)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocation, 32);
+            }
+        });
+        freeThread.join();
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
 }
 
 
@@ -193,6 +292,74 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // range(0) enables the thread caches, every thread allocates and frees short lived small blocks like containers do
+    class HphaSchemaThreadedBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            if (state.thread_index == 0)
+            {
+                HphaSchema_TestAllocator::Descriptor desc;
+                desc.m_isThreadCacheEnabled = state.range(0) != 0;
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+            }
+        }
+
+        void internalTearDown(const benchmark::State& state)
+        {
+            if (state.thread_index == 0)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(HphaSchemaThreadedBenchmarkFixture, SmallAllocationsThreaded)(benchmark::State& state)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        AZStd::array<void*, 64> allocations;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+            }
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * allocations.size());
+
+        if (state.thread_index == 0 && state.range(0) != 0)
+        {
+            size_t hits = 0;
+            size_t misses = 0;
+            allocator.GetThreadCacheHitCounts(hits, misses);
+            state.counters["HitRate"] = hits + misses ? static_cast<double>(hits) / (hits + misses) : 0.0;
+        }
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaThreadedBenchmarkFixture, SmallAllocationsThreaded)->Arg(0)->Arg(1)->ThreadRange(1, 16)->UseRealTime();
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
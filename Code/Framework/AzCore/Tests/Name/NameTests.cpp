@@ -48,14 +48,29 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            size_t count = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                count += shard.m_dictionary.size();
+            }
+            return count;
         }
-        
-        static size_t GetEntryCount()
+
+        static bool ContainsEntry(AZStd::string_view name)
         {
-            return GetDictionary().size();
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                for (const auto& entry : shard.m_dictionary)
+                {
+                    if (entry.second->GetName() == name)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -280,11 +295,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsEntry(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -635,6 +646,52 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, StatisticsCountNamesInAllShards)
+    {
+        constexpr size_t nameCount = 1000;
+
+        AZStd::vector<AZ::Name> names;
+        names.reserve(nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name%zu", i));
+        }
+
+        AZ::NameDictionary::Statistics statistics = AZ::NameDictionary::Instance().GetStatistics();
+        EXPECT_EQ(nameCount, statistics.m_nameCount);
+        EXPECT_EQ(nameCount, NameDictionaryTester::GetEntryCount());
+
+        names.clear();
+        statistics = AZ::NameDictionary::Instance().GetStatistics();
+        EXPECT_EQ(0, statistics.m_nameCount);
+    }
+
+    TEST_F(NameTest, FindName_NameReleasedAndRecreated_FindsOnlyLiveNames)
+    {
+        AZ::Name::Hash hash = 0;
+        {
+            AZ::Name name{ "released" };
+            hash = name.GetHash();
+            // The second lookup is served by the lock-free cache
+            EXPECT_EQ(name, AZ::NameDictionary::Instance().FindName(hash));
+            EXPECT_EQ(name, AZ::NameDictionary::Instance().FindName(hash));
+        }
+        EXPECT_TRUE(AZ::NameDictionary::Instance().FindName(hash).IsEmpty());
+
+        // Released entries are reused for new names, which must not be found with the hash of the released name
+        AZStd::vector<AZ::Name> names;
+        for (int i = 0; i < 1000; ++i)
+        {
+            names.emplace_back(AZStd::string::format("recreated%d", i));
+        }
+        AZ::Name found = AZ::NameDictionary::Instance().FindName(hash);
+        EXPECT_TRUE(found.IsEmpty() || found.GetHash() == hash);
+
+        AZ::Name recreated{ "released" };
+        EXPECT_EQ(hash, recreated.GetHash());
+        EXPECT_EQ("released", AZ::NameDictionary::Instance().FindName(hash).GetStringView());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = 1000;
@@ -846,3 +903,137 @@ namespace UnitTest
     }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Multi-threaded name creation. All threads share the fixture, so only the first thread sets up the allocators,
+    // the dictionary and the strings for all threads. The other threads can only access them inside the benchmark loop,
+    // which starts after all threads are synchronized.
+    class NameDictionaryBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NamesPerThread = 1024;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+                CreateNames(state.threads);
+            }
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+                CreateNames(state.threads);
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                DestroyNames();
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                DestroyNames();
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+
+    protected:
+        void CreateNames(int threadCount)
+        {
+            m_existingNames.reserve(NamesPerThread);
+            for (size_t i = 0; i < NamesPerThread; ++i)
+            {
+                m_existingNames.emplace_back(AZStd::string::format("ExistingName%zu", i));
+            }
+
+            m_existingNameStrings.resize(threadCount);
+            m_newNameStrings.resize(threadCount);
+            for (int thread = 0; thread < threadCount; ++thread)
+            {
+                // Every thread gets its own copy of the strings so creating a name has to look it up from new data
+                m_existingNameStrings[thread].reserve(NamesPerThread);
+                for (size_t i = 0; i < NamesPerThread; ++i)
+                {
+                    m_existingNameStrings[thread].emplace_back(m_existingNames[(i + thread * 7) % NamesPerThread].GetStringView());
+                }
+
+                // Strings for names that aren't in the dictionary, so every creation adds the name and every destruction
+                // removes it again.
+                m_newNameStrings[thread].reserve(NamesPerThread);
+                for (size_t i = 0; i < NamesPerThread; ++i)
+                {
+                    m_newNameStrings[thread].push_back(AZStd::string::format("NewName%d_%zu", thread, i));
+                }
+            }
+        }
+
+        void DestroyNames()
+        {
+            m_existingNames = {};
+            m_existingNameStrings = {};
+            m_newNameStrings = {};
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+        AZStd::vector<AZStd::vector<AZStd::string>> m_existingNameStrings;
+        AZStd::vector<AZStd::vector<AZStd::string>> m_newNameStrings;
+    };
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeExistingName)(benchmark::State& state)
+    {
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            AZ::Name name(m_existingNameStrings[state.thread_index][index++ % NamesPerThread]);
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeExistingName)->ThreadRange(1, 32)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeAndReleaseNewName)(benchmark::State& state)
+    {
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            AZ::Name name(m_newNameStrings[state.thread_index][index++ % NamesPerThread]);
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeAndReleaseNewName)->ThreadRange(1, 32)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeMixedNames)(benchmark::State& state)
+    {
+        // One in eight names is new, the rest already exist
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            const size_t current = index++;
+            const AZStd::vector<AZStd::string>& strings =
+                (current & 7) == 0 ? m_newNameStrings[state.thread_index] : m_existingNameStrings[state.thread_index];
+            AZ::Name name(strings[current % NamesPerThread]);
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeMixedNames)->ThreadRange(1, 32)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
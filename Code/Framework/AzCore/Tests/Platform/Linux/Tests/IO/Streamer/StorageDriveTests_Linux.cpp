@@ -0,0 +1,620 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr size_t TestStagingBufferSize = 16_kib;
+    constexpr bool TestEnableUnbufferReads = true;
+    constexpr bool HasSeekPenalty = false;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux({ "/" }, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestStagingBufferSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        // Data...
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+
+        // Methods...
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetupStorageDrive(s32 overCommit, bool enableIoUring = true)
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            ASSERT_FALSE(m_dummyFilepath.empty());
+
+            m_configurationOptions.m_hasSeekPenalty = HasSeekPenalty;
+            m_configurationOptions.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            m_configurationOptions.m_enableIoUring = enableIoUring;
+            m_configurationOptions.m_minimalReporting = true;
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+                TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, overCommit,
+                TestStagingBufferSize, m_configurationOptions);
+            m_storageDriveLinux->SetContext(*m_context);
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            RemoveDummyFiles();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            using namespace AZ::IO;
+
+            SystemFile file;
+            bool fileCreated = file.Open(m_dummyFilepath.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+
+            ASSERT_TRUE(fileCreated);
+
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void RemoveDummyFiles()
+        {
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        void ParallelReads()
+        {
+            constexpr size_t chunkSize = TestPhysicalSectorSize;
+            // Use more chunks than the queue depth so read slots are reused.
+            constexpr size_t numChunks = TestQueueDepth * 2 + 1;
+            constexpr size_t fileSize = numChunks * chunkSize;
+            AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+            // Create a file with chunk markers and begin/end markers
+            CreateDummyFile(fileSize, chunkSize, true);
+
+            for (size_t i = 0; i < numChunks; ++i)
+            {
+                buffers[i].reset(new u8[chunkSize]);
+                AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+                request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+                request->SetCompletionCallback([i](const FileRequest& request)
+                    {
+                        EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                        auto& readRequest = AZStd::get<AZ::IO::FileRequest::ReadData>(request.GetCommand());
+                        EXPECT_EQ(readRequest.m_offset, i * chunkSize);
+                    });
+                m_storageDriveLinux->QueueRequest(request);
+            }
+
+            WaitTillCompleted();
+
+            EXPECT_EQ(buffers[0][0], s_beginCharacter);
+            EXPECT_EQ(buffers[0][chunkSize - 1], s_fileCharacter);
+            EXPECT_EQ(buffers[numChunks - 1][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+            for (size_t i = 1; i < numChunks - 1; ++i)
+            {
+                EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+                EXPECT_EQ(buffers[i][chunkSize - 1], s_fileCharacter);
+            }
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+            // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_MultipleDrivePaths_AllPathsAreIncludedInTheName)
+    {
+        AZStd::vector<AZStd::string_view> drives;
+        drives.push_back("/");
+        drives.push_back("/home/");
+        drives.push_back("/mnt/data");
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(drives,
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, TestOverCommit,
+            TestStagingBufferSize, m_configurationOptions);
+
+        EXPECT_STREQ("Storage drive (/,/home,/mnt/data)", m_storageDriveLinux->GetName().c_str());
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0, TestQueueDepth, TestOverCommit, TestStagingBufferSize,
+            m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth,
+            -(aznumeric_cast<s32>(TestQueueDepth) + 2), TestStagingBufferSize, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, QueueRequest_PathOnDifferentMountPoint_RequestIsForwarded)
+    {
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/mnt/data" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, TestOverCommit,
+            TestStagingBufferSize, m_configurationOptions);
+        m_storageDriveLinux->SetContext(*m_context);
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath("/mnt/database/File.bin");
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(fileExistsCheck.m_found);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetRead_ReturnsCorrectData)
+    {
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+
+        constexpr char unexpectedChar = 'Z';
+        char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestPhysicalSectorSize));
+        buffer[unalignedSize] = unexpectedChar;
+
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedReadLargerThanStagingBuffer_ReturnsCorrectData)
+    {
+        constexpr AZ::u64 readSize = TestStagingBufferSize * 4;
+
+        char* memory = reinterpret_cast<char*>(azmalloc(readSize + 16, TestPhysicalSectorSize));
+        char* buffer = memory + 7;
+
+        CreateDummyFile(readSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, readSize + 16 - 7, m_dummyRequestPath, 0, readSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < readSize; ++i)
+        {
+            ASSERT_EQ(s_fileCharacter, buffer[i]);
+        }
+
+        azfree(memory);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ReportsFailure)
+    {
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize * 2]);
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize * 2, m_dummyRequestPath, 0, fileSize * 2);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Failed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReadsWithIoUring_DataIsCorrect)
+    {
+        SetupStorageDrive(TestOverCommit, true);
+        ParallelReads();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReadsWithThreadPool_DataIsCorrect)
+    {
+        SetupStorageDrive(TestOverCommit, false);
+        ParallelReads();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_NoReadDone_NoStatisticsAreReturned)
+    {
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_TRUE(statistics.empty());
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class StorageDriveLinuxFixture : public benchmark::Fixture
+    {
+        void internalTearDown()
+        {
+            using namespace AZ::IO;
+
+            AZStd::string temp;
+            m_absolutePath.swap(temp);
+
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            SystemFile::Delete(TestFileName);
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+            delete m_fileIO;
+            m_fileIO = nullptr;
+        }
+    public:
+        constexpr static const char* TestFileName = "StreamerBenchmark.bin";
+        constexpr static size_t FileSize = 64_mib;
+        constexpr static size_t ChunkSize = 256_kib;
+
+        void SetupStreamer(u32 queueDepth, bool enableIoUring)
+        {
+            using namespace AZ::IO;
+
+            m_fileIO = new UnitTest::TestFileIOBase();
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_fileIO);
+
+            SystemFile file;
+            file.Open(TestFileName, SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+            ::memset(buffer.get(), 'c', FileSize);
+
+            file.Write(buffer.get(), FileSize);
+            file.Close();
+
+            AZStd::optional<AZ::IO::FixedMaxPathString> absolutePath = AZ::Utils::ConvertToAbsolutePath(TestFileName);
+            if (absolutePath.has_value())
+            {
+                m_absolutePath = *absolutePath;
+
+                StorageDriveLinux::ConstructionOptions options;
+                options.m_hasSeekPenalty = false;
+                options.m_enableUnbufferedReads = true; // Leave this on otherwise repeated loads will be using the page cache instead.
+                options.m_enableIoUring = enableIoUring;
+                options.m_minimalReporting = true;
+                AZStd::shared_ptr<StreamStackEntry> storageDriveLinux = AZStd::make_shared<StorageDriveLinux>(
+                    AZStd::vector<AZStd::string_view>{ "/" }, 32, 32, 4_kib, 512, queueDepth, 0, 64_kib, options);
+
+                AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(AZStd::move(storageDriveLinux));
+                m_streamer = aznew Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            }
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        // Reads the entire file in chunks that are all queued at the same time so the drive can keep as many reads in flight
+        // as its queue depth allows.
+        void RepeatedlyReadFileInChunks(benchmark::State& state)
+        {
+            using namespace AZ::IO;
+            using namespace AZStd::chrono;
+
+            constexpr size_t numChunks = FileSize / ChunkSize;
+            AZStd::unique_ptr<char[]> buffer(new char[FileSize]);
+
+            for (auto _ : state)
+            {
+                AZStd::binary_semaphore waitForReads;
+                AZStd::atomic_int remainingReads{ aznumeric_cast<int>(numChunks) };
+                AZStd::atomic<system_clock::time_point> end;
+                auto callback = [&end, &remainingReads, &waitForReads]([[maybe_unused]] FileRequestHandle request)
+                {
+                    if (--remainingReads == 0)
+                    {
+                        benchmark::DoNotOptimize(end = high_resolution_clock::now());
+                        waitForReads.release();
+                    }
+                };
+
+                AZStd::vector<FileRequestPtr> requests;
+                m_streamer->CreateRequestBatch(requests, numChunks);
+                for (size_t i = 0; i < numChunks; ++i)
+                {
+                    m_streamer->Read(requests[i], m_absolutePath, buffer.get() + i * ChunkSize, ChunkSize, ChunkSize,
+                        IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * ChunkSize);
+                    m_streamer->SetRequestCompleteCallback(requests[i], callback);
+                }
+
+                system_clock::time_point start;
+                benchmark::DoNotOptimize(start = high_resolution_clock::now());
+                m_streamer->QueueRequestBatch(AZStd::move(requests));
+
+                waitForReads.try_acquire_for(AZStd::chrono::seconds(10));
+                auto durationInSeconds = duration_cast<duration<double>>(end.load() - start);
+
+                state.SetIterationTime(durationInSeconds.count());
+                state.SetBytesProcessed(state.bytes_processed() + FileSize);
+
+                m_streamer->QueueRequest(m_streamer->FlushCaches());
+            }
+        }
+
+        AZStd::string m_absolutePath;
+        AZ::IO::Streamer* m_streamer{};
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        UnitTest::TestFileIOBase* m_fileIO{};
+    };
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ChunkedReadsWithIoUring)(benchmark::State& state)
+    {
+        constexpr bool EnableIoUring = true;
+        SetupStreamer(aznumeric_cast<AZ::u32>(state.range(0)), EnableIoUring);
+        RepeatedlyReadFileInChunks(state);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, ChunkedReadsWithThreadPool)(benchmark::State& state)
+    {
+        constexpr bool EnableIoUring = false;
+        SetupStreamer(aznumeric_cast<AZ::u32>(state.range(0)), EnableIoUring);
+        RepeatedlyReadFileInChunks(state);
+    }
+
+    // The argument is the queue depth of the drive.
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ChunkedReadsWithIoUring)
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, ChunkedReadsWithThreadPool)
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1792,4 +1793,242 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // Key
+    //
+
+    TEST_F(SettingsRegistryTest, GetWithKey_AllTypes_MatchesGetWithPath)
+    {
+        ASSERT_TRUE(m_registry->Set("/Test/Bool", true));
+        ASSERT_TRUE(m_registry->Set("/Test/Int", aznumeric_cast<AZ::s64>(-42)));
+        ASSERT_TRUE(m_registry->Set("/Test/Uint", aznumeric_cast<AZ::u64>(42)));
+        ASSERT_TRUE(m_registry->Set("/Test/Double", 42.5));
+        ASSERT_TRUE(m_registry->Set("/Test/String", "Hello"));
+
+        // Read twice, the second time the cached value is used
+        for (int i = 0; i < 2; ++i)
+        {
+            bool boolValue = false;
+            AZ::s64 intValue = 0;
+            AZ::u64 uintValue = 0;
+            double doubleValue = 0.0;
+            AZStd::string stringValue;
+            AZ::SettingsRegistryInterface::FixedValueString fixedStringValue;
+
+            EXPECT_TRUE(m_registry->Get(boolValue, AZ::SettingsRegistryInterface::Key("/Test/Bool")));
+            EXPECT_TRUE(boolValue);
+            EXPECT_TRUE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::Key("/Test/Int")));
+            EXPECT_EQ(-42, intValue);
+            EXPECT_TRUE(m_registry->Get(uintValue, AZ::SettingsRegistryInterface::Key("/Test/Uint")));
+            EXPECT_EQ(42, uintValue);
+            EXPECT_TRUE(m_registry->Get(doubleValue, AZ::SettingsRegistryInterface::Key("/Test/Double")));
+            EXPECT_DOUBLE_EQ(42.5, doubleValue);
+            EXPECT_TRUE(m_registry->Get(stringValue, AZ::SettingsRegistryInterface::Key("/Test/String")));
+            EXPECT_STREQ("Hello", stringValue.c_str());
+            EXPECT_TRUE(m_registry->Get(fixedStringValue, AZ::SettingsRegistryInterface::Key("/Test/String")));
+            EXPECT_STREQ("Hello", fixedStringValue.c_str());
+        }
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKey_TypeMismatch_ReturnsFalse)
+    {
+        ASSERT_TRUE(m_registry->Set("/Test/Negative", aznumeric_cast<AZ::s64>(-1)));
+        ASSERT_TRUE(m_registry->Set("/Test/Large", AZStd::numeric_limits<AZ::u64>::max()));
+        ASSERT_TRUE(m_registry->Set("/Test/String", "Hello"));
+
+        const AZ::SettingsRegistryInterface::Key negativeKey("/Test/Negative");
+        const AZ::SettingsRegistryInterface::Key largeKey("/Test/Large");
+        const AZ::SettingsRegistryInterface::Key stringKey("/Test/String");
+
+        AZ::s64 intValue = 0;
+        AZ::u64 uintValue = 0;
+        bool boolValue = false;
+        AZStd::string stringValue;
+        EXPECT_FALSE(m_registry->Get(uintValue, negativeKey));
+        EXPECT_TRUE(m_registry->Get(intValue, negativeKey));
+        EXPECT_FALSE(m_registry->Get(intValue, largeKey));
+        EXPECT_TRUE(m_registry->Get(uintValue, largeKey));
+        EXPECT_FALSE(m_registry->Get(boolValue, stringKey));
+        EXPECT_FALSE(m_registry->Get(stringValue, negativeKey));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKey_InvalidOrUnknownPath_ReturnsFalse)
+    {
+        AZ::s64 value = 0;
+        EXPECT_FALSE(m_registry->Get(value, AZ::SettingsRegistryInterface::Key("$%^&")));
+        EXPECT_FALSE(m_registry->Get(value, AZ::SettingsRegistryInterface::Key("/Unknown/Path")));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKey_RegistryModified_ReturnsNewValue)
+    {
+        const AZ::SettingsRegistryInterface::Key key("/Test/Value");
+        AZ::s64 value = 0;
+
+        ASSERT_TRUE(m_registry->Set("/Test/Value", aznumeric_cast<AZ::s64>(1)));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(1, value);
+
+        ASSERT_TRUE(m_registry->Set("/Test/Value", aznumeric_cast<AZ::s64>(2)));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(2, value);
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": { "Value": 3 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(3, value);
+
+        ASSERT_TRUE(m_registry->Remove("/Test/Value"));
+        EXPECT_FALSE(m_registry->Get(value, key));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKey_KeyUsedWithMultipleRegistries_ReturnsValueOfEachRegistry)
+    {
+        AZ::SettingsRegistryImpl otherRegistry;
+        ASSERT_TRUE(m_registry->Set("/Test/Value", aznumeric_cast<AZ::s64>(1)));
+        ASSERT_TRUE(otherRegistry.Set("/Test/Value", aznumeric_cast<AZ::s64>(2)));
+
+        const AZ::SettingsRegistryInterface::Key key("/Test/Value");
+        for (int i = 0; i < 2; ++i)
+        {
+            AZ::s64 value = 0;
+            EXPECT_TRUE(m_registry->Get(value, key));
+            EXPECT_EQ(1, value);
+            EXPECT_TRUE(otherRegistry.Get(value, key));
+            EXPECT_EQ(2, value);
+        }
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKey_ReadWhileWriting_ValuesAreNeverTorn)
+    {
+        constexpr AZ::s64 lastValue = 10000;
+        constexpr int readerCount = 4;
+        ASSERT_TRUE(m_registry->Set("/Test/Value", aznumeric_cast<AZ::s64>(0)));
+
+        AZStd::atomic_bool readersFailed{ false };
+        AZStd::vector<AZStd::thread> readers;
+        for (int reader = 0; reader < readerCount; ++reader)
+        {
+            readers.emplace_back([this, &readersFailed]()
+            {
+                const AZ::SettingsRegistryInterface::Key key("/Test/Value");
+                AZ::s64 previousValue = 0;
+                while (previousValue != lastValue)
+                {
+                    AZ::s64 value = -1;
+                    // Values are only written in increasing order, so they can never go back
+                    if (!m_registry->Get(value, key) || value < previousValue || value > lastValue)
+                    {
+                        readersFailed = true;
+                        return;
+                    }
+                    previousValue = value;
+                }
+            });
+        }
+
+        for (AZ::s64 value = 1; value <= lastValue; ++value)
+        {
+            m_registry->Set("/Test/Value", value);
+        }
+
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+        EXPECT_FALSE(readersFailed);
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SettingsRegistryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            CreateRegistry();
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            CreateRegistry();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_registry.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_registry.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr AZStd::string_view ValuePath = "/Amazon/Benchmark/Settings/Rendering/ShadowQuality";
+
+        void CreateRegistry()
+        {
+            m_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            // Add some siblings, so the lookup has to search objects of a realistic size
+            for (int i = 0; i < 64; ++i)
+            {
+                m_registry->Set(AZStd::string::format("/Amazon/Benchmark/Settings/Rendering/Value%d", i), aznumeric_cast<AZ::s64>(i));
+            }
+            m_registry->Set(ValuePath, aznumeric_cast<AZ::s64>(3));
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+    };
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, BM_SettingsRegistry_GetInteger_Path)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::s64 value = 0;
+            m_registry->Get(value, ValuePath);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, BM_SettingsRegistry_GetInteger_Key)(benchmark::State& state)
+    {
+        const AZ::SettingsRegistryInterface::Key key(ValuePath);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::s64 value = 0;
+            m_registry->Get(value, key);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, BM_SettingsRegistry_GetString_Path)(benchmark::State& state)
+    {
+        m_registry->Set(ValuePath, "High");
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryInterface::FixedValueString value;
+            m_registry->Get(value, ValuePath);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryBenchmarkFixture, BM_SettingsRegistry_GetString_Key)(benchmark::State& state)
+    {
+        m_registry->Set(ValuePath, "High");
+        const AZ::SettingsRegistryInterface::Key key(ValuePath);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryInterface::FixedValueString value;
+            m_registry->Get(value, key);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
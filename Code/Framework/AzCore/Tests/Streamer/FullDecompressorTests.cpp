@@ -14,11 +14,16 @@
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <Tests/Streamer/StreamStackEntryConformityTests.h>
 #include <Tests/Streamer/StreamStackEntryMock.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 namespace AZ::IO
 {
     class FullFileDecompressorTestDescription :
@@ -94,13 +99,13 @@ namespace AZ::IO
             UnitTest::AllocatorsFixture::TearDown();
         }
 
-        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, u32 maxNumThreads = 0)
         {
             m_buffer = new u32[m_fakeFileLength >> 2];
 
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_decompressor = AZStd::make_shared<FullFileDecompressor>(maxNumReads, maxNumJobs,
-                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, maxNumThreads);
 
             m_context = new StreamerContext();
             m_decompressor->SetContext(*m_context);
@@ -158,6 +163,33 @@ namespace AZ::IO
             m_context->MarkRequestAsCompleted(request);
         }
 
+        void MockBlockFramedReadCalls()
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests())
+                .WillOnce(Return(true))
+                .WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, &Streamer_FullDecompressorTest::PrepareBlockFramedReadRequest));
+        }
+
+        void PrepareBlockFramedReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+            ASSERT_LE(data->m_offset + data->m_size, m_blockFramedData.size());
+
+            memcpy(data->m_output, m_blockFramedData.data() + data->m_offset, data->m_size);
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
         void PrepareFailedReadRequest(FileRequest* request)
         {
             request->SetStatus(IStreamerTypes::RequestStatus::Failed);
@@ -186,6 +218,64 @@ namespace AZ::IO
             return false;
         }
 
+        static bool ZStdDecompressor(const CompressionInfo&, const void* compressed, size_t compressedSize, void* uncompressed,
+            size_t uncompressedBufferSize)
+        {
+            size_t result = ZSTD_decompress(uncompressed, uncompressedBufferSize, compressed, compressedSize);
+            return !ZSTD_isError(result) && result == uncompressedBufferSize;
+        }
+
+        //! Compresses the same pattern as the fake reads produce, so VerifyReadBuffer can be used on the decompressed result.
+        void CreateBlockFramedData(size_t blockSize)
+        {
+            AZStd::vector<u32> uncompressed(m_fakeFileLength >> 2);
+            for (size_t i = 0; i < uncompressed.size(); ++i)
+            {
+                uncompressed[i] = aznumeric_caster(i << 2);
+            }
+
+            m_blockFramedData.resize(ZStd::GetMinBlockFramedBufferSize(m_fakeFileLength, blockSize));
+            size_t compressedSize = ZStd::CompressBlockFramed(uncompressed.data(), m_fakeFileLength,
+                m_blockFramedData.data(), m_blockFramedData.size(), 1, blockSize);
+            ASSERT_NE(0, compressedSize);
+            m_blockFramedData.resize(compressedSize);
+        }
+
+        void ProcessBlockFramedRead(u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult)
+        {
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_blockFramedData.size();
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_decompressor = &Streamer_FullDecompressorTest::ZStdDecompressor;
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
+            bool result = true;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = result && request.GetStatus() == expectedResult;
+            };
+            request->SetCompletionCallback(completed);
+
+            m_decompressor->QueueRequest(request);
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_TRUE(result);
+        }
+
         void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
         {
             CompressionInfo compressionInfo;
@@ -315,6 +405,7 @@ namespace AZ::IO
         StreamerContext* m_context;
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        AZStd::vector<u8> m_blockFramedData;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
     };
 
@@ -334,6 +425,39 @@ namespace AZ::IO
         VerifyReadBuffer(256, m_fakeFileLength-512);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadBlockFramedData_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4);
+        CreateBlockFramedData(64 * 1024);
+        MockBlockFramedReadCalls();
+        ProcessBlockFramedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadBlockFramedData_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4);
+        CreateBlockFramedData(64 * 1024);
+        MockBlockFramedReadCalls();
+        // Starts and ends in the middle of a block.
+        ProcessBlockFramedRead(70000, 200000, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(70000, 200000);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_CorruptedBlockFramedData_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(1, 1, 4);
+        CreateBlockFramedData(64 * 1024);
+        ZStd::BlockTable blocks;
+        ASSERT_TRUE(ZStd::ReadBlockTable(m_blockFramedData.data(), m_blockFramedData.size(), blocks));
+        ASSERT_GT(blocks.size(), 2);
+        // Break the frame magic of one of the blocks.
+        m_blockFramedData[blocks[2].m_compressedOffset] ^= 0xFF;
+
+        MockBlockFramedReadCalls();
+        ProcessBlockFramedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadFromArchive_SuccessfullyReadData)
     {
         SetupEnvironment();
@@ -395,3 +519,157 @@ namespace AZ::IO
         ProcessMultipleCompressedReads();
     }
 } // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FullFileDecompressorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            using ::testing::_;
+            using ::testing::Invoke;
+
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            // Data with enough repetition to compress roughly 2:1, similar to typical asset data.
+            m_uncompressedSize = aznumeric_cast<size_t>(state.range(0)) * 1024 * 1024;
+            AZStd::vector<AZ::u32> uncompressed(m_uncompressedSize >> 2);
+            AZ::u32 seed = 0x12345678;
+            for (AZ::u32& value : uncompressed)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 17;
+                seed ^= seed << 5;
+                value = seed & 0x0F0F00FF;
+            }
+
+            m_singleFrameData.resize(ZSTD_compressBound(m_uncompressedSize));
+            m_singleFrameData.resize(ZSTD_compress(m_singleFrameData.data(), m_singleFrameData.size(),
+                uncompressed.data(), m_uncompressedSize, 1));
+            m_blockFramedData.resize(AZ::ZStd::GetMinBlockFramedBufferSize(m_uncompressedSize));
+            m_blockFramedData.resize(AZ::ZStd::CompressBlockFramed(uncompressed.data(), m_uncompressedSize,
+                m_blockFramedData.data(), m_blockFramedData.size()));
+            m_output.resize(m_uncompressedSize);
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            m_mock = AZStd::make_shared<::testing::NiceMock<AZ::IO::StreamStackEntryMock>>();
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, &FullFileDecompressorBenchmarkFixture::ReadCompressedData));
+            m_decompressor = AZStd::make_shared<AZ::IO::FullFileDecompressor>(1, 1,
+                AZ::IO::FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, AZStd::thread::hardware_concurrency());
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_decompressor.reset();
+            m_mock.reset();
+            m_context.reset();
+            m_singleFrameData = {};
+            m_blockFramedData = {};
+            m_output = {};
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void ReadCompressedData(AZ::IO::FileRequest* request)
+        {
+            auto data = AZStd::get_if<AZ::IO::FileRequest::ReadData>(&request->GetCommand());
+            memcpy(data->m_output, m_compressedData->data() + data->m_offset, data->m_size);
+            request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void BM_Decompress(::benchmark::State& state, bool blockFramed, AZ::u64 readOffset, AZ::u64 readSize)
+        {
+            m_compressedData = blockFramed ? &m_blockFramedData : &m_singleFrameData;
+
+            AZ::IO::CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_compressedData->size();
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_uncompressedSize;
+            compressionInfo.m_decompressor = [](const AZ::IO::CompressionInfo&, const void* compressed, size_t compressedSize,
+                void* uncompressed, size_t uncompressedBufferSize) -> bool
+            {
+                return !ZSTD_isError(ZSTD_decompress(uncompressed, uncompressedBufferSize, compressed, compressedSize));
+            };
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+                request->CreateCompressedRead(nullptr, compressionInfo, m_output.data(), readOffset, readSize);
+                m_decompressor->QueueRequest(request);
+                bool hasCompleted = false;
+                while (m_decompressor->ExecuteRequests() || !hasCompleted)
+                {
+                    AZ::IO::StreamStackEntry::Status status;
+                    m_decompressor->UpdateStatus(status);
+                    hasCompleted = status.m_isIdle;
+                    m_context->FinalizeCompletedRequests();
+                }
+            }
+            state.SetBytesProcessed(state.iterations() * readSize);
+        }
+
+        void BM_FullRead(::benchmark::State& state, bool blockFramed)
+        {
+            BM_Decompress(state, blockFramed, 0, m_uncompressedSize);
+        }
+
+        void BM_PartialRead(::benchmark::State& state, bool blockFramed)
+        {
+            // A 1MB range in the middle of the entry.
+            BM_Decompress(state, blockFramed, m_uncompressedSize / 2, 1024 * 1024);
+        }
+
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::shared_ptr<::testing::NiceMock<AZ::IO::StreamStackEntryMock>> m_mock;
+        AZStd::shared_ptr<AZ::IO::FullFileDecompressor> m_decompressor;
+        AZStd::vector<AZ::u8> m_singleFrameData;
+        AZStd::vector<AZ::u8> m_blockFramedData;
+        AZStd::vector<AZ::u8>* m_compressedData{ nullptr };
+        AZStd::vector<AZ::u8> m_output;
+        size_t m_uncompressedSize{ 0 };
+    };
+
+    BENCHMARK_DEFINE_F(FullFileDecompressorBenchmarkFixture, FullRead_SingleFrame)(::benchmark::State& state)
+    {
+        BM_FullRead(state, false);
+    }
+    BENCHMARK_REGISTER_F(FullFileDecompressorBenchmarkFixture, FullRead_SingleFrame)->Arg(256)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(FullFileDecompressorBenchmarkFixture, FullRead_BlockFramed)(::benchmark::State& state)
+    {
+        BM_FullRead(state, true);
+    }
+    BENCHMARK_REGISTER_F(FullFileDecompressorBenchmarkFixture, FullRead_BlockFramed)->Arg(256)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(FullFileDecompressorBenchmarkFixture, PartialRead_SingleFrame)(::benchmark::State& state)
+    {
+        BM_PartialRead(state, false);
+    }
+    BENCHMARK_REGISTER_F(FullFileDecompressorBenchmarkFixture, PartialRead_SingleFrame)->Arg(256)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(FullFileDecompressorBenchmarkFixture, PartialRead_BlockFramed)(::benchmark::State& state)
+    {
+        BM_PartialRead(state, true);
+    }
+    BENCHMARK_REGISTER_F(FullFileDecompressorBenchmarkFixture, PartialRead_BlockFramed)->Arg(256)->Unit(::benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
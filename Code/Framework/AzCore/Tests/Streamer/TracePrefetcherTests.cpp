@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/TracePrefetcher.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class TracePrefetcherTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<TracePrefetcher>
+    {
+    public:
+        TracePrefetcher CreateInstance() override
+        {
+            return TracePrefetcher("", 1024 * 1024, 2, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_TracePrefetcherConformityTests, StreamStackEntryConformityTests, TracePrefetcherTestDescription);
+
+    class Streamer_TracePrefetcherTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        static constexpr u32 ReadSize = 1024;
+        static constexpr u32 NumReads = 4;
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            m_path.InitFromAbsolutePath("Test");
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_prefetcher = AZStd::make_shared<TracePrefetcher>(m_traceFolder.GetDirectory(), 1024 * 1024, NumReads,
+                AZCORE_GLOBAL_NEW_ALIGNMENT);
+
+            m_context = new StreamerContext();
+            m_prefetcher->SetContext(*m_context);
+            m_prefetcher->SetNext(m_mock);
+
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, &Streamer_TracePrefetcherTest::PrepareReadRequest));
+        }
+
+        void TearDown() override
+        {
+            m_prefetcher.reset();
+            m_mock.reset();
+
+            delete m_context;
+            m_context = nullptr;
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void PrepareReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            u64 size = data->m_size >> 2;
+            u32* buffer = reinterpret_cast<u32*>(data->m_output);
+            for (u64 i = 0; i < size; ++i)
+            {
+                buffer[i] = aznumeric_caster(data->m_offset + (i << 2));
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void SendCommand(AZStd::any command)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCustom(AZStd::move(command));
+            m_prefetcher->QueueRequest(request);
+            m_context->FinalizeCompletedRequests();
+        }
+
+        void ProcessReads()
+        {
+            AZStd::vector<u32> buffer(NumReads * (ReadSize >> 2));
+            size_t numCompleted = 0;
+            for (u32 i = 0; i < NumReads; ++i)
+            {
+                FileRequest* request = m_context->GetNewInternalRequest();
+                request->CreateRead(nullptr, buffer.data() + i * (ReadSize >> 2), ReadSize, m_path, i * ReadSize, ReadSize);
+                request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                    {
+                        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                        numCompleted++;
+                    });
+                m_prefetcher->QueueRequest(request);
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_EQ(NumReads, numCompleted);
+            for (u32 i = 0; i < buffer.size(); ++i)
+            {
+                ASSERT_EQ(i << 2, buffer[i]);
+            }
+        }
+
+        double GetHitRate() const
+        {
+            AZStd::vector<Statistic> statistics;
+            m_prefetcher->CollectStatistics(statistics);
+            for (const Statistic& statistic : statistics)
+            {
+                if (statistic.GetName() == "Prefetch hit rate")
+                {
+                    return statistic.GetPercentage();
+                }
+            }
+            ADD_FAILURE() << "TracePrefetcher didn't report a prefetch hit rate.";
+            return 0.0;
+        }
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_traceFolder;
+        RequestPath m_path;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<TracePrefetcher> m_prefetcher;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+    };
+
+    TEST_F(Streamer_TracePrefetcherTest, SaveTrace_LoadStoredTrace_TraceIsIdentical)
+    {
+        TracePrefetcher::Trace trace;
+        trace.m_paths.push_back("First");
+        trace.m_paths.push_back("Second");
+        trace.m_entries.push_back(TracePrefetcher::TraceEntry{ 0, 512, 0 });
+        trace.m_entries.push_back(TracePrefetcher::TraceEntry{ 1024, 256, 1 });
+        trace.m_entries.push_back(TracePrefetcher::TraceEntry{ 512, 128, 0 });
+
+        AZStd::string filePath = m_traceFolder.Resolve("RoundTrip.streamtrace");
+        ASSERT_TRUE(TracePrefetcher::SaveTrace(filePath.c_str(), trace));
+
+        TracePrefetcher::Trace loaded;
+        ASSERT_TRUE(TracePrefetcher::LoadTrace(filePath.c_str(), loaded));
+        EXPECT_EQ(trace.m_paths, loaded.m_paths);
+        ASSERT_EQ(trace.m_entries.size(), loaded.m_entries.size());
+        for (size_t i = 0; i < trace.m_entries.size(); ++i)
+        {
+            EXPECT_EQ(trace.m_entries[i].m_offset, loaded.m_entries[i].m_offset);
+            EXPECT_EQ(trace.m_entries[i].m_size, loaded.m_entries[i].m_size);
+            EXPECT_EQ(trace.m_entries[i].m_pathIndex, loaded.m_entries[i].m_pathIndex);
+        }
+    }
+
+    TEST_F(Streamer_TracePrefetcherTest, LoadTrace_FileIsNotATrace_LoadFailsAndTraceIsEmpty)
+    {
+        AZStd::string filePath = m_traceFolder.Resolve("Corrupted.streamtrace");
+        constexpr char garbage[] = "This is not an access trace.";
+        SystemFile file;
+        ASSERT_TRUE(file.Open(filePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+        file.Write(garbage, sizeof(garbage));
+        file.Close();
+
+        TracePrefetcher::Trace loaded;
+        EXPECT_FALSE(TracePrefetcher::LoadTrace(filePath.c_str(), loaded));
+        EXPECT_TRUE(loaded.m_paths.empty());
+        EXPECT_TRUE(loaded.m_entries.empty());
+    }
+
+    TEST_F(Streamer_TracePrefetcherTest, QueueRequest_NoStoredTrace_ReadsAreForwarded)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(NumReads);
+
+        SendCommand(AZStd::any(TracePrefetcher::StartTraceCommand{ "Level" }));
+        ProcessReads();
+        SendCommand(AZStd::any(TracePrefetcher::StopTraceCommand{}));
+
+        EXPECT_EQ(0.0, GetHitRate());
+    }
+
+    TEST_F(Streamer_TracePrefetcherTest, ExecuteRequests_ReplayStoredTrace_ReadsAreServedFromPrefetches)
+    {
+        using ::testing::_;
+
+        // The first pass records the trace and the second pass only reads the data ahead of the requests.
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(NumReads * 2);
+
+        SendCommand(AZStd::any(TracePrefetcher::StartTraceCommand{ "Level" }));
+        ProcessReads();
+        SendCommand(AZStd::any(TracePrefetcher::StopTraceCommand{}));
+
+        SendCommand(AZStd::any(TracePrefetcher::StartTraceCommand{ "Level" }));
+        EXPECT_TRUE(m_prefetcher->ExecuteRequests());
+        m_context->FinalizeCompletedRequests();
+        ProcessReads();
+
+        EXPECT_DOUBLE_EQ(1.0, GetHitRate());
+        SendCommand(AZStd::any(TracePrefetcher::StopTraceCommand{}));
+    }
+} // namespace AZ::IO
@@ -623,6 +623,198 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    // Releases more tasks at once than fit in a worker's local queue so released tasks are both stolen and submitted
+    static void RunWideFanOutFanIn(TaskExecutor& executor)
+    {
+        constexpr int width = 3000;
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> joined = 0;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                joined = x.load();
+            });
+
+        TaskDescriptor descriptors[] = { { "critical", "TaskGraphTests", TaskPriority::CRITICAL },
+                                         { "high", "TaskGraphTests", TaskPriority::HIGH },
+                                         { "medium", "TaskGraphTests", TaskPriority::MEDIUM },
+                                         { "low", "TaskGraphTests", TaskPriority::LOW } };
+        for (int i = 0; i != width; ++i)
+        {
+            auto task = graph.AddTask(
+                descriptors[i % AZ_ARRAY_SIZE(descriptors)],
+                [&x]
+                {
+                    ++x;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        for (int i = 0; i != 3; ++i)
+        {
+            x = 0;
+            joined = 0;
+
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(width, joined);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, WideFanOutFanIn)
+    {
+        RunWideFanOutFanIn(*m_executor);
+    }
+
+    TEST_F(TaskGraphTestFixture, WideFanOutFanInWithoutWorkStealing)
+    {
+        constexpr bool enableWorkStealing = false;
+        TaskExecutor executor(4, enableWorkStealing);
+        RunWideFanOutFanIn(executor);
+    }
+
+    // Runs a graph where the root releases a single task and the head of a chain of three tasks on a single worker
+    // and returns the position at which the single task ran.
+    static int RunShortAndLongBranch(TaskExecutor& executor, uint16_t shortBranchCost)
+    {
+        AZStd::atomic<int> executed = 0;
+        int shortBranchPosition = -1;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                ++executed;
+            });
+        // Added first so it would run first if tasks weren't ordered by critical path
+        TaskDescriptor shortBranchDescriptor = defaultTD;
+        shortBranchDescriptor.cost = shortBranchCost;
+        auto shortBranch = graph.AddTask(
+            shortBranchDescriptor,
+            [&]
+            {
+                shortBranchPosition = executed++;
+            });
+        auto chain = graph.AddTasks(
+            defaultTD,
+            [&]
+            {
+                ++executed;
+            },
+            [&]
+            {
+                ++executed;
+            },
+            [&]
+            {
+                ++executed;
+            });
+        root.Precedes(shortBranch, chain[0]);
+        chain[0].Precedes(chain[1]);
+        chain[1].Precedes(chain[2]);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(5, executed);
+        return shortBranchPosition;
+    }
+
+    TEST_F(TaskGraphTestFixture, CriticalPathRunsFirst)
+    {
+        TaskExecutor executor(1);
+        // The chain is longer, so the short branch has to wait until at least the first task of the chain started
+        EXPECT_GT(RunShortAndLongBranch(executor, 1), 1);
+    }
+
+    TEST_F(TaskGraphTestFixture, CriticalPathRunsFirstWithoutWorkStealing)
+    {
+        constexpr bool enableWorkStealing = false;
+        TaskExecutor executor(1, enableWorkStealing);
+        EXPECT_GT(RunShortAndLongBranch(executor, 1), 1);
+    }
+
+    TEST_F(TaskGraphTestFixture, CriticalPathUsesTaskCost)
+    {
+        TaskExecutor executor(1);
+        // The single task is more expensive than the entire chain, so it runs right after the root
+        EXPECT_EQ(1, RunShortAndLongBranch(executor, 10));
+    }
+
+    TEST_F(TaskGraphTestFixture, DependencyCycleIsRejected)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto tasks = graph.AddTasks(
+            defaultTD,
+            [&]
+            {
+                ++x;
+            },
+            [&]
+            {
+                ++x;
+            },
+            [&]
+            {
+                ++x;
+            });
+        tasks[0].Precedes(tasks[1]);
+        tasks[1].Precedes(tasks[2]);
+        tasks[2].Precedes(tasks[1]);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        graph.SubmitOnExecutor(*m_executor);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_TRUE(graph.IsEmpty());
+        EXPECT_EQ(0, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, DependencyCycleWithEventSignalsEvent)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto tasks = graph.AddTasks(
+            defaultTD,
+            [&]
+            {
+                ++x;
+            },
+            [&]
+            {
+                ++x;
+            });
+        tasks[0].Precedes(tasks[1]);
+        tasks[1].Precedes(tasks[0]);
+
+        TaskGraphEvent ev;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        // Would block forever if the rejected graph didn't signal the event
+        ev.Wait();
+
+        EXPECT_TRUE(graph.IsEmpty());
+        EXPECT_EQ(0, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -736,5 +928,74 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // Fine-grained fan-out/fan-in: a single root releases a wide layer of small tasks that all join into a final task.
+    // The first argument is the number of worker threads, the second the number of tasks in the wide layer.
+    class TaskGraphFanOutBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        void RunFanOutFanIn(benchmark::State& state, bool enableWorkStealing)
+        {
+            TaskExecutor executor(aznumeric_cast<uint32_t>(state.range(0)), enableWorkStealing);
+            const int64_t width = state.range(1);
+
+            AZStd::atomic<uint64_t> sum = 0;
+            TaskGraph graph;
+            auto root = graph.AddTask(
+                descriptor,
+                []
+                {
+                });
+            auto join = graph.AddTask(
+                descriptor,
+                []
+                {
+                });
+            for (int64_t i = 0; i != width; ++i)
+            {
+                auto task = graph.AddTask(
+                    descriptor,
+                    [&sum, i]
+                    {
+                        sum.fetch_add(i, AZStd::memory_order_relaxed);
+                    });
+                root.Precedes(task);
+                task.Precedes(join);
+            }
+
+            for (auto _ : state)
+            {
+                TaskGraphEvent ev;
+                graph.SubmitOnExecutor(executor, &ev);
+                ev.Wait();
+            }
+
+            state.SetItemsProcessed(state.iterations() * (width + 2));
+        }
+
+        TaskDescriptor descriptor{ "medium", "benchmark", TaskPriority::MEDIUM };
+    };
+
+    BENCHMARK_DEFINE_F(TaskGraphFanOutBenchmarkFixture, FanOutFanIn_WorkStealing)(benchmark::State& state)
+    {
+        RunFanOutFanIn(state, true);
+    }
+
+    BENCHMARK_DEFINE_F(TaskGraphFanOutBenchmarkFixture, FanOutFanIn_RoundRobin)(benchmark::State& state)
+    {
+        RunFanOutFanIn(state, false);
+    }
+
+    BENCHMARK_REGISTER_F(TaskGraphFanOutBenchmarkFixture, FanOutFanIn_WorkStealing)
+        ->RangeMultiplier(4)
+        ->Ranges({ { 8, 64 }, { 64, 1024 } })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(TaskGraphFanOutBenchmarkFixture, FanOutFanIn_RoundRobin)
+        ->RangeMultiplier(4)
+        ->Ranges({ { 8, 64 }, { 64, 1024 } })
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
 } // namespace Benchmark
 #endif
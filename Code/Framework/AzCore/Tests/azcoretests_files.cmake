@@ -18,6 +18,7 @@ set(FILES
     Asset/TestAssetTypes.h
     AssetJsonSerializerTests.cpp
     EBus/ScheduledEventTests.cpp
+    EBus/InstrumentationTests.cpp
     AssetManager.cpp
     TestCatalog.h
     TestCatalog.cpp
@@ -91,6 +92,7 @@ set(FILES
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Streamer/TracePrefetcherTests.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/BaseJsonSerializerFixture.h
     Serialization/Json/BaseJsonSerializerTests.cpp
@@ -170,6 +172,7 @@ set(FILES
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
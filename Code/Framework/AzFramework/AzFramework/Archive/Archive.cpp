@@ -1452,7 +1452,7 @@ namespace AZ::IO
     CCachedFileData::~CCachedFileData()
     {
         // forced destruction
-        if (m_pFileData)
+        if (m_pFileData && !m_bFileDataMapped)
         {
             AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
             m_pFileData = nullptr;
@@ -1512,6 +1512,15 @@ namespace AZ::IO
             // Then, lock it and check whether the data is still not there.
             // if it's not, allocate memory and unpack the file
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
+            if (!m_pFileData && m_pFileEntry->nMethod == ZipFile::METHOD_STORE)
+            {
+                // stored files can be used straight from the memory mapped archive
+                if (const void* mappedData = m_pZip->GetMappedFileData(m_pFileEntry))
+                {
+                    m_pFileData = const_cast<void*>(mappedData);
+                    m_bFileDataMapped = true;
+                }
+            }
             if (!m_pFileData)
             {
                 // don't try to decompress if its not actually compressed
@@ -1566,8 +1575,13 @@ namespace AZ::IO
         if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
+            if (const void* mappedData = m_pZip->GetMappedFileData(m_pFileEntry))
+            {
+                // Uncompressed read of just the requested range from the memory mapped archive.
+                memcpy(pBuffer, reinterpret_cast<const uint8_t*>(mappedData) + nFileOffset, static_cast<size_t>(nReadSize));
+            }
             // Uncompressed read.
-            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
+            else if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
             {
                 return -1;
             }
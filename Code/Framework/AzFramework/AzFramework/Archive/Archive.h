@@ -56,6 +56,7 @@ namespace AZ::IO
         // the cache is refreshed. Otherwise, it returns whatever cache is (nullptr if the data isn't cached yet)
         // decompress can be harmlessly set to true if you want the data back decompressed.
         // set them to false only if you want to operate on the raw data while its still compressed.
+        // if the archive is memory mapped, the data of stored (uncompressed) files points into the read only mapping.
         void* GetData(bool bRefreshCache = true, bool decompress = true);
         // Uncompress file data directly to provided memory.
         bool GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
@@ -69,6 +70,8 @@ namespace AZ::IO
         uint32_t GetFileDataOffset();
 
         void* m_pFileData;
+        // true if m_pFileData points into the memory mapped archive instead of memory owned by this object
+        bool m_bFileDataMapped = false;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
@@ -7,6 +7,7 @@
  */
 
 
+#include <AzCore/Compression/zstd_compression.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/std/string/conversions.h>
@@ -178,6 +179,7 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_mappedFile.Close();
         m_allocator = nullptr;
         m_treeDir.Clear();
     }
@@ -242,7 +244,9 @@ namespace AZ::IO::ZipDir
         case CompressionCodec::Codec::ZLIB:
             return (uncompressedSize + (uncompressedSize >> 3) + 32);
         case CompressionCodec::Codec::ZSTD:
-            return ZSTD_compressBound(uncompressedSize);
+            // Matches ZipRawCompressZSTD, which stores entries bigger than a block as block framed data.
+            return uncompressedSize > AZ::ZStd::DefaultBlockSize
+                ? AZ::ZStd::GetMinBlockFramedBufferSize(uncompressedSize) : ZSTD_compressBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
         default:
@@ -695,36 +699,64 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
-        {
-            return ZD_ERROR_IO_FAILED;
-        }
-
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
-        void* pBuffer = pCompressed; // the buffer where the compressed data will go
+        const void* pBuffer = pCompressed; // the buffer where the compressed data will go
 
-        if (pFileEntry->nMethod == 0 && pUncompressed)
+        if (const void* pMappedData = GetMappedFileData(pFileEntry))
         {
-            // we can directly read into the uncompress buffer
-            pBuffer = pUncompressed;
+            // the data is already in memory, copy it straight to the caller's buffer
+            // and decompress from the mapping when the caller only wants the uncompressed data
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                memcpy(pUncompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+                pBuffer = pUncompressed;
+            }
+            else if (pCompressed)
+            {
+                memcpy(pCompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+            }
+            else if (pUncompressed)
+            {
+                pBuffer = pMappedData;
+            }
+            else
+            {
+                return ZD_ERROR_INVALID_CALL;
+            }
         }
-
-        if (!pBuffer)
+        else
         {
-            if (!pUncompressed)
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
             {
-                // what's the sense of it - no buffers at all?
-                return ZD_ERROR_INVALID_CALL;
+                return ZD_ERROR_IO_FAILED;
             }
 
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed, "Cache::ReadFile");
-            pBuffer = memoryBlock->m_address.get();
-        }
+            void* pReadBuffer = pCompressed;
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
-        {
-            return ZD_ERROR_IO_FAILED;
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                // we can directly read into the uncompress buffer
+                pReadBuffer = pUncompressed;
+            }
+
+            if (!pReadBuffer)
+            {
+                if (!pUncompressed)
+                {
+                    // what's the sense of it - no buffers at all?
+                    return ZD_ERROR_INVALID_CALL;
+                }
+
+                memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed, "Cache::ReadFile");
+                pReadBuffer = memoryBlock->m_address.get();
+            }
+
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pReadBuffer, pFileEntry->desc.lSizeCompressed, true))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+            pBuffer = pReadBuffer;
         }
 
         // if there's a buffer for uncompressed data, uncompress it to that buffer
@@ -758,6 +790,38 @@ namespace AZ::IO::ZipDir
     }
 
 
+    bool Cache::MapFile()
+    {
+        if (!(m_nFlags & FLAGS_READ_ONLY) || m_strFilePath.empty())
+        {
+            // files that are being written to can change size, and without a path there's nothing to map
+            return false;
+        }
+        if (!m_mappedFile.IsOpen() && !m_mappedFile.Open(m_strFilePath.c_str()))
+        {
+            AZ_Warning("Archive", false, R"(Unable to memory map the pack file "%s", its files will be read through the file handle.)", m_strFilePath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    const void* Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!m_mappedFile.IsOpen() || !pFileEntry || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return nullptr;
+        }
+
+        const uint64_t dataEnd = uint64_t{ pFileEntry->nFileDataOffset } + pFileEntry->desc.lSizeCompressed;
+        if (dataEnd > m_mappedFile.GetSize())
+        {
+            AZ_Warning("Archive", false, "ZD_ERROR_DATA_IS_CORRUPT: File data ends at %" PRIu64 " which is past the end of the mapped pack file \"%s\" (%" PRIu64 " bytes)",
+                dataEnd, m_strFilePath.c_str(), m_mappedFile.GetSize());
+            return nullptr;
+        }
+        return reinterpret_cast<const uint8_t*>(m_mappedFile.GetData()) + pFileEntry->nFileDataOffset;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
@@ -83,6 +84,19 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // maps the zip file read only into memory, so file data can be read from the shared page cache
+        // instead of being seeked and read through the file handle. Only read only caches can be mapped.
+        bool MapFile();
+
+        bool IsMapped() const
+        {
+            return m_mappedFile.IsOpen();
+        }
+
+        // returns the raw (possibly compressed) data of the file entry inside the mapped zip file,
+        // or nullptr if the zip file isn't mapped. The data is read only and valid as long as this cache is.
+        const void* GetMappedFileData(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -133,6 +147,8 @@ namespace AZ::IO::ZipDir
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
         AZ::IO::HandleType m_fileHandle;
+        // read only mapping of the zip file, only used by read only caches
+        AZ::IO::MappedFile m_mappedFile;
         AZ::IAllocatorAllocate* m_allocator;
         AZ::IO::Path m_strFilePath;
 
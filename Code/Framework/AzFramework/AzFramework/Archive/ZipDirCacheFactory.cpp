@@ -26,6 +26,11 @@
 
 namespace AZ::IO::ZipDir
 {
+    AZ_CVAR(bool, az_archive_memory_map_read_only_paks, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Memory maps pack files that are opened read only. Files stored without compression are then served straight from the\n"
+        "mapping, which lets processes that load the same pack files share the page cache instead of each keeping private copies.\n"
+        "Pack files must not be modified while they are mapped.");
+
     // this sets the window size of the blocks of data read from the end of the file to find the Central Directory Record
     // since normally there are no
     static constexpr size_t CDRSearchWindowSize = 0x100;
@@ -89,6 +94,11 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+            if (az_archive_memory_map_read_only_paks)
+            {
+                // falls back to reading through the file handle if the pack can't be mapped
+                pCache->MapFile();
+            }
         }
         else
         {
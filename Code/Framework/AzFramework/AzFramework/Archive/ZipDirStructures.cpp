@@ -9,6 +9,7 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Compression/zstd_compression.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzFramework/Archive/Codec.h>
@@ -616,6 +617,19 @@ namespace AZ::IO::ZipDir
 
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
     {
+        // Entries that span multiple blocks are stored as block framed data so the streamer can decompress the blocks in parallel
+        // and ranged reads only decompress the blocks they need. Regular zstd decompression reads both formats.
+        if (nSrcSize > AZ::ZStd::DefaultBlockSize)
+        {
+            size_t blockFramedSize = AZ::ZStd::CompressBlockFramed(pUncompressed, nSrcSize, pCompressed, *pDestSize, 1);
+            if (blockFramedSize == 0)
+            {
+                return Z_BUF_ERROR;
+            }
+            *pDestSize = blockFramedSize;
+            return Z_OK;
+        }
+
         size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
 
         int err = Z_OK;
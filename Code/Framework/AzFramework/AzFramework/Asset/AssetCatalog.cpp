@@ -27,6 +27,7 @@
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
 // uncomment to have the catalog be dumped to stdout:
@@ -185,8 +186,13 @@ namespace AzFramework
             return foundIter->second.m_relativePath;
         }
 
+        if (IsVisibleFlatCatalogAsset(id))
+        {
+            return m_flatCatalog->GetAssetPathById(id);
+        }
+
         // we did not find it - try the backup mapping!
-        AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
+        AZ::Data::AssetId legacyMapping = GetAssetIdByLegacyAssetIdInternal(id);
         if (legacyMapping.IsValid())
         {
             return GetAssetPathByIdInternal(legacyMapping);
@@ -215,14 +221,14 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        auto foundIter = m_registry->m_assetIdToInfo.find(id);
-        if (foundIter != m_registry->m_assetIdToInfo.end())
+        AZ::Data::AssetInfo assetInfo;
+        if (FindAssetInfoInternal(id, assetInfo))
         {
-            return foundIter->second;
+            return assetInfo;
         }
 
         // we did not find it - try the backup mapping!
-        AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
+        AZ::Data::AssetId legacyMapping = GetAssetIdByLegacyAssetIdInternal(id);
         if (legacyMapping.IsValid())
         {
             return GetAssetInfoByIdInternal(legacyMapping);
@@ -231,6 +237,124 @@ namespace AzFramework
         return AZ::Data::AssetInfo();
     }
 
+    //=========================================================================
+    // FindAssetInfoInternal
+    //=========================================================================
+    bool AssetCatalog::FindAssetInfoInternal(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        auto foundIter = m_registry->m_assetIdToInfo.find(id);
+        if (foundIter != m_registry->m_assetIdToInfo.end())
+        {
+            assetInfo = foundIter->second;
+            return true;
+        }
+
+        if (IsVisibleFlatCatalogAsset(id))
+        {
+            assetInfo = m_flatCatalog->GetAssetInfoById(id);
+            return true;
+        }
+        return false;
+    }
+
+    //=========================================================================
+    // GetAssetIdByPathInternal
+    //=========================================================================
+    AZ::Data::AssetId AssetCatalog::GetAssetIdByPathInternal(const char* path) const
+    {
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(path);
+        if (!foundId.IsValid() && m_flatCatalog)
+        {
+            foundId = m_flatCatalog->GetAssetIdByPath(path);
+            if (m_flatCatalogRemovedAssets.find(foundId) != m_flatCatalogRemovedAssets.end())
+            {
+                return AZ::Data::AssetId();
+            }
+        }
+        return foundId;
+    }
+
+    //=========================================================================
+    // GetAssetIdByLegacyAssetIdInternal
+    //=========================================================================
+    AZ::Data::AssetId AssetCatalog::GetAssetIdByLegacyAssetIdInternal(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByLegacyAssetId(legacyAssetId);
+        if (!foundId.IsValid() && m_flatCatalog)
+        {
+            foundId = m_flatCatalog->GetAssetIdByLegacyAssetId(legacyAssetId);
+        }
+        return foundId;
+    }
+
+    //=========================================================================
+    // GetAssetDependenciesInternal
+    //=========================================================================
+    bool AssetCatalog::GetAssetDependenciesInternal(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        auto itr = m_registry->m_assetDependencies.find(id);
+        if (itr != m_registry->m_assetDependencies.end())
+        {
+            dependencies.insert(dependencies.end(), itr->second.begin(), itr->second.end());
+            return true;
+        }
+
+        if (m_flatCatalog && m_flatCatalogRemovedDependencies.find(id) == m_flatCatalogRemovedDependencies.end())
+        {
+            return m_flatCatalog->GetDependencies(id, dependencies);
+        }
+        return false;
+    }
+
+    //=========================================================================
+    // IsVisibleFlatCatalogAsset
+    //=========================================================================
+    bool AssetCatalog::IsVisibleFlatCatalogAsset(const AZ::Data::AssetId& id) const
+    {
+        return m_flatCatalog &&
+            m_registry->m_assetIdToInfo.find(id) == m_registry->m_assetIdToInfo.end() &&
+            m_flatCatalogRemovedAssets.find(id) == m_flatCatalogRemovedAssets.end() &&
+            m_flatCatalog->HasAsset(id);
+    }
+
+    //=========================================================================
+    // CreateMergedRegistryInternal
+    //=========================================================================
+    AZStd::unique_ptr<AssetRegistry> AssetCatalog::CreateMergedRegistryInternal() const
+    {
+        AZ_Assert(m_flatCatalog, "A flat catalog needs to be loaded to merge the registry with it.");
+
+        AZStd::unique_ptr<AssetRegistry> mergedRegistry(aznew AssetRegistry());
+        m_flatCatalog->CopyToRegistry(*mergedRegistry);
+        for (const AZ::Data::AssetId& removedAsset : m_flatCatalogRemovedAssets)
+        {
+            mergedRegistry->UnregisterAsset(removedAsset);
+        }
+        for (const AZ::Data::AssetId& removedDependencies : m_flatCatalogRemovedDependencies)
+        {
+            mergedRegistry->m_assetDependencies.erase(removedDependencies);
+        }
+
+        // Unlike AssetRegistry::AddRegistry this keeps the dependencies of overridden assets, matching GetAssetDependenciesInternal.
+        for (const auto& element : m_registry->m_assetIdToInfo)
+        {
+            mergedRegistry->m_assetIdToInfo[element.first] = element.second;
+        }
+        for (const auto& element : m_registry->m_assetDependencies)
+        {
+            mergedRegistry->m_assetDependencies[element.first] = element.second;
+        }
+        for (const auto& element : m_registry->m_assetPathToId)
+        {
+            mergedRegistry->m_assetPathToId[element.first] = element.second;
+        }
+        for (const auto& element : m_registry->m_legacyAssetIdToRealAssetId)
+        {
+            mergedRegistry->m_legacyAssetIdToRealAssetId[element.first] = element.second;
+        }
+        return mergedRegistry;
+    }
+
     //=========================================================================
     // GetAssetIdByPath
     //=========================================================================
@@ -245,14 +369,13 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
+            AZ::Data::AssetId foundId = GetAssetIdByPathInternal(m_pathBuffer.c_str());
             if (foundId.IsValid())
             {
-                const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
-
                 // If the type is already registered, but with no valid type, allow it to be re-registered.
                 // Otherwise, return the Id.
-                if (!autoRegisterIfNotFound || !assetInfo.m_assetType.IsNull())
+                AZ::Data::AssetInfo assetInfo;
+                if (!autoRegisterIfNotFound || (FindAssetInfoInternal(foundId, assetInfo) && !assetInfo.m_assetType.IsNull()))
                 {
                     return foundId;
                 }
@@ -282,6 +405,7 @@ namespace AzFramework
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
                 m_registry->RegisterAsset(generatedID, newInfo);
+                m_flatCatalogRemovedAssets.erase(generatedID);
             }
 
             EBUS_EVENT(AzFramework::AssetCatalogEventBus, OnCatalogAssetAdded, generatedID);
@@ -302,6 +426,17 @@ namespace AzFramework
         {
             registeredAssetPaths.emplace_back(assetIdToInfoPair.second.m_relativePath);
         }
+        if (m_flatCatalog)
+        {
+            for (size_t i = 0; i < m_flatCatalog->GetNumAssets(); ++i)
+            {
+                const AZ::Data::AssetId assetId = m_flatCatalog->GetAssetIdByIndex(i);
+                if (IsVisibleFlatCatalogAsset(assetId))
+                {
+                    registeredAssetPaths.emplace_back(m_flatCatalog->GetAssetPathById(assetId));
+                }
+            }
+        }
 
         return registeredAssetPaths;
     }
@@ -309,14 +444,14 @@ namespace AzFramework
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetDirectProductDependencies(const AZ::Data::AssetId& id)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(id);
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
 
-        if (itr == m_registry->m_assetDependencies.end())
+        if (!GetAssetDependenciesInternal(id, dependencies))
         {
             return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
         }
 
-        return AZ::Success(itr->second);
+        return AZ::Success(AZStd::move(dependencies));
     }
     
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetAllProductDependencies(const AZ::Data::AssetId& id)
@@ -421,12 +556,10 @@ namespace AzFramework
         using namespace AZ::Data;
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
+        AZStd::vector<ProductDependency> assetDependencyList;
 
-        if (itr != m_registry->m_assetDependencies.end())
+        if (GetAssetDependenciesInternal(searchAssetId, assetDependencyList))
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
-
             for (const ProductDependency& dependency : assetDependencyList)
             {
                 if (!dependency.m_assetId.IsValid())
@@ -502,6 +635,17 @@ namespace AzFramework
             {
                 enumerateCB(it.first, it.second);
             }
+            if (m_flatCatalog)
+            {
+                for (size_t i = 0; i < m_flatCatalog->GetNumAssets(); ++i)
+                {
+                    const AZ::Data::AssetId assetId = m_flatCatalog->GetAssetIdByIndex(i);
+                    if (IsVisibleFlatCatalogAsset(assetId))
+                    {
+                        enumerateCB(assetId, m_flatCatalog->GetAssetInfoByIndex(i));
+                    }
+                }
+            }
         }
 
         if (endCB)
@@ -541,7 +685,19 @@ namespace AzFramework
             // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
             // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
             AZStd::vector<char> bytes;
-            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
+            AZStd::unique_ptr<FlatAssetCatalog> flatCatalog;
+            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance() &&
+                AZStd::string_view(catalogRegistryFile).ends_with(FlatAssetCatalog::FileSuffix))
+            {
+                // flat catalogs are queried in place, so map them instead of reading them whenever they are on disk.
+                flatCatalog = AZStd::make_unique<FlatAssetCatalog>();
+                if (!flatCatalog->Open(catalogRegistryFile))
+                {
+                    flatCatalog.reset();
+                }
+            }
+
+            if (!flatCatalog && catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
             {
                 AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
                 AZ::u64 size = 0;
@@ -563,7 +719,36 @@ namespace AzFramework
                 }
             }
 
-            if (!bytes.empty())
+            if (FlatAssetCatalog::IsFlatCatalog(bytes.data(), bytes.size()))
+            {
+                // files inside of archives can't be mapped, so hold on to the data read from them instead.
+                flatCatalog = AZStd::make_unique<FlatAssetCatalog>();
+                if (!flatCatalog->Open(AZStd::move(bytes)))
+                {
+                    flatCatalog.reset();
+                }
+            }
+
+            if (flatCatalog)
+            {
+                // the flat catalog becomes the base layer, with the registry on top of it starting out empty.
+                AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry = AZStd::move(m_registry);
+                m_registry.reset(aznew AssetRegistry());
+                m_flatCatalog = AZStd::move(flatCatalog);
+                m_flatCatalogRemovedAssets.clear();
+                m_flatCatalogRemovedDependencies.clear();
+
+                AZ_TracePrintf("AssetCatalog", "Loaded flat registry containing %zu assets.\n", m_flatCatalog->GetNumAssets());
+
+                // It's currently possible in tools for us to have received updates from AP which were applied before the catalog was ready to load
+                if (!m_initialized)
+                {
+                    ApplyDeltaCatalog(prevRegistry);
+                    m_initialized = true;
+                }
+                shouldBroadcast = true;
+            }
+            else if (!bytes.empty())
             {
                 AZStd::shared_ptr<AzFramework::AssetRegistry> prevRegistry;
                 if (!m_initialized)
@@ -572,6 +757,10 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
+                // a serialized registry replaces all of the content, including a previously loaded flat catalog.
+                m_flatCatalog.reset();
+                m_flatCatalogRemovedAssets.clear();
+                m_flatCatalogRemovedDependencies.clear();
                 AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
 #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                 ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
@@ -652,6 +841,7 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
             m_registry->RegisterAsset(id, info);
+            m_flatCatalogRemovedAssets.erase(id);
         }
         EBUS_EVENT(AzFramework::AssetCatalogEventBus, OnCatalogAssetAdded, id);
     }
@@ -672,6 +862,11 @@ namespace AzFramework
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
             m_registry->UnregisterAsset(assetId);
+            if (m_flatCatalog && m_flatCatalog->HasAsset(assetId))
+            {
+                m_flatCatalogRemovedAssets.insert(assetId);
+                m_flatCatalogRemovedDependencies.insert(assetId);
+            }
         }
     }
 
@@ -799,8 +994,8 @@ namespace AzFramework
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
                 // is it an add or a change?
-                auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
-                isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
+                AZ::Data::AssetInfo existingInfo;
+                isNewAsset = !FindAssetInfoInternal(assetId, existingInfo);
 
     #if defined(AZ_ENABLE_TRACING)
                 if (message.m_assetType == AZ::Data::s_invalidAssetType)
@@ -809,7 +1004,7 @@ namespace AzFramework
                 }
     #endif
 
-                const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : assetInfoPair->second.m_assetType;
+                const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : existingInfo.m_assetType;
 
                 AZ::Data::AssetInfo newData;
                 newData.m_assetId = assetId;
@@ -819,6 +1014,7 @@ namespace AzFramework
 
                 m_registry->RegisterAsset(assetId, newData);
                 m_registry->SetAssetDependencies(assetId, message.m_dependencies);
+                m_flatCatalogRemovedAssets.erase(assetId);
 
                 for (const auto& mapping : message.m_legacyAssetIds)
                 {
@@ -923,6 +1119,16 @@ namespace AzFramework
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_baseCatalogNameMutex);
             baseCatalogName = m_baseCatalogName;
         }
+        if (fileIO)
+        {
+            // prefer the flat version of the catalog, unless it's older than the serialized one and therefore out of date.
+            AZStd::string flatCatalogName = baseCatalogName + FlatAssetCatalog::FileSuffix;
+            if (fileIO->Exists(flatCatalogName.c_str()) &&
+                (!fileIO->Exists(baseCatalogName.c_str()) || fileIO->ModificationTime(flatCatalogName.c_str()) >= fileIO->ModificationTime(baseCatalogName.c_str())))
+            {
+                baseCatalogName = AZStd::move(flatCatalogName);
+            }
+        }
         if (fileIO && fileIO->Exists(baseCatalogName.c_str()))
         {
             InitializeCatalog(baseCatalogName.c_str());
@@ -978,6 +1184,9 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         m_registry->Clear();
+        m_flatCatalog.reset();
+        m_flatCatalogRemovedAssets.clear();
+        m_flatCatalogRemovedDependencies.clear();
         m_initialized = false;
     }
 
@@ -1084,6 +1293,18 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        if (m_flatCatalog)
+        {
+            // the delta overrides assets of the flat catalog the same way AddRegistry overrides the ones of the registry.
+            for (const auto& element : deltaCatalog->m_assetIdToInfo)
+            {
+                m_flatCatalogRemovedAssets.erase(element.first);
+                if (deltaCatalog->m_assetDependencies.find(element.first) == deltaCatalog->m_assetDependencies.end())
+                {
+                    m_flatCatalogRemovedDependencies.insert(element.first);
+                }
+            }
+        }
         m_registry->AddRegistry(deltaCatalog);
         return true;
     }
@@ -1148,6 +1369,11 @@ namespace AzFramework
     bool AssetCatalog::SaveCatalog(const char* catalogRegistryFile)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        if (m_flatCatalog)
+        {
+            AZStd::unique_ptr<AssetRegistry> mergedRegistry = CreateMergedRegistryInternal();
+            return SaveCatalog(catalogRegistryFile, mergedRegistry.get());
+        }
         return SaveCatalog(catalogRegistryFile, m_registry.get());
     }
 
@@ -1223,11 +1449,13 @@ namespace AzFramework
     //=========================================================================
     bool AssetCatalog::CreateDeltaCatalog(const AZStd::vector<AZStd::string>& files, const AZStd::string& filePath)
     {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+
         AzFramework::AssetRegistry deltaRegistry;
         AZStd::vector<AZ::Data::AssetId> deltaPakAssetIds;
         for (const AZStd::string& file : files)
         {
-            AZ::Data::AssetId asset = m_registry->GetAssetIdByPath(file.c_str());
+            AZ::Data::AssetId asset = GetAssetIdByPathInternal(file.c_str());
             if (!asset.IsValid())
             {
                 // Asset is not listed in the registry, we can early out and fail as there should never be an asset that isn't in the registry.
@@ -1250,6 +1478,18 @@ namespace AzFramework
                 deltaRegistry.RegisterAssetDependency(asset, dependency);
             }            
         }
+        if (m_flatCatalog)
+        {
+            for (size_t i = 0; i < m_flatCatalog->GetNumLegacyAssetIds(); ++i)
+            {
+                auto legacyToRealPair = m_flatCatalog->GetLegacyAssetIdMapping(i);
+                if (AZStd::find(deltaPakAssetIds.begin(), deltaPakAssetIds.end(), legacyToRealPair.second) != deltaPakAssetIds.end())
+                {
+                    deltaRegistry.RegisterLegacyAssetMapping(legacyToRealPair.first, legacyToRealPair.second);
+                }
+            }
+        }
+        // mappings of the registry are registered last, so they override the ones of the flat catalog.
         for (auto legacyToRealPair : m_registry->GetLegacyMappingSubsetFromRealIds(deltaPakAssetIds))
         {
             deltaRegistry.RegisterLegacyAssetMapping(legacyToRealPair.first, legacyToRealPair.second);
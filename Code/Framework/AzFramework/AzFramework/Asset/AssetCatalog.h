@@ -23,6 +23,7 @@ namespace AzFramework
 {
     class AssetRegistry;
     class AssetBundleManifest;
+    class FlatAssetCatalog;
 
     /*
      * An asset catalog keeps a registry of asset data information (file name, size, type, etc)
@@ -130,6 +131,16 @@ namespace AzFramework
         AZStd::string GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const;
         AZ::Data::AssetInfo GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const;
         bool DoesAssetIdMatchWildcardPatternInternal(const AZ::Data::AssetId& assetId, const AZStd::string& wildcardPattern) const;
+
+        // Lookups over the registry layered on top of the flat catalog, if one is loaded. Must be called with m_registryMutex held.
+        bool FindAssetInfoInternal(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        AZ::Data::AssetId GetAssetIdByPathInternal(const char* path) const;
+        AZ::Data::AssetId GetAssetIdByLegacyAssetIdInternal(const AZ::Data::AssetId& legacyAssetId) const;
+        bool GetAssetDependenciesInternal(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+        // Returns true for assets of the flat catalog that are neither overridden by nor removed from the registry.
+        bool IsVisibleFlatCatalogAsset(const AZ::Data::AssetId& id) const;
+        // Returns a copy of the flat catalog with the registry merged on top of it. Only valid while a flat catalog is loaded.
+        AZStd::unique_ptr<AssetRegistry> CreateMergedRegistryInternal() const;
     private:
 
         AZStd::atomic_bool m_shutdownThreadSignal;                  ///< Signals the monitoring thread to stop.
@@ -138,6 +149,12 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
+        //! Optional read only base layer below m_registry, loaded from a memory mapped flat catalog.
+        AZStd::unique_ptr<FlatAssetCatalog> m_flatCatalog;
+        //! Assets of the flat catalog that got unregistered since it was loaded.
+        AZStd::unordered_set<AZ::Data::AssetId> m_flatCatalogRemovedAssets;
+        //! Assets of the flat catalog whose dependencies got dropped by a delta catalog overriding the asset.
+        AZStd::unordered_set<AZ::Data::AssetId> m_flatCatalogRemovedDependencies;
         AZStd::string m_pathBuffer;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
@@ -221,6 +221,11 @@ namespace AzFramework
         m_assetPathToId.insert_key(CreateUUIDForName(assetPath)).first->second = AZStd::move(id);
     }
 
+    AZ::Uuid AssetRegistry::GetAssetPathKey(const char* assetPath)
+    {
+        return CreateUUIDForName(assetPath);
+    }
+
     void AssetRegistry::AddRegistry(AZStd::shared_ptr<AssetRegistry> assetRegistry)
     {
         for (const auto& element : assetRegistry->m_assetIdToInfo)
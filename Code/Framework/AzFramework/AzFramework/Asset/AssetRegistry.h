@@ -24,6 +24,7 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class FlatAssetCatalog;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator, 0);
@@ -74,6 +75,9 @@ namespace AzFramework
         //! Called automatically by RegisterAsset.
         void SetAssetIdByPath(const char* assetPath, const AZ::Data::AssetId& id);
 
+        //! Returns the key of the asset path in m_assetPathToId.
+        static AZ::Uuid GetAssetPathKey(const char* assetPath);
+
     };
 
 } // namespace AzFramework
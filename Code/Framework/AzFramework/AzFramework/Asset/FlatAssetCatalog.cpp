@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/FlatAssetCatalog.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    namespace FlatAssetCatalogInternal
+    {
+        constexpr AZ::u64 TableAlignment = 8;
+
+        AZ::u64 AlignOffset(AZ::u64 offset)
+        {
+            return (offset + TableAlignment - 1) & ~(TableAlignment - 1);
+        }
+
+        // Appends a table to the buffer at the next aligned offset and returns that offset.
+        template<typename T>
+        AZ::u64 AppendTable(AZStd::vector<char>& buffer, const AZStd::vector<T>& table)
+        {
+            const AZ::u64 offset = AlignOffset(buffer.size());
+            buffer.resize(offset + table.size() * sizeof(T), 0);
+            if (!table.empty())
+            {
+                memcpy(buffer.data() + offset, table.data(), table.size() * sizeof(T));
+            }
+            return offset;
+        }
+
+        bool IsTableInBounds(AZ::u64 offset, AZ::u64 count, AZ::u64 elementSize, AZ::u64 size)
+        {
+            return (offset % TableAlignment) == 0 && offset <= size && count <= (size - offset) / elementSize;
+        }
+
+        // Returns the first element in the sorted range that isn't less than the key.
+        template<typename T, typename Key, typename Less>
+        const T* LowerBound(const T* begin, size_t count, const Key& key, Less less)
+        {
+            return AZStd::lower_bound(begin, begin + count, key, less);
+        }
+    }
+
+    using namespace FlatAssetCatalogInternal;
+
+    FlatAssetCatalog::FlatAssetId FlatAssetCatalog::ToFlatAssetId(const AZ::Data::AssetId& assetId)
+    {
+        FlatAssetId result;
+        static_assert(sizeof(result.m_guid) == sizeof(assetId.m_guid.data), "Unexpected size of the asset guid.");
+        memcpy(result.m_guid, assetId.m_guid.data, sizeof(result.m_guid));
+        result.m_subId = assetId.m_subId;
+        result.m_padding = 0;
+        return result;
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::ToAssetId(const FlatAssetId& assetId)
+    {
+        AZ::Uuid guid;
+        memcpy(guid.data, assetId.m_guid, sizeof(assetId.m_guid));
+        return AZ::Data::AssetId(guid, assetId.m_subId);
+    }
+
+    bool FlatAssetCatalog::IsLess(const FlatAssetId& lhs, const FlatAssetId& rhs)
+    {
+        const int guidOrder = memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid));
+        return guidOrder < 0 || (guidOrder == 0 && lhs.m_subId < rhs.m_subId);
+    }
+
+    bool FlatAssetCatalog::IsEqual(const FlatAssetId& lhs, const FlatAssetId& rhs)
+    {
+        return lhs.m_subId == rhs.m_subId && memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid)) == 0;
+    }
+
+    AZStd::vector<char> FlatAssetCatalog::Build(const AssetRegistry& registry)
+    {
+        static_assert(sizeof(Header) == 96, "The header is part of the file format, bump the version when changing it.");
+        static_assert(sizeof(FlatAssetId) == 24, "FlatAssetId is part of the file format, bump the version when changing it.");
+        static_assert(sizeof(AssetEntry) == 64, "AssetEntry is part of the file format, bump the version when changing it.");
+        static_assert(sizeof(DependencyEntry) == 32, "DependencyEntry is part of the file format, bump the version when changing it.");
+        static_assert(sizeof(PathEntry) == 40, "PathEntry is part of the file format, bump the version when changing it.");
+        static_assert(sizeof(LegacyAssetIdEntry) == 48, "LegacyAssetIdEntry is part of the file format, bump the version when changing it.");
+
+        auto assetEntryLess = [](const AssetEntry& lhs, const AssetEntry& rhs) { return IsLess(lhs.m_assetId, rhs.m_assetId); };
+
+        // Assets and the string pool holding their relative paths.
+        AZStd::vector<AssetEntry> assets;
+        AZStd::vector<char> strings;
+        assets.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& [assetId, assetInfo] : registry.m_assetIdToInfo)
+        {
+            AssetEntry& entry = assets.emplace_back();
+            memset(&entry, 0, sizeof(entry));
+            entry.m_assetId = ToFlatAssetId(assetId);
+            memcpy(entry.m_assetType, assetInfo.m_assetType.data, sizeof(entry.m_assetType));
+            entry.m_sizeBytes = assetInfo.m_sizeBytes;
+            entry.m_pathOffset = strings.size();
+            entry.m_pathLength = aznumeric_cast<AZ::u32>(assetInfo.m_relativePath.size());
+            strings.insert(strings.end(), assetInfo.m_relativePath.begin(), assetInfo.m_relativePath.end());
+        }
+        AZStd::sort(assets.begin(), assets.end(), assetEntryLess);
+
+        // Dependencies, with the dependencies of every owner stored in a single row.
+        // Owners without dependencies are kept, as an empty list is different from not having a list at all.
+        AZStd::vector<FlatAssetId> dependencyOwners;
+        dependencyOwners.reserve(registry.m_assetDependencies.size());
+        for (const auto& [assetId, dependencies] : registry.m_assetDependencies)
+        {
+            dependencyOwners.push_back(ToFlatAssetId(assetId));
+        }
+        AZStd::sort(dependencyOwners.begin(), dependencyOwners.end(), &FlatAssetCatalog::IsLess);
+
+        AZStd::vector<AZ::u32> dependencyRows;
+        AZStd::vector<DependencyEntry> dependencies;
+        dependencyRows.reserve(dependencyOwners.size() + 1);
+        for (const FlatAssetId& owner : dependencyOwners)
+        {
+            dependencyRows.push_back(aznumeric_cast<AZ::u32>(dependencies.size()));
+            for (const AZ::Data::ProductDependency& dependency : registry.m_assetDependencies.find(ToAssetId(owner))->second)
+            {
+                DependencyEntry& entry = dependencies.emplace_back();
+                entry.m_assetId = ToFlatAssetId(dependency.m_assetId);
+                entry.m_flags = dependency.m_flags.to_ullong();
+            }
+        }
+        dependencyRows.push_back(aznumeric_cast<AZ::u32>(dependencies.size()));
+
+        AZStd::vector<PathEntry> paths;
+        paths.reserve(registry.m_assetPathToId.size());
+        for (const auto& [pathHash, assetId] : registry.m_assetPathToId)
+        {
+            PathEntry& entry = paths.emplace_back();
+            memcpy(entry.m_pathHash, pathHash.data, sizeof(entry.m_pathHash));
+            entry.m_assetId = ToFlatAssetId(assetId);
+        }
+        AZStd::sort(paths.begin(), paths.end(), [](const PathEntry& lhs, const PathEntry& rhs)
+        {
+            return memcmp(lhs.m_pathHash, rhs.m_pathHash, sizeof(lhs.m_pathHash)) < 0;
+        });
+
+        AZStd::vector<LegacyAssetIdEntry> legacyAssetIds;
+        legacyAssetIds.reserve(registry.m_legacyAssetIdToRealAssetId.size());
+        for (const auto& [legacyAssetId, assetId] : registry.m_legacyAssetIdToRealAssetId)
+        {
+            legacyAssetIds.push_back({ ToFlatAssetId(legacyAssetId), ToFlatAssetId(assetId) });
+        }
+        AZStd::sort(legacyAssetIds.begin(), legacyAssetIds.end(), [](const LegacyAssetIdEntry& lhs, const LegacyAssetIdEntry& rhs)
+        {
+            return IsLess(lhs.m_legacyAssetId, rhs.m_legacyAssetId);
+        });
+
+        Header header;
+        memset(&header, 0, sizeof(header));
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_assetCount = aznumeric_cast<AZ::u32>(assets.size());
+        header.m_dependencyOwnerCount = aznumeric_cast<AZ::u32>(dependencyOwners.size());
+        header.m_dependencyCount = aznumeric_cast<AZ::u32>(dependencies.size());
+        header.m_pathCount = aznumeric_cast<AZ::u32>(paths.size());
+        header.m_legacyAssetIdCount = aznumeric_cast<AZ::u32>(legacyAssetIds.size());
+
+        AZStd::vector<char> buffer;
+        buffer.resize(sizeof(Header));
+        header.m_assetsOffset = AppendTable(buffer, assets);
+        header.m_dependencyOwnersOffset = AppendTable(buffer, dependencyOwners);
+        header.m_dependencyRowsOffset = AppendTable(buffer, dependencyRows);
+        header.m_dependenciesOffset = AppendTable(buffer, dependencies);
+        header.m_pathsOffset = AppendTable(buffer, paths);
+        header.m_legacyAssetIdsOffset = AppendTable(buffer, legacyAssetIds);
+        header.m_stringsOffset = AppendTable(buffer, strings);
+        header.m_stringsSize = strings.size();
+        memcpy(buffer.data(), &header, sizeof(header));
+        return buffer;
+    }
+
+    bool FlatAssetCatalog::Save(const char* catalogFile, const AssetRegistry& registry)
+    {
+        const AZStd::vector<char> buffer = Build(registry);
+
+        AZ::IO::FileIOStream stream(catalogFile, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen() || stream.Write(buffer.size(), buffer.data()) != buffer.size())
+        {
+            AZ_Warning("FlatAssetCatalog", false, "Failed to save flat catalog file %s", catalogFile);
+            return false;
+        }
+        return true;
+    }
+
+    bool FlatAssetCatalog::IsFlatCatalog(const void* data, AZ::u64 size)
+    {
+        AZ::u32 magic = 0;
+        if (!data || size < sizeof(Header))
+        {
+            return false;
+        }
+        memcpy(&magic, data, sizeof(magic));
+        return magic == Magic;
+    }
+
+    bool FlatAssetCatalog::Open(const char* catalogFile)
+    {
+        Close();
+
+        AZ::IO::FixedMaxPathString resolvedPath(catalogFile);
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            char buffer[AZ_MAX_PATH_LEN] = { 0 };
+            if (fileIO->ResolvePath(catalogFile, buffer, AZ_ARRAY_SIZE(buffer)))
+            {
+                resolvedPath = buffer;
+            }
+        }
+
+        if (!m_mappedFile.Open(resolvedPath.c_str()))
+        {
+            return false;
+        }
+        if (!Attach(m_mappedFile.GetData(), m_mappedFile.GetSize()))
+        {
+            AZ_Warning("FlatAssetCatalog", false, "%s is not a valid flat catalog of version %u.", catalogFile, Version);
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    bool FlatAssetCatalog::Open(AZStd::vector<char>&& catalogData)
+    {
+        Close();
+
+        m_ownedData = AZStd::move(catalogData);
+        if (!Attach(m_ownedData.data(), m_ownedData.size()))
+        {
+            AZ_Warning("FlatAssetCatalog", false, "The data is not a valid flat catalog of version %u.", Version);
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void FlatAssetCatalog::Close()
+    {
+        m_header = nullptr;
+        m_assets = nullptr;
+        m_dependencyOwners = nullptr;
+        m_dependencyRows = nullptr;
+        m_dependencies = nullptr;
+        m_paths = nullptr;
+        m_legacyAssetIds = nullptr;
+        m_strings = nullptr;
+
+        m_mappedFile.Close();
+        m_ownedData = {};
+    }
+
+    bool FlatAssetCatalog::Attach(const void* data, AZ::u64 size)
+    {
+        if (!IsFlatCatalog(data, size) || (reinterpret_cast<uintptr_t>(data) % TableAlignment) != 0)
+        {
+            return false;
+        }
+
+        const char* bytes = static_cast<const char*>(data);
+        const Header* header = reinterpret_cast<const Header*>(bytes);
+        if (header->m_version != Version ||
+            !IsTableInBounds(header->m_assetsOffset, header->m_assetCount, sizeof(AssetEntry), size) ||
+            !IsTableInBounds(header->m_dependencyOwnersOffset, header->m_dependencyOwnerCount, sizeof(FlatAssetId), size) ||
+            !IsTableInBounds(header->m_dependencyRowsOffset, AZ::u64(header->m_dependencyOwnerCount) + 1, sizeof(AZ::u32), size) ||
+            !IsTableInBounds(header->m_dependenciesOffset, header->m_dependencyCount, sizeof(DependencyEntry), size) ||
+            !IsTableInBounds(header->m_pathsOffset, header->m_pathCount, sizeof(PathEntry), size) ||
+            !IsTableInBounds(header->m_legacyAssetIdsOffset, header->m_legacyAssetIdCount, sizeof(LegacyAssetIdEntry), size) ||
+            !IsTableInBounds(header->m_stringsOffset, header->m_stringsSize, 1, size))
+        {
+            return false;
+        }
+
+        // The rows must start at 0, never decrease and end at the number of dependencies, so that no row can point outside the
+        // dependency table.
+        const AZ::u32* dependencyRows = reinterpret_cast<const AZ::u32*>(bytes + header->m_dependencyRowsOffset);
+        if (dependencyRows[0] != 0 || dependencyRows[header->m_dependencyOwnerCount] != header->m_dependencyCount)
+        {
+            return false;
+        }
+        for (AZ::u32 i = 0; i < header->m_dependencyOwnerCount; ++i)
+        {
+            if (dependencyRows[i] > dependencyRows[i + 1])
+            {
+                return false;
+            }
+        }
+
+        m_header = header;
+        m_assets = reinterpret_cast<const AssetEntry*>(bytes + header->m_assetsOffset);
+        m_dependencyOwners = reinterpret_cast<const FlatAssetId*>(bytes + header->m_dependencyOwnersOffset);
+        m_dependencyRows = dependencyRows;
+        m_dependencies = reinterpret_cast<const DependencyEntry*>(bytes + header->m_dependenciesOffset);
+        m_paths = reinterpret_cast<const PathEntry*>(bytes + header->m_pathsOffset);
+        m_legacyAssetIds = reinterpret_cast<const LegacyAssetIdEntry*>(bytes + header->m_legacyAssetIdsOffset);
+        m_strings = bytes + header->m_stringsOffset;
+        return true;
+    }
+
+    size_t FlatAssetCatalog::GetNumAssets() const
+    {
+        return m_header ? m_header->m_assetCount : 0;
+    }
+
+    AZ::Data::AssetInfo FlatAssetCatalog::GetAssetInfoByIndex(size_t index) const
+    {
+        AZ_Assert(index < GetNumAssets(), "Asset index %zu is out of range.", index);
+        const AssetEntry& entry = m_assets[index];
+
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = ToAssetId(entry.m_assetId);
+        memcpy(assetInfo.m_assetType.data, entry.m_assetType, sizeof(entry.m_assetType));
+        assetInfo.m_sizeBytes = entry.m_sizeBytes;
+        assetInfo.m_relativePath = GetPath(entry);
+        return assetInfo;
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::GetAssetIdByIndex(size_t index) const
+    {
+        AZ_Assert(index < GetNumAssets(), "Asset index %zu is out of range.", index);
+        return ToAssetId(m_assets[index].m_assetId);
+    }
+
+    const FlatAssetCatalog::AssetEntry* FlatAssetCatalog::FindAsset(const AZ::Data::AssetId& assetId) const
+    {
+        if (!m_header)
+        {
+            return nullptr;
+        }
+
+        const FlatAssetId key = ToFlatAssetId(assetId);
+        const AssetEntry* found = LowerBound(m_assets, m_header->m_assetCount, key,
+            [](const AssetEntry& entry, const FlatAssetId& value) { return IsLess(entry.m_assetId, value); });
+        if (found != m_assets + m_header->m_assetCount && IsEqual(found->m_assetId, key))
+        {
+            return found;
+        }
+        return nullptr;
+    }
+
+    AZStd::string_view FlatAssetCatalog::GetPath(const AssetEntry& entry) const
+    {
+        if (entry.m_pathOffset > m_header->m_stringsSize || entry.m_pathLength > m_header->m_stringsSize - entry.m_pathOffset)
+        {
+            return {};
+        }
+        return AZStd::string_view(m_strings + entry.m_pathOffset, entry.m_pathLength);
+    }
+
+    bool FlatAssetCatalog::HasAsset(const AZ::Data::AssetId& assetId) const
+    {
+        return FindAsset(assetId) != nullptr;
+    }
+
+    AZ::Data::AssetInfo FlatAssetCatalog::GetAssetInfoById(const AZ::Data::AssetId& assetId) const
+    {
+        if (const AssetEntry* entry = FindAsset(assetId))
+        {
+            return GetAssetInfoByIndex(entry - m_assets);
+        }
+        return AZ::Data::AssetInfo();
+    }
+
+    AZStd::string_view FlatAssetCatalog::GetAssetPathById(const AZ::Data::AssetId& assetId) const
+    {
+        if (const AssetEntry* entry = FindAsset(assetId))
+        {
+            return GetPath(*entry);
+        }
+        return {};
+    }
+
+    bool FlatAssetCatalog::GetDependencies(const AZ::Data::AssetId& assetId, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        if (!m_header)
+        {
+            return false;
+        }
+
+        const FlatAssetId key = ToFlatAssetId(assetId);
+        const FlatAssetId* owner = LowerBound(m_dependencyOwners, m_header->m_dependencyOwnerCount, key, &FlatAssetCatalog::IsLess);
+        if (owner == m_dependencyOwners + m_header->m_dependencyOwnerCount || !IsEqual(*owner, key))
+        {
+            return false;
+        }
+
+        const size_t row = owner - m_dependencyOwners;
+        const AZ::u32 begin = m_dependencyRows[row];
+        const AZ::u32 end = m_dependencyRows[row + 1];
+        dependencies.reserve(dependencies.size() + (end - begin));
+        for (AZ::u32 i = begin; i < end; ++i)
+        {
+            dependencies.emplace_back(ToAssetId(m_dependencies[i].m_assetId), AZStd::bitset<64>(m_dependencies[i].m_flags));
+        }
+        return true;
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::GetAssetIdByPath(const char* assetPath) const
+    {
+        if (!m_header || !assetPath || assetPath[0] == 0)
+        {
+            return AZ::Data::AssetId();
+        }
+
+        const AZ::Uuid pathHash = AssetRegistry::GetAssetPathKey(assetPath);
+        const PathEntry* found = LowerBound(m_paths, m_header->m_pathCount, pathHash,
+            [](const PathEntry& entry, const AZ::Uuid& value) { return memcmp(entry.m_pathHash, value.data, sizeof(entry.m_pathHash)) < 0; });
+        if (found != m_paths + m_header->m_pathCount && memcmp(found->m_pathHash, pathHash.data, sizeof(found->m_pathHash)) == 0)
+        {
+            return ToAssetId(found->m_assetId);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    AZ::Data::AssetId FlatAssetCatalog::GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        if (!m_header)
+        {
+            return AZ::Data::AssetId();
+        }
+
+        const FlatAssetId key = ToFlatAssetId(legacyAssetId);
+        const LegacyAssetIdEntry* found = LowerBound(m_legacyAssetIds, m_header->m_legacyAssetIdCount, key,
+            [](const LegacyAssetIdEntry& entry, const FlatAssetId& value) { return IsLess(entry.m_legacyAssetId, value); });
+        if (found != m_legacyAssetIds + m_header->m_legacyAssetIdCount && IsEqual(found->m_legacyAssetId, key))
+        {
+            return ToAssetId(found->m_assetId);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    size_t FlatAssetCatalog::GetNumLegacyAssetIds() const
+    {
+        return m_header ? m_header->m_legacyAssetIdCount : 0;
+    }
+
+    AZStd::pair<AZ::Data::AssetId, AZ::Data::AssetId> FlatAssetCatalog::GetLegacyAssetIdMapping(size_t index) const
+    {
+        AZ_Assert(index < GetNumLegacyAssetIds(), "Legacy asset id index %zu is out of range.", index);
+        return { ToAssetId(m_legacyAssetIds[index].m_legacyAssetId), ToAssetId(m_legacyAssetIds[index].m_assetId) };
+    }
+
+    void FlatAssetCatalog::CopyToRegistry(AssetRegistry& registry) const
+    {
+        if (!m_header)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < m_header->m_assetCount; ++i)
+        {
+            AZ::Data::AssetInfo assetInfo = GetAssetInfoByIndex(i);
+            registry.m_assetIdToInfo[assetInfo.m_assetId] = AZStd::move(assetInfo);
+        }
+        // The path table is copied as is, instead of hashing the paths of the assets again.
+        for (size_t i = 0; i < m_header->m_pathCount; ++i)
+        {
+            AZ::Uuid pathHash;
+            memcpy(pathHash.data, m_paths[i].m_pathHash, sizeof(m_paths[i].m_pathHash));
+            registry.m_assetPathToId[pathHash] = ToAssetId(m_paths[i].m_assetId);
+        }
+        for (size_t i = 0; i < m_header->m_dependencyOwnerCount; ++i)
+        {
+            AZStd::vector<AZ::Data::ProductDependency>& dependencies = registry.m_assetDependencies[ToAssetId(m_dependencyOwners[i])];
+            dependencies.clear();
+            GetDependencies(ToAssetId(m_dependencyOwners[i]), dependencies);
+        }
+        for (size_t i = 0; i < m_header->m_legacyAssetIdCount; ++i)
+        {
+            registry.m_legacyAssetIdToRealAssetId[ToAssetId(m_legacyAssetIds[i].m_legacyAssetId)] = ToAssetId(m_legacyAssetIds[i].m_assetId);
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    /**
+    * Read only asset catalog stored in a flat, versioned binary layout that is queried in place.
+    * Instead of deserializing the catalog into hash maps, the file is memory mapped and lookups binary search sorted tables:
+    *  - assets sorted by asset id, pointing into a shared string pool for the relative paths,
+    *  - product dependencies stored as one array per asset (compressed sparse rows), indexed by a sorted table of owning asset ids,
+    *  - the legacy path hash -> asset id and legacy asset id -> asset id tables, both sorted by their key.
+    * The mapped pages are shared between every process using the same catalog and only the pages that are touched get loaded.
+    * The format stores its values in the native (little endian) byte order of the platforms the engine runs on.
+    * AssetCatalog uses this as its base layer, with an AssetRegistry on top holding everything registered afterwards.
+    */
+    class FlatAssetCatalog
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FlatAssetCatalog, AZ::SystemAllocator, 0);
+
+        //! The characters "AZFC" when read from the start of the file.
+        static constexpr AZ::u32 Magic = 0x43465A41;
+        static constexpr AZ::u32 Version = 1;
+        //! Appended to the path of a serialized catalog to get the path of its flat counterpart.
+        static constexpr const char* FileSuffix = ".flat";
+
+        FlatAssetCatalog() = default;
+        FlatAssetCatalog(const FlatAssetCatalog&) = delete;
+        FlatAssetCatalog& operator=(const FlatAssetCatalog&) = delete;
+
+        //! Writes the content of the registry into a buffer using the flat layout.
+        static AZStd::vector<char> Build(const AssetRegistry& registry);
+        //! Writes the content of the registry to a file using the flat layout.
+        static bool Save(const char* catalogFile, const AssetRegistry& registry);
+        //! Returns true when the data starts with the header of a flat catalog, regardless of its version.
+        static bool IsFlatCatalog(const void* data, AZ::u64 size);
+
+        //! Memory maps the catalog file. The path is resolved through FileIOBase, so aliases are supported.
+        //! Fails for files that aren't flat catalogs of the current version or that aren't on disk, for example inside an archive.
+        bool Open(const char* catalogFile);
+        //! Takes ownership of a buffer holding a flat catalog, for files that can't be mapped.
+        bool Open(AZStd::vector<char>&& catalogData);
+        void Close();
+        bool IsOpen() const { return m_header != nullptr; }
+
+        size_t GetNumAssets() const;
+        //! Returns the info of the asset at the given index, the assets are sorted by asset id.
+        AZ::Data::AssetInfo GetAssetInfoByIndex(size_t index) const;
+        AZ::Data::AssetId GetAssetIdByIndex(size_t index) const;
+
+        bool HasAsset(const AZ::Data::AssetId& assetId) const;
+        //! Returns an invalid asset info (with an invalid asset id) when the asset isn't in the catalog.
+        AZ::Data::AssetInfo GetAssetInfoById(const AZ::Data::AssetId& assetId) const;
+        AZStd::string_view GetAssetPathById(const AZ::Data::AssetId& assetId) const;
+
+        //! Returns false when the catalog holds no dependency list for the asset.
+        bool GetDependencies(const AZ::Data::AssetId& assetId, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+        //! LEGACY - see AssetRegistry::GetAssetIdByPath.
+        AZ::Data::AssetId GetAssetIdByPath(const char* assetPath) const;
+        AZ::Data::AssetId GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
+
+        size_t GetNumLegacyAssetIds() const;
+        //! Returns the legacy asset id and the asset id it maps to for the entry at the given index.
+        AZStd::pair<AZ::Data::AssetId, AZ::Data::AssetId> GetLegacyAssetIdMapping(size_t index) const;
+
+        //! Adds everything stored in this catalog to the registry, overwriting any existing entries.
+        void CopyToRegistry(AssetRegistry& registry) const;
+
+    private:
+        // Uuids are stored as plain bytes, so the tables only need to be 8 byte aligned.
+        using FlatUuid = AZ::u8[16];
+
+        struct FlatAssetId
+        {
+            FlatUuid m_guid;
+            AZ::u32 m_subId;
+            AZ::u32 m_padding;
+        };
+
+        struct Header
+        {
+            AZ::u32 m_magic;
+            AZ::u32 m_version;
+            AZ::u32 m_assetCount;
+            AZ::u32 m_dependencyOwnerCount;
+            AZ::u32 m_dependencyCount;
+            AZ::u32 m_pathCount;
+            AZ::u32 m_legacyAssetIdCount;
+            AZ::u32 m_padding;
+            AZ::u64 m_assetsOffset;
+            AZ::u64 m_dependencyOwnersOffset;
+            AZ::u64 m_dependencyRowsOffset;
+            AZ::u64 m_dependenciesOffset;
+            AZ::u64 m_pathsOffset;
+            AZ::u64 m_legacyAssetIdsOffset;
+            AZ::u64 m_stringsOffset;
+            AZ::u64 m_stringsSize;
+        };
+
+        struct AssetEntry
+        {
+            FlatAssetId m_assetId;
+            FlatUuid m_assetType;
+            AZ::u64 m_sizeBytes;
+            AZ::u64 m_pathOffset;
+            AZ::u32 m_pathLength;
+            AZ::u32 m_padding;
+        };
+
+        struct DependencyEntry
+        {
+            FlatAssetId m_assetId;
+            AZ::u64 m_flags;
+        };
+
+        struct PathEntry
+        {
+            FlatUuid m_pathHash;
+            FlatAssetId m_assetId;
+        };
+
+        struct LegacyAssetIdEntry
+        {
+            FlatAssetId m_legacyAssetId;
+            FlatAssetId m_assetId;
+        };
+
+        static FlatAssetId ToFlatAssetId(const AZ::Data::AssetId& assetId);
+        static AZ::Data::AssetId ToAssetId(const FlatAssetId& assetId);
+        static bool IsLess(const FlatAssetId& lhs, const FlatAssetId& rhs);
+        static bool IsEqual(const FlatAssetId& lhs, const FlatAssetId& rhs);
+
+        //! Sets up the table pointers after validating that all of them are within the given data.
+        bool Attach(const void* data, AZ::u64 size);
+        const AssetEntry* FindAsset(const AZ::Data::AssetId& assetId) const;
+        AZStd::string_view GetPath(const AssetEntry& entry) const;
+
+        AZ::IO::MappedFile m_mappedFile;
+        AZStd::vector<char> m_ownedData;
+
+        const Header* m_header = nullptr;
+        const AssetEntry* m_assets = nullptr;
+        const FlatAssetId* m_dependencyOwners = nullptr;
+        const AZ::u32* m_dependencyRows = nullptr;
+        const DependencyEntry* m_dependencies = nullptr;
+        const PathEntry* m_paths = nullptr;
+        const LegacyAssetIdEntry* m_legacyAssetIds = nullptr;
+        const char* m_strings = nullptr;
+    };
+} // namespace AzFramework
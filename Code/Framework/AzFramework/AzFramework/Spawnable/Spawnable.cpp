@@ -530,6 +530,16 @@ namespace AzFramework
         return m_metaData;
     }
 
+    void Spawnable::SetClonePlan(AZStd::shared_ptr<const SpawnableClonePlan> clonePlan)
+    {
+        m_clonePlan = AZStd::move(clonePlan);
+    }
+
+    const SpawnableClonePlan* Spawnable::GetClonePlan() const
+    {
+        return m_clonePlan.get();
+    }
+
     void Spawnable::Reflect(AZ::ReflectContext* context)
     {
         EntityAlias::Reflect(context);
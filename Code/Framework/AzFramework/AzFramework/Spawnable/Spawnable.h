@@ -13,6 +13,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
@@ -23,6 +24,8 @@ namespace AZ
 
 namespace AzFramework
 {
+    class SpawnableClonePlan;
+
     class Spawnable final
         : public AZ::Data::AssetData
     {
@@ -195,6 +198,12 @@ namespace AzFramework
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
+        //! Sets the precompiled plan used to clone the entities in this spawnable. The plan refers to the entities in the spawnable,
+        //! so it needs to be cleared or replaced if the entities are changed afterwards.
+        void SetClonePlan(AZStd::shared_ptr<const SpawnableClonePlan> clonePlan);
+        //! Returns the precompiled plan to clone the entities in this spawnable or null if there's no plan.
+        const SpawnableClonePlan* GetClonePlan() const;
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
@@ -205,6 +214,8 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+        // Optional plan to clone the entities, compiled when the spawnable is loaded.
+        AZStd::shared_ptr<const SpawnableClonePlan> m_clonePlan;
 
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
     };
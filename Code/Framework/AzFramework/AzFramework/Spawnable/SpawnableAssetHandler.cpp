@@ -7,18 +7,27 @@
  */
 
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/sort.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableAssetBus.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 
 namespace AzFramework
 {
     SpawnableAssetHandler::SpawnableAssetHandler()
     {
         AZ::AssetTypeInfoBus::MultiHandler::BusConnect(AZ::AzTypeInfo<Spawnable>::Uuid());
+
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(m_compileClonePlans, "/O3DE/AzFramework/Spawnables/CompileClonePlans");
+        }
     }
 
     SpawnableAssetHandler::~SpawnableAssetHandler()
@@ -55,6 +64,18 @@ namespace AzFramework
         if (AZ::Utils::LoadObjectFromStreamInPlace(*stream, *spawnable, nullptr /*SerializeContext*/, filter))
         {
             ResolveEntityAliases(spawnable, asset, stream->GetStreamingDeadline(), stream->GetStreamingPriority(), assetLoadFilterCB);
+
+            if (m_compileClonePlans)
+            {
+                // The entities in a loaded spawnable don't change anymore, so the walk through the reflection data that's needed to
+                // clone them can be done once here instead of for every spawned entity.
+                AZ::SerializeContext* serializeContext = nullptr;
+                AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+                if (serializeContext)
+                {
+                    spawnable->SetClonePlan(AZStd::make_shared<SpawnableClonePlan>(spawnable->GetEntities(), *serializeContext));
+                }
+            }
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
         }
         else
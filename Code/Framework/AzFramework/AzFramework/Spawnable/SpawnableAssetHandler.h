@@ -58,5 +58,9 @@ namespace AzFramework
             AZStd::chrono::milliseconds streamingDeadline,
             AZ::IO::IStreamerTypes::Priority streamingPriority,
             const AZ::Data::AssetFilterCB& assetLoadFilterCB);
+
+        //! Whether or not to compile a clone plan for loaded spawnables. This can be configured through the Settings Registry
+        //! under the key "/O3DE/AzFramework/Spawnables/CompileClonePlans".
+        bool m_compileClonePlans{ true };
     };
 } // namespace AzFramework
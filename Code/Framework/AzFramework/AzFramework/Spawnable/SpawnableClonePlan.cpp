@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+namespace AzFramework
+{
+    namespace SpawnableClonePlanInternal
+    {
+        AZ::EntityId RemapEntityId(const SpawnableClonePlan::EntityIdMap& prototypeToCloneMap, AZ::EntityId id)
+        {
+            auto it = prototypeToCloneMap.find(id);
+            return it != prototypeToCloneMap.end() ? it->second : id;
+        }
+    } // namespace SpawnableClonePlanInternal
+
+    SpawnableClonePlan::SpawnableClonePlan(const Spawnable::EntityList& prototypes, AZ::SerializeContext& serializeContext)
+        : m_serializeContext(&serializeContext)
+    {
+        m_entityPlans.resize(prototypes.size());
+        for (size_t i = 0; i < prototypes.size(); ++i)
+        {
+            if (prototypes[i])
+            {
+                CompileEntityPlan(m_entityPlans[i], *prototypes[i]);
+            }
+            else
+            {
+                m_entityPlans[i].m_isValid = false;
+            }
+        }
+    }
+
+    AZ::Entity* SpawnableClonePlan::CloneEntity(size_t index, const AZ::Entity& prototype, EntityIdMap& prototypeToCloneMap) const
+    {
+        if (index >= m_entityPlans.size())
+        {
+            return nullptr;
+        }
+
+        const EntityPlan& plan = m_entityPlans[index];
+        if (!plan.m_isValid || plan.m_prototype != &prototype)
+        {
+            return nullptr;
+        }
+
+        // The Remapper first generates new ids for all ids that have a generator and then remaps the remaining ids. Generating
+        // the ids up front gives the same mapping and allows every id to be remapped with a single look up while it's copied.
+        for (const GeneratedId& generatedId : plan.m_generatedIds)
+        {
+            if (prototypeToCloneMap.find(generatedId.m_prototypeId) == prototypeToCloneMap.end())
+            {
+                prototypeToCloneMap.emplace(generatedId.m_prototypeId, generatedId.m_generator->Invoke(nullptr));
+            }
+        }
+
+        AZStd::vector<Frame> frames;
+        frames.reserve(plan.m_maxDepth);
+        AZStd::vector<char> scratchBuffer;
+        void* root = nullptr;
+
+        for (size_t i = 0, count = plan.m_instructions.size(); i < count; ++i)
+        {
+            const Instruction& instruction = plan.m_instructions[i];
+            switch (instruction.m_operation)
+            {
+            case Operation::BeginObject:
+            {
+                void* object = BeginObject(instruction, frames, scratchBuffer, prototypeToCloneMap);
+                if (instruction.m_isRoot)
+                {
+                    root = object;
+                }
+                if (!object)
+                {
+                    // Skip the content of the object and continue with the EndObject that removes the empty frame.
+                    i = instruction.m_endIndex - 1;
+                }
+                break;
+            }
+            case Operation::EndObject:
+                EndObject(instruction, frames);
+                break;
+            case Operation::CopyBytes:
+                memcpy(reinterpret_cast<char*>(frames.back().m_object) + instruction.m_offset, instruction.m_source, instruction.m_size);
+                break;
+            case Operation::CopyEntityId:
+                *reinterpret_cast<AZ::EntityId*>(reinterpret_cast<char*>(frames.back().m_object) + instruction.m_offset) =
+                    SpawnableClonePlanInternal::RemapEntityId(
+                        prototypeToCloneMap, *reinterpret_cast<const AZ::EntityId*>(instruction.m_source));
+                break;
+            default:
+                AZ_Assert(false, "Unsupported clone plan operation: %i", static_cast<int>(instruction.m_operation));
+                break;
+            }
+        }
+
+        return root ? m_serializeContext->Cast<AZ::Entity*>(root, plan.m_instructions.front().m_classData->m_typeId) : nullptr;
+    }
+
+    bool SpawnableClonePlan::HasEntityPlan(size_t index) const
+    {
+        return index < m_entityPlans.size() && m_entityPlans[index].m_isValid;
+    }
+
+    const AZ::SerializeContext& SpawnableClonePlan::GetSerializeContext() const
+    {
+        return *m_serializeContext;
+    }
+
+    void SpawnableClonePlan::CompileEntityPlan(EntityPlan& plan, const AZ::Entity& prototype) const
+    {
+        using ClassData = AZ::SerializeContext::ClassData;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+
+        enum class FrameType
+        {
+            Object, //!< A BeginObject was recorded, so the object becomes the current object while cloning.
+            Inline, //!< A plain reflected object inside the current object. Its fields are copied relative to the current object.
+            Skipped //!< The element was fully recorded or is not cloned at all, so its children are not visited.
+        };
+
+        struct CompileFrame
+        {
+            const ClassData* m_classData;
+            size_t m_offset; //!< Offset from the current object while cloning.
+            size_t m_beginIndex;
+            FrameType m_type;
+        };
+
+        AZStd::vector<CompileFrame> frames;
+        AZStd::vector<Instruction>& instructions = plan.m_instructions;
+        size_t depth = 0;
+        plan.m_prototype = &prototype;
+
+        auto beginObject = [&](const ClassData* classData, size_t offset) -> Instruction&
+        {
+            frames.push_back({ classData, 0, instructions.size(), FrameType::Object });
+            plan.m_maxDepth = AZStd::max(plan.m_maxDepth, ++depth);
+
+            Instruction& instruction = instructions.emplace_back();
+            instruction.m_operation = Operation::BeginObject;
+            instruction.m_classData = classData;
+            instruction.m_offset = offset;
+            return instruction;
+        };
+
+        auto beginCB = [&](void* ptr, const ClassData* classData, const ClassElement* elementData) -> bool
+        {
+            if (!plan.m_isValid)
+            {
+                frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                return false;
+            }
+
+            if (frames.empty())
+            {
+                if (!classData->m_factory)
+                {
+                    plan.m_isValid = false;
+                    frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                    return false;
+                }
+                Instruction& instruction = beginObject(classData, 0);
+                instruction.m_source = ptr;
+                instruction.m_isRoot = true;
+                return true;
+            }
+
+            // Deprecated classes are not cloned.
+            if (classData->IsDeprecated())
+            {
+                frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                return false;
+            }
+
+            // The class element of dynamic fields only exists while the field is being enumerated, so it can't be stored in the plan.
+            if ((elementData->m_flags & ClassElement::FLG_DYNAMIC_FIELD) ||
+                classData->m_typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+            {
+                plan.m_isValid = false;
+                frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                return false;
+            }
+
+            const CompileFrame& parent = frames.back();
+            const bool isInContainer = parent.m_classData->m_container != nullptr;
+            const bool isPointer = (elementData->m_flags & ClassElement::FLG_POINTER) != 0;
+            const bool isEntityId = classData->m_typeId == azrtti_typeid<AZ::EntityId>();
+
+            const void* source = ptr;
+            if (isPointer)
+            {
+                source = *reinterpret_cast<void**>(ptr);
+                // Pointing to a derived type, adjust the pointer to the actual class.
+                if (source && elementData->m_azRtti && classData->m_azRtti &&
+                    elementData->m_azRtti->GetActualUuid(source) != elementData->m_typeId)
+                {
+                    source = elementData->m_azRtti->Cast(const_cast<void*>(source), classData->m_azRtti->GetTypeId());
+                }
+            }
+
+            if (isEntityId)
+            {
+                if (AZ::Attribute* attribute = elementData->FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction))
+                {
+                    auto generator = azrtti_cast<AZ::AttributeFunction<AZ::EntityId()>*>(attribute);
+                    AZ_Assert(generator, "Attribute \"AZ::Edit::Attributes::IdGeneratorFunction\" must contain a non-member function with "
+                        "signature EntityId()");
+                    if (generator)
+                    {
+                        plan.m_generatedIds.push_back({ *reinterpret_cast<const AZ::EntityId*>(source), generator });
+                    }
+                }
+            }
+
+            // Values stored directly in the current object don't need to be created and can be copied without going through
+            // their serializer if they're plain data.
+            if (!isInContainer && !isPointer && !classData->m_eventHandler && !classData->m_container)
+            {
+                const size_t offset = parent.m_offset + elementData->m_offset;
+                if (isEntityId)
+                {
+                    Instruction& instruction = instructions.emplace_back();
+                    instruction.m_operation = Operation::CopyEntityId;
+                    instruction.m_offset = offset;
+                    instruction.m_source = source;
+                    frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                    return false;
+                }
+
+                if (IsPlainData(classData->m_typeId))
+                {
+                    // Merge with the previous copy if both the source and destination are adjacent.
+                    if (!instructions.empty() && instructions.back().m_operation == Operation::CopyBytes &&
+                        instructions.back().m_offset + instructions.back().m_size == offset &&
+                        reinterpret_cast<const char*>(instructions.back().m_source) + instructions.back().m_size == source)
+                    {
+                        instructions.back().m_size += elementData->m_dataSize;
+                    }
+                    else
+                    {
+                        Instruction& instruction = instructions.emplace_back();
+                        instruction.m_operation = Operation::CopyBytes;
+                        instruction.m_offset = offset;
+                        instruction.m_source = source;
+                        instruction.m_size = elementData->m_dataSize;
+                    }
+                    frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                    return false;
+                }
+
+                if (!classData->m_serializer)
+                {
+                    frames.push_back({ classData, offset, 0, FrameType::Inline });
+                    return true;
+                }
+            }
+
+            if (isPointer && !classData->m_factory)
+            {
+                plan.m_isValid = false;
+                frames.push_back({ classData, 0, 0, FrameType::Skipped });
+                return false;
+            }
+
+            const size_t offset = isInContainer ? 0 : parent.m_offset + elementData->m_offset;
+            Instruction& instruction = beginObject(classData, offset);
+            instruction.m_elementData = elementData;
+            instruction.m_source = source;
+            instruction.m_isInContainer = isInContainer;
+            instruction.m_isPointer = isPointer;
+            instruction.m_isEntityId = isEntityId;
+            if (!isPointer && IsPlainData(classData->m_typeId))
+            {
+                instruction.m_size = elementData->m_dataSize;
+            }
+            // Entity ids are copied as a whole so their content doesn't need to be visited.
+            return !isEntityId;
+        };
+
+        auto endCB = [&]() -> bool
+        {
+            const CompileFrame frame = frames.back();
+            frames.pop_back();
+            if (frame.m_type == FrameType::Object)
+            {
+                Instruction& instruction = instructions.emplace_back();
+                instruction.m_operation = Operation::EndObject;
+                instruction.m_classData = frame.m_classData;
+                instruction.m_source = instructions[frame.m_beginIndex].m_source;
+                instructions[frame.m_beginIndex].m_endIndex = instructions.size() - 1;
+                --depth;
+            }
+            return true;
+        };
+
+        const void* classPtr =
+            AZ::SerializeTypeInfo<AZ::Entity>::RttiCast(&prototype, AZ::SerializeTypeInfo<AZ::Entity>::GetRttiTypeId(&prototype));
+        const AZ::Uuid& classId = AZ::SerializeTypeInfo<AZ::Entity>::GetUuid(&prototype);
+        m_serializeContext->EnumerateInstance(
+            const_cast<void*>(classPtr), classId, beginCB, endCB, AZ::SerializeContext::ENUM_ACCESS_FOR_READ, nullptr, nullptr);
+
+        if (!plan.m_isValid || instructions.empty())
+        {
+            AZ_Warning("SpawnableClonePlan", false, "Unable to compile a clone plan for entity '%s'. It will be cloned through the "
+                "SerializeContext instead.", prototype.GetName().c_str());
+            plan.m_instructions.clear();
+            plan.m_generatedIds.clear();
+            plan.m_isValid = false;
+        }
+        else
+        {
+            plan.m_instructions.shrink_to_fit();
+        }
+    }
+
+    void* SpawnableClonePlan::BeginObject(
+        const Instruction& instruction,
+        AZStd::vector<Frame>& frames,
+        AZStd::vector<char>& scratchBuffer,
+        const EntityIdMap& prototypeToCloneMap) const
+    {
+        const AZ::SerializeContext::ClassData* classData = instruction.m_classData;
+        void* source = const_cast<void*>(instruction.m_source);
+
+        // Let the prototype know it's being read, the same way enumerating it during a regular clone does.
+        if (classData->m_eventHandler)
+        {
+            classData->m_eventHandler->OnReadBegin(source);
+        }
+
+        void* object = nullptr;
+        if (instruction.m_isRoot)
+        {
+            object = classData->m_factory->Create(classData->m_name);
+        }
+        else
+        {
+            Frame& parent = frames.back();
+            if (instruction.m_isInContainer)
+            {
+                AZ::SerializeContext::IDataContainer* container = parent.m_classData->m_container;
+                object = container->CanAccessElementsByIndex() && container->Size(parent.m_object) > parent.m_containerIndex
+                    ? container->GetElementByIndex(parent.m_object, instruction.m_elementData, parent.m_containerIndex)
+                    : container->ReserveElement(parent.m_object, instruction.m_elementData);
+                AZ_Error("SpawnableClonePlan", object, "Failed to reserve element %zu in container '%s'. The container may be full.",
+                    parent.m_containerIndex, parent.m_classData->m_name);
+                ++parent.m_containerIndex;
+            }
+            else
+            {
+                object = reinterpret_cast<char*>(parent.m_object) + instruction.m_offset;
+            }
+        }
+
+        void* reservedElement = object;
+        if (object && instruction.m_isPointer)
+        {
+            void* newElement = classData->m_factory->Create(classData->m_name);
+            *reinterpret_cast<void**>(object) = m_serializeContext->DownCast(newElement, classData->m_typeId,
+                instruction.m_elementData->m_typeId, classData->m_azRtti, instruction.m_elementData->m_azRtti);
+            object = newElement;
+        }
+
+        frames.push_back({ object, reservedElement, classData, 0 });
+        if (!object)
+        {
+            return nullptr;
+        }
+
+        if (classData->m_eventHandler)
+        {
+            classData->m_eventHandler->OnWriteBegin(object);
+        }
+
+        if (instruction.m_isEntityId)
+        {
+            *reinterpret_cast<AZ::EntityId*>(object) =
+                SpawnableClonePlanInternal::RemapEntityId(prototypeToCloneMap, *reinterpret_cast<const AZ::EntityId*>(source));
+        }
+        else if (classData->m_serializer)
+        {
+            if (instruction.m_size != 0)
+            {
+                memcpy(object, source, instruction.m_size);
+            }
+            else if (classData->m_typeId == AZ::GetAssetClassId())
+            {
+                static_cast<AZ::AssetSerializer*>(classData->m_serializer.get())->Clone(source, object);
+            }
+            else
+            {
+                scratchBuffer.clear();
+                AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&scratchBuffer);
+                classData->m_serializer->Save(source, stream);
+                stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+                classData->m_serializer->Load(object, stream, classData->m_version);
+            }
+        }
+
+        if (classData->m_container)
+        {
+            classData->m_container->ClearElements(object, m_serializeContext);
+        }
+
+        return object;
+    }
+
+    void SpawnableClonePlan::EndObject(const Instruction& instruction, AZStd::vector<Frame>& frames) const
+    {
+        const Frame frame = frames.back();
+        frames.pop_back();
+
+        const AZ::SerializeContext::ClassData* classData = frame.m_classData;
+        if (frame.m_object)
+        {
+            if (classData->m_eventHandler)
+            {
+                classData->m_eventHandler->OnWriteEnd(frame.m_object);
+                classData->m_eventHandler->OnObjectCloned(frame.m_object);
+            }
+
+            if (classData->m_serializer)
+            {
+                classData->m_serializer->PostClone(frame.m_object);
+            }
+
+            // Entity ids were already remapped when they were copied, so containers keyed on entity ids store their elements with
+            // the final ids and don't need to be rebuilt afterwards like they are after remapping a regular clone.
+            if (!frames.empty() && frames.back().m_classData->m_container)
+            {
+                frames.back().m_classData->m_container->StoreElement(frames.back().m_object, frame.m_reservedElement);
+            }
+        }
+
+        if (classData->m_eventHandler)
+        {
+            classData->m_eventHandler->OnReadEnd(const_cast<void*>(instruction.m_source));
+        }
+    }
+
+    bool SpawnableClonePlan::IsPlainData(const AZ::Uuid& typeId)
+    {
+        // Types that are stored as plain values and whose serializers store nothing but those values.
+        static const AZ::Uuid plainDataTypes[] = {
+            azrtti_typeid<bool>(),
+            azrtti_typeid<char>(),
+            azrtti_typeid<AZ::s8>(),
+            azrtti_typeid<short>(),
+            azrtti_typeid<int>(),
+            azrtti_typeid<long>(),
+            azrtti_typeid<AZ::s64>(),
+            azrtti_typeid<unsigned char>(),
+            azrtti_typeid<unsigned short>(),
+            azrtti_typeid<unsigned int>(),
+            azrtti_typeid<unsigned long>(),
+            azrtti_typeid<AZ::u64>(),
+            azrtti_typeid<float>(),
+            azrtti_typeid<double>(),
+            azrtti_typeid<AZ::Uuid>(),
+            azrtti_typeid<AZ::Vector2>(),
+            azrtti_typeid<AZ::Vector3>(),
+            azrtti_typeid<AZ::Vector4>(),
+            azrtti_typeid<AZ::Quaternion>(),
+            azrtti_typeid<AZ::Color>(),
+            azrtti_typeid<AZ::Matrix3x3>(),
+            azrtti_typeid<AZ::Matrix4x4>(),
+            azrtti_typeid<AZ::Transform>()
+        };
+        return AZStd::find(AZStd::begin(plainDataTypes), AZStd::end(plainDataTypes), typeId) != AZStd::end(plainDataTypes);
+    }
+} // namespace AzFramework
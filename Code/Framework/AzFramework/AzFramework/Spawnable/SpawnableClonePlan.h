@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+
+namespace AzFramework
+{
+    //! Precompiled instructions to clone the entities in a spawnable.
+    //! Cloning through the SerializeContext walks the full reflection tree of an entity for every clone and then walks the clone
+    //! twice more to remap its entity ids. The clone plan does the walk once when the spawnable is loaded and records per entity the
+    //! objects that need to be created, the fields that can be copied with a plain memory copy and where the entity ids are stored.
+    //! Cloning an entity then only replays those instructions. Entity ids are remapped while they're copied, which gives the same
+    //! result as IdUtils::Remapper::CloneObjectAndGenerateNewIdsAndFixRefs without duplicate ids.
+    //! The plan reads directly from the prototype entities, so the prototypes can't be changed while the plan is in use.
+    class SpawnableClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableClonePlan, AZ::SystemAllocator, 0);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        SpawnableClonePlan(const Spawnable::EntityList& prototypes, AZ::SerializeContext& serializeContext);
+
+        //! Clones the prototype entity at the given index and remaps its entity ids using the provided map. New ids are added to the
+        //! map for ids that are generated, such as the entity's own id, if they're not in the map yet.
+        //! Returns null if no plan could be compiled for the entity or if the prototype is no longer the one the plan was compiled
+        //! for. In that case the entity needs to be cloned through the SerializeContext instead.
+        AZ::Entity* CloneEntity(size_t index, const AZ::Entity& prototype, EntityIdMap& prototypeToCloneMap) const;
+
+        //! Returns true if a plan was compiled for the entity at the given index.
+        bool HasEntityPlan(size_t index) const;
+        const AZ::SerializeContext& GetSerializeContext() const;
+
+    private:
+        enum class Operation : uint8_t
+        {
+            BeginObject, //!< Creates or locates an object, runs its serializer and event handlers and makes it the current object.
+            EndObject, //!< Finishes the current object and stores it in its container if needed.
+            CopyBytes, //!< Copies a range of plain data into the current object.
+            CopyEntityId //!< Copies an entity id into the current object and remaps it.
+        };
+
+        struct Instruction
+        {
+            const AZ::SerializeContext::ClassData* m_classData{ nullptr };
+            const AZ::SerializeContext::ClassElement* m_elementData{ nullptr };
+            const void* m_source{ nullptr }; //!< Address in the prototype to copy from.
+            size_t m_offset{ 0 }; //!< Offset in the current object to copy to or where to find the object.
+            size_t m_size{ 0 }; //!< Number of bytes to copy or, for objects, the size to copy instead of using the serializer.
+            size_t m_endIndex{ 0 }; //!< Index of the matching EndObject, used to skip objects that couldn't be created.
+            Operation m_operation{ Operation::CopyBytes };
+            bool m_isRoot{ false };
+            bool m_isInContainer{ false };
+            bool m_isPointer{ false };
+            bool m_isEntityId{ false };
+        };
+
+        struct GeneratedId
+        {
+            AZ::EntityId m_prototypeId;
+            AZ::AttributeFunction<AZ::EntityId()>* m_generator{ nullptr };
+        };
+
+        struct EntityPlan
+        {
+            AZStd::vector<Instruction> m_instructions;
+            //! Ids that get a newly generated id during cloning, such as the entity id.
+            AZStd::vector<GeneratedId> m_generatedIds;
+            const AZ::Entity* m_prototype{ nullptr };
+            size_t m_maxDepth{ 0 };
+            bool m_isValid{ true };
+        };
+
+        struct Frame
+        {
+            void* m_object;
+            void* m_reservedElement; //!< The address returned by the container when the object was reserved.
+            const AZ::SerializeContext::ClassData* m_classData;
+            size_t m_containerIndex;
+        };
+
+        void CompileEntityPlan(EntityPlan& plan, const AZ::Entity& prototype) const;
+        void* BeginObject(
+            const Instruction& instruction,
+            AZStd::vector<Frame>& frames,
+            AZStd::vector<char>& scratchBuffer,
+            const EntityIdMap& prototypeToCloneMap) const;
+        void EndObject(const Instruction& instruction, AZStd::vector<Frame>& frames) const;
+
+        static bool IsPlainData(const AZ::Uuid& typeId);
+
+        AZStd::vector<EntityPlan> m_entityPlans;
+        AZ::SerializeContext* m_serializeContext;
+    };
+} // namespace AzFramework
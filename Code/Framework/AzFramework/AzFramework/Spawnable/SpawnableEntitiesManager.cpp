@@ -16,6 +16,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 
 namespace AzFramework
@@ -310,8 +311,24 @@ namespace AzFramework
             &entityPrototype, prototypeToCloneMap, &serializeContext);
     }
 
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(
+        const Spawnable& spawnable, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        const AZ::Entity& entityPrototype = *spawnable.GetEntities()[entityIndex];
+        if (const SpawnableClonePlan* clonePlan = spawnable.GetClonePlan();
+            clonePlan != nullptr && &clonePlan->GetSerializeContext() == &serializeContext)
+        {
+            if (AZ::Entity* clone = clonePlan->CloneEntity(entityIndex, entityPrototype, prototypeToCloneMap); clone != nullptr)
+            {
+                return clone;
+            }
+        }
+        return CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext);
+    }
+
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
-        const AZ::Entity& entityPrototype,
+        const Spawnable& spawnable,
+        uint32_t entityIndex,
         const Spawnable::EntityAlias& alias,
         EntityIdMap& prototypeToCloneMap,
         AZ::Entity* previouslySpawnedEntity,
@@ -322,20 +339,20 @@ namespace AzFramework
         {
         case Spawnable::EntityAliasType::Original:
             // Behave as the original version.
-            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(spawnable, entityIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Disable:
             // Do nothing.
             return nullptr;
         case Spawnable::EntityAliasType::Replace:
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(*alias.m_spawnable, alias.m_targetIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Additional:
             // The asset handler will have sorted and inserted a Spawnable::EntityAliasType::Original, so the just
             // spawn the additional entity.
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(*alias.m_spawnable, alias.m_targetIndex, prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Merge:
@@ -443,7 +460,7 @@ namespace AzFramework
                             entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
                         spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            CloneSingleEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                         spawnedEntityIndices.push_back(i);
                     }
                 }
@@ -458,7 +475,7 @@ namespace AzFramework
                         if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
                         {
                             spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                CloneSingleEntity(*ticket.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(i);
                         }
                         else
@@ -469,7 +486,7 @@ namespace AzFramework
                             do
                             {
                                 AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                    *ticket.m_spawnable, i, *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
                                     *request.m_serializeContext);
                                 previousEntity = clone;
                                 if (clone)
@@ -570,7 +587,7 @@ namespace AzFramework
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
                             spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                CloneSingleEntity(*ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -594,8 +611,8 @@ namespace AzFramework
 
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *ticket.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -606,7 +623,7 @@ namespace AzFramework
                                 do
                                 {
                                     AZ::Entity* clone = CloneSingleAliasedEntity(
-                                        *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                        *ticket.m_spawnable, index, *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
                                         *request.m_serializeContext);
                                     previousEntity = clone;
                                     if (clone)
@@ -768,7 +785,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*request.m_spawnable, i, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -789,7 +807,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone =
+                            CloneSingleEntity(*request.m_spawnable, index, ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
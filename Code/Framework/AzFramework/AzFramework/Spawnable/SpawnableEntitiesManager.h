@@ -244,8 +244,13 @@ namespace AzFramework
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones the entity at the given index in the spawnable. This uses the spawnable's clone plan if it has one that was compiled
+        //! with the same serialize context and otherwise clones the entity through the serialize context.
+        AZ::Entity* CloneSingleEntity(
+            const Spawnable& spawnable, uint32_t entityIndex, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
         AZ::Entity* CloneSingleAliasedEntity(
-            const AZ::Entity& entityPrototype,
+            const Spawnable& spawnable,
+            uint32_t entityIndex,
             const Spawnable::EntityAlias& alias,
             EntityIdMap& prototypeToCloneMap,
             AZ::Entity* previouslySpawnedEntity,
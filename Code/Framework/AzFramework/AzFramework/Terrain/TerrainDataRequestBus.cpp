@@ -9,6 +9,7 @@
 #include "TerrainDataRequestBus.h"
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Casting/numeric_cast.h>
 
 namespace AzFramework::Terrain
 {
@@ -55,6 +56,79 @@ namespace AzFramework::Terrain
         }
     };
 
+    namespace Internal
+    {
+        //! Runs the sample function for every position in the region, one position at a time.
+        template<typename SampleFunction>
+        void ProcessRegion(
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            const TerrainDataRequests::SurfacePointRegionFillCallback& perPositionCallback,
+            SampleFunction&& sampleFunction)
+        {
+            // Don't bother processing if we don't have a callback
+            if (!perPositionCallback)
+            {
+                return;
+            }
+
+            const auto [numSamplesX, numSamplesY] = TerrainDataRequests::GetNumSamplesFromRegion(inRegion, stepSize);
+            SurfaceData::SurfacePoint surfacePoint;
+            for (size_t y = 0; y < numSamplesY; y++)
+            {
+                const float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
+                for (size_t x = 0; x < numSamplesX; x++)
+                {
+                    const float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
+                    bool terrainExists = false;
+                    surfacePoint.m_position.Set(fx, fy, inRegion.GetMin().GetZ());
+                    sampleFunction(fx, fy, surfacePoint, terrainExists);
+                    perPositionCallback(x, y, surfacePoint, terrainExists);
+                }
+            }
+        }
+    } // namespace Internal
+
+    void TerrainDataRequests::ProcessHeightsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        Internal::ProcessRegion(inRegion, stepSize, perPositionCallback,
+            [this, sampleFilter](float x, float y, SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+            {
+                surfacePoint.m_position.SetZ(GetHeightFromFloats(x, y, sampleFilter, &terrainExists));
+            });
+    }
+
+    void TerrainDataRequests::ProcessNormalsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        Internal::ProcessRegion(inRegion, stepSize, perPositionCallback,
+            [this, sampleFilter](float x, float y, SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+            {
+                surfacePoint.m_normal = GetNormalFromFloats(x, y, sampleFilter, &terrainExists);
+            });
+    }
+
+    void TerrainDataRequests::ProcessSurfaceWeightsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        Internal::ProcessRegion(inRegion, stepSize, perPositionCallback,
+            [this, sampleFilter](float x, float y, SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+            {
+                GetSurfaceWeightsFromFloats(x, y, surfacePoint.m_surfaceTags, sampleFilter, &terrainExists);
+            });
+    }
+
+    void TerrainDataRequests::ProcessSurfacePointsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        Internal::ProcessRegion(inRegion, stepSize, perPositionCallback,
+            [this, sampleFilter](float x, float y, SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+            {
+                GetSurfacePointFromFloats(x, y, surfacePoint, sampleFilter, &terrainExists);
+            });
+    }
+
     void TerrainDataRequests::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
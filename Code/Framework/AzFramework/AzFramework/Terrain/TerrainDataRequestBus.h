@@ -11,6 +11,8 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/utils.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
 
 namespace AzFramework
@@ -44,6 +46,26 @@ namespace AzFramework
             static float GetDefaultTerrainHeight() { return 0.0f; }
             static AZ::Vector3 GetDefaultTerrainNormal() { return AZ::Vector3::CreateAxisZ(); }
 
+            //! Callback for the region queries. xIndex and yIndex are the indices of the position in the sample grid of the region.
+            //! Only the fields of the surface point that the query fills in are valid.
+            //! Region queries can call this from multiple threads at the same time, but every position in the region is only
+            //! passed in once.
+            using SurfacePointRegionFillCallback =
+                AZStd::function<void(size_t xIndex, size_t yIndex, const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)>;
+
+            //! Returns the number of positions in each direction that a region query with the given step size processes.
+            //! Positions start at the minimum corner of the region and the maximum edges are excluded.
+            static AZStd::pair<size_t, size_t> GetNumSamplesFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize)
+            {
+                if (!inRegion.IsValid() || stepSize.GetX() <= 0.0f || stepSize.GetY() <= 0.0f)
+                {
+                    return { 0, 0 };
+                }
+
+                const AZ::Vector3 extents = inRegion.GetExtents();
+                return { static_cast<size_t>(extents.GetX() / stepSize.GetX()), static_cast<size_t>(extents.GetY() / stepSize.GetY()) };
+            }
+
             // System-level queries to understand world size and resolution
             virtual AZ::Vector2 GetTerrainHeightQueryResolution() const = 0;
             virtual void SetTerrainHeightQueryResolution(AZ::Vector2 queryResolution) = 0;
@@ -131,6 +153,33 @@ namespace AzFramework
                 Sampler sampleFilter = Sampler::DEFAULT,
                 bool* terrainExistsPtr = nullptr) const = 0;
 
+            //! Region queries that process every position in a grid over the region with a single request, instead of one request
+            //! per position. The Z value of the region is ignored. Implementations are free to process the region in parallel, see
+            //! SurfacePointRegionFillCallback. The default implementations process the positions one at a time.
+            //! ProcessHeightsFromRegion fills in the position, ProcessNormalsFromRegion the position and normal,
+            //! ProcessSurfaceWeightsFromRegion the position and surface weights and ProcessSurfacePointsFromRegion fills in all of
+            //! the surface point. The queries block until the whole region is processed, so don't call them from a task graph task.
+            virtual void ProcessHeightsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessNormalsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessSurfaceWeightsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessSurfacePointsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+
         private:
             // Private variations of the GetSurfacePoint API exposed to BehaviorContext that returns a value instead of
             // using an "out" parameter. The "out" parameter is useful for reusing memory allocated in SurfacePoint when
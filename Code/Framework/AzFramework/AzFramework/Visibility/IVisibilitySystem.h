@@ -60,6 +60,9 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! The nodes gathered for a single bounding volume by EnumerateMany.
+        using NodeDataList = AZStd::vector<NodeData>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -94,6 +97,21 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a set of axis aligned bounding boxes against the visibility system, traversing the system once for all of them.
+        //! @param aabbs the axis aligned bounding boxes to test against
+        //! @param results receives one list per bounding box with the nodes that are visible to it, lists are cleared but keep their capacity
+        virtual void EnumerateMany(const AZStd::vector<AZ::Aabb>& aabbs, AZStd::vector<NodeDataList>& results) const = 0;
+
+        //! Intersects a set of spheres against the visibility system, traversing the system once for all of them.
+        //! @param spheres the spheres to test against
+        //! @param results receives one list per sphere with the nodes that are visible to it, lists are cleared but keep their capacity
+        virtual void EnumerateMany(const AZStd::vector<AZ::Sphere>& spheres, AZStd::vector<NodeDataList>& results) const = 0;
+
+        //! Intersects a set of frustums against the visibility system, traversing the system once for all of them.
+        //! @param frustums the frustums to test against
+        //! @param results receives one list per frustum with the nodes that are visible to it, lists are cleared but keep their capacity
+        virtual void EnumerateMany(const AZStd::vector<AZ::Frustum>& frustums, AZStd::vector<NodeDataList>& results) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -16,6 +17,10 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to node bounds when fitting entries, values above 1 (up to 2) create loose octrees where moving entries change nodes less often. Only affects newly created scenes");
+
+    // The top bit of an active query index in EnumerateMany marks a query that fully contains the node, so its descendants don't need testing
+    static constexpr uint32_t ContainedQueryFlag = 0x80000000;
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,14 +29,21 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
-    OctreeNode::OctreeNode(const AZ::Aabb& bounds)
+    static AZ::Aabb CreateLooseBounds(const AZ::Aabb& bounds, float looseness)
+    {
+        return AZ::Aabb::CreateCenterHalfExtents(bounds.GetCenter(), bounds.GetExtents() * (0.5f * looseness));
+    }
+
+    OctreeNode::OctreeNode(const AZ::Aabb& bounds, float looseness)
         : m_bounds(bounds)
+        , m_looseBounds(CreateLooseBounds(bounds, looseness))
     {
         ;
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -46,6 +58,7 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -66,14 +79,9 @@ namespace AzFramework
         // If this is not a leaf node, try to insert into the child nodes
         if (m_children != nullptr)
         {
-            const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            if (OctreeNode* child = FindChildForEntry(entry->m_boundingVolume))
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return child->Insert(octreeScene, entry);
             }
         }
 
@@ -98,10 +106,10 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume) && (IsLeaf() || FindChildForEntry(boundingVolume) == nullptr))
         {
             // Entry moved, but is still fully contained within the current node
-            // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
+            // For non-leaf nodes we also have to check the child nodes, otherwise entries can get 'stuck' in non-leaf nodes
             // even when one of the child nodes would be an adequate fit, due to this early out check
             return;
         }
@@ -114,7 +122,7 @@ namespace AzFramework
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -147,7 +155,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +163,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,18 +171,33 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
     }
 
+    void OctreeNode::EnumerateMany(const AZStd::vector<AZ::Aabb>& aabbs, AZStd::vector<IVisibilityScene::NodeDataList>& results) const
+    {
+        EnumerateManyHelper(aabbs, results);
+    }
+
+    void OctreeNode::EnumerateMany(const AZStd::vector<AZ::Sphere>& spheres, AZStd::vector<IVisibilityScene::NodeDataList>& results) const
+    {
+        EnumerateManyHelper(spheres, results);
+    }
+
+    void OctreeNode::EnumerateMany(const AZStd::vector<AZ::Frustum>& frustums, AZStd::vector<IVisibilityScene::NodeDataList>& results) const
+    {
+        EnumerateManyHelper(frustums, results);
+    }
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -203,6 +226,35 @@ namespace AzFramework
         return m_children == nullptr;
     }
 
+    const AZ::Aabb& OctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
+    OctreeNode* OctreeNode::FindChildForEntry(const AZ::Aabb& boundingVolume) const
+    {
+        AZ_Assert(m_children != nullptr, "FindChildForEntry invoked on an octreeScene node that does not have children");
+
+        // Child offsets match the bit layout used by Split
+        const AZ::Vector3 splitPoint = m_bounds.GetCenter();
+        const AZ::Vector3 entryCenter = boundingVolume.GetCenter();
+        uint32_t child = 0;
+        if (entryCenter.GetX() > splitPoint.GetX())
+        {
+            child |= 0x01;
+        }
+        if (entryCenter.GetY() > splitPoint.GetY())
+        {
+            child |= 0x02;
+        }
+        if ((GetChildNodeCount() > 4) && (entryCenter.GetZ() > splitPoint.GetZ()))
+        {
+            child |= 0x04;
+        }
+
+        return AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume) ? &m_children[child] : nullptr;
+    }
+
     void OctreeNode::TryMerge(OctreeScene& octreeScene)
     {
         if (IsLeaf())
@@ -233,12 +285,12 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -247,7 +299,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -255,6 +307,91 @@ namespace AzFramework
         }
     }
 
+    template <typename T>
+    void OctreeNode::EnumerateManyHelper(const AZStd::vector<T>& boundingVolumes, AZStd::vector<IVisibilityScene::NodeDataList>& results) const
+    {
+        AZ_Assert(boundingVolumes.size() < ContainedQueryFlag, "Too many bounding volumes passed to EnumerateMany");
+
+        results.resize(boundingVolumes.size());
+        for (IVisibilityScene::NodeDataList& nodeDataList : results)
+        {
+            nodeDataList.clear();
+        }
+
+        // The active query indices form a stack, each node appends the queries that overlap it and pops them again once its children are done
+        AZStd::vector<uint32_t> activeQueries;
+        activeQueries.reserve(boundingVolumes.size() * 4);
+        for (uint32_t query = 0; query < aznumeric_cast<uint32_t>(boundingVolumes.size()); ++query)
+        {
+            if (AZ::ShapeIntersection::Contains(boundingVolumes[query], m_looseBounds))
+            {
+                activeQueries.push_back(query | ContainedQueryFlag);
+            }
+            else if (AZ::ShapeIntersection::Overlaps(boundingVolumes[query], m_looseBounds))
+            {
+                activeQueries.push_back(query);
+            }
+        }
+
+        if (!activeQueries.empty())
+        {
+            EnumerateManyRecursive(boundingVolumes, activeQueries, 0, results);
+        }
+    }
+
+    template <typename T>
+    void OctreeNode::EnumerateManyRecursive(
+        const AZStd::vector<T>& boundingVolumes,
+        AZStd::vector<uint32_t>& activeQueries,
+        size_t activeBegin,
+        AZStd::vector<IVisibilityScene::NodeDataList>& results) const
+    {
+        const size_t activeEnd = activeQueries.size();
+
+        // Record the current node for every query that overlaps it
+        if (!m_entries.empty())
+        {
+            for (size_t active = activeBegin; active < activeEnd; ++active)
+            {
+                results[activeQueries[active] & ~ContainedQueryFlag].push_back({ m_looseBounds, m_entries });
+            }
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children with the subset of queries that overlap each child
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                const OctreeNode& childNode = m_children[child];
+                const size_t childBegin = activeQueries.size();
+                for (size_t active = activeBegin; active < activeEnd; ++active)
+                {
+                    // Read the index by value, pushing to activeQueries may reallocate it
+                    const uint32_t query = activeQueries[active];
+                    if ((query & ContainedQueryFlag) != 0)
+                    {
+                        activeQueries.push_back(query);
+                    }
+                    else if (AZ::ShapeIntersection::Contains(boundingVolumes[query], childNode.m_looseBounds))
+                    {
+                        activeQueries.push_back(query | ContainedQueryFlag);
+                    }
+                    else if (AZ::ShapeIntersection::Overlaps(boundingVolumes[query], childNode.m_looseBounds))
+                    {
+                        activeQueries.push_back(query);
+                    }
+                }
+
+                if (activeQueries.size() > childBegin)
+                {
+                    childNode.EnumerateManyRecursive(boundingVolumes, activeQueries, childBegin, results);
+                    activeQueries.resize(childBegin);
+                }
+            }
+        }
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -290,6 +427,7 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = CreateLooseBounds(m_children[child].m_bounds, octreeScene.GetLooseness());
                 m_children[child].m_parent = this;
             }
         }
@@ -328,7 +466,8 @@ namespace AzFramework
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
         : m_sceneName(sceneName)
-        , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
+        , m_looseness(AZ::GetClamp(static_cast<float>(bg_octreeLooseness), 1.0f, 2.0f))
+        , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)), m_looseness)
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
     }
@@ -396,6 +535,24 @@ namespace AzFramework
         m_root.EnumerateNoCull(callback);
     }
 
+    void OctreeScene::EnumerateMany(const AZStd::vector<AZ::Aabb>& aabbs, AZStd::vector<NodeDataList>& results) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateMany(aabbs, results);
+    }
+
+    void OctreeScene::EnumerateMany(const AZStd::vector<AZ::Sphere>& spheres, AZStd::vector<NodeDataList>& results) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateMany(spheres, results);
+    }
+
+    void OctreeScene::EnumerateMany(const AZStd::vector<AZ::Frustum>& frustums, AZStd::vector<NodeDataList>& results) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateMany(frustums, results);
+    }
+
     uint32_t OctreeScene::GetEntryCount() const
     {
         return m_entryCount;
@@ -422,6 +579,11 @@ namespace AzFramework
         return AzFramework::GetChildNodeCount();
     }
 
+    float OctreeScene::GetLooseness() const
+    {
+        return m_looseness;
+    }
+
     void OctreeScene::DumpStats()
     {
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
@@ -429,6 +591,7 @@ namespace AzFramework
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::Looseness = %.2f", GetName().GetCStr(), GetLooseness());
     }
 
     static inline uint32_t CreateNodeIndex(uint32_t page, uint32_t offset)
@@ -23,13 +23,14 @@ namespace AzFramework
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! Containment is tested against the loose bounds of the node, which are the node's cell scaled by the scene's looseness.
     class OctreeNode
         : public VisibilityNode
     {
     public:
 
         OctreeNode() = default;
-        explicit OctreeNode(const AZ::Aabb& bounds);
+        explicit OctreeNode(const AZ::Aabb& bounds, float looseness = 1.0f);
         OctreeNode(OctreeNode&& rhs);
 
         virtual ~OctreeNode() = default;
@@ -54,6 +55,13 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively gathers the OctreeNodes that intersect each of the provided bounding volumes, visiting each node at most once.
+        //! @{
+        void EnumerateMany(const AZStd::vector<AZ::Aabb>& aabbs, AZStd::vector<IVisibilityScene::NodeDataList>& results) const;
+        void EnumerateMany(const AZStd::vector<AZ::Sphere>& spheres, AZStd::vector<IVisibilityScene::NodeDataList>& results) const;
+        void EnumerateMany(const AZStd::vector<AZ::Frustum>& frustums, AZStd::vector<IVisibilityScene::NodeDataList>& results) const;
+        //! @}
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -66,6 +74,9 @@ namespace AzFramework
         //! Returns true if this is a leaf node.
         bool IsLeaf() const;
 
+        //! Returns the bounds used for containment and intersection tests, which are reported to enumeration callbacks.
+        const AZ::Aabb& GetLooseBounds() const;
+
     private:
 
         void TryMerge(OctreeScene& octreeScene);
@@ -73,6 +84,20 @@ namespace AzFramework
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        template <typename T>
+        void EnumerateManyHelper(const AZStd::vector<T>& boundingVolumes, AZStd::vector<IVisibilityScene::NodeDataList>& results) const;
+
+        template <typename T>
+        void EnumerateManyRecursive(
+            const AZStd::vector<T>& boundingVolumes,
+            AZStd::vector<uint32_t>& activeQueries,
+            size_t activeBegin,
+            AZStd::vector<IVisibilityScene::NodeDataList>& results) const;
+
+        //! Returns the child node an entry should be inserted into, or nullptr if it doesn't fit in any of them.
+        //! The child is chosen by the center of the entry, so in a loose octree an entry always lands in the tightest fitting child.
+        OctreeNode* FindChildForEntry(const AZ::Aabb& boundingVolume) const;
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
@@ -81,6 +106,7 @@ namespace AzFramework
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds;
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
@@ -88,6 +114,7 @@ namespace AzFramework
 
     //! Implementation of the visibility system interface.
     //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! When bg_octreeLooseness is above 1 the tree is a loose octree, so entries that move a little stay bound to the same node.
     class OctreeScene
         : public IVisibilityScene
     {
@@ -108,6 +135,9 @@ namespace AzFramework
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateMany(const AZStd::vector<AZ::Aabb>& aabbs, AZStd::vector<NodeDataList>& results) const override;
+        void EnumerateMany(const AZStd::vector<AZ::Sphere>& spheres, AZStd::vector<NodeDataList>& results) const override;
+        void EnumerateMany(const AZStd::vector<AZ::Frustum>& frustums, AZStd::vector<NodeDataList>& results) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
@@ -117,6 +147,7 @@ namespace AzFramework
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
+        float GetLooseness() const;
         void DumpStats();
         //! @}
 
@@ -128,6 +159,7 @@ namespace AzFramework
         mutable AZStd::shared_mutex m_sharedMutex;
 
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        float m_looseness = 1.0f; //< Scale applied to node cells to get their loose bounds, captured from bg_octreeLooseness on creation.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
         uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
@@ -55,6 +55,8 @@ set(FILES
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
     Asset/AssetRegistry.cpp
+    Asset/FlatAssetCatalog.h
+    Asset/FlatAssetCatalog.cpp
     Asset/AssetSeedList.cpp
     Asset/AssetSeedList.h
     Asset/AssetSystemComponent.cpp
@@ -294,6 +296,8 @@ set(FILES
     Spawnable/SpawnableAssetBus.h
     Spawnable/SpawnableAssetHandler.h
     Spawnable/SpawnableAssetHandler.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -23,6 +23,13 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzTest/Utils.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
 
 namespace UnitTest
 {
@@ -280,6 +287,54 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_MemoryMappedPakFile)
+    {
+        constexpr const char* storedFileInArchiveFile = "levels\\mylevel\\storedinfo.xml";
+        constexpr const char* compressedFileInArchiveFile = "levels\\mylevel\\compressedinfo.xml";
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+        constexpr const char* testArchivePath = "@usercache@/mapped.pak";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(storedFileInArchiveFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        EXPECT_EQ(0, pArchive->UpdateFile(compressedFileInArchiveFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        // Packs opened from now on are memory mapped
+        console->PerformCommand("az_archive_memory_map_read_only_paks", { "true" });
+        EXPECT_TRUE(archive->OpenPack("@products@", testArchivePath));
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::FileSearchPriority::PakOnly)) });
+
+        TestFGetCachedFileData(storedFileInArchiveFile, dataString.size(), dataString.data());
+        TestFGetCachedFileData(compressedFileInArchiveFile, dataString.size(), dataString.data());
+
+        // Partial reads of stored files only copy the requested range out of the mapping
+        AZ::IO::HandleType fileHandle = archive->FOpen(storedFileInArchiveFile, "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        char buffer[5] = {};
+        EXPECT_EQ(0, archive->FSeek(fileHandle, 6, SEEK_SET));
+        EXPECT_EQ(sizeof(buffer), archive->FRead(buffer, sizeof(buffer), fileHandle));
+        EXPECT_EQ(0, memcmp(buffer, "WORLD", sizeof(buffer)));
+        archive->FClose(fileHandle);
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+        console->PerformCommand("az_archive_memory_map_read_only_paks", { "false" });
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -880,3 +935,124 @@ namespace UnitTest
         reslist->Clear();
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Compares loading every stored file of a pack into private heap memory with using them straight from a memory mapped pack.
+    // The PrivateBytes counter is the heap memory each process needs to hold the loaded files, mapped pages are shared between processes.
+    class ArchiveMemoryMapBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static constexpr size_t FileCount = 64;
+        static constexpr size_t FileSize = 256 * 1024;
+        static constexpr size_t PageSize = 4096;
+
+        void internalSetUp()
+        {
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_prevDirectFileIO = AZ::IO::FileIOBase::GetDirectInstance();
+            AZ::IO::FileIOBase::SetDirectInstance(&m_fileIO);
+
+            m_pakPath = m_tempDirectory->Resolve("benchmark.pak");
+            AZStd::vector<uint8_t> fileData(FileSize);
+            for (size_t i = 0; i < FileSize; ++i)
+            {
+                fileData[i] = static_cast<uint8_t>(i * 31);
+            }
+
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::InitMethod::Default, AZ::IO::ZipDir::CacheFactory::FLAGS_CREATE_NEW);
+            AZ::IO::ZipDir::CachePtr cache = factory.New(m_pakPath.c_str());
+            for (size_t fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+            {
+                m_fileNames.push_back(AZStd::string::format("file%zu.bin", fileIndex));
+                cache->UpdateFile(m_fileNames.back(), fileData.data(), fileData.size(), AZ::IO::ZipFile::METHOD_STORE);
+            }
+            cache->Close();
+        }
+
+        void internalTearDown()
+        {
+            m_fileNames = {};
+            AZ::IO::FileIOBase::SetDirectInstance(m_prevDirectFileIO);
+            m_tempDirectory.reset();
+        }
+
+        AZ::IO::ZipDir::CachePtr OpenPack()
+        {
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::InitMethod::Default, AZ::IO::ZipDir::CacheFactory::FLAGS_READ_ONLY);
+            return factory.New(m_pakPath.c_str());
+        }
+
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::IO::LocalFileIO m_fileIO;
+        AZ::IO::FileIOBase* m_prevDirectFileIO{};
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZStd::string m_pakPath;
+        AZStd::vector<AZStd::string> m_fileNames;
+    };
+
+    BENCHMARK_F(ArchiveMemoryMapBenchmarkFixture, LoadStoredFiles_ReadIntoHeap)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::ZipDir::CachePtr cache = OpenPack();
+            AZStd::vector<AZStd::vector<uint8_t>> loadedFiles(FileCount);
+            for (size_t fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+            {
+                AZ::IO::ZipDir::FileEntry* fileEntry = cache->FindFile(m_fileNames[fileIndex]);
+                loadedFiles[fileIndex].resize_no_construct(fileEntry->desc.lSizeUncompressed);
+                cache->ReadFile(fileEntry, nullptr, loadedFiles[fileIndex].data());
+            }
+            benchmark::DoNotOptimize(loadedFiles.data());
+        }
+        state.counters["PrivateBytes"] = static_cast<double>(FileCount * FileSize);
+        state.SetBytesProcessed(state.iterations() * FileCount * FileSize);
+    }
+
+    BENCHMARK_F(ArchiveMemoryMapBenchmarkFixture, LoadStoredFiles_MemoryMapped)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::ZipDir::CachePtr cache = OpenPack();
+            cache->MapFile();
+            uint64_t checksum = 0;
+            for (size_t fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+            {
+                AZ::IO::ZipDir::FileEntry* fileEntry = cache->FindFile(m_fileNames[fileIndex]);
+                auto fileData = reinterpret_cast<const uint8_t*>(cache->GetMappedFileData(fileEntry));
+                // touch every page so the comparison includes faulting the data in
+                for (size_t offset = 0; offset < fileEntry->desc.lSizeUncompressed; offset += PageSize)
+                {
+                    checksum += fileData[offset];
+                }
+            }
+            benchmark::DoNotOptimize(checksum);
+        }
+        state.counters["PrivateBytes"] = 0;
+        state.SetBytesProcessed(state.iterations() * FileCount * FileSize);
+    }
+}
+#endif // HAVE_BENCHMARK
@@ -12,6 +12,7 @@
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/Jobs/JobManager.h>
@@ -19,12 +20,15 @@
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <AzFramework/Asset/NetworkAssetNotification_private.h>
 #include <AzFramework/Application/Application.h>
@@ -32,6 +36,11 @@
 
 #include "AZTestShared/Utils/Utils.h"
 
+#if defined(HAVE_BENCHMARK)
+#include <AzTest/Utils.h>
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 using namespace AZStd;
 using namespace AZ::Data;
 
@@ -839,6 +848,221 @@ namespace UnitTest
         CheckNoDependencies(asset1);
     }
 
+    TEST_F(AssetCatalogDeltaTest, LoadCatalog_FlatCatalog_RegistryAppliesOnTop)
+    {
+        // flatcatalog - the same content as sourcecatalog2, only stored in the flat format without a serialized version next to it.
+        AZStd::string flatCatalogPath = GetTestFolderPath() + "AssetCatalogFlat.xml";
+        AZStd::string flatCatalogFile = flatCatalogPath + AzFramework::FlatAssetCatalog::FileSuffix;
+        AZStd::shared_ptr<AzFramework::AssetRegistry> sourceCatalog2 = AzFramework::AssetCatalog::LoadCatalogFromFile(sourceCatalogPath2);
+        ASSERT_TRUE(sourceCatalog2);
+        ASSERT_TRUE(AzFramework::FlatAssetCatalog::Save(flatCatalogFile.c_str(), *sourceCatalog2));
+
+        AZStd::string assetPath;
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::ClearCatalog);
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::LoadCatalog, flatCatalogPath.c_str());
+
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset4);
+        EXPECT_EQ(assetPath, path4);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path5);
+        CheckDirectDependencies(asset1, { asset2 });
+        CheckNoDependencies(asset2);
+        CheckDirectDependencies(asset5, { asset2 });
+
+        AssetId assetId;
+        AssetCatalogRequestBus::BroadcastResult(assetId, &AssetCatalogRequestBus::Events::GetAssetIdByPath, path4, AZ::Data::s_invalidAssetType, false);
+        EXPECT_EQ(assetId, asset4);
+
+        size_t enumeratedAssets = 0;
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::EnumerateAssets, nullptr,
+            [&enumeratedAssets](const AssetId, const AssetInfo&) { ++enumeratedAssets; }, nullptr);
+        EXPECT_EQ(enumeratedAssets, 4);
+
+        // deltacatalog3 overrides asset1 without dependencies and asset5 with them
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::AddDeltaCatalog, deltaCatalog3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path6);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset5);
+        EXPECT_EQ(assetPath, path4);
+        CheckNoDependencies(asset1);
+        CheckDirectDependencies(asset5, { asset2 });
+
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::UnregisterAsset, asset2);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, "");
+        AssetCatalogRequestBus::BroadcastResult(assetId, &AssetCatalogRequestBus::Events::GetAssetIdByPath, path2, AZ::Data::s_invalidAssetType, false);
+        EXPECT_FALSE(assetId.IsValid());
+
+        // removing the delta reloads the flat catalog, which brings back everything that was overridden or removed since.
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::RemoveDeltaCatalog, deltaCatalog3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset1);
+        EXPECT_EQ(assetPath, path3);
+        AssetCatalogRequestBus::BroadcastResult(assetPath, &AssetCatalogRequestBus::Events::GetAssetPathById, asset2);
+        EXPECT_EQ(assetPath, path2);
+        CheckDirectDependencies(asset1, { asset2 });
+
+        AssetCatalogRequestBus::Broadcast(&AssetCatalogRequestBus::Events::ClearCatalog);
+        AZ::IO::FileIOBase::GetInstance()->Remove(flatCatalogFile.c_str());
+    }
+
+    class FlatAssetCatalogTest
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr size_t AssetCount = 8;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_registry = AZStd::make_unique<AzFramework::AssetRegistry>();
+            const AZ::Data::AssetType assetType = AZ::Uuid::CreateRandom();
+            for (size_t i = 0; i < AssetCount; ++i)
+            {
+                AssetInfo info;
+                info.m_assetId = AssetId(AZ::Uuid::CreateRandom(), aznumeric_cast<AZ::u32>(i % 2));
+                info.m_assetType = assetType;
+                info.m_relativePath = AZStd::string::format("folder%zu/asset%zu.bin", i % 3, i);
+                info.m_sizeBytes = 100 + i;
+                m_registry->RegisterAsset(info.m_assetId, info);
+                m_assetIds.push_back(info.m_assetId);
+            }
+
+            // asset0 -> asset1, asset2 (preload)
+            // asset1 has an empty dependency list, the others have none at all
+            m_registry->RegisterAssetDependency(m_assetIds[0], ProductDependency(m_assetIds[1], 0));
+            m_registry->RegisterAssetDependency(m_assetIds[0], ProductDependency(m_assetIds[2],
+                ProductDependencyInfo::CreateFlags(AssetLoadBehavior::PreLoad)));
+            m_registry->SetAssetDependencies(m_assetIds[1], {});
+
+            m_legacyAssetId = AssetId(AZ::Uuid::CreateRandom(), 0);
+            m_registry->RegisterLegacyAssetMapping(m_legacyAssetId, m_assetIds[3]);
+        }
+
+        void TearDown() override
+        {
+            m_assetIds.set_capacity(0);
+            m_registry.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        void CheckMatchesRegistry(const AzFramework::FlatAssetCatalog& flatCatalog)
+        {
+            ASSERT_EQ(flatCatalog.GetNumAssets(), AssetCount);
+            for (const AssetId& assetId : m_assetIds)
+            {
+                const AssetInfo& expected = m_registry->m_assetIdToInfo[assetId];
+                AssetInfo actual = flatCatalog.GetAssetInfoById(assetId);
+                EXPECT_EQ(actual.m_assetId, expected.m_assetId);
+                EXPECT_EQ(actual.m_assetType, expected.m_assetType);
+                EXPECT_EQ(actual.m_relativePath, expected.m_relativePath);
+                EXPECT_EQ(actual.m_sizeBytes, expected.m_sizeBytes);
+                EXPECT_EQ(flatCatalog.GetAssetIdByPath(expected.m_relativePath.c_str()), assetId);
+            }
+
+            AZStd::vector<ProductDependency> dependencies;
+            EXPECT_TRUE(flatCatalog.GetDependencies(m_assetIds[0], dependencies));
+            ASSERT_EQ(dependencies.size(), 2);
+            EXPECT_EQ(dependencies[0].m_assetId, m_assetIds[1]);
+            EXPECT_EQ(dependencies[1].m_assetId, m_assetIds[2]);
+            EXPECT_EQ(ProductDependencyInfo::LoadBehaviorFromFlags(dependencies[1].m_flags), AssetLoadBehavior::PreLoad);
+
+            dependencies.clear();
+            EXPECT_TRUE(flatCatalog.GetDependencies(m_assetIds[1], dependencies));
+            EXPECT_TRUE(dependencies.empty());
+            EXPECT_FALSE(flatCatalog.GetDependencies(m_assetIds[2], dependencies));
+
+            EXPECT_EQ(flatCatalog.GetAssetIdByLegacyAssetId(m_legacyAssetId), m_assetIds[3]);
+            EXPECT_FALSE(flatCatalog.GetAssetIdByLegacyAssetId(m_assetIds[3]).IsValid());
+        }
+
+        AZStd::unique_ptr<AzFramework::AssetRegistry> m_registry;
+        AZStd::vector<AssetId> m_assetIds;
+        AssetId m_legacyAssetId;
+    };
+
+    TEST_F(FlatAssetCatalogTest, Build_OpenFromBuffer_MatchesRegistry)
+    {
+        AzFramework::FlatAssetCatalog flatCatalog;
+        ASSERT_TRUE(flatCatalog.Open(AzFramework::FlatAssetCatalog::Build(*m_registry)));
+        CheckMatchesRegistry(flatCatalog);
+
+        // path lookups are normalized the same way as the ones of the registry
+        EXPECT_EQ(flatCatalog.GetAssetIdByPath("FOLDER0\\ASSET0.BIN"), m_assetIds[0]);
+        EXPECT_FALSE(flatCatalog.GetAssetIdByPath("folder0/asset1.bin").IsValid());
+        EXPECT_FALSE(flatCatalog.GetAssetIdByPath("").IsValid());
+
+        const AssetId unknownAssetId(AZ::Uuid::CreateRandom(), 0);
+        EXPECT_FALSE(flatCatalog.HasAsset(unknownAssetId));
+        EXPECT_FALSE(flatCatalog.GetAssetInfoById(unknownAssetId).m_assetId.IsValid());
+        EXPECT_TRUE(flatCatalog.GetAssetPathById(unknownAssetId).empty());
+    }
+
+    TEST_F(FlatAssetCatalogTest, CopyToRegistry_FlatCatalog_MatchesRegistry)
+    {
+        AzFramework::FlatAssetCatalog flatCatalog;
+        ASSERT_TRUE(flatCatalog.Open(AzFramework::FlatAssetCatalog::Build(*m_registry)));
+
+        AzFramework::AssetRegistry copiedRegistry;
+        flatCatalog.CopyToRegistry(copiedRegistry);
+        EXPECT_EQ(copiedRegistry.m_assetIdToInfo.size(), m_registry->m_assetIdToInfo.size());
+        EXPECT_EQ(copiedRegistry.m_assetDependencies.size(), m_registry->m_assetDependencies.size());
+
+        // building from the copy gives exactly the same data
+        EXPECT_EQ(AzFramework::FlatAssetCatalog::Build(copiedRegistry), AzFramework::FlatAssetCatalog::Build(*m_registry));
+    }
+
+    TEST_F(FlatAssetCatalogTest, Open_InvalidData_Fails)
+    {
+        const AZStd::vector<char> data = AzFramework::FlatAssetCatalog::Build(*m_registry);
+        AzFramework::FlatAssetCatalog flatCatalog;
+
+        AZStd::vector<char> truncatedData(data.begin(), data.begin() + data.size() / 2);
+        EXPECT_TRUE(AzFramework::FlatAssetCatalog::IsFlatCatalog(truncatedData.data(), truncatedData.size()));
+        EXPECT_FALSE(flatCatalog.Open(AZStd::move(truncatedData)));
+        EXPECT_FALSE(flatCatalog.IsOpen());
+
+        AZStd::vector<char> otherVersion = data;
+        const AZ::u32 version = AzFramework::FlatAssetCatalog::Version + 1;
+        memcpy(otherVersion.data() + sizeof(AZ::u32), &version, sizeof(version));
+        EXPECT_FALSE(flatCatalog.Open(AZStd::move(otherVersion)));
+
+        AZStd::vector<char> notACatalog(data.size(), 'x');
+        EXPECT_FALSE(AzFramework::FlatAssetCatalog::IsFlatCatalog(notACatalog.data(), notACatalog.size()));
+        EXPECT_FALSE(flatCatalog.Open(AZStd::move(notACatalog)));
+
+        EXPECT_EQ(flatCatalog.GetNumAssets(), 0);
+        EXPECT_FALSE(flatCatalog.HasAsset(m_assetIds[0]));
+    }
+
+    TEST_F(FlatAssetCatalogTest, Open_DependencyRowsOutOfOrder_Fails)
+    {
+        const AZStd::vector<char> data = AzFramework::FlatAssetCatalog::Build(*m_registry);
+        AzFramework::FlatAssetCatalog flatCatalog;
+
+        // The offset of the dependency rows follows the 8 counts and the offsets of the asset and dependency owner tables.
+        AZ::u64 dependencyRowsOffset = 0;
+        memcpy(&dependencyRowsOffset, data.data() + 8 * sizeof(AZ::u32) + 2 * sizeof(AZ::u64), sizeof(dependencyRowsOffset));
+
+        // asset0 and asset1 own dependency rows, so there are 3 row offsets ending at the 2 dependencies of asset0.
+        // A row past the end of the dependencies leaves the last row going backwards.
+        AZStd::vector<char> rowPastEnd = data;
+        const AZ::u32 pastEnd = 3;
+        memcpy(rowPastEnd.data() + dependencyRowsOffset + sizeof(AZ::u32), &pastEnd, sizeof(pastEnd));
+        EXPECT_FALSE(flatCatalog.Open(AZStd::move(rowPastEnd)));
+
+        AZStd::vector<char> firstRowNotAtStart = data;
+        const AZ::u32 notAtStart = 1;
+        memcpy(firstRowNotAtStart.data() + dependencyRowsOffset, &notAtStart, sizeof(notAtStart));
+        EXPECT_FALSE(flatCatalog.Open(AZStd::move(firstRowNotAtStart)));
+
+        EXPECT_TRUE(flatCatalog.Open(AZStd::vector<char>(data)));
+    }
+
     class AssetCatalogAPITest
         : public AllocatorsFixture
     {
@@ -1146,3 +1370,192 @@ namespace UnitTest
         delete handler2;
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Compares the startup cost of the serialized asset catalog, which is deserialized into the hash maps of an AssetRegistry,
+    // with opening a memory mapped flat catalog that is queried in place.
+    // The PrivateBytes counter is the heap memory each process needs to hold the loaded catalog, mapped pages are shared between processes.
+    class AssetCatalogLoadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static constexpr size_t DependenciesPerAsset = 4;
+        static constexpr size_t LegacyAssetIdInterval = 8;
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::Data::AssetId::Reflect(m_serializeContext.get());
+            AzFramework::AssetRegistry::ReflectSerialize(m_serializeContext.get());
+
+            // A registry similar to what the AssetProcessor builds for a large project.
+            const size_t assetCount = aznumeric_cast<size_t>(state.range(0));
+            AzFramework::AssetRegistry registry;
+            const AZ::Data::AssetType assetType = AZ::Uuid::CreateRandom();
+            for (size_t i = 0; i < assetCount; ++i)
+            {
+                AZ::Data::AssetInfo info;
+                info.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), aznumeric_cast<AZ::u32>(i % 3));
+                info.m_assetType = assetType;
+                info.m_relativePath = AZStd::string::format("levels/level%zu/objects/object%zu.azmodel", i % 64, i);
+                info.m_sizeBytes = 4096 + i;
+                registry.RegisterAsset(info.m_assetId, info);
+                m_assetIds.push_back(info.m_assetId);
+                m_assetPaths.push_back(info.m_relativePath);
+            }
+            for (size_t i = 0; i < assetCount; ++i)
+            {
+                for (size_t dependency = 1; dependency <= DependenciesPerAsset; ++dependency)
+                {
+                    registry.RegisterAssetDependency(m_assetIds[i], AZ::Data::ProductDependency(m_assetIds[(i + dependency * 7) % assetCount], 0));
+                }
+                if ((i % LegacyAssetIdInterval) == 0)
+                {
+                    registry.RegisterLegacyAssetMapping(AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 0), m_assetIds[i]);
+                }
+            }
+
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> catalogStream(&m_serializedCatalog);
+            AZ::Utils::SaveObjectToStream(catalogStream, AZ::DataStream::ST_BINARY, &registry, m_serializeContext.get());
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_flatCatalogPath = m_tempDirectory->Resolve("assetcatalog.xml.flat");
+            const AZStd::vector<char> flatCatalog = AzFramework::FlatAssetCatalog::Build(registry);
+            AZ::IO::SystemFile file;
+            file.Open(m_flatCatalogPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY);
+            file.Write(flatCatalog.data(), flatCatalog.size());
+            file.Close();
+        }
+
+        void internalTearDown()
+        {
+            m_assetIds = {};
+            m_assetPaths = {};
+            m_serializedCatalog = {};
+            m_tempDirectory.reset();
+            m_serializeContext.reset();
+        }
+
+        size_t GetAllocatedBytes() const
+        {
+            return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        }
+
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZStd::string m_flatCatalogPath;
+        AZStd::vector<char> m_serializedCatalog;
+        AZStd::vector<AZ::Data::AssetId> m_assetIds;
+        AZStd::vector<AZStd::string> m_assetPaths;
+    };
+
+    BENCHMARK_DEFINE_F(AssetCatalogLoadBenchmarkFixture, LoadCatalog_ObjectStream)(benchmark::State& state)
+    {
+        size_t privateBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t allocatedBytes = GetAllocatedBytes();
+            AzFramework::AssetRegistry registry;
+            AZ::IO::MemoryStream catalogStream(m_serializedCatalog.data(), m_serializedCatalog.size());
+            AZ::Utils::LoadObjectFromStreamInPlace(catalogStream, registry, m_serializeContext.get(),
+                AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+            privateBytes = GetAllocatedBytes() - allocatedBytes;
+            benchmark::DoNotOptimize(registry.m_assetIdToInfo.size());
+        }
+        state.counters["PrivateBytes"] = static_cast<double>(privateBytes);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(AssetCatalogLoadBenchmarkFixture, LoadCatalog_ObjectStream)
+        ->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(AssetCatalogLoadBenchmarkFixture, LoadCatalog_FlatMemoryMapped)(benchmark::State& state)
+    {
+        size_t privateBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t allocatedBytes = GetAllocatedBytes();
+            AzFramework::FlatAssetCatalog flatCatalog;
+            flatCatalog.Open(m_flatCatalogPath.c_str());
+            privateBytes = GetAllocatedBytes() - allocatedBytes;
+            benchmark::DoNotOptimize(flatCatalog.GetNumAssets());
+        }
+        state.counters["PrivateBytes"] = static_cast<double>(privateBytes);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(AssetCatalogLoadBenchmarkFixture, LoadCatalog_FlatMemoryMapped)
+        ->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+    // The lookups the asset manager does for every asset it loads, by id and by path, including the dependencies.
+    BENCHMARK_DEFINE_F(AssetCatalogLoadBenchmarkFixture, Lookup_Registry)(benchmark::State& state)
+    {
+        AzFramework::AssetRegistry registry;
+        AZ::IO::MemoryStream catalogStream(m_serializedCatalog.data(), m_serializedCatalog.size());
+        AZ::Utils::LoadObjectFromStreamInPlace(catalogStream, registry, m_serializeContext.get(),
+            AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t found = 0;
+            for (size_t i = 0; i < m_assetIds.size(); ++i)
+            {
+                auto info = registry.m_assetIdToInfo.find(m_assetIds[i]);
+                found += (info != registry.m_assetIdToInfo.end() && !info->second.m_relativePath.empty()) ? 1 : 0;
+                found += registry.GetAssetIdByPath(m_assetPaths[i].c_str()).IsValid() ? 1 : 0;
+                found += registry.m_assetDependencies.find(m_assetIds[i])->second.size();
+            }
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * m_assetIds.size());
+    }
+    BENCHMARK_REGISTER_F(AssetCatalogLoadBenchmarkFixture, Lookup_Registry)
+        ->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(AssetCatalogLoadBenchmarkFixture, Lookup_Flat)(benchmark::State& state)
+    {
+        AzFramework::FlatAssetCatalog flatCatalog;
+        flatCatalog.Open(m_flatCatalogPath.c_str());
+
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t found = 0;
+            for (size_t i = 0; i < m_assetIds.size(); ++i)
+            {
+                found += !flatCatalog.GetAssetPathById(m_assetIds[i]).empty() ? 1 : 0;
+                found += flatCatalog.GetAssetIdByPath(m_assetPaths[i].c_str()).IsValid() ? 1 : 0;
+                dependencies.clear();
+                flatCatalog.GetDependencies(m_assetIds[i], dependencies);
+                found += dependencies.size();
+            }
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * m_assetIds.size());
+    }
+    BENCHMARK_REGISTER_F(AssetCatalogLoadBenchmarkFixture, Lookup_Flat)
+        ->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+}
+#endif // HAVE_BENCHMARK
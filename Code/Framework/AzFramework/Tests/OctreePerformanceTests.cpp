@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
@@ -346,6 +347,176 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    //! Mixed load where a fraction of the entries move every frame before a set of awareness spheres is queried, the way
+    //! a server updates entity bounds and then its replication windows. The argument is the octree looseness in percent.
+    class BM_OctreeMixedLoad
+        : public benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
+            AZStd::string commandString;
+            commandString.format("bg_octreeLooseness %f", aznumeric_cast<float>(state.range(0)) / 100.0f);
+            m_console->PerformCommand(commandString.c_str());
+
+            m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeMixedLoadBenchmarkVisibilityScene"));
+
+            std::mt19937_64 rng(1);
+            std::uniform_real_distribution<float> unif;
+
+            m_dataArray.resize(EntryCount);
+            for (AzFramework::VisibilityEntry& data : m_dataArray)
+            {
+                const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng) * 0.05f) * 8000.0f;
+                data.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 4.0f);
+                data.m_typeFlags = AzFramework::VisibilityEntry::TYPE_Entity;
+                m_visScene->InsertOrUpdateEntry(data);
+            }
+
+            m_moveOffsets.resize(EntryCount / MovingEntryFraction);
+            for (AZ::Vector3& moveOffset : m_moveOffsets)
+            {
+                moveOffset = (AZ::Vector3(unif(rng), unif(rng), 0.0f) - AZ::Vector3(0.5f, 0.5f, 0.0f)) * 2.0f;
+            }
+
+            m_spheres.resize(QueryCount);
+            for (AZ::Sphere& sphere : m_spheres)
+            {
+                sphere = AZ::Sphere(AZ::Vector3(unif(rng), unif(rng), unif(rng) * 0.05f) * 8000.0f, 500.0f);
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_results = {};
+            m_spheres = {};
+            m_moveOffsets = {};
+            for (AzFramework::VisibilityEntry& data : m_dataArray)
+            {
+                m_visScene->RemoveEntry(data);
+            }
+            m_dataArray = {};
+
+            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            delete m_octreeSystemComponent;
+            m_octreeSystemComponent = nullptr;
+
+            AZStd::string commandString;
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            m_console = nullptr;
+
+            AZ::NameDictionary::Destroy();
+
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+                m_ownsSystemAllocator = false;
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        //! Moves every MovingEntryFraction'th entry back and forth by a small offset.
+        void MoveEntries(uint32_t frame)
+        {
+            const float direction = (frame & 1) ? -1.0f : 1.0f;
+            for (size_t moveIndex = 0; moveIndex < m_moveOffsets.size(); ++moveIndex)
+            {
+                AzFramework::VisibilityEntry& data = m_dataArray[moveIndex * MovingEntryFraction];
+                data.m_boundingVolume.Translate(m_moveOffsets[moveIndex] * direction);
+                m_visScene->InsertOrUpdateEntry(data);
+            }
+        }
+
+        static constexpr uint32_t EntryCount = 100000;
+        static constexpr uint32_t MovingEntryFraction = 10;
+        static constexpr uint32_t QueryCount = 64;
+
+        bool m_ownsSystemAllocator = false;
+        float m_savedLooseness = 1.0f;
+        AZ::Console* m_console = nullptr;
+        AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        AzFramework::IVisibilityScene* m_visScene = nullptr;
+        AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
+        AZStd::vector<AZ::Vector3> m_moveOffsets;
+        AZStd::vector<AZ::Sphere> m_spheres;
+        AZStd::vector<AzFramework::IVisibilityScene::NodeDataList> m_results;
+    };
+
+    BENCHMARK_DEFINE_F(BM_OctreeMixedLoad, UpdateAndEnumerate)(benchmark::State& state)
+    {
+        uint32_t frame = 0;
+        for (auto _ : state)
+        {
+            MoveEntries(frame++);
+            size_t gatheredEntryCount = 0;
+            for (const AZ::Sphere& sphere : m_spheres)
+            {
+                m_visScene->Enumerate(sphere, [&gatheredEntryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    gatheredEntryCount += nodeData.m_entries.size();
+                });
+            }
+            benchmark::DoNotOptimize(gatheredEntryCount);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeMixedLoad, UpdateAndEnumerate)->Arg(100)->Arg(150)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(BM_OctreeMixedLoad, UpdateAndEnumerateMany)(benchmark::State& state)
+    {
+        uint32_t frame = 0;
+        for (auto _ : state)
+        {
+            MoveEntries(frame++);
+            m_visScene->EnumerateMany(m_spheres, m_results);
+            size_t gatheredEntryCount = 0;
+            for (const AzFramework::IVisibilityScene::NodeDataList& nodeDataList : m_results)
+            {
+                for (const AzFramework::IVisibilityScene::NodeData& nodeData : nodeDataList)
+                {
+                    gatheredEntryCount += nodeData.m_entries.size();
+                }
+            }
+            benchmark::DoNotOptimize(gatheredEntryCount);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeMixedLoad, UpdateAndEnumerateMany)->Arg(100)->Arg(150)->Unit(benchmark::kMillisecond);
 }
 
 #endif
@@ -11,6 +11,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -38,6 +39,7 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
@@ -63,6 +65,8 @@ namespace UnitTest
             m_console->PerformCommand(commandString.c_str());
             commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
             m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
             delete m_octreeSystemComponent;
@@ -88,6 +92,7 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 0.0f;
         AZ::Console* m_console;
     };
 
@@ -420,4 +425,154 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    // Compares the results of EnumerateMany against one Enumerate call per bounding volume
+    template <typename BoundType>
+    void ValidateEnumerateManyMatchesEnumerate(IVisibilityScene* visScene, const AZStd::vector<BoundType>& bounds)
+    {
+        AZStd::vector<IVisibilityScene::NodeDataList> results;
+        visScene->EnumerateMany(bounds, results);
+        ASSERT_EQ(results.size(), bounds.size());
+
+        for (size_t queryIndex = 0; queryIndex < bounds.size(); ++queryIndex)
+        {
+            AZStd::vector<VisibilityEntry*> expectedEntries;
+            visScene->Enumerate(bounds[queryIndex], [&expectedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(expectedEntries, nodeData); });
+
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            for (const IVisibilityScene::NodeData& nodeData : results[queryIndex])
+            {
+                AppendEntries(gatheredEntries, nodeData);
+            }
+
+            AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            EXPECT_EQ(gatheredEntries, expectedEntries);
+        }
+    }
+
+    void ValidateEnumerateManyWithRandomEntries(IVisibilityScene* visScene)
+    {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+        auto randomVector = [&rng, &unif]() { return AZ::Vector3(unif(rng), unif(rng), unif(rng)); };
+
+        AZStd::vector<VisibilityEntry> visEntries(256);
+        for (VisibilityEntry& visEntry : visEntries)
+        {
+            visEntry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(randomVector(), randomVector().GetAbs() * 0.05f);
+            visScene->InsertOrUpdateEntry(visEntry);
+        }
+
+        AZStd::vector<AZ::Aabb> aabbs;
+        AZStd::vector<AZ::Sphere> spheres;
+        AZStd::vector<AZ::Frustum> frustums;
+        for (uint32_t queryIndex = 0; queryIndex < 16; ++queryIndex)
+        {
+            aabbs.push_back(AZ::Aabb::CreateCenterHalfExtents(randomVector(), randomVector().GetAbs() * 0.5f));
+            spheres.push_back(AZ::Sphere(randomVector(), (unif(rng) + 1.0f) * 0.25f));
+            AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateFromAxisAngle(randomVector().GetNormalized(), unif(rng) * AZ::Constants::Pi), randomVector());
+            frustums.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 0.1f, 1.0f)));
+        }
+        // Include queries that contain the whole scene and queries that miss it entirely
+        aabbs.push_back(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-4.0f), AZ::Vector3(4.0f)));
+        spheres.push_back(AZ::Sphere(AZ::Vector3(8.0f), 0.5f));
+
+        ValidateEnumerateManyMatchesEnumerate(visScene, aabbs);
+        ValidateEnumerateManyMatchesEnumerate(visScene, spheres);
+        ValidateEnumerateManyMatchesEnumerate(visScene, frustums);
+
+        // Move every entry a little and validate again
+        for (VisibilityEntry& visEntry : visEntries)
+        {
+            visEntry.m_boundingVolume.Translate(randomVector() * 0.1f);
+            visScene->InsertOrUpdateEntry(visEntry);
+        }
+        ValidateEntryCountEqualsExpectedCount(visScene, aznumeric_cast<uint32_t>(visEntries.size()));
+        ValidateEnumerateManyMatchesEnumerate(visScene, aabbs);
+        ValidateEnumerateManyMatchesEnumerate(visScene, spheres);
+        ValidateEnumerateManyMatchesEnumerate(visScene, frustums);
+
+        for (VisibilityEntry& visEntry : visEntries)
+        {
+            visScene->RemoveEntry(visEntry);
+        }
+        ValidateEntryCountEqualsExpectedCount(visScene, 0);
+    }
+
+    TEST_F(OctreeTests, EnumerateMany_RandomEntries_MatchesEnumerate)
+    {
+        ValidateEnumerateManyWithRandomEntries(m_octreeScene);
+    }
+
+    TEST_F(OctreeTests, EnumerateMany_LooseOctreeRandomEntries_MatchesEnumerate)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        IVisibilityScene* looseScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseUnitTestScene"));
+        EXPECT_FLOAT_EQ(azdynamic_cast<OctreeScene*>(looseScene)->GetLooseness(), 1.5f);
+
+        ValidateEnumerateManyWithRandomEntries(looseScene);
+
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
+    TEST_F(OctreeTests, EnumerateMany_EmptyQueryList_ClearsResults)
+    {
+        AZStd::vector<IVisibilityScene::NodeDataList> results(4);
+        m_octreeScene->EnumerateMany(AZStd::vector<AZ::Aabb>(), results);
+        EXPECT_TRUE(results.empty());
+    }
+
+    TEST_F(OctreeTests, UpdateEntry_LooseOctreeSmallMove_EntryKeepsNode)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        IVisibilityScene* looseScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseUnitTestScene"));
+
+        // Force a split of the root node in both scenes, leaving visEntry[0] in the -/-/- child node
+        AzFramework::VisibilityEntry visEntry[2];
+        AzFramework::VisibilityEntry looseVisEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        looseVisEntry[0].m_boundingVolume = visEntry[0].m_boundingVolume;
+        looseVisEntry[1].m_boundingVolume = visEntry[1].m_boundingVolume;
+        for (uint32_t entryIndex = 0; entryIndex < 2; ++entryIndex)
+        {
+            m_octreeScene->InsertOrUpdateEntry(visEntry[entryIndex]);
+            looseScene->InsertOrUpdateEntry(looseVisEntry[entryIndex]);
+        }
+
+        const VisibilityNode* tightNode = visEntry[0].m_internalNode;
+        const VisibilityNode* looseNode = looseVisEntry[0].m_internalNode;
+
+        // Move the entries so that they straddle the split planes of the root node, but stay mostly within the -/-/- child node
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.3f), AZ::Vector3(0.1f));
+        looseVisEntry[0].m_boundingVolume = visEntry[0].m_boundingVolume;
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+        looseScene->InsertOrUpdateEntry(looseVisEntry[0]);
+
+        // The tight octree has to move the entry up to the root node, the loose octree keeps it in place
+        EXPECT_NE(visEntry[0].m_internalNode, tightNode);
+        EXPECT_EQ(looseVisEntry[0].m_internalNode, looseNode);
+
+        // Queries against the loose octree still find the entry where it overhangs its node
+        AZStd::vector<AZ::Aabb> aabbs = { AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.05f), AZ::Vector3(0.08f)) };
+        ValidateEnumerateManyMatchesEnumerate(looseScene, aabbs);
+        AZStd::vector<IVisibilityScene::NodeDataList> results;
+        looseScene->EnumerateMany(aabbs, results);
+        ASSERT_EQ(results.size(), 1u);
+        bool foundEntry = false;
+        for (const IVisibilityScene::NodeData& nodeData : results[0])
+        {
+            foundEntry = foundEntry || (AZStd::find(nodeData.m_entries.begin(), nodeData.m_entries.end(), &looseVisEntry[0]) != nodeData.m_entries.end());
+        }
+        EXPECT_TRUE(foundEntry);
+
+        for (uint32_t entryIndex = 0; entryIndex < 2; ++entryIndex)
+        {
+            m_octreeScene->RemoveEntry(visEntry[entryIndex]);
+            looseScene->RemoveEntry(looseVisEntry[entryIndex]);
+        }
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
 }
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+#include <AzTest/AzTest.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    // Plain reflected structure that's stored inside a component.
+    struct ClonePlanTestSettings
+    {
+        AZ_TYPE_INFO(ClonePlanTestSettings, "{5E2E3B27-5A7F-4C1B-9D0E-0B7F6B1D5C84}");
+
+        float m_speed{ 0.0f };
+        int m_count{ 0 };
+        bool m_isEnabled{ false };
+        AZ::Vector3 m_offset{ AZ::Vector3::CreateZero() };
+    };
+
+    // Test component with plain data, data that needs a serializer and entity references both directly and in containers.
+    class ClonePlanTestComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ClonePlanTestComponent, "{0B1F4E53-21A7-4C3B-8A0F-8E6C0C3D9A12}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ClonePlanTestSettings>()
+                    ->Field("Speed", &ClonePlanTestSettings::m_speed)
+                    ->Field("Count", &ClonePlanTestSettings::m_count)
+                    ->Field("IsEnabled", &ClonePlanTestSettings::m_isEnabled)
+                    ->Field("Offset", &ClonePlanTestSettings::m_offset)
+                    ;
+
+                serializeContext->Class<ClonePlanTestComponent, AZ::Component>()
+                    ->Field("Settings", &ClonePlanTestComponent::m_settings)
+                    ->Field("Label", &ClonePlanTestComponent::m_label)
+                    ->Field("Target", &ClonePlanTestComponent::m_target)
+                    ->Field("Followers", &ClonePlanTestComponent::m_followers)
+                    ->Field("Weights", &ClonePlanTestComponent::m_weights)
+                    ;
+            }
+        }
+
+        ClonePlanTestSettings m_settings;
+        AZStd::string m_label;
+        AZ::EntityId m_target;
+        AZStd::vector<AZ::EntityId> m_followers;
+        AZStd::unordered_map<AZ::EntityId, float> m_weights;
+    };
+
+    using EntityIdMap = AzFramework::SpawnableClonePlan::EntityIdMap;
+
+    AZStd::unique_ptr<AZ::SerializeContext> CreateClonePlanSerializeContext()
+    {
+        auto serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+        AZ::MathReflect(serializeContext.get());
+        AZ::Entity::Reflect(serializeContext.get());
+        ClonePlanTestComponent::Reflect(serializeContext.get());
+        return serializeContext;
+    }
+
+    //! Creates entities that each reference the next entity and are followed by the two entities before them.
+    void CreateClonePlanPrototypes(AzFramework::Spawnable::EntityList& prototypes, size_t count)
+    {
+        prototypes.clear();
+        prototypes.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            prototypes.push_back(AZStd::make_unique<AZ::Entity>(AZStd::string::format("Prototype%zu", i).c_str()));
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto component = prototypes[i]->CreateComponent<ClonePlanTestComponent>();
+            component->m_settings.m_speed = 1.5f * i;
+            component->m_settings.m_count = aznumeric_cast<int>(i);
+            component->m_settings.m_isEnabled = (i % 2) == 0;
+            component->m_settings.m_offset = AZ::Vector3(1.0f, 2.0f, aznumeric_cast<float>(i));
+            component->m_label = AZStd::string::format("Label%zu", i);
+            component->m_target = prototypes[(i + 1) % count]->GetId();
+            for (size_t follower = 1; follower <= 2 && follower < count; ++follower)
+            {
+                const AZ::EntityId followerId = prototypes[(i + count - follower) % count]->GetId();
+                component->m_followers.push_back(followerId);
+                component->m_weights[followerId] = 0.25f * follower;
+            }
+        }
+    }
+
+    class SpawnableClonePlanTest : public AllocatorsFixture
+    {
+    public:
+        static constexpr size_t NumEntities = 8;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_serializeContext = CreateClonePlanSerializeContext();
+            CreateClonePlanPrototypes(m_prototypes, NumEntities);
+        }
+
+        void TearDown() override
+        {
+            m_prototypes = {};
+            m_serializeContext.reset();
+
+            AllocatorsFixture::TearDown();
+        }
+
+        //! Maps every prototype to a new id, the same way the SpawnableEntitiesManager does before spawning.
+        EntityIdMap CreateIdMap() const
+        {
+            EntityIdMap idMap;
+            for (const AZStd::unique_ptr<AZ::Entity>& prototype : m_prototypes)
+            {
+                idMap.emplace(prototype->GetId(), AZ::Entity::MakeId());
+            }
+            return idMap;
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AzFramework::Spawnable::EntityList m_prototypes;
+    };
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_CompareWithSerializeContextClone_ClonesAreIdentical)
+    {
+        AzFramework::SpawnableClonePlan clonePlan(m_prototypes, *m_serializeContext);
+        EntityIdMap planIdMap = CreateIdMap();
+        EntityIdMap referenceIdMap = planIdMap;
+
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            ASSERT_TRUE(clonePlan.HasEntityPlan(i));
+
+            AZStd::unique_ptr<AZ::Entity> clone(clonePlan.CloneEntity(i, *m_prototypes[i], planIdMap));
+            AZStd::unique_ptr<AZ::Entity> reference(AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                m_prototypes[i].get(), referenceIdMap, m_serializeContext.get()));
+            ASSERT_NE(nullptr, clone);
+            ASSERT_NE(nullptr, reference);
+
+            EXPECT_EQ(reference->GetId(), clone->GetId());
+            EXPECT_EQ(reference->GetName(), clone->GetName());
+            EXPECT_EQ(reference->IsRuntimeActiveByDefault(), clone->IsRuntimeActiveByDefault());
+            ASSERT_EQ(reference->GetComponents().size(), clone->GetComponents().size());
+
+            auto referenceComponent = reference->FindComponent<ClonePlanTestComponent>();
+            auto component = clone->FindComponent<ClonePlanTestComponent>();
+            ASSERT_NE(nullptr, component);
+            EXPECT_EQ(referenceComponent->GetId(), component->GetId());
+            EXPECT_EQ(referenceComponent->m_settings.m_speed, component->m_settings.m_speed);
+            EXPECT_EQ(referenceComponent->m_settings.m_count, component->m_settings.m_count);
+            EXPECT_EQ(referenceComponent->m_settings.m_isEnabled, component->m_settings.m_isEnabled);
+            EXPECT_EQ(referenceComponent->m_settings.m_offset, component->m_settings.m_offset);
+            EXPECT_EQ(referenceComponent->m_label, component->m_label);
+            EXPECT_EQ(referenceComponent->m_target, component->m_target);
+            EXPECT_EQ(referenceComponent->m_followers, component->m_followers);
+            EXPECT_EQ(referenceComponent->m_weights, component->m_weights);
+        }
+        EXPECT_EQ(referenceIdMap, planIdMap);
+    }
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_ReferencesInContainers_ReferencesAreRemapped)
+    {
+        AzFramework::SpawnableClonePlan clonePlan(m_prototypes, *m_serializeContext);
+        EntityIdMap idMap = CreateIdMap();
+
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            AZStd::unique_ptr<AZ::Entity> clone(clonePlan.CloneEntity(i, *m_prototypes[i], idMap));
+            ASSERT_NE(nullptr, clone);
+            EXPECT_EQ(idMap[m_prototypes[i]->GetId()], clone->GetId());
+
+            auto prototypeComponent = m_prototypes[i]->FindComponent<ClonePlanTestComponent>();
+            auto component = clone->FindComponent<ClonePlanTestComponent>();
+            ASSERT_NE(nullptr, component);
+            EXPECT_EQ(idMap[prototypeComponent->m_target], component->m_target);
+
+            ASSERT_EQ(prototypeComponent->m_followers.size(), component->m_followers.size());
+            for (size_t follower = 0; follower < component->m_followers.size(); ++follower)
+            {
+                EXPECT_EQ(idMap[prototypeComponent->m_followers[follower]], component->m_followers[follower]);
+            }
+
+            // The keys are remapped before the elements are added, so the elements need to be found by their new ids.
+            ASSERT_EQ(prototypeComponent->m_weights.size(), component->m_weights.size());
+            for (const auto& [prototypeId, weight] : prototypeComponent->m_weights)
+            {
+                auto it = component->m_weights.find(idMap[prototypeId]);
+                ASSERT_NE(component->m_weights.end(), it);
+                EXPECT_EQ(weight, it->second);
+            }
+        }
+    }
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_EmptyIdMap_NewEntityIdIsGenerated)
+    {
+        AzFramework::SpawnableClonePlan clonePlan(m_prototypes, *m_serializeContext);
+        EntityIdMap idMap;
+
+        AZStd::unique_ptr<AZ::Entity> clone(clonePlan.CloneEntity(0, *m_prototypes[0], idMap));
+        ASSERT_NE(nullptr, clone);
+        EXPECT_NE(m_prototypes[0]->GetId(), clone->GetId());
+        ASSERT_EQ(1, idMap.size());
+        EXPECT_EQ(clone->GetId(), idMap[m_prototypes[0]->GetId()]);
+
+        // References to entities that don't have a new id yet keep pointing to the original entity.
+        auto component = clone->FindComponent<ClonePlanTestComponent>();
+        ASSERT_NE(nullptr, component);
+        EXPECT_EQ(m_prototypes[1]->GetId(), component->m_target);
+    }
+
+    TEST_F(SpawnableClonePlanTest, CloneEntity_DifferentPrototype_ReturnsNull)
+    {
+        AzFramework::SpawnableClonePlan clonePlan(m_prototypes, *m_serializeContext);
+        EntityIdMap idMap = CreateIdMap();
+
+        EXPECT_EQ(nullptr, clonePlan.CloneEntity(1, *m_prototypes[0], idMap));
+        EXPECT_EQ(nullptr, clonePlan.CloneEntity(NumEntities, *m_prototypes[0], idMap));
+        EXPECT_FALSE(clonePlan.HasEntityPlan(NumEntities));
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Clones a spawnable worth of entities per iteration, the way SpawnAllEntities does.
+    class SpawnableClonePlanBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = UnitTest::CreateClonePlanSerializeContext();
+            UnitTest::CreateClonePlanPrototypes(m_prototypes, aznumeric_cast<size_t>(state.range(0)));
+            m_clones.reserve(m_prototypes.size());
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_clones = {};
+            m_prototypes = {};
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        UnitTest::EntityIdMap CreateIdMap() const
+        {
+            UnitTest::EntityIdMap idMap;
+            idMap.reserve(m_prototypes.size());
+            for (const AZStd::unique_ptr<AZ::Entity>& prototype : m_prototypes)
+            {
+                idMap.emplace(prototype->GetId(), AZ::Entity::MakeId());
+            }
+            return idMap;
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AzFramework::Spawnable::EntityList m_prototypes;
+        AzFramework::Spawnable::EntityList m_clones;
+    };
+
+    BENCHMARK_DEFINE_F(SpawnableClonePlanBenchmarkFixture, CloneEntities_SerializeContext)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            UnitTest::EntityIdMap idMap = CreateIdMap();
+            for (const AZStd::unique_ptr<AZ::Entity>& prototype : m_prototypes)
+            {
+                m_clones.emplace_back(AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    prototype.get(), idMap, m_serializeContext.get()));
+            }
+
+            state.PauseTiming();
+            m_clones.clear();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SpawnableClonePlanBenchmarkFixture, CloneEntities_SerializeContext)
+        ->Arg(100)->Arg(1000)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SpawnableClonePlanBenchmarkFixture, CloneEntities_ClonePlan)(::benchmark::State& state)
+    {
+        // Compiling the plan is part of loading the spawnable, so it's not included in the measurements.
+        AzFramework::SpawnableClonePlan clonePlan(m_prototypes, *m_serializeContext);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            UnitTest::EntityIdMap idMap = CreateIdMap();
+            for (size_t i = 0; i < m_prototypes.size(); ++i)
+            {
+                m_clones.emplace_back(clonePlan.CloneEntity(i, *m_prototypes[i], idMap));
+            }
+
+            state.PauseTiming();
+            m_clones.clear();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SpawnableClonePlanBenchmarkFixture, CloneEntities_ClonePlan)
+        ->Arg(100)->Arg(1000)->Unit(::benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
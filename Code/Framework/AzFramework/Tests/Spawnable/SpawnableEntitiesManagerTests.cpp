@@ -8,8 +8,10 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzTest/AzTest.h>
@@ -501,6 +503,33 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ClonePlanAndEntitiesReferenceOtherEntities_EntityIdsAreMappedCorrectly)
+    {
+        // Same as the previous test, but with the entities cloned by replaying a precompiled clone plan.
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 4;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+            m_spawnable->SetClonePlan(AZStd::make_shared<AzFramework::SpawnableClonePlan>(
+                m_spawnable->GetEntities(), *m_application->GetSerializeContext()));
+
+            auto callback = [this, refScheme]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        }
+        m_spawnable->SetClonePlan(nullptr);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
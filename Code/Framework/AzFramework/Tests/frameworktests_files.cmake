@@ -8,6 +8,7 @@
 
 set(FILES
     Main.cpp
+    Spawnable/SpawnableClonePlanTests.cpp
     Spawnable/SpawnableEntitiesInterfaceTests.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
     Spawnable/SpawnableTests.cpp
@@ -87,6 +87,14 @@ namespace AzNetworking
         //! @return the unreliable packet identifier of the transmitted packet
         virtual PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) = 0;
 
+        //! Starts queuing up packets sent on this network interface, so they can be transmitted together when EndSendBatch is called.
+        //! Use this around code that sends to many connections at once, such as a server sending out updates at the end of a tick.
+        //! Network interfaces that can't transmit multiple packets at once continue to transmit packets immediately.
+        virtual void BeginSendBatch() = 0;
+
+        //! Transmits all packets queued up since BeginSendBatch and stops queuing up packets.
+        virtual void EndSendBatch() = 0;
+
         //! Returns true if the given packet id was confirmed acknowledged by the remote endpoint, false otherwise.
         //! @param connectionId identifier of the connection to send to
         //! @param packetId   the packet id of the packet to confirm acknowledgment of
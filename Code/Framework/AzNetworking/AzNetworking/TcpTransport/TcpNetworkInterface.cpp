@@ -136,6 +136,16 @@ namespace AzNetworking
         return connection->SendUnreliablePacket(packet);
     }
 
+    void TcpNetworkInterface::BeginSendBatch()
+    {
+        // No-op, TCP sockets already coalesce small writes
+    }
+
+    void TcpNetworkInterface::EndSendBatch()
+    {
+        ;
+    }
+
     bool TcpNetworkInterface::WasPacketAcked(ConnectionId connectionId, PacketId packetId)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
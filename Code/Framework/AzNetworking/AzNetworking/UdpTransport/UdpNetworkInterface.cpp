@@ -36,6 +36,7 @@ namespace AzNetworking
     AZ_CVAR(AZ::TimeMs, net_MinPacketTimeoutMs, AZ::TimeMs{ 200 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Minimum time to wait before timing out an unacked packet");
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
+    AZ_CVAR(bool, net_UdpBatchSends, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, packets sent in a send batch are transmitted together using as few system calls as possible");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
@@ -366,6 +367,19 @@ namespace AzNetworking
         return connection->SendUnreliablePacket(packet);
     }
 
+    void UdpNetworkInterface::BeginSendBatch()
+    {
+        if (net_UdpBatchSends)
+        {
+            m_socket->BeginSendBatch();
+        }
+    }
+
+    void UdpNetworkInterface::EndSendBatch()
+    {
+        m_socket->EndSendBatch();
+    }
+
     bool UdpNetworkInterface::WasPacketAcked(ConnectionId connectionId, PacketId packetId)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
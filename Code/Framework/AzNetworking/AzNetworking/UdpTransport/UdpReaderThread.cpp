@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,43 @@ namespace AzNetworking
                     break;
                 }
 
+                if (receivedPackets.full())
+                {
+                    AZLOG_INFO("Received packet list full, leaving data on the socket");
+                    break;
+                }
+
+                // Read as many packets as fit in both the receive buffer and the received packet list with a single call
+                const uint32_t bufferSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t packetSlots = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t maxPackets = AZStd::min(AZStd::min(bufferSlots, packetSlots), UdpSocket::MaxBatchSize);
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + maxPackets * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                AZStd::array<IpAddress, UdpSocket::MaxBatchSize> addresses;
+                AZStd::array<int32_t, UdpSocket::MaxBatchSize> sizes;
+                const int32_t receivedCount = socket->ReceiveBatch(addresses.data(), sizes.data(), dstData, MaxUdpTransmissionUnit, maxPackets);
+                if (receivedCount <= 0)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    receiveBuffer.Resize(bufferHead);
+                    break;
                 }
-                else
+
+                for (int32_t i = 0; i < receivedCount; ++i)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    if (sizes[i] > 0)
+                    {
+                        receivedPackets.push_back(ReceivedPacket(addresses[i], dstData + i * MaxUdpTransmissionUnit, sizes[i]));
+                    }
+                }
+
+                // Packets are spaced an MTU apart, only the space after the last packet can be given back
+                receiveBuffer.Resize(bufferHead + (receivedCount - 1) * MaxUdpTransmissionUnit + sizes[receivedCount - 1]);
+
+                if (static_cast<uint32_t>(receivedCount) < maxPackets)
+                {
+                    // The socket has been drained
                     break;
                 }
             }
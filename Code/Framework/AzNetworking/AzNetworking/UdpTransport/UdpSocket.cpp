@@ -9,6 +9,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzNetworking/Utilities/Endian.h>
 #include <AzNetworking/Utilities/NetworkIncludes.h>
 #include <AzCore/Console/IConsole.h>
@@ -24,6 +25,33 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
 
+    // Filters the error of a failed receive, returns 0 if the error can be ignored and SocketOpResultError otherwise
+    static int32_t HandleReceiveError()
+    {
+        const int32_t error = GetLastNetworkError();
+
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return 0;
+        }
+
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            if (ignoreForciblyClosedError)
+            {
+                return 0;
+            }
+            else
+            {
+                return SocketOpResultError;
+            }
+        }
+
+        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
+    }
+
     UdpSocket::~UdpSocket()
     {
         Close();
@@ -96,6 +124,10 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        if (m_sendBatch != nullptr)
+        {
+            m_sendBatch->m_count = 0;
+        }
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -191,30 +223,10 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
-
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
-            {
-                return 0;
-            }
-
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
-            {
-                if (ignoreForciblyClosedError)
-                {
-                    return 0;
-                }
-                else
-                {
-                    return SocketOpResultError;
-                }
-            }
-
-            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return HandleReceiveError();
         }
 
-        if (receivedBytes <= 0)
+        if (receivedBytes == 0)
         {
             return 0;
         }
@@ -224,9 +236,98 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t stride, uint32_t maxPackets) const
+    {
+        AZ_Assert(stride > 0, "Invalid stride for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+        AZ_Assert(maxPackets <= MaxBatchSize, "Requested %u packets, but at most %u packets can be received at once", maxPackets, MaxBatchSize);
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        sockaddr_in from[MaxBatchSize];
+        iovec buffers[MaxBatchSize];
+        mmsghdr messages[MaxBatchSize];
+        memset(messages, 0, sizeof(mmsghdr) * maxPackets);
+        for (uint32_t i = 0; i < maxPackets; ++i)
+        {
+            buffers[i].iov_base = outData + i * stride;
+            buffers[i].iov_len = stride;
+            messages[i].msg_hdr.msg_name = &from[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedPackets = recvmmsg(static_cast<int32_t>(m_socketFd), messages, maxPackets, 0, nullptr);
+        if (receivedPackets < 0)
+        {
+            return HandleReceiveError();
+        }
+
+        for (int32_t i = 0; i < receivedPackets; ++i)
+        {
+            outAddresses[i] = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+            outSizes[i] = aznumeric_cast<int32_t>(messages[i].msg_len);
+            m_recvBytes += messages[i].msg_len;
+        }
+        m_recvPackets += receivedPackets;
+        return receivedPackets;
+#else
+        int32_t receivedPackets = 0;
+        for (uint32_t i = 0; i < maxPackets; ++i)
+        {
+            const int32_t receivedBytes = Receive(outAddresses[i], outData + i * stride, stride);
+            if (receivedBytes <= 0)
+            {
+                // Report an error only if nothing was received, otherwise it will resurface on the next receive
+                return (receivedPackets > 0) ? receivedPackets : receivedBytes;
+            }
+            outSizes[i] = receivedBytes;
+            ++receivedPackets;
+        }
+        return receivedPackets;
+#endif
+    }
+
+    void UdpSocket::BeginSendBatch()
+    {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        if (m_sendBatch == nullptr)
+        {
+            m_sendBatch = AZStd::make_unique<SendBatch>();
+        }
+        m_isBatchingSends = true;
+#endif
+    }
+
+    void UdpSocket::EndSendBatch()
+    {
+        if (m_isBatchingSends)
+        {
+            FlushSendBatch();
+            m_isBatchingSends = false;
+        }
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if (m_isBatchingSends && size <= MaxUdpTransmissionUnit)
+        {
+            if (m_sendBatch->m_count == MaxBatchSize)
+            {
+                FlushSendBatch();
+            }
+            m_sendBatch->m_addresses[m_sendBatch->m_count] = address;
+            m_sendBatch->m_payloads[m_sendBatch->m_count].CopyValues(data, size);
+            ++m_sendBatch->m_count;
+            return size;
+        }
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -235,6 +336,60 @@ namespace AzNetworking
         return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
     }
 
+    void UdpSocket::FlushSendBatch() const
+    {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        const uint32_t count = m_sendBatch->m_count;
+        if (count == 0 || !IsOpen())
+        {
+            m_sendBatch->m_count = 0;
+            return;
+        }
+
+        sockaddr_in destAddrs[MaxBatchSize];
+        iovec buffers[MaxBatchSize];
+        mmsghdr messages[MaxBatchSize];
+        memset(destAddrs, 0, sizeof(sockaddr_in) * count);
+        memset(messages, 0, sizeof(mmsghdr) * count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const IpAddress& address = m_sendBatch->m_addresses[i];
+            destAddrs[i].sin_family = AF_INET;
+            destAddrs[i].sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+            destAddrs[i].sin_port = address.GetPort(ByteOrder::Network);
+
+            ChunkBuffer& payload = m_sendBatch->m_payloads[i];
+            buffers[i].iov_base = payload.GetBuffer();
+            buffers[i].iov_len = payload.GetSize();
+            messages[i].msg_hdr.msg_name = &destAddrs[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(destAddrs[i]);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // sendmmsg can return before all payloads are sent, for example when a payload fails to send
+        uint32_t sentPackets = 0;
+        while (sentPackets < count)
+        {
+            const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentPackets, count - sentPackets, 0);
+            if (result < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+
+                // Skip the failed payload, the same as it would've been dropped if it were sent on its own
+                ++sentPackets;
+                continue;
+            }
+            sentPackets += aznumeric_cast<uint32_t>(result);
+        }
+        m_sendBatch->m_count = 0;
+#endif
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
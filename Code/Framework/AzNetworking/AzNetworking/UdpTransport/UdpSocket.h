@@ -13,7 +13,9 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +44,9 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads that are sent or received with a single system call.
+        static constexpr uint32_t MaxBatchSize = 64;
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +98,23 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outAddresses on success, the addresses of the endpoints that sent each payload
+        //! @param outSizes     on success, the number of bytes received for each payload
+        //! @param outData      address to write the received data to, payload i is written to outData + i * stride
+        //! @param stride       distance in bytes between payloads in outData, this is also the maximum size of a single payload
+        //! @param maxPackets   maximum number of payloads to receive, can be at most MaxBatchSize
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(IpAddress* outAddresses, int32_t* outSizes, uint8_t* outData, uint32_t stride, uint32_t maxPackets) const;
+
+        //! Starts queuing up payloads instead of sending them immediately.
+        //! Queued payloads are sent together when EndSendBatch is called, or when the queue is full, using a single system call.
+        //! On platforms that can't send multiple payloads with a single system call, payloads continue to be sent immediately.
+        void BeginSendBatch();
+
+        //! Sends all payloads queued since BeginSendBatch and stops queuing up payloads.
+        void EndSendBatch();
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,7 +152,20 @@ namespace AzNetworking
 
     private:
 
+        //! Sends all queued payloads.
+        void FlushSendBatch() const;
+
+        struct SendBatch
+        {
+            AZStd::array<IpAddress, MaxBatchSize> m_addresses;
+            // Payloads have gone through UDP fragmentation and encryption already, so ChunkBuffer is sufficient size
+            AZStd::array<ChunkBuffer, MaxBatchSize> m_payloads;
+            uint32_t m_count = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        AZStd::unique_ptr<SendBatch> m_sendBatch; // Allocated by the first BeginSendBatch and reused after that
+        bool m_isBatchingSends = false;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -17,6 +18,11 @@
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
 
 namespace UnitTest
 {
@@ -321,4 +327,170 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, UdpSocketBatchedSendAndReceive)
+    {
+        constexpr uint16_t ReceiverPort = 12346;
+        constexpr uint32_t NumPackets = UdpSocket::MaxBatchSize * 2 + 3; // Overflows the send batch twice
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+
+        sender.BeginSendBatch();
+        for (uint32_t i = 0; i < NumPackets; ++i)
+        {
+            EXPECT_EQ(sender.Send(receiverAddress, reinterpret_cast<const uint8_t*>(&i), sizeof(i), false, dtlsEndpoint, connectionQuality), static_cast<int32_t>(sizeof(i)));
+        }
+        sender.EndSendBatch();
+        EXPECT_EQ(sender.GetSentPackets(), NumPackets);
+
+        AZStd::array<IpAddress, UdpSocket::MaxBatchSize> addresses;
+        AZStd::array<int32_t, UdpSocket::MaxBatchSize> sizes;
+        AZStd::vector<uint8_t> buffer(UdpSocket::MaxBatchSize * MaxUdpTransmissionUnit);
+        uint32_t receivedPackets = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedPackets < NumPackets && AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 })
+        {
+            const int32_t count = receiver.ReceiveBatch(addresses.data(), sizes.data(), buffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchSize);
+            if (count <= 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                continue;
+            }
+
+            for (int32_t i = 0; i < count; ++i)
+            {
+                uint32_t value = 0;
+                ASSERT_EQ(sizes[i], static_cast<int32_t>(sizeof(value)));
+                memcpy(&value, buffer.data() + i * MaxUdpTransmissionUnit, sizeof(value));
+                EXPECT_EQ(value, receivedPackets);
+                EXPECT_EQ(addresses[i].GetAddress(ByteOrder::Host), receiverAddress.GetAddress(ByteOrder::Host));
+                ++receivedPackets;
+            }
+        }
+
+        EXPECT_EQ(receivedPackets, NumPackets);
+        EXPECT_EQ(receiver.GetRecvPackets(), NumPackets);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Sends packets over the loopback interface and reads them back. Items per second is the number of packets per second of
+    //! CPU time, the CPU time per packet is the reported CPU time divided by the number of packets in an iteration.
+    class UdpSocketBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t ReceiverPort = 12347;
+        static constexpr uint32_t PayloadSize = 256;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sender->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+            m_buffer.resize(UdpSocket::MaxBatchSize * MaxUdpTransmissionUnit);
+            m_payload.resize(PayloadSize, 0xA5);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_dtlsEndpoint.reset();
+            m_sender.reset();
+            m_receiver.reset();
+            m_buffer = {};
+            m_payload = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void SendPackets(uint32_t numPackets, bool batched)
+        {
+            const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+            if (batched)
+            {
+                m_sender->BeginSendBatch();
+            }
+            for (uint32_t i = 0; i < numPackets; ++i)
+            {
+                m_sender->Send(receiverAddress, m_payload.data(), PayloadSize, false, *m_dtlsEndpoint, m_connectionQuality);
+            }
+            if (batched)
+            {
+                m_sender->EndSendBatch();
+            }
+        }
+
+        uint32_t ReceivePackets(uint32_t numPackets, bool batched)
+        {
+            AZStd::array<IpAddress, UdpSocket::MaxBatchSize> addresses;
+            AZStd::array<int32_t, UdpSocket::MaxBatchSize> sizes;
+            uint32_t receivedPackets = 0;
+            while (receivedPackets < numPackets)
+            {
+                const uint32_t maxPackets = batched ? AZStd::min(numPackets - receivedPackets, UdpSocket::MaxBatchSize) : 1;
+                const int32_t count = batched
+                    ? m_receiver->ReceiveBatch(addresses.data(), sizes.data(), m_buffer.data(), MaxUdpTransmissionUnit, maxPackets)
+                    : (m_receiver->Receive(addresses[0], m_buffer.data(), MaxUdpTransmissionUnit) > 0 ? 1 : 0);
+                if (count <= 0)
+                {
+                    // Loopback delivery is immediate, so anything that isn't there now was dropped
+                    break;
+                }
+                receivedPackets += count;
+            }
+            return receivedPackets;
+        }
+
+        void RunBenchmark(::benchmark::State& state, bool batched)
+        {
+            const uint32_t numPackets = aznumeric_cast<uint32_t>(state.range(0));
+            size_t receivedPackets = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                SendPackets(numPackets, batched);
+                receivedPackets += ReceivePackets(numPackets, batched);
+            }
+            state.SetItemsProcessed(receivedPackets);
+        }
+
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        AZStd::vector<uint8_t> m_buffer;
+        AZStd::vector<uint8_t> m_payload;
+    };
+
+    BENCHMARK_DEFINE_F(UdpSocketBenchmarkFixture, LoopbackPerPacket)(::benchmark::State& state)
+    {
+        RunBenchmark(state, false);
+    }
+    BENCHMARK_REGISTER_F(UdpSocketBenchmarkFixture, LoopbackPerPacket)->Arg(64)->Arg(256);
+
+    BENCHMARK_DEFINE_F(UdpSocketBenchmarkFixture, LoopbackBatched)(::benchmark::State& state)
+    {
+        RunBenchmark(state, true);
+    }
+    BENCHMARK_REGISTER_F(UdpSocketBenchmarkFixture, LoopbackBatched)->Arg(64)->Arg(256);
 }
+#endif // HAVE_BENCHMARK
@@ -19,7 +19,10 @@
 
 #include "MainThreadRenderRequestBus.h"
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/TracePrefetcher.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/Script/ScriptSystemBus.h>
@@ -63,6 +66,17 @@ namespace LegacyLevelSystem
     AZ_CONSOLEFREEFUNC(LoadLevel, AZ::ConsoleFunctorFlags::Null, "Unloads the current level and loads a new one with the given asset name");
     AZ_CONSOLEFREEFUNC(UnloadLevel, AZ::ConsoleFunctorFlags::Null, "Unloads the current level");
 
+    //------------------------------------------------------------------------
+    // Let the streamer record the reads of a level load so the next load of the same level can read ahead.
+    static void SendStreamerTraceCommand(AZStd::any command)
+    {
+        if (auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get(); streamer != nullptr)
+        {
+            // Not every streaming stack has a TracePrefetcher, in which case the request is quietly marked as failed.
+            streamer->QueueRequest(streamer->Custom(AZStd::move(command)));
+        }
+    }
+
     //------------------------------------------------------------------------
     SpawnableLevelSystem::SpawnableLevelSystem([[maybe_unused]] ISystem* pSystem)
     {
@@ -244,6 +258,7 @@ namespace LegacyLevelSystem
         gEnv->pSystem->GetISystemEventDispatcher()->OnSystemEvent(ESYSTEM_EVENT_LEVEL_LOAD_PREPARE, 0, 0);
         PrepareNextLevel(validLevelName.c_str());
 
+        SendStreamerTraceCommand(AZStd::any(AZ::IO::TracePrefetcher::StartTraceCommand{ validLevelName }));
         bool result = LoadLevelInternal(validLevelName.c_str());
         if (result)
         {
@@ -515,6 +530,8 @@ namespace LegacyLevelSystem
             return;
         }
 
+        SendStreamerTraceCommand(AZStd::any(AZ::IO::TracePrefetcher::StopTraceCommand{}));
+
         AZ_TracePrintf("LevelSystem", "UnloadLevel Start\n");
         INDENT_LOG_DURING_SCOPE();
 
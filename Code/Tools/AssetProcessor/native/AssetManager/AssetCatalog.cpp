@@ -12,6 +12,7 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/FlatAssetCatalog.h>
 #include <AzFramework/FileTag/FileTagBus.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
@@ -314,9 +315,12 @@ namespace AssetProcessor
 
                 // these 3 lines are what writes the entire registry to the memory stream
                 AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+                AZStd::vector<char> flatCatalogBuffer;
                 {
                     QMutexLocker locker(&m_registriesMutex);
                     objStream->WriteClass(&m_registries[platform]);
+                    // the flat version of the catalog is built from the same state, so that both files always match.
+                    flatCatalogBuffer = AzFramework::FlatAssetCatalog::Build(m_registries[platform]);
                 }
                 objStream->Finalize();
 
@@ -362,6 +366,22 @@ namespace AssetProcessor
                         if (moved)
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Saved %s catalog containing %u assets in %fs\n", platform.toUtf8().constData(), m_registries[platform].m_assetIdToInfo.size(), timer.elapsed() / 1000.0f);
+
+                            // the flat catalog is moved in place after the serialized one, the runtime only uses it when it isn't older.
+                            QString tempFlatRegistryFile = tempRegistryFile + AzFramework::FlatAssetCatalog::FileSuffix;
+                            QString actualFlatRegistryFile = actualRegistryFile + AzFramework::FlatAssetCatalog::FileSuffix;
+                            if (AZ::IO::FileIOBase::GetInstance()->Open(tempFlatRegistryFile.toUtf8().data(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+                            {
+                                AZ::IO::FileIOBase::GetInstance()->Write(fileHandle, flatCatalogBuffer.data(), flatCatalogBuffer.size());
+                                AZ::IO::FileIOBase::GetInstance()->Close(fileHandle);
+
+                                [[maybe_unused]] bool flatMoved = AssetUtilities::MoveFileWithTimeout(tempFlatRegistryFile, actualFlatRegistryFile, 3);
+                                AZ_Warning(AssetProcessor::ConsoleChannel, flatMoved, "Failed to move %s to %s", tempFlatRegistryFile.toUtf8().constData(), actualFlatRegistryFile.toUtf8().constData());
+                            }
+                            else
+                            {
+                                AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to create flat catalog file %s", tempFlatRegistryFile.toUtf8().constData());
+                            }
                         }
                     }
                     else
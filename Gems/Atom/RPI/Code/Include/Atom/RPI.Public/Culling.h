@@ -217,6 +217,39 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Same as above, but uses a screen coverage that was already computed, for instance by CullableBatch::ApproxScreenPercentages().
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view);
+
+        //! The cull data of a group of Cullables, stored as structure-of-arrays so the bounding spheres can be tested
+        //! against a frustum and the screen coverage for lod selection can be computed four cullables at a time.
+        //! The culling fills a batch with the cullables of an octree node right before testing them against a view.
+        class CullableBatch
+        {
+        public:
+            static constexpr size_t LaneCount = 4;
+
+            void Clear();
+            void Add(Cullable& cullable);
+
+            size_t GetSize() const { return m_cullables.size(); }
+            Cullable* GetCullable(size_t index) const { return m_cullables[index]; }
+
+            //! Classifies the bounding spheres against the frustum with the same results as ShapeIntersection::Classify().
+            void ClassifySpheres(const Frustum& frustum, AZStd::vector<IntersectResult>& results) const;
+
+            //! Computes ModelLodUtils::ApproxScreenPercentage() for the lod selection radius of every cullable.
+            void ApproxScreenPercentages(const Vector3& cameraPosition, float yScale, bool isPerspective, AZStd::vector<float>& results) const;
+
+        private:
+            AZStd::vector<Cullable*> m_cullables;
+            // Padded to a multiple of LaneCount so the last group of cullables can be loaded as a whole.
+            AZStd::vector<float> m_centerX;
+            AZStd::vector<float> m_centerY;
+            AZStd::vector<float> m_centerZ;
+            AZStd::vector<float> m_radius;
+            AZStd::vector<float> m_lodSelectionRadius;
+        };
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
@@ -16,6 +16,7 @@
 
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/Casting/numeric_cast.h>
@@ -315,6 +316,18 @@ namespace AZ
             uint32_t numDrawPackets = 0;
             uint32_t numVisibleCullables = 0;
 
+            const Matrix4x4& viewToClip = worklistData->m_view->GetViewToClipMatrix();
+            //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
+            //which is used to determine the (vertical) projected size in screen space
+            const float yScale = viewToClip.GetElement(1, 1);
+            const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+            const Vector3 cameraPos = worklistData->m_view->GetViewToWorldMatrix().GetTranslation();
+
+            //The batch and the results are reused for every node in the worklist to avoid reallocating them
+            CullableBatch batch;
+            AZStd::vector<IntersectResult> intersectResults;
+            AZStd::vector<float> screenPercentages;
+
             AZ_Assert(worklist.size() > 0, "Received empty worklist in ProcessWorklist");
 
             for (const AzFramework::IVisibilityScene::NodeData& nodeData : worklist)
@@ -329,69 +342,57 @@ namespace AZ
                     worklistData->m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? "true" : "false");
 #endif
 
-                if (nodeIsContainedInFrustum)
+                //Gather the cull data of the cullables that can show up in this view, so they can be culled and have their lod selected 4 at a time
+                batch.Clear();
+                for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                 {
-                    //Add all objects within this node to the view, without any extra culling
-                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                    if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                     {
-                        {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                            {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != worklistData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
-                                    ++numVisibleCullables;
-                                    c->m_isVisible = true;
-                                }
-                            }
+                        if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                            c->m_cullData.m_hideFlags & viewFlags ||
+                            c->m_cullData.m_scene != worklistData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                            c->m_isHidden)
+                        {
+                            continue;
                         }
+
+                        batch.Add(*c);
                     }
                 }
-                else
+
+                if (batch.GetSize() > 0)
                 {
-                    //Do fine-grained culling before adding objects to the view
-                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                    if (!nodeIsContainedInFrustum)
                     {
-                        if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                        {
-                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                        //Do fine-grained culling before adding objects to the view
+                        batch.ClassifySpheres(worklistData->m_frustum, intersectResults);
+                    }
+                    batch.ApproxScreenPercentages(cameraPos, yScale, isPerspective, screenPercentages);
 
-                            if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                c->m_cullData.m_hideFlags & viewFlags ||
-                                c->m_cullData.m_scene != worklistData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                c->m_isHidden)
-                            {
-                                continue;
-                            }
+                    for (size_t i = 0; i < batch.GetSize(); ++i)
+                    {
+                        Cullable* c = batch.GetCullable(i);
 
-                            IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
-                            if (res == IntersectResult::Exterior)
+                        //Objects in nodes that are contained within the frustum are added to the view without any extra culling
+                        if (!nodeIsContainedInFrustum)
+                        {
+                            const IntersectResult res = intersectResults[i];
+                            if (res == IntersectResult::Exterior ||
+                                (res == IntersectResult::Overlaps && !ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb)))
                             {
                                 continue;
                             }
-                            else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb))
-                            {
+                        }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                        if (TestOcclusionCulling(worklistData, &c->m_cullData.m_visibilityEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
-                                {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
-                                    ++numVisibleCullables;
-                                    c->m_isVisible = true;
-                                }
-                            }
+                        {
+                            numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, screenPercentages[i], *worklistData->m_view);
+                            ++numVisibleCullables;
+                            c->m_isVisible = true;
                         }
                     }
                 }
@@ -732,10 +733,6 @@ namespace AZ
 
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
         {
-#ifdef AZ_CULL_PROFILE_DETAILED
-            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
-#endif
-
             const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
             //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
             //which is used to determine the (vertical) projected size in screen space
@@ -746,6 +743,15 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, lodData, approxScreenPercentage, view);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view)
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
+#endif
+
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -784,6 +790,135 @@ namespace AZ
             return numVisibleDrawPackets;
         }
 
+        void CullableBatch::Clear()
+        {
+            m_cullables.clear();
+            m_centerX.clear();
+            m_centerY.clear();
+            m_centerZ.clear();
+            m_radius.clear();
+            m_lodSelectionRadius.clear();
+        }
+
+        void CullableBatch::Add(Cullable& cullable)
+        {
+            const size_t index = m_cullables.size();
+            if (index % LaneCount == 0)
+            {
+                // Start a new group of lanes, the padding lanes describe empty spheres whose results are ignored
+                const size_t paddedSize = index + LaneCount;
+                m_centerX.resize(paddedSize, 0.0f);
+                m_centerY.resize(paddedSize, 0.0f);
+                m_centerZ.resize(paddedSize, 0.0f);
+                m_radius.resize(paddedSize, 0.0f);
+                m_lodSelectionRadius.resize(paddedSize, 0.0f);
+            }
+
+            const Vector3& center = cullable.m_cullData.m_boundingSphere.GetCenter();
+            m_centerX[index] = center.GetX();
+            m_centerY[index] = center.GetY();
+            m_centerZ[index] = center.GetZ();
+            m_radius[index] = cullable.m_cullData.m_boundingSphere.GetRadius();
+            m_lodSelectionRadius[index] = cullable.m_lodData.m_lodSelectionRadius;
+            m_cullables.push_back(&cullable);
+        }
+
+        void CullableBatch::ClassifySpheres(const Frustum& frustum, AZStd::vector<IntersectResult>& results) const
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_SCOPE(RPI, "CullableBatch::ClassifySpheres");
+#endif
+            using Simd::Vec4;
+
+            Vec4::FloatType planeX[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeY[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeZ[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeW[Frustum::PlaneId::MAX];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane frustumPlane = frustum.GetPlane(planeId);
+                const Vector4& plane = frustumPlane.GetPlaneEquationCoefficients();
+                planeX[planeId] = Vec4::Splat(plane.GetX());
+                planeY[planeId] = Vec4::Splat(plane.GetY());
+                planeZ[planeId] = Vec4::Splat(plane.GetZ());
+                planeW[planeId] = Vec4::Splat(plane.GetW());
+            }
+
+            const size_t size = m_cullables.size();
+            results.resize_no_construct(size);
+
+            alignas(16) int32_t exterior[LaneCount];
+            alignas(16) int32_t overlaps[LaneCount];
+            for (size_t first = 0; first < size; first += LaneCount)
+            {
+                const Vec4::FloatType x = Vec4::LoadUnaligned(&m_centerX[first]);
+                const Vec4::FloatType y = Vec4::LoadUnaligned(&m_centerY[first]);
+                const Vec4::FloatType z = Vec4::LoadUnaligned(&m_centerZ[first]);
+                const Vec4::FloatType radius = Vec4::LoadUnaligned(&m_radius[first]);
+                const Vec4::FloatType negativeRadius = Vec4::Sub(Vec4::ZeroFloat(), radius);
+
+                // Matches Frustum::IntersectSphere, a sphere is outside as soon as it's behind one plane and
+                // overlaps the frustum if it straddles any plane, otherwise it's inside.
+                Vec4::FloatType exteriorMask = Vec4::ZeroFloat();
+                Vec4::FloatType overlapsMask = Vec4::ZeroFloat();
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    // Summed in the same order as Vec4::Dot so the results are identical to the per-cullable test
+                    const Vec4::FloatType distance = Vec4::Add(
+                        Vec4::Add(Vec4::Mul(x, planeX[planeId]), Vec4::Mul(y, planeY[planeId])),
+                        Vec4::Add(Vec4::Mul(z, planeZ[planeId]), planeW[planeId]));
+                    exteriorMask = Vec4::Or(exteriorMask, Vec4::CmpLt(distance, negativeRadius));
+                    overlapsMask = Vec4::Or(overlapsMask, Vec4::CmpLt(Vec4::Abs(distance), radius));
+                }
+                Vec4::StoreAligned(exterior, Vec4::CastToInt(exteriorMask));
+                Vec4::StoreAligned(overlaps, Vec4::CastToInt(overlapsMask));
+
+                const size_t laneCount = AZStd::min(LaneCount, size - first);
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    results[first + lane] = exterior[lane] ? IntersectResult::Exterior
+                        : (overlaps[lane] ? IntersectResult::Overlaps : IntersectResult::Interior);
+                }
+            }
+        }
+
+        void CullableBatch::ApproxScreenPercentages(
+            const Vector3& cameraPosition, float yScale, bool isPerspective, AZStd::vector<float>& results) const
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_SCOPE(RPI, "CullableBatch::ApproxScreenPercentages");
+#endif
+            using Simd::Vec4;
+
+            const size_t size = m_cullables.size();
+            // Also covers the padding lanes so every group of lanes can be stored as a whole
+            results.resize_no_construct(m_lodSelectionRadius.size());
+
+            const Vec4::FloatType cameraX = Vec4::Splat(cameraPosition.GetX());
+            const Vec4::FloatType cameraY = Vec4::Splat(cameraPosition.GetY());
+            const Vec4::FloatType cameraZ = Vec4::Splat(cameraPosition.GetZ());
+            const Vec4::FloatType scale = Vec4::Splat(yScale);
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+            // See ModelLodUtils::ApproxScreenPercentage for the derivation
+            for (size_t first = 0; first < size; first += LaneCount)
+            {
+                Vec4::FloatType percentage = Vec4::Mul(scale, Vec4::LoadUnaligned(&m_lodSelectionRadius[first]));
+                if (isPerspective)
+                {
+                    const Vec4::FloatType toCenterX = Vec4::Sub(cameraX, Vec4::LoadUnaligned(&m_centerX[first]));
+                    const Vec4::FloatType toCenterY = Vec4::Sub(cameraY, Vec4::LoadUnaligned(&m_centerY[first]));
+                    const Vec4::FloatType toCenterZ = Vec4::Sub(cameraZ, Vec4::LoadUnaligned(&m_centerZ[first]));
+                    Vec4::FloatType lengthSq = Vec4::Mul(toCenterX, toCenterX);
+                    lengthSq = Vec4::Madd(toCenterY, toCenterY, lengthSq);
+                    lengthSq = Vec4::Madd(toCenterZ, toCenterZ, lengthSq);
+                    percentage = Vec4::Div(percentage, Vec4::Sqrt(lengthSq));
+                }
+                Vec4::StoreUnaligned(&results[first], Vec4::Min(percentage, one));
+            }
+            results.resize_no_construct(size);
+        }
+
         void CullingScene::Activate(const Scene* parentScene)
         {
             m_parentScene = parentScene;
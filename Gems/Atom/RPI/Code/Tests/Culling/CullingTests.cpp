@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    //! Scatters cullables with random bounding spheres and lod selection radii through a cube around the origin
+    void CreateRandomCullables(AZStd::vector<AZ::RPI::Cullable>& cullables, size_t count, float worldExtents)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        cullables.resize(count);
+        for (AZ::RPI::Cullable& cullable : cullables)
+        {
+            const AZ::Vector3 center(
+                (random.GetRandomFloat() * 2.0f - 1.0f) * worldExtents,
+                (random.GetRandomFloat() * 2.0f - 1.0f) * worldExtents,
+                (random.GetRandomFloat() * 2.0f - 1.0f) * worldExtents);
+            const float radius = 0.1f + random.GetRandomFloat() * 10.0f;
+            cullable.m_cullData.m_boundingSphere = AZ::Sphere(center, radius);
+            cullable.m_lodData.m_lodSelectionRadius = radius * 0.5f;
+        }
+    }
+
+    //! Creates a camera at the origin looking in the given direction
+    AZ::RPI::ViewPtr CreateCullingView(const AZ::Vector3& direction, bool isPerspective)
+    {
+        AZ::RPI::ViewPtr view = AZ::RPI::View::CreateView(AZ::Name("CullingView"), AZ::RPI::View::UsageCamera);
+        view->SetCameraTransform(AZ::Matrix3x4::CreateLookAt(AZ::Vector3::CreateZero(), direction));
+
+        AZ::Matrix4x4 viewToClip;
+        if (isPerspective)
+        {
+            AZ::MakePerspectiveFovMatrixRH(viewToClip, AZ::Constants::HalfPi, 16.0f / 9.0f, 0.1f, 500.0f, true);
+        }
+        else
+        {
+            AZ::MakeOrthographicMatrixRH(viewToClip, -200.0f, 200.0f, -100.0f, 100.0f, 0.1f, 500.0f, true);
+        }
+        view->SetViewToClipMatrix(viewToClip);
+        return view;
+    }
+
+    class CullingTests
+        : public RPITestFixture
+    {
+    protected:
+        static constexpr size_t NumCullables = 1001; // not a multiple of the lane count so the padding is covered too
+        static constexpr float WorldExtents = 400.0f;
+
+        void ExpectBatchMatchesScalarCulling(AZ::RPI::View& view)
+        {
+            using namespace AZ;
+
+            AZStd::vector<RPI::Cullable> cullables;
+            CreateRandomCullables(cullables, NumCullables, WorldExtents);
+
+            RPI::CullableBatch batch;
+            for (RPI::Cullable& cullable : cullables)
+            {
+                batch.Add(cullable);
+            }
+            ASSERT_EQ(NumCullables, batch.GetSize());
+
+            const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
+            AZStd::vector<IntersectResult> intersectResults;
+            batch.ClassifySpheres(frustum, intersectResults);
+            ASSERT_EQ(NumCullables, intersectResults.size());
+
+            const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+            const float yScale = viewToClip.GetElement(1, 1);
+            const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+            const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+            AZStd::vector<float> screenPercentages;
+            batch.ApproxScreenPercentages(cameraPos, yScale, isPerspective, screenPercentages);
+            ASSERT_EQ(NumCullables, screenPercentages.size());
+
+            size_t numVisible = 0;
+            for (size_t i = 0; i < NumCullables; ++i)
+            {
+                const RPI::Cullable& cullable = cullables[i];
+                EXPECT_EQ(&cullable, batch.GetCullable(i));
+                EXPECT_EQ(ShapeIntersection::Classify(frustum, cullable.m_cullData.m_boundingSphere), intersectResults[i]);
+                numVisible += intersectResults[i] != IntersectResult::Exterior ? 1 : 0;
+
+                const float expectedPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
+                    cullable.m_cullData.m_boundingSphere.GetCenter(), cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                EXPECT_NEAR(expectedPercentage, screenPercentages[i], 1e-5f);
+            }
+
+            // Make sure the views actually split the cullables
+            EXPECT_GT(numVisible, 0);
+            EXPECT_LT(numVisible, NumCullables);
+        }
+    };
+
+    TEST_F(CullingTests, CullableBatch_PerspectiveViews_MatchesScalarCulling)
+    {
+        ExpectBatchMatchesScalarCulling(*CreateCullingView(AZ::Vector3::CreateAxisY(), true));
+        ExpectBatchMatchesScalarCulling(*CreateCullingView(-AZ::Vector3::CreateAxisX(), true));
+        ExpectBatchMatchesScalarCulling(*CreateCullingView(AZ::Vector3(1.0f, 1.0f, -1.0f).GetNormalized(), true));
+    }
+
+    TEST_F(CullingTests, CullableBatch_OrthographicView_MatchesScalarCulling)
+    {
+        ExpectBatchMatchesScalarCulling(*CreateCullingView(-AZ::Vector3::CreateAxisZ(), false));
+    }
+
+    TEST_F(CullingTests, CullableBatch_Clear_RemovesAllCullables)
+    {
+        AZStd::vector<AZ::RPI::Cullable> cullables;
+        CreateRandomCullables(cullables, 6, 10.0f);
+
+        AZ::RPI::CullableBatch batch;
+        for (AZ::RPI::Cullable& cullable : cullables)
+        {
+            batch.Add(cullable);
+        }
+        batch.Clear();
+        EXPECT_EQ(0, batch.GetSize());
+
+        batch.Add(cullables[5]);
+        AZStd::vector<AZ::IntersectResult> intersectResults;
+        batch.ClassifySpheres(AZ::Frustum::CreateFromMatrixColumnMajor(AZ::Matrix4x4::CreateIdentity()), intersectResults);
+        EXPECT_EQ(1, intersectResults.size());
+        EXPECT_EQ(&cullables[5], batch.GetCullable(0));
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Culls cullables against several views, one octree node worth of cullables at a time, the way the CullingScene does.
+    class CullingBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NumViews = 4;
+        static constexpr size_t NodeSize = 64; // bg_octreeNodeMaxEntries
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            UnitTest::CreateRandomCullables(m_cullables, aznumeric_cast<size_t>(state.range(0)), 400.0f);
+
+            const AZ::Vector3 directions[NumViews] = {
+                AZ::Vector3::CreateAxisY(), -AZ::Vector3::CreateAxisY(), AZ::Vector3::CreateAxisX(), -AZ::Vector3::CreateAxisZ() };
+            for (size_t viewIndex = 0; viewIndex < NumViews; ++viewIndex)
+            {
+                AZ::Matrix4x4 viewToClip;
+                AZ::MakePerspectiveFovMatrixRH(viewToClip, AZ::Constants::HalfPi, 16.0f / 9.0f, 0.1f, 500.0f, true);
+                const AZ::Matrix4x4 worldToView =
+                    AZ::Matrix4x4::CreateFromMatrix3x4(AZ::Matrix3x4::CreateLookAt(AZ::Vector3::CreateZero(), directions[viewIndex]).GetInverseFast());
+                m_frustums[viewIndex] = AZ::Frustum::CreateFromMatrixColumnMajor(viewToClip * worldToView);
+                m_yScale = viewToClip.GetElement(1, 1);
+            }
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_cullables = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        AZStd::vector<AZ::RPI::Cullable> m_cullables;
+        AZ::Frustum m_frustums[NumViews];
+        float m_yScale = 1.0f;
+    };
+
+    BENCHMARK_DEFINE_F(CullingBenchmarkFixture, CullAndSelectLod_PerCullable)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::Frustum& frustum : m_frustums)
+            {
+                float totalScreenPercentage = 0.0f;
+                for (const AZ::RPI::Cullable& cullable : m_cullables)
+                {
+                    if (AZ::ShapeIntersection::Classify(frustum, cullable.m_cullData.m_boundingSphere) != AZ::IntersectResult::Exterior)
+                    {
+                        totalScreenPercentage += AZ::RPI::ModelLodUtils::ApproxScreenPercentage(cullable.m_cullData.m_boundingSphere.GetCenter(),
+                            cullable.m_lodData.m_lodSelectionRadius, AZ::Vector3::CreateZero(), m_yScale, true);
+                    }
+                }
+                ::benchmark::DoNotOptimize(totalScreenPercentage);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * NumViews);
+    }
+    BENCHMARK_REGISTER_F(CullingBenchmarkFixture, CullAndSelectLod_PerCullable)->Arg(100000)->Arg(250000)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(CullingBenchmarkFixture, CullAndSelectLod_Batched)(::benchmark::State& state)
+    {
+        AZ::RPI::CullableBatch batch;
+        AZStd::vector<AZ::IntersectResult> intersectResults;
+        AZStd::vector<float> screenPercentages;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::Frustum& frustum : m_frustums)
+            {
+                float totalScreenPercentage = 0.0f;
+                for (size_t first = 0; first < m_cullables.size(); first += NodeSize)
+                {
+                    batch.Clear();
+                    const size_t last = AZStd::min(first + NodeSize, m_cullables.size());
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        batch.Add(m_cullables[i]);
+                    }
+                    batch.ClassifySpheres(frustum, intersectResults);
+                    batch.ApproxScreenPercentages(AZ::Vector3::CreateZero(), m_yScale, true, screenPercentages);
+                    for (size_t i = 0; i < batch.GetSize(); ++i)
+                    {
+                        if (intersectResults[i] != AZ::IntersectResult::Exterior)
+                        {
+                            totalScreenPercentage += screenPercentages[i];
+                        }
+                    }
+                }
+                ::benchmark::DoNotOptimize(totalScreenPercentage);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * NumViews);
+    }
+    BENCHMARK_REGISTER_F(CullingBenchmarkFixture, CullAndSelectLod_Batched)->Arg(100000)->Arg(250000)->Unit(::benchmark::kMillisecond);
+}
+#endif // HAVE_BENCHMARK
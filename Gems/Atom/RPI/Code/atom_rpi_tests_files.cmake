@@ -26,6 +26,7 @@ set(FILES
     Tests/Common/RHI/Stubs.h
     Tests/Common/ShaderAssetTestUtils.cpp
     Tests/Common/ShaderAssetTestUtils.h
+    Tests/Culling/CullingTests.cpp
     Tests/Image/StreamingImageTests.cpp
     Tests/Material/LuaMaterialFunctorTests.cpp
     Tests/Material/MaterialTypeAssetTests.cpp
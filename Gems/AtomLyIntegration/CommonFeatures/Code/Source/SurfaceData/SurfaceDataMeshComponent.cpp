@@ -188,6 +188,26 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataMeshComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Hold the cache lock for the whole list so that every position is traced against the same mesh data.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+        {
+            AZ::Vector3 hitPosition;
+            AZ::Vector3 hitNormal;
+            if (DoRayTrace(inPositions[inPositionIndex], hitPosition, hitNormal))
+            {
+                const size_t pointIndex = surfacePointLists.AddSurfacePoint(inPositionIndex, entityId, hitPosition, hitNormal);
+                surfacePointLists.AddSurfaceTagWeights(pointIndex, m_configuration.m_tags, 1.0f);
+            }
+        }
+    }
+
     AZ::Aabb SurfaceDataMeshComponent::GetSurfaceAabb() const
     {
         return m_meshBounds;
@@ -224,8 +224,9 @@ namespace EMotionFX
 
         /**
          * Set the scheduler to use.
-         * EMotion FX provides two different scheduler implementations:
-         * A single threaded scheduler (SingleThreadScheduler) and a multithreaded scheduler (MultiThreadScheduler, the default).
+         * EMotion FX provides three different scheduler implementations:
+         * A single threaded scheduler (SingleThreadScheduler), a multithreaded scheduler (MultiThreadScheduler, the default) and
+         * a scheduler that updates the actor instances using a task graph (TaskGraphScheduler).
          * The current scheduler will automatically be deleted at application shutdown.
          * The schedulers are responsible for figuring out the update order.
          * @param scheduler The new scheduler to use.
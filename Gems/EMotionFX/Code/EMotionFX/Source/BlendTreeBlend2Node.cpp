@@ -114,7 +114,7 @@ namespace EMotionFX
         const size_t numNodes = uniqueData->m_mask.size();
         if (numNodes == 0)
         {
-            OutputNoFeathering(animGraphInstance);
+            OutputNoFeathering(animGraphInstance, uniqueData);
         }
         else
         {
@@ -129,7 +129,7 @@ namespace EMotionFX
     }
 
 
-    void BlendTreeBlend2Node::OutputNoFeathering(AnimGraphInstance* animGraphInstance)
+    void BlendTreeBlend2Node::OutputNoFeathering(AnimGraphInstance* animGraphInstance, UniqueData* uniqueData)
     {
         ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
 
@@ -166,7 +166,15 @@ namespace EMotionFX
             RequestPoses(animGraphInstance);
             outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
             *outputPose = *nodeA->GetMainOutputPose(animGraphInstance);
-            outputPose->GetPose().Blend(&nodeB->GetMainOutputPose(animGraphInstance)->GetPose(), weight);
+            const Pose* destPose = &nodeB->GetMainOutputPose(animGraphInstance)->GetPose();
+            if (GetEMotionFX().GetEnableSoAPoseBlending())
+            {
+                outputPose->GetPose().BlendUsingSoAPoses(destPose, weight, uniqueData->m_soaPose, uniqueData->m_soaDestPose);
+            }
+            else
+            {
+                outputPose->GetPose().Blend(destPose, weight);
+            }
         }
         else
         {
@@ -36,7 +36,7 @@ namespace EMotionFX
         void TopDownUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
         void PostUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
         void Output(AnimGraphInstance* animGraphInstance) override;
-        void OutputNoFeathering(AnimGraphInstance* animGraphInstance);
+        void OutputNoFeathering(AnimGraphInstance* animGraphInstance, UniqueData* uniqueData);
         void OutputFeathering(AnimGraphInstance* animGraphInstance, UniqueData* uniqueData);
         void UpdateMotionExtraction(AnimGraphInstance* animGraphInstance, AnimGraphNode* nodeA, AnimGraphNode* nodeB, float weight, UniqueData* uniqueData);
     };
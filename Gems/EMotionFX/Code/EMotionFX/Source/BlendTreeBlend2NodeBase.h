@@ -10,6 +10,7 @@
 
 #include "EMotionFXConfig.h"
 #include "AnimGraphNode.h"
+#include "SoAPose.h"
 
 #include <AzCore/std/containers/vector.h>
 
@@ -56,6 +57,8 @@ namespace EMotionFX
         public:
             AZStd::vector<size_t>   m_mask;
             AnimGraphNode*          m_syncTrackNode;
+            SoAPose                 m_soaPose;          /**< Scratch pose used by the blend 2 node when blending using SoA poses is enabled. */
+            SoAPose                 m_soaDestPose;      /**< Scratch pose for the destination pose, kept around to not reallocate every update. */
         };
 
         BlendTreeBlend2NodeBase();
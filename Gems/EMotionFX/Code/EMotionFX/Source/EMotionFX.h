@@ -132,6 +132,7 @@
 #include "SoftSkinManager.h"
 #include "StandardMaterial.h"
 #include "SubMesh.h"
+#include "TaskGraphScheduler.h"
 #include "ThreadData.h"
 #include "Transform.h"
 #include "TransformData.h"
@@ -131,6 +131,7 @@ namespace EMotionFX
 
         // EMotionFX will do optimization in server mode when this is enabled.
         m_enableServerOptimization = true;
+        m_enableSoAPoseBlending = false;
 
         if (MCore::GetMCore().GetIsTrackingMemory())
         {
@@ -343,6 +343,19 @@ namespace EMotionFX
          */
         bool GetEnableServerOptimization() const { return m_isInServerMode && m_enableServerOptimization; }
 
+        /**
+         * Get if blend tree blend nodes blend their input poses using the structure of arrays pose layout.
+         * @return True when the poses are converted into SoAPose objects before they are blended.
+         */
+        bool GetEnableSoAPoseBlending() const { return m_enableSoAPoseBlending; }
+
+        /**
+         * Enable or disable blending the input poses of blend tree blend nodes using the structure of arrays pose layout.
+         * The results are the same, but the poses have to be converted every update, which only pays off for actors with many joints.
+         * @param enabled True to blend using SoAPose objects, false to blend the poses directly.
+         */
+        void SetEnableSoAPoseBlending(bool enabled) { m_enableSoAPoseBlending = enabled; }
+
     private:
         AZStd::string               m_versionString;         /**< The version string. */
         AZStd::string               m_compilationDate;       /**< The compilation date string. */
@@ -368,6 +381,7 @@ namespace EMotionFX
         bool                        m_isInEditorMode;       /**< True when the runtime requires to support an editor. Optimizations can be made if there is no need for editor support. */
         bool                        m_isInServerMode;       /**< True when emotionfx is running on server. */
         bool                        m_enableServerOptimization; /**< True when optimization can be made when emotionfx is running in server mode. */
+        bool                        m_enableSoAPoseBlending; /**< True when blend nodes blend their input poses using SoAPose objects. */
 
         /**
          * The constructor.
@@ -8,12 +8,15 @@
 
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/Algorithms.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/EventManager.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoAPose.h>
 #include <EMotionFX/Source/TransformData.h>
 
 #include <MCore/Source/Endian.h>
@@ -453,6 +456,20 @@ namespace EMotionFX
         m_sampleRate = 30.0f;
     }
 
+    void MotionData::SampleSoAPose(const MotionDataSampleSettings& settings, SoAPose& outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        AZ_Assert(outputPose.GetNumJoints() == actorInstance->GetActor()->GetNumNodes(), "Expecting the output pose to hold all joints of the actor.");
+
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            outputPose.SetLocalSpaceTransform(skeletonJointIndex, SampleJointTransform(settings, skeletonJointIndex));
+        }
+    }
+
     void MotionData::BasicRetarget(const ActorInstance* actorInstance, const MotionLinkData* motionLinkData, size_t jointIndex, Transform& inOutTransform) const
     {
         AZ_Assert(motionLinkData, "Expecting valid motionLinkData pointer.");
@@ -29,6 +29,7 @@ namespace MCore
 namespace EMotionFX
 {
     class Pose;
+    class SoAPose;
     class MotionInstance;
     class ActorInstance;
     class Actor;
@@ -153,6 +154,9 @@ namespace EMotionFX
         // Sampling
         virtual Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const = 0;
         virtual void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const = 0;
+        // Samples the local space transforms of all enabled joints into a structure of arrays pose, morph weights are not sampled.
+        // The default implementation samples one joint at a time, motion data types with a suitable layout can override this.
+        virtual void SampleSoAPose(const MotionDataSampleSettings& settings, SoAPose& outputPose) const;
         virtual float SampleMorph(float sampleTime, size_t morphDataIndex) const = 0;
         virtual float SampleFloat(float sampleTime, size_t morphDataIndex) const = 0;
 
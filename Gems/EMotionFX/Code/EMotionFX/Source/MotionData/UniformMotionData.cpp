@@ -18,6 +18,7 @@
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoAPose.h>
 #include <EMotionFX/Source/TransformData.h>
 
 #include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
@@ -304,6 +305,121 @@ namespace EMotionFX
         outputPose->InvalidateAllModelSpaceTransforms();
     }
 
+    void UniformMotionData::SampleSoAPose(const MotionDataSampleSettings& settings, SoAPose& outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        AZ_Assert(outputPose.GetNumJoints() == actor->GetNumNodes(), "Expecting the output pose to hold all joints of the actor.");
+
+        // Mirroring needs the sampled transforms of other joints, so leave that to the per joint path.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            MotionData::SampleSoAPose(settings, outputPose);
+            return;
+        }
+
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        // All joints share the same sample indices, which lets us interpolate several joints at once.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+
+        SoAPose::TransformLanes samplesA;
+        SoAPose::TransformLanes samplesB;
+        SoAPose::TransformLanes results;
+        size_t laneJointIndices[SoAPose::s_laneCount];
+        for (size_t first = 0; first < numNodes; first += SoAPose::s_laneCount)
+        {
+            // Gather the two samples of every joint in this group of lanes.
+            const size_t numLanes = AZStd::min(SoAPose::s_laneCount, numNodes - first);
+            for (size_t lane = 0; lane < SoAPose::s_laneCount; ++lane)
+            {
+                if (lane >= numLanes)
+                {
+                    samplesA.SetTransform(lane, Transform::CreateIdentity());
+                    samplesB.SetTransform(lane, Transform::CreateIdentity());
+                    continue;
+                }
+
+                const size_t skeletonJointIndex = actorInstance->GetEnabledNode(first + lane);
+                laneJointIndices[lane] = skeletonJointIndex;
+                const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+                const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+                if (jointDataIndex != InvalidIndex && !inPlace)
+                {
+                    const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+                    const JointData& jointData = m_jointData[jointDataIndex];
+                    Transform sampleA = staticJointData.m_staticTransform;
+                    Transform sampleB = staticJointData.m_staticTransform;
+                    if (!jointData.m_positions.empty())
+                    {
+                        sampleA.m_position = jointData.m_positions[indexA];
+                        sampleB.m_position = jointData.m_positions[indexB];
+                    }
+                    if (!jointData.m_rotations.empty())
+                    {
+                        sampleA.m_rotation = jointData.m_rotations[indexA].ToQuaternion();
+                        sampleB.m_rotation = jointData.m_rotations[indexB].ToQuaternion();
+                    }
+#ifndef EMFX_SCALE_DISABLED
+                    if (!jointData.m_scales.empty())
+                    {
+                        sampleA.m_scale = jointData.m_scales[indexA];
+                        sampleB.m_scale = jointData.m_scales[indexB];
+                    }
+#endif
+                    samplesA.SetTransform(lane, sampleA);
+                    samplesB.SetTransform(lane, sampleB);
+                }
+                else
+                {
+                    Transform result;
+                    if (m_additive && jointDataIndex == InvalidIndex)
+                    {
+                        result = Transform::CreateIdentity();
+                    }
+                    else if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    samplesA.SetTransform(lane, result);
+                    samplesB.SetTransform(lane, result);
+                }
+            }
+
+            SoAPose::BlendLanes(samplesA, samplesB, t, results);
+
+            // Scatter the interpolated transforms back to their joints.
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                const size_t skeletonJointIndex = laneJointIndices[lane];
+                if (settings.m_retarget)
+                {
+                    Transform result = results.GetTransform(lane);
+                    BasicRetarget(actorInstance, motionLinkData, skeletonJointIndex, result);
+                    outputPose.SetLocalSpaceTransform(skeletonJointIndex, result);
+                }
+                else
+                {
+                    outputPose.SetLocalSpaceTransform(skeletonJointIndex, results.GetTransform(lane));
+                }
+            }
+        }
+    }
+
     float UniformMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
     {
         // Calculate the sample indices to interpolate between, and the interpolation fraction.
@@ -55,6 +55,7 @@ namespace EMotionFX
         // Overloaded.
         Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
         void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        void SampleSoAPose(const MotionDataSampleSettings& settings, SoAPose& outputPose) const override;
         float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
         float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
         Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
@@ -14,6 +14,7 @@
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
+#include <EMotionFX/Source/SoAPose.h>
 #include <EMotionFX/Source/TransformData.h>
 
 namespace EMotionFX
@@ -841,20 +842,8 @@ namespace EMotionFX
                 curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
             }
 
-            // blend the morph weights
-            const size_t numMorphs = m_morphWeights.size();
-            MCORE_ASSERT(m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == numMorphs);
-            MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
-            for (size_t i = 0; i < numMorphs; ++i)
-            {
-                m_morphWeights[i] = MCore::LinearInterpolate<float>(m_morphWeights[i], destPose->m_morphWeights[i], weight);
-            }
-
-            for (const auto& poseDataItem : m_poseDatas)
-            {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
-            }
+            MCORE_ASSERT(m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == m_morphWeights.size());
+            BlendMorphWeightsAndPoseDatas(destPose, weight);
         }
         else
         {
@@ -865,26 +854,67 @@ namespace EMotionFX
                 curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
             }
 
-            // blend the morph weights
-            const size_t numMorphs = m_morphWeights.size();
-            MCORE_ASSERT(m_actor->GetMorphSetup(0)->GetNumMorphTargets() == numMorphs);
-            MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
-            for (size_t i = 0; i < numMorphs; ++i)
+            MCORE_ASSERT(m_actor->GetMorphSetup(0)->GetNumMorphTargets() == m_morphWeights.size());
+            BlendMorphWeightsAndPoseDatas(destPose, weight);
+        }
+
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
+    // blend, without motion instance, using the structure of arrays layout
+    void Pose::BlendUsingSoAPoses(const Pose* destPose, float weight, SoAPose& scratchPose, SoAPose& scratchDestPose)
+    {
+        scratchPose.InitFromPose(*this);
+        scratchDestPose.InitFromPose(*destPose);
+        scratchPose.Blend(scratchDestPose, weight);
+
+        if (m_actorInstance)
+        {
+            // only write back the enabled nodes, the disabled ones keep their transforms like they do in Blend()
+            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
+            for (size_t i = 0; i < numNodes; ++i)
             {
-                m_morphWeights[i] = MCore::LinearInterpolate<float>(m_morphWeights[i], destPose->m_morphWeights[i], weight);
+                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
+                SetLocalSpaceTransformDirect(nodeNr, scratchPose.GetLocalSpaceTransform(nodeNr));
             }
 
-            for (const auto& poseDataItem : m_poseDatas)
+            MCORE_ASSERT(m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == m_morphWeights.size());
+        }
+        else
+        {
+            const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
+            for (size_t i = 0; i < numNodes; ++i)
             {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
+                SetLocalSpaceTransformDirect(i, scratchPose.GetLocalSpaceTransform(i));
             }
+
+            MCORE_ASSERT(m_actor->GetMorphSetup(0)->GetNumMorphTargets() == m_morphWeights.size());
         }
 
+        BlendMorphWeightsAndPoseDatas(destPose, weight);
         InvalidateAllModelSpaceTransforms();
     }
 
 
+    void Pose::BlendMorphWeightsAndPoseDatas(const Pose* destPose, float weight)
+    {
+        // blend the morph weights
+        const size_t numMorphs = m_morphWeights.size();
+        MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            m_morphWeights[i] = MCore::LinearInterpolate<float>(m_morphWeights[i], destPose->m_morphWeights[i], weight);
+        }
+
+        for (const auto& poseDataItem : m_poseDatas)
+        {
+            PoseData* poseData = poseDataItem.second.get();
+            poseData->Blend(destPose, weight);
+        }
+    }
+
+
     Pose& Pose::MakeRelativeTo(const Pose& other)
     {
         AZ_Assert(m_localSpaceTransforms.size() == other.m_localSpaceTransforms.size(), "Poses must be of the same size");
@@ -24,6 +24,7 @@ namespace EMotionFX
     class TransformData;
     class Skeleton;
     class MotionLinkData;
+    class SoAPose;
 
     /**
      *
@@ -134,6 +135,17 @@ namespace EMotionFX
          */
         void Blend(const Pose* destPose, float weight);
 
+        /**
+         * Blend the transforms for all enabled nodes in the actor instance, using the structure of arrays pose layout.
+         * The result is the same as Blend(destPose, weight). Both poses are converted into the scratch poses, which are only
+         * resized when the number of joints changes, so reusing them over multiple frames avoids allocating.
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         * @param scratchPose The scratch pose this pose is converted into.
+         * @param scratchDestPose The scratch pose the destination pose is converted into.
+         */
+        void BlendUsingSoAPoses(const Pose* destPose, float weight, SoAPose& scratchPose, SoAPose& scratchDestPose);
+
         /**
          * Additively blend the transforms for all enabled nodes in the actor instance.
          * You can see this as: thisPose += destPose * weight.
@@ -204,6 +216,13 @@ namespace EMotionFX
 
         void RecursiveInvalidateModelSpaceTransforms(const Actor* actor, size_t nodeIndex);
 
+        /**
+         * Blend the morph weights and the pose datas into the ones of the specified destination pose.
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         */
+        void BlendMorphWeightsAndPoseDatas(const Pose* destPose, float weight);
+
         /**
          * Perform a non-mixed blend into the specified destination pose.
          * @param destPose The destination pose to blend into.
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/SoAPose.h>
+#include <AzCore/Math/SimdMath.h>
+#include <EMotionFX/Source/Pose.h>
+#include <MCore/Source/FastMath.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        struct Vector3Lanes
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+        };
+
+        struct QuaternionLanes
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+            Vec4::FloatType m_w;
+        };
+
+        Vector3Lanes LoadVector3(const SoAPose& pose, SoAPose::Stream firstStream, size_t firstJoint)
+        {
+            return {
+                Vec4::LoadUnaligned(pose.GetStream(firstStream) + firstJoint),
+                Vec4::LoadUnaligned(pose.GetStream(static_cast<SoAPose::Stream>(firstStream + 1)) + firstJoint),
+                Vec4::LoadUnaligned(pose.GetStream(static_cast<SoAPose::Stream>(firstStream + 2)) + firstJoint) };
+        }
+
+        void StoreVector3(SoAPose& pose, SoAPose::Stream firstStream, size_t firstJoint, const Vector3Lanes& value)
+        {
+            Vec4::StoreUnaligned(pose.GetStream(firstStream) + firstJoint, value.m_x);
+            Vec4::StoreUnaligned(pose.GetStream(static_cast<SoAPose::Stream>(firstStream + 1)) + firstJoint, value.m_y);
+            Vec4::StoreUnaligned(pose.GetStream(static_cast<SoAPose::Stream>(firstStream + 2)) + firstJoint, value.m_z);
+        }
+
+        QuaternionLanes LoadRotation(const SoAPose& pose, size_t firstJoint)
+        {
+            return {
+                Vec4::LoadUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_X) + firstJoint),
+                Vec4::LoadUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_Y) + firstJoint),
+                Vec4::LoadUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_Z) + firstJoint),
+                Vec4::LoadUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_W) + firstJoint) };
+        }
+
+        void StoreRotation(SoAPose& pose, size_t firstJoint, const QuaternionLanes& value)
+        {
+            Vec4::StoreUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_X) + firstJoint, value.m_x);
+            Vec4::StoreUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_Y) + firstJoint, value.m_y);
+            Vec4::StoreUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_Z) + firstJoint, value.m_z);
+            Vec4::StoreUnaligned(pose.GetStream(SoAPose::STREAM_ROTATION_W) + firstJoint, value.m_w);
+        }
+
+        // Read a transform from streams that hold stride values each.
+        Transform ReadTransform(const float* streams, size_t stride, size_t index)
+        {
+            Transform result;
+            result.m_position.Set(
+                streams[SoAPose::STREAM_POSITION_X * stride + index],
+                streams[SoAPose::STREAM_POSITION_Y * stride + index],
+                streams[SoAPose::STREAM_POSITION_Z * stride + index]);
+            result.m_rotation.Set(
+                streams[SoAPose::STREAM_ROTATION_X * stride + index],
+                streams[SoAPose::STREAM_ROTATION_Y * stride + index],
+                streams[SoAPose::STREAM_ROTATION_Z * stride + index],
+                streams[SoAPose::STREAM_ROTATION_W * stride + index]);
+#ifndef EMFX_SCALE_DISABLED
+            result.m_scale.Set(
+                streams[SoAPose::STREAM_SCALE_X * stride + index],
+                streams[SoAPose::STREAM_SCALE_Y * stride + index],
+                streams[SoAPose::STREAM_SCALE_Z * stride + index]);
+#endif
+            return result;
+        }
+
+        void WriteTransform(float* streams, size_t stride, size_t index, const Transform& transform)
+        {
+            streams[SoAPose::STREAM_POSITION_X * stride + index] = transform.m_position.GetX();
+            streams[SoAPose::STREAM_POSITION_Y * stride + index] = transform.m_position.GetY();
+            streams[SoAPose::STREAM_POSITION_Z * stride + index] = transform.m_position.GetZ();
+            streams[SoAPose::STREAM_ROTATION_X * stride + index] = transform.m_rotation.GetX();
+            streams[SoAPose::STREAM_ROTATION_Y * stride + index] = transform.m_rotation.GetY();
+            streams[SoAPose::STREAM_ROTATION_Z * stride + index] = transform.m_rotation.GetZ();
+            streams[SoAPose::STREAM_ROTATION_W * stride + index] = transform.m_rotation.GetW();
+#ifndef EMFX_SCALE_DISABLED
+            streams[SoAPose::STREAM_SCALE_X * stride + index] = transform.m_scale.GetX();
+            streams[SoAPose::STREAM_SCALE_Y * stride + index] = transform.m_scale.GetY();
+            streams[SoAPose::STREAM_SCALE_Z * stride + index] = transform.m_scale.GetZ();
+#endif
+        }
+
+        Vector3Lanes LoadVector3(const SoAPose::TransformLanes& lanes, SoAPose::Stream firstStream)
+        {
+            return {
+                Vec4::LoadAligned(lanes.m_values[firstStream]),
+                Vec4::LoadAligned(lanes.m_values[firstStream + 1]),
+                Vec4::LoadAligned(lanes.m_values[firstStream + 2]) };
+        }
+
+        void StoreVector3(SoAPose::TransformLanes& lanes, SoAPose::Stream firstStream, const Vector3Lanes& value)
+        {
+            Vec4::StoreAligned(lanes.m_values[firstStream], value.m_x);
+            Vec4::StoreAligned(lanes.m_values[firstStream + 1], value.m_y);
+            Vec4::StoreAligned(lanes.m_values[firstStream + 2], value.m_z);
+        }
+
+        QuaternionLanes LoadRotation(const SoAPose::TransformLanes& lanes)
+        {
+            return {
+                Vec4::LoadAligned(lanes.m_values[SoAPose::STREAM_ROTATION_X]),
+                Vec4::LoadAligned(lanes.m_values[SoAPose::STREAM_ROTATION_Y]),
+                Vec4::LoadAligned(lanes.m_values[SoAPose::STREAM_ROTATION_Z]),
+                Vec4::LoadAligned(lanes.m_values[SoAPose::STREAM_ROTATION_W]) };
+        }
+
+        void StoreRotation(SoAPose::TransformLanes& lanes, const QuaternionLanes& value)
+        {
+            Vec4::StoreAligned(lanes.m_values[SoAPose::STREAM_ROTATION_X], value.m_x);
+            Vec4::StoreAligned(lanes.m_values[SoAPose::STREAM_ROTATION_Y], value.m_y);
+            Vec4::StoreAligned(lanes.m_values[SoAPose::STREAM_ROTATION_Z], value.m_z);
+            Vec4::StoreAligned(lanes.m_values[SoAPose::STREAM_ROTATION_W], value.m_w);
+        }
+
+        Vector3Lanes Lerp(const Vector3Lanes& source, const Vector3Lanes& target, Vec4::FloatArgType t)
+        {
+            // Same as MCore::LinearInterpolate, source * (1 - t) + t * target.
+            const Vec4::FloatType omt = Vec4::Sub(Vec4::Splat(1.0f), t);
+            return {
+                Vec4::Madd(source.m_x, omt, Vec4::Mul(t, target.m_x)),
+                Vec4::Madd(source.m_y, omt, Vec4::Mul(t, target.m_y)),
+                Vec4::Madd(source.m_z, omt, Vec4::Mul(t, target.m_z)) };
+        }
+
+        Vec4::FloatType Dot(const QuaternionLanes& a, const QuaternionLanes& b)
+        {
+            return Vec4::Madd(a.m_w, b.m_w, Vec4::Madd(a.m_z, b.m_z, Vec4::Madd(a.m_y, b.m_y, Vec4::Mul(a.m_x, b.m_x))));
+        }
+
+        QuaternionLanes Scale(const QuaternionLanes& q, Vec4::FloatArgType s)
+        {
+            return { Vec4::Mul(q.m_x, s), Vec4::Mul(q.m_y, s), Vec4::Mul(q.m_z, s), Vec4::Mul(q.m_w, s) };
+        }
+
+        QuaternionLanes Normalize(const QuaternionLanes& q)
+        {
+            return Scale(q, Vec4::SqrtInv(Dot(q, q)));
+        }
+
+        QuaternionLanes Conjugate(const QuaternionLanes& q)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return { Vec4::Sub(zero, q.m_x), Vec4::Sub(zero, q.m_y), Vec4::Sub(zero, q.m_z), q.m_w };
+        }
+
+        // Same as AZ::Quaternion::operator*, a * b.
+        QuaternionLanes Multiply(const QuaternionLanes& a, const QuaternionLanes& b)
+        {
+            return {
+                Vec4::Add(Vec4::Sub(Vec4::Mul(a.m_y, b.m_z), Vec4::Mul(a.m_z, b.m_y)), Vec4::Add(Vec4::Mul(a.m_w, b.m_x), Vec4::Mul(a.m_x, b.m_w))),
+                Vec4::Add(Vec4::Sub(Vec4::Mul(a.m_z, b.m_x), Vec4::Mul(a.m_x, b.m_z)), Vec4::Add(Vec4::Mul(a.m_w, b.m_y), Vec4::Mul(a.m_y, b.m_w))),
+                Vec4::Add(Vec4::Sub(Vec4::Mul(a.m_x, b.m_y), Vec4::Mul(a.m_y, b.m_x)), Vec4::Add(Vec4::Mul(a.m_w, b.m_z), Vec4::Mul(a.m_z, b.m_w))),
+                Vec4::Sub(Vec4::Mul(a.m_w, b.m_w), Vec4::Add(Vec4::Add(Vec4::Mul(a.m_x, b.m_x), Vec4::Mul(a.m_y, b.m_y)), Vec4::Mul(a.m_z, b.m_z))) };
+        }
+
+        // Same as MCore::NLerp, interpolates along the shortest path and normalizes the result.
+        QuaternionLanes NLerp(const QuaternionLanes& left, const QuaternionLanes& right, Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType omt = Vec4::Sub(Vec4::Splat(1.0f), t);
+            const Vec4::FloatType negativeDot = Vec4::CmpLt(Dot(left, right), Vec4::ZeroFloat());
+            const Vec4::FloatType signedT = Vec4::Select(Vec4::Sub(Vec4::ZeroFloat(), t), t, negativeDot);
+            const QuaternionLanes result = {
+                Vec4::Madd(left.m_x, omt, Vec4::Mul(signedT, right.m_x)),
+                Vec4::Madd(left.m_y, omt, Vec4::Mul(signedT, right.m_y)),
+                Vec4::Madd(left.m_z, omt, Vec4::Mul(signedT, right.m_z)),
+                Vec4::Madd(left.m_w, omt, Vec4::Mul(signedT, right.m_w)) };
+            return Normalize(result);
+        }
+    } // namespace
+
+
+    SoAPose::SoAPose(size_t numJoints)
+    {
+        SetNumJoints(numJoints);
+    }
+
+
+    void SoAPose::SetNumJoints(size_t numJoints)
+    {
+        const size_t paddedNumJoints = ((numJoints + s_laneCount - 1) / s_laneCount) * s_laneCount;
+        if (paddedNumJoints != m_paddedNumJoints)
+        {
+            // Move the existing values to their new stream offsets, the padding lanes are reset below.
+            AZStd::vector<float> streams(NUM_STREAMS * paddedNumJoints, 0.0f);
+            const size_t numToKeep = AZStd::min(m_numJoints, numJoints);
+            for (size_t stream = 0; stream < NUM_STREAMS; ++stream)
+            {
+                AZStd::copy(
+                    m_streams.begin() + stream * m_paddedNumJoints,
+                    m_streams.begin() + stream * m_paddedNumJoints + numToKeep,
+                    streams.begin() + stream * paddedNumJoints);
+            }
+            m_streams = AZStd::move(streams);
+            m_paddedNumJoints = paddedNumJoints;
+        }
+
+        const size_t firstNewJoint = AZStd::min(m_numJoints, numJoints);
+        m_numJoints = numJoints;
+        for (size_t i = firstNewJoint; i < m_paddedNumJoints; ++i)
+        {
+            SetLocalSpaceTransform(i, Transform::CreateIdentity());
+        }
+    }
+
+
+    void SoAPose::InitFromPose(const Pose& pose)
+    {
+        const size_t numJoints = pose.GetNumTransforms();
+        SetNumJoints(numJoints);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            SetLocalSpaceTransform(i, pose.GetLocalSpaceTransform(i));
+        }
+    }
+
+
+    void SoAPose::CopyToPose(Pose& pose) const
+    {
+        AZ_Assert(pose.GetNumTransforms() == m_numJoints, "Expected the pose to have %zu transforms, but it has %zu.", m_numJoints, pose.GetNumTransforms());
+        for (size_t i = 0; i < m_numJoints; ++i)
+        {
+            pose.SetLocalSpaceTransformDirect(i, GetLocalSpaceTransform(i));
+        }
+
+        // Since we used the SetLocalSpaceTransformDirect, make sure we manually invalidate all model space transforms.
+        pose.InvalidateAllModelSpaceTransforms();
+    }
+
+
+    Transform SoAPose::GetLocalSpaceTransform(size_t jointIndex) const
+    {
+        AZ_Assert(jointIndex < m_paddedNumJoints, "Joint index %zu out of range.", jointIndex);
+        return ReadTransform(m_streams.data(), m_paddedNumJoints, jointIndex);
+    }
+
+
+    void SoAPose::SetLocalSpaceTransform(size_t jointIndex, const Transform& transform)
+    {
+        AZ_Assert(jointIndex < m_paddedNumJoints, "Joint index %zu out of range.", jointIndex);
+        WriteTransform(m_streams.data(), m_paddedNumJoints, jointIndex, transform);
+    }
+
+
+    Transform SoAPose::TransformLanes::GetTransform(size_t lane) const
+    {
+        return ReadTransform(&m_values[0][0], s_laneCount, lane);
+    }
+
+
+    void SoAPose::TransformLanes::SetTransform(size_t lane, const Transform& transform)
+    {
+        WriteTransform(&m_values[0][0], s_laneCount, lane, transform);
+    }
+
+
+    void SoAPose::BlendLanes(const TransformLanes& source, const TransformLanes& dest, float weight, TransformLanes& outResult)
+    {
+        const Vec4::FloatType t = Vec4::Splat(weight);
+        StoreVector3(outResult, STREAM_POSITION_X, Lerp(LoadVector3(source, STREAM_POSITION_X), LoadVector3(dest, STREAM_POSITION_X), t));
+        StoreRotation(outResult, NLerp(LoadRotation(source), LoadRotation(dest), t));
+#ifndef EMFX_SCALE_DISABLED
+        StoreVector3(outResult, STREAM_SCALE_X, Lerp(LoadVector3(source, STREAM_SCALE_X), LoadVector3(dest, STREAM_SCALE_X), t));
+#endif
+    }
+
+
+    void SoAPose::Blend(const SoAPose& destPose, float weight)
+    {
+        AZ_Assert(m_numJoints == destPose.m_numJoints, "Poses must be of the same size");
+        const Vec4::FloatType t = Vec4::Splat(weight);
+        for (size_t first = 0; first < m_paddedNumJoints; first += s_laneCount)
+        {
+            StoreVector3(*this, STREAM_POSITION_X, first,
+                Lerp(LoadVector3(*this, STREAM_POSITION_X, first), LoadVector3(destPose, STREAM_POSITION_X, first), t));
+            StoreRotation(*this, first, NLerp(LoadRotation(*this, first), LoadRotation(destPose, first), t));
+#ifndef EMFX_SCALE_DISABLED
+            StoreVector3(*this, STREAM_SCALE_X, first,
+                Lerp(LoadVector3(*this, STREAM_SCALE_X, first), LoadVector3(destPose, STREAM_SCALE_X, first), t));
+#endif
+        }
+    }
+
+
+    void SoAPose::BlendAdditive(const SoAPose& destPose, const SoAPose& basePose, float weight)
+    {
+        AZ_Assert(m_numJoints == destPose.m_numJoints && m_numJoints == basePose.m_numJoints, "Poses must be of the same size");
+        const Vec4::FloatType t = Vec4::Splat(weight);
+        for (size_t first = 0; first < m_paddedNumJoints; first += s_laneCount)
+        {
+            const Vector3Lanes position = LoadVector3(*this, STREAM_POSITION_X, first);
+            const Vector3Lanes destPosition = LoadVector3(destPose, STREAM_POSITION_X, first);
+            const Vector3Lanes basePosition = LoadVector3(basePose, STREAM_POSITION_X, first);
+            StoreVector3(*this, STREAM_POSITION_X, first, {
+                Vec4::Madd(Vec4::Sub(destPosition.m_x, basePosition.m_x), t, position.m_x),
+                Vec4::Madd(Vec4::Sub(destPosition.m_y, basePosition.m_y), t, position.m_y),
+                Vec4::Madd(Vec4::Sub(destPosition.m_z, basePosition.m_z), t, position.m_z) });
+
+            const QuaternionLanes baseRotation = LoadRotation(basePose, first);
+            const QuaternionLanes rotation = NLerp(baseRotation, LoadRotation(destPose, first), t);
+            StoreRotation(*this, first, Normalize(Multiply(LoadRotation(*this, first), Multiply(Conjugate(baseRotation), rotation))));
+
+#ifndef EMFX_SCALE_DISABLED
+            const Vector3Lanes scale = LoadVector3(*this, STREAM_SCALE_X, first);
+            const Vector3Lanes destScale = LoadVector3(destPose, STREAM_SCALE_X, first);
+            const Vector3Lanes baseScale = LoadVector3(basePose, STREAM_SCALE_X, first);
+            StoreVector3(*this, STREAM_SCALE_X, first, {
+                Vec4::Madd(Vec4::Sub(destScale.m_x, baseScale.m_x), t, scale.m_x),
+                Vec4::Madd(Vec4::Sub(destScale.m_y, baseScale.m_y), t, scale.m_y),
+                Vec4::Madd(Vec4::Sub(destScale.m_z, baseScale.m_z), t, scale.m_z) });
+#endif
+        }
+    }
+
+
+    void SoAPose::ApplyAdditive(const SoAPose& additivePose, float weight)
+    {
+        AZ_Assert(m_numJoints == additivePose.m_numJoints, "Poses must be of the same size");
+        static const float weightCloseToOne = 1.0f - MCore::Math::epsilon;
+        if (weight < MCore::Math::epsilon)
+        {
+            return;
+        }
+        else if (weight > weightCloseToOne)
+        {
+            ApplyAdditive(additivePose);
+            return;
+        }
+
+        const Vec4::FloatType t = Vec4::Splat(weight);
+        for (size_t first = 0; first < m_paddedNumJoints; first += s_laneCount)
+        {
+            const Vector3Lanes position = LoadVector3(*this, STREAM_POSITION_X, first);
+            const Vector3Lanes additivePosition = LoadVector3(additivePose, STREAM_POSITION_X, first);
+            StoreVector3(*this, STREAM_POSITION_X, first, {
+                Vec4::Madd(additivePosition.m_x, t, position.m_x),
+                Vec4::Madd(additivePosition.m_y, t, position.m_y),
+                Vec4::Madd(additivePosition.m_z, t, position.m_z) });
+
+            const QuaternionLanes rotation = LoadRotation(*this, first);
+            StoreRotation(*this, first, NLerp(rotation, Multiply(LoadRotation(additivePose, first), rotation), t));
+
+#ifndef EMFX_SCALE_DISABLED
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vector3Lanes scale = LoadVector3(*this, STREAM_SCALE_X, first);
+            const Vector3Lanes additiveScale = LoadVector3(additivePose, STREAM_SCALE_X, first);
+            StoreVector3(*this, STREAM_SCALE_X, first, {
+                Vec4::Mul(scale.m_x, Vec4::Madd(Vec4::Sub(additiveScale.m_x, one), t, one)),
+                Vec4::Mul(scale.m_y, Vec4::Madd(Vec4::Sub(additiveScale.m_y, one), t, one)),
+                Vec4::Mul(scale.m_z, Vec4::Madd(Vec4::Sub(additiveScale.m_z, one), t, one)) });
+#endif
+        }
+    }
+
+
+    void SoAPose::ApplyAdditive(const SoAPose& additivePose)
+    {
+        for (size_t first = 0; first < m_paddedNumJoints; first += s_laneCount)
+        {
+            const Vector3Lanes position = LoadVector3(*this, STREAM_POSITION_X, first);
+            const Vector3Lanes additivePosition = LoadVector3(additivePose, STREAM_POSITION_X, first);
+            StoreVector3(*this, STREAM_POSITION_X, first, {
+                Vec4::Add(position.m_x, additivePosition.m_x),
+                Vec4::Add(position.m_y, additivePosition.m_y),
+                Vec4::Add(position.m_z, additivePosition.m_z) });
+
+            StoreRotation(*this, first, Normalize(Multiply(LoadRotation(*this, first), LoadRotation(additivePose, first))));
+
+#ifndef EMFX_SCALE_DISABLED
+            const Vector3Lanes scale = LoadVector3(*this, STREAM_SCALE_X, first);
+            const Vector3Lanes additiveScale = LoadVector3(additivePose, STREAM_SCALE_X, first);
+            StoreVector3(*this, STREAM_SCALE_X, first, {
+                Vec4::Mul(scale.m_x, additiveScale.m_x),
+                Vec4::Mul(scale.m_y, additiveScale.m_y),
+                Vec4::Mul(scale.m_z, additiveScale.m_z) });
+#endif
+        }
+    }
+} // namespace EMotionFX
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/Transform.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Pose;
+
+    /**
+     * Local space pose stored as a structure of arrays.
+     * Every transform component (position x, position y, ..., rotation w, scale z) lives in its own float stream, so that
+     * blending and additive operations can process several joints at once with SIMD instructions. The streams are padded
+     * to a multiple of the SIMD lane count and the padding lanes hold identity transforms.
+     * This is an opt-in alternative to the array of transforms inside Pose. It only holds local space transforms, use
+     * InitFromPose() and CopyToPose() to convert from and to a regular pose, which also takes care of the model space transforms.
+     */
+    class EMFX_API SoAPose
+    {
+        MCORE_MEMORYOBJECTCATEGORY(SoAPose, EMFX_DEFAULT_ALIGNMENT, EMFX_MEMCATEGORY_POSE);
+
+    public:
+        enum Stream : size_t
+        {
+            STREAM_POSITION_X,
+            STREAM_POSITION_Y,
+            STREAM_POSITION_Z,
+            STREAM_ROTATION_X,
+            STREAM_ROTATION_Y,
+            STREAM_ROTATION_Z,
+            STREAM_ROTATION_W,
+#ifndef EMFX_SCALE_DISABLED
+            STREAM_SCALE_X,
+            STREAM_SCALE_Y,
+            STREAM_SCALE_Z,
+#endif
+            NUM_STREAMS
+        };
+
+        //! Number of joints processed at once, each stream is padded to a multiple of this.
+        static constexpr size_t s_laneCount = 4;
+
+        //! The transforms of s_laneCount joints laid out like the streams, used to gather joints that are not next to each other.
+        struct EMFX_API TransformLanes
+        {
+            alignas(16) float m_values[NUM_STREAMS][s_laneCount];
+
+            Transform GetTransform(size_t lane) const;
+            void SetTransform(size_t lane, const Transform& transform);
+        };
+
+        //! Blend between two sets of lanes, the equivalent of Transform::Blend() for every lane.
+        static void BlendLanes(const TransformLanes& source, const TransformLanes& dest, float weight, TransformLanes& outResult);
+
+        SoAPose() = default;
+        explicit SoAPose(size_t numJoints);
+
+        //! Resize the pose, newly added joints are set to identity transforms.
+        void SetNumJoints(size_t numJoints);
+        size_t GetNumJoints() const                                                 { return m_numJoints; }
+
+        //! Resize the pose to the number of transforms of the given pose and copy all its local space transforms.
+        void InitFromPose(const Pose& pose);
+
+        //! Copy all local space transforms into the given pose and invalidate its model space transforms.
+        //! The pose needs to have the same number of transforms.
+        void CopyToPose(Pose& pose) const;
+
+        Transform GetLocalSpaceTransform(size_t jointIndex) const;
+        void SetLocalSpaceTransform(size_t jointIndex, const Transform& transform);
+
+        /**
+         * Blend all joints towards the destination pose, the equivalent of Transform::Blend() for every joint.
+         * @param destPose The destination pose to blend into, which must have the same number of joints.
+         * @param weight The weight value to use, where 0 keeps the current pose and 1 results in the destination pose.
+         */
+        void Blend(const SoAPose& destPose, float weight);
+
+        /**
+         * Additively blend all joints, the equivalent of Transform::BlendAdditive() for every joint.
+         * The difference between the destination and the base pose is applied on top of this pose.
+         * @param destPose The destination pose, which must have the same number of joints.
+         * @param basePose The base pose the destination pose is relative to, usually the bind pose.
+         * @param weight The weight value to use.
+         */
+        void BlendAdditive(const SoAPose& destPose, const SoAPose& basePose, float weight);
+
+        /**
+         * Apply an additive pose on top of this pose, the equivalent of Pose::ApplyAdditive().
+         * @param additivePose The additive pose, which must have the same number of joints.
+         * @param weight The weight value to use, in range of 0..1.
+         */
+        void ApplyAdditive(const SoAPose& additivePose, float weight);
+
+        float* GetStream(Stream stream)                                             { return m_streams.data() + stream * m_paddedNumJoints; }
+        const float* GetStream(Stream stream) const                                 { return m_streams.data() + stream * m_paddedNumJoints; }
+
+    private:
+        void ApplyAdditive(const SoAPose& additivePose);
+
+        AZStd::vector<float> m_streams; /**< All streams after each other, each one holding m_paddedNumJoints values. */
+        size_t m_numJoints = 0;
+        size_t m_paddedNumJoints = 0;
+    };
+} // namespace EMotionFX
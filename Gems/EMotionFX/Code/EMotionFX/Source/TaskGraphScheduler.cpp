@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "TaskGraphScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TaskGraphScheduler, ActorUpdateAllocator, 0)
+
+    // The weight of a new measurement in the moving average of the update time.
+    static constexpr float s_updateTimeSmoothing = 0.1f;
+
+    // The relative difference between the measured update time and the task cost that triggers a rebuild of the task graph.
+    static constexpr float s_taskCostRebuildThreshold = 0.25f;
+
+    // The update time in microseconds maps directly to the task cost, clamped to the range of the cost.
+    static AZ::u16 CalcTaskCost(float averageUpdateTime)
+    {
+        return aznumeric_cast<AZ::u16>(AZ::GetClamp(averageUpdateTime + 0.5f, 1.0f, static_cast<float>(AZStd::numeric_limits<AZ::u16>::max())));
+    }
+
+
+    // constructor
+    TaskGraphScheduler::TaskGraphScheduler()
+        : ActorUpdateScheduler()
+    {
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        m_useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        m_entries.reserve(1024);
+    }
+
+
+    // destructor
+    TaskGraphScheduler::~TaskGraphScheduler()
+    {
+    }
+
+
+    // create
+    TaskGraphScheduler* TaskGraphScheduler::Create()
+    {
+        return aznew TaskGraphScheduler();
+    }
+
+
+    // clear the schedule
+    void TaskGraphScheduler::Clear()
+    {
+        Lock();
+        m_entries.clear();
+        m_graphDirty = true;
+        Unlock();
+    }
+
+
+    // log it, for debugging purposes
+    void TaskGraphScheduler::Print()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const size_t numEntries = m_entries.size();
+        for (size_t i = 0; i < numEntries; ++i)
+        {
+            const ScheduleEntry& entry = m_entries[i];
+            const ActorInstance* attachedTo = entry.m_actorInstance->GetAttachedTo();
+            AZ_Printf("EMotionFX", "ENTRY %.3zu - ActorInstance #%u (attached to #%d) - %.1f us - cost %u", i,
+                entry.m_actorInstance->GetID(), attachedTo ? static_cast<int>(attachedTo->GetID()) : -1,
+                entry.m_averageUpdateTime, entry.m_taskCost);
+        }
+
+        AZ_Printf("EMotionFX", "---------");
+    }
+
+
+    void TaskGraphScheduler::SetTaskExecutor(AZ::TaskExecutor* taskExecutor)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_taskExecutor = taskExecutor;
+    }
+
+
+    AZ::TaskExecutor* TaskGraphScheduler::GetTaskExecutor() const
+    {
+        if (m_taskExecutor)
+        {
+            return m_taskExecutor;
+        }
+
+        return m_useTaskGraph ? &AZ::TaskExecutor::Instance() : nullptr;
+    }
+
+
+    void TaskGraphScheduler::BuildTaskGraph()
+    {
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::BuildTaskGraph");
+
+        m_taskGraph.Reset();
+
+        const size_t numEntries = m_entries.size();
+        AZStd::vector<AZ::TaskToken> taskTokens;
+        taskTokens.reserve(numEntries);
+        AZStd::unordered_map<const ActorInstance*, size_t> entryIndices;
+        entryIndices.reserve(numEntries);
+
+        for (size_t i = 0; i < numEntries; ++i)
+        {
+            ScheduleEntry& entry = m_entries[i];
+            entry.m_taskCost = CalcTaskCost(entry.m_averageUpdateTime);
+
+            AZ::TaskDescriptor taskDescriptor{"ActorInstanceUpdate", "Animation"};
+            taskDescriptor.cost = entry.m_taskCost;
+            taskTokens.emplace_back(m_taskGraph.AddTask(
+                taskDescriptor,
+                [this, i]()
+                {
+                    const uint32 threadIndex = AcquireThreadIndex();
+                    UpdateActorInstance(m_entries[i], threadIndex);
+                    ReleaseThreadIndex(threadIndex);
+                }));
+
+            entryIndices.emplace(entry.m_actorInstance, i);
+        }
+
+        // attachments can only be updated after the actor instance they are attached to
+        for (size_t i = 0; i < numEntries; ++i)
+        {
+            const auto attachedTo = entryIndices.find(m_entries[i].m_actorInstance->GetAttachedTo());
+            if (attachedTo != entryIndices.end())
+            {
+                taskTokens[attachedTo->second].Precedes(taskTokens[i]);
+            }
+        }
+
+        m_graphDirty = false;
+    }
+
+
+    bool TaskGraphScheduler::HaveTaskCostsDrifted() const
+    {
+        for (const ScheduleEntry& entry : m_entries)
+        {
+            const float taskCost = static_cast<float>(entry.m_taskCost);
+            if (AZ::GetAbs(static_cast<float>(CalcTaskCost(entry.m_averageUpdateTime)) - taskCost) > taskCost * s_taskCostRebuildThreshold)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    uint32 TaskGraphScheduler::AcquireThreadIndex()
+    {
+        // The executor can run more tasks at the same time than there are thread datas, wait for one to become available in that case.
+        for (;;)
+        {
+            {
+                AZStd::scoped_lock lock(m_threadIndexMutex);
+                if (!m_freeThreadIndices.empty())
+                {
+                    const uint32 threadIndex = m_freeThreadIndices.back();
+                    m_freeThreadIndices.pop_back();
+                    return threadIndex;
+                }
+            }
+
+            AZStd::this_thread::yield();
+        }
+    }
+
+
+    void TaskGraphScheduler::ReleaseThreadIndex(uint32 threadIndex)
+    {
+        AZStd::scoped_lock lock(m_threadIndexMutex);
+        m_freeThreadIndices.emplace_back(threadIndex);
+    }
+
+
+    void TaskGraphScheduler::UpdateActorInstance(ScheduleEntry& entry, uint32 threadIndex)
+    {
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::UpdateActorInstance");
+
+        ActorInstance* actorInstance = entry.m_actorInstance;
+        if (actorInstance->GetIsEnabled() == false)
+        {
+            return;
+        }
+
+        const auto startTime = AZStd::chrono::high_resolution_clock::now();
+        actorInstance->SetThreadIndex(threadIndex);
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + m_timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(m_timePassedInSeconds, isVisible, sampleMotions);
+        m_numUpdated.Increment();
+
+        // every entry is only updated by its own task, so the measurement can be stored without synchronization
+        // keep the fraction, as whole microseconds would measure most light actor instances as zero
+        const float updateTime =
+            AZStd::chrono::duration<float, AZStd::micro>(AZStd::chrono::high_resolution_clock::now() - startTime).count();
+        if (entry.m_averageUpdateTime > 0.0f)
+        {
+            entry.m_averageUpdateTime += (updateTime - entry.m_averageUpdateTime) * s_updateTimeSmoothing;
+        }
+        else
+        {
+            entry.m_averageUpdateTime = updateTime;
+        }
+    }
+
+
+    // execute the schedule
+    void TaskGraphScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_entries.empty())
+        {
+            return;
+        }
+
+        // check if the measured costs moved away from the ones the task graph got built with
+        m_cleanTimer += timePassedInSeconds;
+        if (m_cleanTimer >= 1.0f)
+        {
+            m_cleanTimer = 0.0f;
+            if (!m_graphDirty && HaveTaskCostsDrifted())
+            {
+                m_graphDirty = true;
+            }
+        }
+
+        // propagate root actor instance visibility to their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+
+        m_timePassedInSeconds = timePassedInSeconds;
+
+        AZ::TaskExecutor* taskExecutor = GetTaskExecutor();
+        if (!taskExecutor)
+        {
+            // attachments are stored after the actor instance they are attached to, so the entry order is a valid update order
+            for (ScheduleEntry& entry : m_entries)
+            {
+                UpdateActorInstance(entry, 0);
+            }
+            return;
+        }
+
+        // the tasks hand out the thread datas, so there are never two actor instances updating with the same one at the same time
+        const size_t numThreads = GetEMotionFX().GetNumThreads();
+        if (m_numThreadIndices != numThreads)
+        {
+            m_numThreadIndices = numThreads;
+            m_freeThreadIndices.resize(numThreads);
+            for (size_t i = 0; i < numThreads; ++i)
+            {
+                m_freeThreadIndices[i] = aznumeric_cast<uint32>(i);
+            }
+        }
+
+        if (m_graphDirty)
+        {
+            BuildTaskGraph();
+        }
+
+        AZ::TaskGraphEvent finishedEvent;
+        m_taskGraph.SubmitOnExecutor(*taskExecutor, &finishedEvent);
+        finishedEvent.Wait();
+    }
+
+
+    bool TaskGraphScheduler::HasActorInstance(const ActorInstance* actorInstance) const
+    {
+        return AZStd::find_if(m_entries.begin(), m_entries.end(), [actorInstance](const ScheduleEntry& entry)
+            {
+                return entry.m_actorInstance == actorInstance;
+            }) != m_entries.end();
+    }
+
+
+    void TaskGraphScheduler::RecursiveInsertActorInstance(ActorInstance* instance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        AZ_Assert(!HasActorInstance(instance), "Expected the actor instance not being part of the schedule already.");
+
+        ScheduleEntry& entry = m_entries.emplace_back();
+        entry.m_actorInstance = instance;
+        m_graphDirty = true;
+
+        // recursively add all attachments too, they end up behind the actor instance they are attached to
+        const size_t numAttachments = instance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = instance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveInsertActorInstance(attachment);
+            }
+        }
+    }
+
+
+    // remove the actor instance from the schedule (excluding attachments)
+    size_t TaskGraphScheduler::RemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const size_t numEntries = m_entries.size();
+        for (size_t i = startStep; i < numEntries; ++i)
+        {
+            if (m_entries[i].m_actorInstance == actorInstance)
+            {
+                // keep the order, as attachments have to stay behind the actor instance they are attached to
+                m_entries.erase(AZStd::next(m_entries.begin(), i));
+                m_graphDirty = true;
+                return i;
+            }
+        }
+
+        return 0;
+    }
+
+
+    // remove the actor instance (including all of its attachments)
+    void TaskGraphScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        // remove the actual actor instance
+        const size_t entryIndex = RemoveActorInstance(actorInstance, startStep);
+
+        // recursively remove all attachments as well
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveRemoveActorInstance(attachment, entryIndex);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::Lock()
+    {
+        m_mutex.Lock();
+    }
+
+
+    void TaskGraphScheduler::Unlock()
+    {
+        m_mutex.Unlock();
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The task graph scheduler.
+     * Instead of executing the actor instances step by step, the attachment dependencies between the actor instances are compiled into
+     * an AZ::TaskGraph, with one task per actor instance and attachments following the actor instance they are attached to.
+     * The graph is only rebuilt when actor instances get inserted or removed, every other frame the retained graph is submitted again.
+     * The update time of every actor instance is measured and used as the cost of its task, so that the executor starts the
+     * actor instances with the longest (cost weighted) chain of work first and a single heavy character does not end up running
+     * on its own at the end of the frame. The costs are re-evaluated once per second and the graph is rebuilt when they drifted.
+     * When the task graph system is not active and no executor has been set, the actor instances are updated on the calling thread.
+     */
+    class EMFX_API TaskGraphScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * An actor instance inside the schedule together with its measured update cost.
+         */
+        struct EMFX_API ScheduleEntry
+        {
+            ActorInstance*  m_actorInstance = nullptr;      /**< The actor instance to update. */
+            float           m_averageUpdateTime = 0.0f;     /**< The moving average of the update time, in microseconds. */
+            AZ::u16         m_taskCost = 1;                 /**< The cost the task in the current task graph got created with. */
+        };
+
+        /**
+         * The constructor.
+         */
+        static TaskGraphScheduler* Create();
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override        { return "TaskGraphScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * All schedulers will have another ID, so that you can use this to identify what scheduler you are dealing with.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        /**
+         * Update all actor instances by submitting the task graph and waiting for it to finish.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * LOG the schedule using the LOG method.
+         * This shows the actor instances in update order together with their measured update times and task costs.
+         */
+        void Print() override;
+
+        /**
+         * Clear the schedule.
+         */
+        void Clear() override;
+
+        /**
+         * Recursively insert an actor instance into the schedule, including all its attachments.
+         * @param actorInstance The actor instance to insert.
+         * @param startStep Unused, as the order of execution is defined by the task graph.
+         */
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Recursively remove an actor instance and its attachments from the schedule.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep The schedule entry to start searching from.
+         */
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Remove a single actor instance from the schedule. This will not remove its attachments.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep The schedule entry to start searching from.
+         * @result Returns the index of the schedule entry the actor instance got removed from.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Set the executor to submit the task graph to.
+         * When set to nullptr, the global task executor is used in case the task graph system is active.
+         * @param taskExecutor The executor to use, which has to stay alive as long as it is set.
+         */
+        void SetTaskExecutor(AZ::TaskExecutor* taskExecutor);
+        AZ::TaskExecutor* GetTaskExecutor() const;
+
+        void Lock();
+        void Unlock();
+
+        const ScheduleEntry& GetScheduleEntry(size_t index) const   { return m_entries[index]; }
+        size_t GetNumScheduleEntries() const                        { return m_entries.size(); }
+
+    protected:
+        AZStd::vector<ScheduleEntry>    m_entries;                  /**< The actor instances, where attachments are always stored after the actor instance they are attached to. */
+        AZ::TaskGraph                   m_taskGraph;                /**< The retained task graph holding a task per schedule entry. */
+        AZ::TaskExecutor*               m_taskExecutor = nullptr;   /**< The executor set by the user, or nullptr to use the global one. */
+        AZStd::vector<uint32>           m_freeThreadIndices;        /**< The thread data indices that are not in use by any of the running tasks. */
+        AZStd::spin_mutex               m_threadIndexMutex;
+        MCore::MutexRecursive           m_mutex;
+        size_t                          m_numThreadIndices = 0;
+        float                           m_timePassedInSeconds = 0.0f;
+        float                           m_cleanTimer = 0.0f;        /**< The time passed since the task costs got checked last. */
+        bool                            m_graphDirty = true;
+        bool                            m_useTaskGraph = false;
+
+        /**
+         * The constructor.
+         */
+        TaskGraphScheduler();
+
+        /**
+         * The destructor.
+         */
+        ~TaskGraphScheduler() override;
+
+        bool HasActorInstance(const ActorInstance* actorInstance) const;
+
+        /**
+         * Rebuild the task graph from the schedule entries, using their measured update times as task costs.
+         */
+        void BuildTaskGraph();
+
+        /**
+         * Check if the measured update time of any of the actor instances differs that much from the cost its task got created with,
+         * that the task graph should be rebuilt.
+         */
+        bool HaveTaskCostsDrifted() const;
+
+        /**
+         * Update a single actor instance and measure the time it took.
+         * @param entry The schedule entry of the actor instance to update.
+         * @param threadIndex The thread data index to use while updating.
+         */
+        void UpdateActorInstance(ScheduleEntry& entry, uint32 threadIndex);
+
+        uint32 AcquireThreadIndex();
+        void ReleaseThreadIndex(uint32 threadIndex);
+    };
+}   // namespace EMotionFX
@@ -126,6 +126,8 @@ set(FILES
     Source/Skeleton.h
     Source/SkinningInfoVertexAttributeLayer.cpp
     Source/SkinningInfoVertexAttributeLayer.h
+    Source/SoAPose.cpp
+    Source/SoAPose.h
     Source/SoftSkinDeformer.cpp
     Source/SoftSkinDeformer.h
     Source/SoftSkinManager.cpp
@@ -136,6 +138,8 @@ set(FILES
     Source/StandardMaterial.h
     Source/SubMesh.cpp
     Source/SubMesh.h
+    Source/TaskGraphScheduler.cpp
+    Source/TaskGraphScheduler.h
     Source/ThreadData.cpp
     Source/ThreadData.h
     Source/Transform.cpp
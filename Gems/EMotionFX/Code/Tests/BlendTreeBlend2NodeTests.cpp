@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/AnimGraphFixture.h>
+#include <Tests/Matchers.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class BlendTreeBlend2NodeFixture
+        : public AnimGraphFixture
+        , public ::testing::WithParamInterface<float>
+    {
+    public:
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(m_numJoints);
+        }
+
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            m_blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            AddMotionEntry("motionA", 0.5f)->GetMotion()->SetMotionData(CreateMotionData(0.1f));
+            AddMotionEntry("motionB", 0.5f)->GetMotion()->SetMotionData(CreateMotionData(-0.2f));
+
+            // Add nodes to blend tree.
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            m_blendTree->AddChildNode(finalNode);
+            BlendTreeBlend2Node* blend2Node = aznew BlendTreeBlend2Node();
+            m_blendTree->AddChildNode(blend2Node);
+            m_floatConstantNode = aznew BlendTreeFloatConstantNode();
+            m_blendTree->AddChildNode(m_floatConstantNode);
+            AnimGraphMotionNode* motionNodeA = aznew AnimGraphMotionNode();
+            motionNodeA->AddMotionId("motionA");
+            m_blendTree->AddChildNode(motionNodeA);
+            AnimGraphMotionNode* motionNodeB = aznew AnimGraphMotionNode();
+            motionNodeB->AddMotionId("motionB");
+            m_blendTree->AddChildNode(motionNodeB);
+
+            // Connect the nodes.
+            blend2Node->AddConnection(motionNodeA, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_A);
+            blend2Node->AddConnection(motionNodeB, AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::INPUTPORT_POSE_B);
+            blend2Node->AddConnection(m_floatConstantNode, BlendTreeFloatConstantNode::PORTID_OUTPUT_RESULT, BlendTreeBlend2Node::INPUTPORT_WEIGHT);
+            finalNode->AddConnection(blend2Node, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+        }
+
+        void TearDown() override
+        {
+            GetEMotionFX().SetEnableSoAPoseBlending(false);
+            AnimGraphFixture::TearDown();
+        }
+
+        UniformMotionData* CreateMotionData(float speed) const
+        {
+            UniformMotionData* motionData = aznew UniformMotionData();
+            UniformMotionData::InitSettings settings;
+            settings.m_numJoints = m_numJoints;
+            settings.m_numSamples = 16;
+            settings.m_sampleRate = 30.0f;
+            motionData->Init(settings);
+
+            const Skeleton* skeleton = m_actor->GetSkeleton();
+            for (size_t i = 0; i < m_numJoints; ++i)
+            {
+                motionData->SetJointName(i, skeleton->GetNode(i)->GetNameString());
+                motionData->AllocateJointPositionSamples(i);
+                motionData->AllocateJointRotationSamples(i);
+                for (size_t s = 0; s < settings.m_numSamples; ++s)
+                {
+                    const float angle = speed * static_cast<float>(i + s + 1);
+                    motionData->SetJointPositionSample(i, s, AZ::Vector3(static_cast<float>(i), angle, 0.0f));
+                    motionData->SetJointRotationSample(i, s, AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(0.0f, 0.6f, 0.8f), angle));
+                }
+            }
+            return motionData;
+        }
+
+    protected:
+        // Not a multiple of the SoA pose lane count, so the padding lanes get exercised as well.
+        const size_t m_numJoints = 7;
+        AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
+        BlendTreeFloatConstantNode* m_floatConstantNode = nullptr;
+        BlendTree* m_blendTree = nullptr;
+    };
+
+    INSTANTIATE_TEST_CASE_P(BlendTreeBlend2Node, BlendTreeBlend2NodeFixture, ::testing::ValuesIn({0.1f, 0.25f, 0.5f, 0.77f}));
+
+    TEST_P(BlendTreeBlend2NodeFixture, SoAPoseBlending_MatchesPoseBlending)
+    {
+        m_floatConstantNode->SetValue(GetParam());
+
+        // Move the motions away from their first sample before comparing the blended poses.
+        GetEMotionFX().SetEnableSoAPoseBlending(false);
+        GetEMotionFX().Update(0.2f);
+        const Pose expectedPose(*m_actorInstance->GetTransformData()->GetCurrentPose());
+
+        GetEMotionFX().SetEnableSoAPoseBlending(true);
+        GetEMotionFX().Update(0.0f);
+        const Pose* soaBlendedPose = m_actorInstance->GetTransformData()->GetCurrentPose();
+
+        ASSERT_EQ(soaBlendedPose->GetNumTransforms(), expectedPose.GetNumTransforms());
+        for (size_t i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_THAT(soaBlendedPose->GetLocalSpaceTransform(i), IsClose(expectedPose.GetLocalSpaceTransform(i))) << "Joint " << i;
+        }
+
+        // Make sure the motions got sampled, comparing two bind poses would not test the blend.
+        EXPECT_THAT(soaBlendedPose->GetLocalSpaceTransform(m_numJoints - 1),
+            ::testing::Not(IsClose(m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(m_numJoints - 1))));
+    }
+} // namespace EMotionFX
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <benchmark/benchmark.h>
+
+#include <Tests/SystemComponentFixture.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoAPose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <Tests/TestAssetCode/SimpleActors.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    //! Brings up the EMotionFX runtime the same way the unit tests do.
+    class SoAPoseBenchmarkSystem
+        : public SystemComponentFixture
+    {
+    public:
+        void TestBody() override {}
+    };
+
+    //! Many actor instances that each sample two motions, blend them and apply an additive pose on top, which is what a
+    //! simple anim graph with a blend and an additive node does every frame.
+    class SoAPoseBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t s_numJoints = 96;
+        static constexpr size_t s_numSamples = 31;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            m_system = AZStd::make_unique<SoAPoseBenchmarkSystem>();
+            m_system->SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(s_numJoints);
+            m_motionDataA = CreateMotionData(0.1f);
+            m_motionDataB = CreateMotionData(-0.2f);
+            m_additiveMotionData = CreateMotionData(0.05f);
+            m_additiveMotionData->SetAdditive(true);
+
+            const size_t numActorInstances = aznumeric_cast<size_t>(state.range(0));
+            m_instances.resize(numActorInstances);
+            for (InstanceData& instance : m_instances)
+            {
+                instance.m_actorInstance = ActorInstance::Create(m_actor.get());
+                for (Pose* pose : { &instance.m_poseA, &instance.m_poseB, &instance.m_additivePose })
+                {
+                    pose->LinkToActorInstance(instance.m_actorInstance);
+                    pose->InitFromBindPose(m_actor.get());
+                }
+                for (SoAPose* soaPose : { &instance.m_soaPoseA, &instance.m_soaPoseB, &instance.m_soaAdditivePose })
+                {
+                    soaPose->InitFromPose(*instance.m_actorInstance->GetTransformData()->GetBindPose());
+                }
+            }
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            for (InstanceData& instance : m_instances)
+            {
+                instance.m_actorInstance->Destroy();
+            }
+            m_instances = {};
+            m_motionDataA.reset();
+            m_motionDataB.reset();
+            m_additiveMotionData.reset();
+            m_actor.reset();
+            m_system->TearDown();
+            m_system.reset();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        struct InstanceData
+        {
+            ActorInstance* m_actorInstance = nullptr;
+            Pose m_poseA;
+            Pose m_poseB;
+            Pose m_additivePose;
+            SoAPose m_soaPoseA;
+            SoAPose m_soaPoseB;
+            SoAPose m_soaAdditivePose;
+        };
+
+        AZStd::unique_ptr<UniformMotionData> CreateMotionData(float speed) const
+        {
+            auto motionData = AZStd::make_unique<UniformMotionData>();
+            UniformMotionData::InitSettings settings;
+            settings.m_numJoints = s_numJoints;
+            settings.m_numSamples = s_numSamples;
+            settings.m_sampleRate = 30.0f;
+            motionData->Init(settings);
+
+            const Skeleton* skeleton = m_actor->GetSkeleton();
+            for (size_t i = 0; i < s_numJoints; ++i)
+            {
+                motionData->SetJointName(i, skeleton->GetNode(i)->GetNameString());
+                motionData->AllocateJointPositionSamples(i);
+                motionData->AllocateJointRotationSamples(i);
+                for (size_t s = 0; s < s_numSamples; ++s)
+                {
+                    const float angle = speed * static_cast<float>(i + s);
+                    motionData->SetJointPositionSample(i, s, AZ::Vector3(static_cast<float>(i), angle, 0.0f));
+                    motionData->SetJointRotationSample(i, s, AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(0.0f, 0.6f, 0.8f), angle));
+                }
+            }
+            return motionData;
+        }
+
+        void SampleInputPoses()
+        {
+            for (size_t i = 0; i < m_instances.size(); ++i)
+            {
+                InstanceData& instance = m_instances[i];
+                MotionDataSampleSettings sampleSettings;
+                sampleSettings.m_actorInstance = instance.m_actorInstance;
+                sampleSettings.m_sampleTime = GetSampleTime(i);
+                m_motionDataA->SamplePose(sampleSettings, &instance.m_poseA);
+                m_motionDataB->SamplePose(sampleSettings, &instance.m_poseB);
+            }
+        }
+
+        float GetSampleTime(size_t iteration) const
+        {
+            return m_motionDataA->GetDuration() * static_cast<float>(iteration % 100) / 100.0f;
+        }
+
+        AZStd::unique_ptr<SoAPoseBenchmarkSystem> m_system;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::unique_ptr<UniformMotionData> m_motionDataA;
+        AZStd::unique_ptr<UniformMotionData> m_motionDataB;
+        AZStd::unique_ptr<UniformMotionData> m_additiveMotionData;
+        AZStd::vector<InstanceData> m_instances;
+    };
+
+    BENCHMARK_DEFINE_F(SoAPoseBenchmarkFixture, SampleAndBlend_Pose)(::benchmark::State& state)
+    {
+        size_t iteration = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const float sampleTime = GetSampleTime(iteration++);
+            for (InstanceData& instance : m_instances)
+            {
+                MotionDataSampleSettings sampleSettings;
+                sampleSettings.m_actorInstance = instance.m_actorInstance;
+                sampleSettings.m_sampleTime = sampleTime;
+                m_motionDataA->SamplePose(sampleSettings, &instance.m_poseA);
+                m_motionDataB->SamplePose(sampleSettings, &instance.m_poseB);
+                m_additiveMotionData->SamplePose(sampleSettings, &instance.m_additivePose);
+
+                instance.m_poseA.Blend(&instance.m_poseB, 0.3f);
+                instance.m_poseA.ApplyAdditive(instance.m_additivePose, 0.5f);
+                ::benchmark::DoNotOptimize(instance.m_poseA.GetLocalSpaceTransforms());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SoAPoseBenchmarkFixture, SampleAndBlend_Pose)
+        ->Arg(100)->Arg(500)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SoAPoseBenchmarkFixture, SampleAndBlend_SoAPose)(::benchmark::State& state)
+    {
+        size_t iteration = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const float sampleTime = GetSampleTime(iteration++);
+            for (InstanceData& instance : m_instances)
+            {
+                MotionDataSampleSettings sampleSettings;
+                sampleSettings.m_actorInstance = instance.m_actorInstance;
+                sampleSettings.m_sampleTime = sampleTime;
+                m_motionDataA->SampleSoAPose(sampleSettings, instance.m_soaPoseA);
+                m_motionDataB->SampleSoAPose(sampleSettings, instance.m_soaPoseB);
+                m_additiveMotionData->SampleSoAPose(sampleSettings, instance.m_soaAdditivePose);
+
+                instance.m_soaPoseA.Blend(instance.m_soaPoseB, 0.3f);
+                instance.m_soaPoseA.ApplyAdditive(instance.m_soaAdditivePose, 0.5f);
+
+                // Include converting back, since the rest of the runtime still works on regular poses.
+                instance.m_soaPoseA.CopyToPose(instance.m_poseA);
+                ::benchmark::DoNotOptimize(instance.m_poseA.GetLocalSpaceTransforms());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SoAPoseBenchmarkFixture, SampleAndBlend_SoAPose)
+        ->Arg(100)->Arg(500)->Unit(::benchmark::kMillisecond);
+
+    //! The blend a blend 2 node does when both inputs are active, on already sampled poses.
+    BENCHMARK_DEFINE_F(SoAPoseBenchmarkFixture, Blend2_Pose)(::benchmark::State& state)
+    {
+        SampleInputPoses();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (InstanceData& instance : m_instances)
+            {
+                instance.m_poseA.Blend(&instance.m_poseB, 0.3f);
+                ::benchmark::DoNotOptimize(instance.m_poseA.GetLocalSpaceTransforms());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SoAPoseBenchmarkFixture, Blend2_Pose)
+        ->Arg(100)->Arg(500)->Unit(::benchmark::kMillisecond);
+
+    //! The same blend, the way the blend 2 node does it when SoA pose blending is enabled, including the conversions.
+    BENCHMARK_DEFINE_F(SoAPoseBenchmarkFixture, Blend2_SoAPoseBlending)(::benchmark::State& state)
+    {
+        SampleInputPoses();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (InstanceData& instance : m_instances)
+            {
+                instance.m_poseA.BlendUsingSoAPoses(&instance.m_poseB, 0.3f, instance.m_soaPoseA, instance.m_soaPoseB);
+                ::benchmark::DoNotOptimize(instance.m_poseA.GetLocalSpaceTransforms());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SoAPoseBenchmarkFixture, Blend2_SoAPoseBlending)
+        ->Arg(100)->Arg(500)->Unit(::benchmark::kMillisecond);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
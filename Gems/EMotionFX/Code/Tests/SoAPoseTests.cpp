@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/Matchers.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SoAPose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <Tests/TestAssetCode/SimpleActors.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    class SoAPoseTests
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            // Not a multiple of the lane count, so the padding lanes get exercised as well.
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(m_numJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+        }
+
+        void TearDown() override
+        {
+            m_actorInstance->Destroy();
+            SystemComponentFixture::TearDown();
+        }
+
+        Transform CreateTransform(float offset, const AZ::Vector3& axis) const
+        {
+            Transform transform(AZ::Vector3(offset, -offset, 0.5f * offset),
+                AZ::Quaternion::CreateFromAxisAngle(axis.GetNormalized(), offset));
+            EMFX_SCALECODE
+            (
+                transform.m_scale = AZ::Vector3(1.0f + offset, 1.0f, 1.0f + 0.5f * offset);
+            )
+            return transform;
+        }
+
+        void InitPose(Pose& pose, float offset, const AZ::Vector3& axis) const
+        {
+            pose.LinkToActorInstance(m_actorInstance);
+            pose.InitFromBindPose(m_actor.get());
+            for (size_t i = 0; i < m_numJoints; ++i)
+            {
+                pose.SetLocalSpaceTransform(i, CreateTransform(offset + static_cast<float>(i), axis));
+            }
+        }
+
+        void ComparePoses(const SoAPose& soaPose, const Pose& pose) const
+        {
+            ASSERT_EQ(soaPose.GetNumJoints(), pose.GetNumTransforms());
+            for (size_t i = 0; i < m_numJoints; ++i)
+            {
+                EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(pose.GetLocalSpaceTransform(i))) << "Joint " << i;
+            }
+        }
+
+    protected:
+        const size_t m_numJoints = 7;
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+    };
+
+    TEST_F(SoAPoseTests, InitFromPose_CopyToPose_RoundTrips)
+    {
+        Pose pose;
+        InitPose(pose, 0.5f, AZ::Vector3(1.0f, 2.0f, 3.0f));
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(pose);
+        EXPECT_EQ(soaPose.GetNumJoints(), m_numJoints);
+        ComparePoses(soaPose, pose);
+
+        Pose result;
+        result.LinkToActorInstance(m_actorInstance);
+        result.InitFromBindPose(m_actor.get());
+        soaPose.CopyToPose(result);
+        for (size_t i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_THAT(result.GetLocalSpaceTransform(i), IsClose(pose.GetLocalSpaceTransform(i)));
+            EXPECT_THAT(result.GetModelSpaceTransform(i), IsClose(pose.GetModelSpaceTransform(i)));
+        }
+    }
+
+    TEST_F(SoAPoseTests, SetNumJoints_KeepsExistingJoints)
+    {
+        Pose pose;
+        InitPose(pose, 0.5f, AZ::Vector3(0.0f, 1.0f, 0.0f));
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(pose);
+        soaPose.SetNumJoints(m_numJoints + 5);
+        EXPECT_EQ(soaPose.GetNumJoints(), m_numJoints + 5);
+        for (size_t i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(pose.GetLocalSpaceTransform(i)));
+        }
+        for (size_t i = m_numJoints; i < soaPose.GetNumJoints(); ++i)
+        {
+            EXPECT_THAT(soaPose.GetLocalSpaceTransform(i), IsClose(Transform::CreateIdentity()));
+        }
+
+        soaPose.SetNumJoints(2);
+        EXPECT_EQ(soaPose.GetNumJoints(), 2);
+        EXPECT_THAT(soaPose.GetLocalSpaceTransform(1), IsClose(pose.GetLocalSpaceTransform(1)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    class SoAPoseTestsBlendWeightParam
+        : public SoAPoseTests
+        , public ::testing::WithParamInterface<float>
+    {
+    };
+    INSTANTIATE_TEST_CASE_P(SoAPoseTests, SoAPoseTestsBlendWeightParam, ::testing::ValuesIn({0.0f, 0.1f, 0.25f, 0.33f, 0.5f, 0.77f, 1.0f}));
+
+    TEST_P(SoAPoseTestsBlendWeightParam, Blend_MatchesPose)
+    {
+        const float blendWeight = GetParam();
+        Pose sourcePose;
+        InitPose(sourcePose, 0.0f, AZ::Vector3(1.0f, 0.0f, 0.0f));
+        Pose destPose;
+        // Rotating the other way round makes some of the rotations end up in the opposite hemisphere.
+        InitPose(destPose, -2.0f, AZ::Vector3(0.0f, 1.0f, 1.0f));
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(sourcePose);
+        SoAPose soaDestPose;
+        soaDestPose.InitFromPose(destPose);
+        soaPose.Blend(soaDestPose, blendWeight);
+
+        sourcePose.Blend(&destPose, blendWeight);
+        ComparePoses(soaPose, sourcePose);
+    }
+
+    TEST_P(SoAPoseTestsBlendWeightParam, BlendUsingSoAPoses_MatchesBlend)
+    {
+        // Disabled joints are not blended, so they have to keep their transforms in both blend paths.
+        m_actorInstance->DisableNode(2);
+
+        const float blendWeight = GetParam();
+        Pose sourcePose;
+        InitPose(sourcePose, 0.0f, AZ::Vector3(1.0f, 0.0f, 0.0f));
+        Pose destPose;
+        InitPose(destPose, -2.0f, AZ::Vector3(0.0f, 1.0f, 1.0f));
+
+        Pose expectedPose(sourcePose);
+        expectedPose.Blend(&destPose, blendWeight);
+
+        SoAPose scratchPose;
+        SoAPose scratchDestPose;
+        sourcePose.BlendUsingSoAPoses(&destPose, blendWeight, scratchPose, scratchDestPose);
+
+        ASSERT_EQ(sourcePose.GetNumTransforms(), expectedPose.GetNumTransforms());
+        for (size_t i = 0; i < m_numJoints; ++i)
+        {
+            EXPECT_THAT(sourcePose.GetLocalSpaceTransform(i), IsClose(expectedPose.GetLocalSpaceTransform(i))) << "Joint " << i;
+        }
+        EXPECT_THAT(sourcePose.GetLocalSpaceTransform(2), IsClose(CreateTransform(2.0f, AZ::Vector3(1.0f, 0.0f, 0.0f))));
+    }
+
+    TEST_P(SoAPoseTestsBlendWeightParam, BlendAdditive_MatchesPose)
+    {
+        const float blendWeight = GetParam();
+        Pose sourcePose;
+        InitPose(sourcePose, 1.0f, AZ::Vector3(0.0f, 1.0f, 0.0f));
+        Pose destPose;
+        InitPose(destPose, -1.0f, AZ::Vector3(1.0f, 0.0f, 0.0f));
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(sourcePose);
+        SoAPose soaDestPose;
+        soaDestPose.InitFromPose(destPose);
+        SoAPose soaBindPose;
+        soaBindPose.InitFromPose(*m_actorInstance->GetTransformData()->GetBindPose());
+        soaPose.BlendAdditive(soaDestPose, soaBindPose, blendWeight);
+
+        sourcePose.BlendAdditiveUsingBindPose(&destPose, blendWeight);
+        ComparePoses(soaPose, sourcePose);
+    }
+
+    TEST_P(SoAPoseTestsBlendWeightParam, ApplyAdditive_MatchesPose)
+    {
+        const float blendWeight = GetParam();
+        Pose pose;
+        InitPose(pose, 0.25f, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        Pose additivePose;
+        InitPose(additivePose, 0.1f, AZ::Vector3(0.0f, 0.0f, 1.0f));
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(pose);
+        SoAPose soaAdditivePose;
+        soaAdditivePose.InitFromPose(additivePose);
+        soaPose.ApplyAdditive(soaAdditivePose, blendWeight);
+
+        pose.ApplyAdditive(additivePose, blendWeight);
+        ComparePoses(soaPose, pose);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    class SoAPoseSampleTests
+        : public SoAPoseTests
+        , public ::testing::WithParamInterface<float>
+    {
+    public:
+        void SetUp() override
+        {
+            SoAPoseTests::SetUp();
+
+            m_motionData = AZStd::make_unique<UniformMotionData>();
+
+            // Leave the last two joints without motion data, so they fall back to the bind pose.
+            const size_t numAnimatedJoints = m_numJoints - 2;
+            UniformMotionData::InitSettings settings;
+            settings.m_numJoints = numAnimatedJoints;
+            settings.m_numSamples = 11;
+            settings.m_sampleRate = 10.0f;
+            m_motionData->Init(settings);
+
+            const Skeleton* skeleton = m_actor->GetSkeleton();
+            for (size_t i = 0; i < numAnimatedJoints; ++i)
+            {
+                m_motionData->SetJointName(i, skeleton->GetNode(i)->GetNameString());
+
+                // Keep the second joint static, so the static transform gets used.
+                if (i == 1)
+                {
+                    m_motionData->SetJointStaticTransform(i, CreateTransform(3.0f, AZ::Vector3(1.0f, 0.0f, 1.0f)));
+                    continue;
+                }
+
+                m_motionData->AllocateJointPositionSamples(i);
+                m_motionData->AllocateJointRotationSamples(i);
+                EMFX_SCALECODE
+                (
+                    m_motionData->AllocateJointScaleSamples(i);
+                )
+                for (size_t s = 0; s < m_motionData->GetNumSamples(); ++s)
+                {
+                    // Flip the sign of every other rotation sample, to cover interpolating between opposite hemispheres.
+                    const Transform sample = CreateTransform(static_cast<float>(i + s) * 0.3f, AZ::Vector3(1.0f, 2.0f, static_cast<float>(i)));
+                    m_motionData->SetJointPositionSample(i, s, sample.m_position);
+                    m_motionData->SetJointRotationSample(i, s, (s % 2) ? -sample.m_rotation : sample.m_rotation);
+                    EMFX_SCALECODE
+                    (
+                        m_motionData->SetJointScaleSample(i, s, sample.m_scale);
+                    )
+                }
+            }
+        }
+
+        void TearDown() override
+        {
+            m_motionData.reset();
+            SoAPoseTests::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<UniformMotionData> m_motionData;
+    };
+    INSTANTIATE_TEST_CASE_P(SoAPoseTests, SoAPoseSampleTests, ::testing::ValuesIn({-1.0f, 0.0f, 0.025f, 0.33f, 0.5f, 0.77f, 1.0f, 2.0f}));
+
+    TEST_P(SoAPoseSampleTests, SampleSoAPose_MatchesSamplePose)
+    {
+        MotionDataSampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = m_actorInstance;
+        sampleSettings.m_sampleTime = GetParam();
+
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        pose.InitFromBindPose(m_actor.get());
+        m_motionData->SamplePose(sampleSettings, &pose);
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(*m_actorInstance->GetTransformData()->GetBindPose());
+        m_motionData->SampleSoAPose(sampleSettings, soaPose);
+        ComparePoses(soaPose, pose);
+    }
+
+    TEST_P(SoAPoseSampleTests, SampleSoAPose_InPlaceAndRetargeted_MatchesSamplePose)
+    {
+        m_actor->SetMotionExtractionNodeIndex(0);
+
+        MotionDataSampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = m_actorInstance;
+        sampleSettings.m_sampleTime = GetParam();
+        sampleSettings.m_inPlace = true;
+        sampleSettings.m_retarget = true;
+
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        pose.InitFromBindPose(m_actor.get());
+        m_motionData->SamplePose(sampleSettings, &pose);
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(*m_actorInstance->GetTransformData()->GetBindPose());
+        m_motionData->SampleSoAPose(sampleSettings, soaPose);
+        ComparePoses(soaPose, pose);
+    }
+
+    TEST_P(SoAPoseSampleTests, SampleSoAPose_Additive_MatchesSamplePose)
+    {
+        m_motionData->SetAdditive(true);
+
+        MotionDataSampleSettings sampleSettings;
+        sampleSettings.m_actorInstance = m_actorInstance;
+        sampleSettings.m_sampleTime = GetParam();
+
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        pose.InitFromBindPose(m_actor.get());
+        m_motionData->SamplePose(sampleSettings, &pose);
+
+        SoAPose soaPose;
+        soaPose.InitFromPose(*m_actorInstance->GetTransformData()->GetBindPose());
+        m_motionData->SampleSoAPose(sampleSettings, soaPose);
+        ComparePoses(soaPose, pose);
+    }
+} // namespace EMotionFX
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <benchmark/benchmark.h>
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <Tests/SystemComponentFixture.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+
+#include <Tests/TestAssetCode/SimpleActors.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    //! Brings up the EMotionFX runtime the same way the unit tests do.
+    class TaskGraphSchedulerBenchmarkSystem
+        : public SystemComponentFixture
+    {
+    public:
+        void TestBody() override {}
+    };
+
+    //! A crowd of actor instances, some of them carrying attachments and a few of them a lot more expensive than the rest,
+    //! updated by the task graph scheduler on an executor with the number of threads given by the benchmark argument.
+    class TaskGraphSchedulerBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t s_numRootActorInstances = 512;
+        static constexpr size_t s_numJoints = 64;
+        static constexpr size_t s_numHeavyJoints = 1024;
+        static constexpr size_t s_heavyInterval = 64;
+        static constexpr size_t s_attachmentInterval = 4;
+        static constexpr uint32 s_maxNumThreads = 64;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            m_system = AZStd::make_unique<TaskGraphSchedulerBenchmarkSystem>();
+            m_system->SetUp();
+
+            // There is a thread data per job worker thread, which matches the hardware concurrency. Beyond that the executor threads
+            // wait for a thread data to become available, just like they would be competing for a core anyway.
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>(aznumeric_cast<uint32_t>(state.range(0)));
+
+            m_scheduler = TaskGraphScheduler::Create();
+            m_scheduler->SetTaskExecutor(m_taskExecutor.get());
+            GetEMotionFX().GetActorManager()->SetScheduler(m_scheduler);
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(s_numJoints);
+            m_heavyActor = ActorFactory::CreateAndInit<SimpleJointChainActor>(s_numHeavyJoints);
+            for (size_t i = 0; i < s_numRootActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = CreateActorInstance((i % s_heavyInterval) == 0 ? m_heavyActor.get() : m_actor.get());
+                if ((i % s_attachmentInterval) == 0)
+                {
+                    ActorInstance* attachment = CreateActorInstance(m_actor.get());
+                    actorInstance->AddAttachment(AttachmentNode::Create(actorInstance, s_numJoints - 1, attachment));
+                }
+            }
+
+            // Warm up, so that the measured update times made it into the task costs.
+            for (int frame = 0; frame < 70; ++frame)
+            {
+                m_scheduler->Execute(1.0f / 60.0f);
+            }
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances = {};
+            m_actor.reset();
+            m_heavyActor.reset();
+
+            m_scheduler->SetTaskExecutor(nullptr);
+            m_taskExecutor.reset();
+
+            m_system->TearDown();
+            m_system.reset();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        ActorInstance* CreateActorInstance(Actor* actor)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(actor);
+            actorInstance->SetIsVisible(true);
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        AZStd::unique_ptr<TaskGraphSchedulerBenchmarkSystem> m_system;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        TaskGraphScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::unique_ptr<Actor> m_heavyActor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulerBenchmarkFixture, Execute)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_scheduler->Execute(1.0f / 60.0f);
+        }
+        state.SetItemsProcessed(state.iterations() * m_actorInstances.size());
+    }
+    BENCHMARK_REGISTER_F(TaskGraphSchedulerBenchmarkFixture, Execute)
+        ->RangeMultiplier(2)->Range(1, TaskGraphSchedulerBenchmarkFixture::s_maxNumThreads)
+        ->UseRealTime()->Unit(::benchmark::kMillisecond);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
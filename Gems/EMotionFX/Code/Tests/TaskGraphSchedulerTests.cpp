@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class TaskGraphSchedulerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>(4);
+
+            // The scheduler does not take over the actor instances from the previous one, so set it before creating any.
+            m_scheduler = TaskGraphScheduler::Create();
+            m_scheduler->SetTaskExecutor(m_taskExecutor.get());
+            GetEMotionFX().GetActorManager()->SetScheduler(m_scheduler);
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(5);
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+            m_heavyActor.reset();
+
+            m_scheduler->SetTaskExecutor(nullptr);
+            m_taskExecutor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+    protected:
+        ActorInstance* CreateActorInstance()
+        {
+            return CreateActorInstance(m_actor.get());
+        }
+
+        ActorInstance* CreateActorInstance(Actor* actor)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(actor);
+            actorInstance->SetIsVisible(true);
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+        ActorInstance* CreateAttachment(ActorInstance* attachTo, size_t jointIndex)
+        {
+            ActorInstance* attachment = CreateActorInstance();
+            attachTo->AddAttachment(AttachmentNode::Create(attachTo, jointIndex, attachment));
+            return attachment;
+        }
+
+        size_t FindScheduleEntry(const ActorInstance* actorInstance) const
+        {
+            for (size_t i = 0; i < m_scheduler->GetNumScheduleEntries(); ++i)
+            {
+                if (m_scheduler->GetScheduleEntry(i).m_actorInstance == actorInstance)
+                {
+                    return i;
+                }
+            }
+            return InvalidIndex;
+        }
+
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        TaskGraphScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::unique_ptr<Actor> m_heavyActor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(TaskGraphSchedulerFixture, AttachmentsAreScheduledAfterTheirParent)
+    {
+        ActorInstance* root = CreateActorInstance();
+        ActorInstance* other = CreateActorInstance();
+        ActorInstance* attachment = CreateAttachment(root, 4);
+        ActorInstance* nestedAttachment = CreateAttachment(attachment, 2);
+
+        ASSERT_EQ(m_scheduler->GetNumScheduleEntries(), 4);
+        EXPECT_NE(FindScheduleEntry(other), InvalidIndex);
+        EXPECT_LT(FindScheduleEntry(root), FindScheduleEntry(attachment));
+        EXPECT_LT(FindScheduleEntry(attachment), FindScheduleEntry(nestedAttachment));
+
+        // Removing the root takes its attachments with it.
+        m_scheduler->RecursiveRemoveActorInstance(root);
+        ASSERT_EQ(m_scheduler->GetNumScheduleEntries(), 1);
+        EXPECT_EQ(m_scheduler->GetScheduleEntry(0).m_actorInstance, other);
+
+        m_scheduler->RecursiveInsertActorInstance(root);
+        ASSERT_EQ(m_scheduler->GetNumScheduleEntries(), 4);
+        EXPECT_LT(FindScheduleEntry(root), FindScheduleEntry(attachment));
+        EXPECT_LT(FindScheduleEntry(attachment), FindScheduleEntry(nestedAttachment));
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, ExecuteUpdatesAllEnabledActorInstances)
+    {
+        constexpr size_t numRoots = 16;
+        for (size_t i = 0; i < numRoots; ++i)
+        {
+            CreateAttachment(CreateActorInstance(), 3);
+        }
+
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numRoots * 2);
+            EXPECT_EQ(m_scheduler->GetNumVisibleActorInstances(), numRoots * 2);
+        }
+
+        m_actorInstances[0]->SetIsEnabled(false);
+        m_actorInstances[5]->SetIsEnabled(false);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numRoots * 2 - 2);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, ExecuteUpdatesAttachmentsAfterTheirParent)
+    {
+        constexpr size_t numRoots = 8;
+        AZStd::vector<AZStd::pair<ActorInstance*, ActorInstance*>> attachedPairs;
+        for (size_t i = 0; i < numRoots; ++i)
+        {
+            ActorInstance* root = CreateActorInstance();
+            attachedPairs.emplace_back(root, CreateAttachment(root, 4));
+        }
+
+        // Move the roots every frame, the attachments can only follow within the same frame when they got updated after their parent.
+        for (int frame = 1; frame <= 5; ++frame)
+        {
+            for (size_t i = 0; i < numRoots; ++i)
+            {
+                attachedPairs[i].first->SetLocalSpacePosition(AZ::Vector3(static_cast<float>(i), static_cast<float>(frame), 0.0f));
+            }
+
+            GetEMotionFX().Update(1.0f / 60.0f);
+
+            for (const auto& [root, attachment] : attachedPairs)
+            {
+                const AZ::Vector3 jointPosition = root->GetTransformData()->GetCurrentPose()->GetWorldSpaceTransform(4).m_position;
+                EXPECT_TRUE(attachment->GetWorldSpaceTransform().m_position.IsClose(jointPosition))
+                    << "The attachment should follow its parent joint in the same frame.";
+            }
+        }
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, ExecuteWithoutTaskExecutor)
+    {
+        constexpr size_t numRoots = 4;
+        for (size_t i = 0; i < numRoots; ++i)
+        {
+            CreateAttachment(CreateActorInstance(), 1);
+        }
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numRoots * 2);
+
+        // Without an executor and an active task graph system the actor instances get updated on the calling thread.
+        m_scheduler->SetTaskExecutor(nullptr);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), numRoots * 2);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, MeasuredUpdateTimesBecomeTheTaskCosts)
+    {
+        // The update cost grows with the number of joints, the heavy actor instance costs a multiple of the light ones.
+        m_heavyActor = ActorFactory::CreateAndInit<SimpleJointChainActor>(5000);
+        ActorInstance* heavy = CreateActorInstance(m_heavyActor.get());
+        ActorInstance* light = CreateActorInstance();
+
+        // The task graph gets built on the first frame, before anything got measured.
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetScheduleEntry(FindScheduleEntry(heavy)).m_taskCost, 1);
+        EXPECT_GT(m_scheduler->GetScheduleEntry(FindScheduleEntry(heavy)).m_averageUpdateTime, 0.0f);
+        EXPECT_GT(m_scheduler->GetScheduleEntry(FindScheduleEntry(light)).m_averageUpdateTime, 0.0f);
+
+        // Run for more than a second, so that the task costs get re-evaluated and the graph is rebuilt with the measured costs.
+        for (int frame = 0; frame < 70; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+        }
+
+        const TaskGraphScheduler::ScheduleEntry& heavyEntry = m_scheduler->GetScheduleEntry(FindScheduleEntry(heavy));
+        const TaskGraphScheduler::ScheduleEntry& lightEntry = m_scheduler->GetScheduleEntry(FindScheduleEntry(light));
+        EXPECT_GT(heavyEntry.m_averageUpdateTime, lightEntry.m_averageUpdateTime);
+        // The costs the tasks got rebuilt with are what the executor orders the critical path by.
+        EXPECT_GT(heavyEntry.m_taskCost, 1);
+        EXPECT_GT(heavyEntry.m_taskCost, lightEntry.m_taskCost);
+    }
+} // namespace EMotionFX
@@ -60,6 +60,7 @@ set(FILES
     Tests/BlendSpaceFixture.h
     Tests/BlendSpaceFixture.cpp
     Tests/BlendSpaceTests.cpp
+    Tests/BlendTreeBlend2NodeTests.cpp
     Tests/BlendTreeBlendNNodeTests.cpp
     Tests/BlendTreeFloatConstantNodeTests.cpp
     Tests/BlendTreeFloatConditionNodeTests.cpp
@@ -108,9 +109,13 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SoAPoseBenchmarks.cpp
+    Tests/SoAPoseTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
+    Tests/TaskGraphSchedulerBenchmarks.cpp
+    Tests/TaskGraphSchedulerTests.cpp
     Tests/TransformUnitTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -49,6 +50,23 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them. This has the same thread-safety requirements as GetValue.
+        * Gradients that can generate values more efficiently in bulk, for instance because they only need to look up their
+        * settings or sample their inputs once, should override this. The default implementation calls GetValue for every position.
+        * @param positions The positions to generate values for.
+        * @param outValues The generated values. This needs to be the same size as positions.
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "The number of positions and values for a gradient don't match.");
+            const size_t count = AZStd::min(positions.size(), outValues.size());
+            for (size_t i = 0; i < count; ++i)
+            {
+                outValues[i] = GetValue(GradientSampleParams(positions[i]));
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
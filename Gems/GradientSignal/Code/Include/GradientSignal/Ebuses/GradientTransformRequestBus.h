@@ -11,6 +11,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -28,6 +29,22 @@ namespace GradientSignal
         virtual ~GradientTransformRequests() = default;
 
         virtual void TransformPositionToUVW(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const = 0;
+
+        //! Transforms a list of positions at once. outUVWs and wasPointRejected need to be the same size as inPositions.
+        virtual void TransformPositionsToUVW(
+            const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs, const bool shouldNormalizeOutput,
+            AZStd::vector<bool>& wasPointRejected) const
+        {
+            AZ_Assert(inPositions.size() == outUVWs.size() && inPositions.size() == wasPointRejected.size(),
+                "The number of positions, uvws and rejections for a gradient transform don't match.");
+            const size_t count = AZStd::min(inPositions.size(), AZStd::min(outUVWs.size(), wasPointRejected.size()));
+            for (size_t i = 0; i < count; ++i)
+            {
+                bool wasRejected = false;
+                TransformPositionToUVW(inPositions[i], outUVWs[i], shouldNormalizeOutput, wasRejected);
+                wasPointRejected[i] = wasRejected;
+            }
+        }
         virtual void GetGradientLocalBounds(AZ::Aabb& bounds) const = 0;
         virtual void GetGradientEncompassingBounds(AZ::Aabb& bounds) const = 0;
     };
@@ -34,6 +34,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Samples the gradient at every position with a single request to the gradient. outValues needs to be the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -147,4 +150,71 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions and values for a gradient sampler don't match.");
+
+        // Gradients without a handler leave the values untouched, so start out with the same default as GetValue.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool useTransform = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (useTransform)
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.reserve(positions.size());
+            for (const AZ::Vector3& position : positions)
+            {
+                transformedPositions.push_back(matrix3x4 * position);
+            }
+        }
+
+        {
+            // See GetValue for why the surface data mutex is locked before checking for cyclic dependencies.
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            GradientRequestBus::Event(
+                m_gradientId, &GradientRequestBus::Events::GetValues, useTransform ? transformedPositions : positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        const bool useLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+        for (float& output : outValues)
+        {
+            if (m_invertInput)
+            {
+                output = 1.0f - output;
+            }
+
+            //apply levels if set
+            if (useLevels)
+            {
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            output *= m_opacity;
+        }
+    }
 }
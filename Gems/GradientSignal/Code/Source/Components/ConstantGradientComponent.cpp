@@ -134,6 +134,12 @@ namespace GradientSignal
         return m_configuration.m_value;
     }
 
+    void ConstantGradientComponent::GetValues(
+        [[maybe_unused]] const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
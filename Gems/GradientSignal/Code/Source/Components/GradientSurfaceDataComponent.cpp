@@ -261,6 +261,72 @@ namespace GradientSignal
         }
     }
 
+    void GradientSurfaceDataComponent::ModifySurfacePointLists(SurfaceData::SurfacePointLists& surfacePointLists) const
+    {
+        if (m_configuration.m_modifierTags.empty())
+        {
+            return;
+        }
+
+        // Grab a copy of the optional constraining shape bounds, the same way ModifySurfacePoints does.
+        bool validShapeBounds = false;
+        AZ::Aabb shapeConstraintBounds;
+        if (m_validShapeBounds)
+        {
+            AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+            shapeConstraintBounds = m_cachedShapeConstraintBounds;
+            validShapeBounds = m_cachedShapeConstraintBounds.IsValid();
+        }
+
+        // Gather the points that are within our allowed shape bounds, so that the gradient can be sampled for all of them at once.
+        const AZ::EntityId entityId = GetEntityId();
+        AZStd::vector<size_t> pointIndices;
+        AZStd::vector<AZ::Vector3> positions;
+        pointIndices.reserve(surfacePointLists.GetPointCount());
+        positions.reserve(surfacePointLists.GetPointCount());
+
+        auto gatherPoints = [&](LmbrCentral::ShapeComponentRequests* shape)
+        {
+            for (size_t pointIndex = 0; pointIndex < surfacePointLists.GetPointCount(); ++pointIndex)
+            {
+                if (surfacePointLists.GetEntityId(pointIndex) == entityId)
+                {
+                    continue;
+                }
+
+                const AZ::Vector3& position = surfacePointLists.GetPosition(pointIndex);
+                if (!shape || (shapeConstraintBounds.Contains(position) && shape->IsPointInside(position)))
+                {
+                    pointIndices.push_back(pointIndex);
+                    positions.push_back(position);
+                }
+            }
+            return false;
+        };
+
+        if (validShapeBounds)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(m_configuration.m_shapeConstraintEntityId, gatherPoints);
+        }
+        else
+        {
+            // Assume an unbounded surface modifier and allow *all* points through the shape check.
+            gatherPoints(nullptr);
+        }
+
+        AZStd::vector<float> values(positions.size());
+        m_gradientSampler.GetValues(positions, values);
+
+        // Add the value to the surface tags of every point that meets the gradient thresholds.
+        for (size_t index = 0; index < pointIndices.size(); ++index)
+        {
+            if (values[index] >= m_configuration.m_thresholdMin && values[index] <= m_configuration.m_thresholdMax)
+            {
+                surfacePointLists.AddSurfaceTagWeights(pointIndices[index], m_configuration.m_modifierTags, values[index]);
+            }
+        }
+    }
+
     void GradientSurfaceDataComponent::OnCompositionChanged()
     {
         AZ_PROFILE_FUNCTION(Entity);
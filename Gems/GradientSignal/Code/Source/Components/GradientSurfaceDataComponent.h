@@ -73,6 +73,7 @@ namespace GradientSignal
         ////////////////////////////////////////////////////////////////////////
         // SurfaceData::SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointLists(SurfaceData::SurfacePointLists& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // LmbrCentral::DependencyNotificationBus
@@ -325,7 +325,30 @@ namespace GradientSignal
     void GradientTransformComponent::TransformPositionToUVW(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
     {
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        TransformPositionToUVWUnlocked(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(
+        const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs, const bool shouldNormalizeOutput,
+        AZStd::vector<bool>& wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(inPositions.size() == outUVWs.size() && inPositions.size() == wasPointRejected.size(),
+            "The number of positions, uvws and rejections for a gradient transform don't match.");
+
+        // Only lock once for the entire list instead of once per position.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        const size_t count = AZStd::min(inPositions.size(), AZStd::min(outUVWs.size(), wasPointRejected.size()));
+        for (size_t i = 0; i < count; ++i)
+        {
+            bool wasRejected = false;
+            TransformPositionToUVWUnlocked(inPositions[i], outUVWs[i], shouldNormalizeOutput, wasRejected);
+            wasPointRejected[i] = wasRejected;
+        }
+    }
 
+    void GradientTransformComponent::TransformPositionToUVWUnlocked(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
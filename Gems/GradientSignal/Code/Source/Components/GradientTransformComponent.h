@@ -102,6 +102,9 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientTransformRequestBus
         void TransformPositionToUVW(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const override;
+        void TransformPositionsToUVW(
+            const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs, const bool shouldNormalizeOutput,
+            AZStd::vector<bool>& wasPointRejected) const override;
         void GetGradientLocalBounds(AZ::Aabb& bounds) const override;
         void GetGradientEncompassingBounds(AZ::Aabb& bounds) const override;
 
@@ -166,6 +169,9 @@ namespace GradientSignal
         void SetAdvancedMode(bool value) override;
 
     private:
+        //! Transforms a single position. m_cacheMutex needs to be locked by the caller.
+        void TransformPositionToUVWUnlocked(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const;
+
         mutable AZStd::recursive_mutex m_cacheMutex;
         GradientTransformConfig m_configuration;
         AZ::Aabb m_shapeBounds = AZ::Aabb::CreateNull();
@@ -207,6 +207,28 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void ImageGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions and values for a gradient don't match.");
+
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = true;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        // Only lock the image once for the entire list of positions.
+        AZStd::lock_guard<decltype(m_imageMutex)> imageLock(m_imageMutex);
+        const size_t count = AZStd::min(positions.size(), outValues.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            outValues[i] = wasPointRejected[i]
+                ? 0.0f
+                : GetValueFromImageAsset(m_configuration.m_imageAsset, uvws[i], m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+        }
+    }
+
     AZStd::string ImageGradientComponent::GetImageAssetPath() const
     {
         AZStd::string assetPathString;
@@ -137,6 +137,15 @@ namespace GradientSignal
         return output;
     }
 
+    void InvertGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+        for (float& value : outValues)
+        {
+            value = 1.0f - AZ::GetClamp(value, 0.0f, 1.0f);
+        }
+    }
+
     bool InvertGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -99,6 +99,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
     protected:
@@ -110,6 +111,9 @@ namespace GradientSignal
         MixedGradientLayer* GetLayer(int layerIndex) override;
 
     private:
+        //! Combines the value of a layer with the result of the layers before it.
+        static float MixLayer(const MixedGradientLayer& layer, float result, float current);
+
         MixedGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
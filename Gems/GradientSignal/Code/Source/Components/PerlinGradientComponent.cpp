@@ -192,6 +192,32 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void PerlinGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(positions.size() == outValues.size(), "The number of positions and values for a gradient don't match.");
+
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        if (m_perlinImprovedNoise)
+        {
+            AZStd::vector<AZ::Vector3> uvws(positions);
+            AZStd::vector<bool> wasPointRejected(positions.size(), false);
+            const bool shouldNormalizeOutput = false;
+            GradientTransformRequestBus::Event(
+                GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+            const size_t count = AZStd::min(positions.size(), outValues.size());
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!wasPointRejected[i])
+                {
+                    outValues[i] = m_perlinImprovedNoise->GenerateOctaveNoise(
+                        uvws[i].GetX(), uvws[i].GetY(), uvws[i].GetZ(), m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+                }
+            }
+        }
+    }
+
     int PerlinGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
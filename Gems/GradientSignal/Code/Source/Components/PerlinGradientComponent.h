@@ -70,6 +70,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     private:
         PerlinGradientConfig m_configuration;
@@ -176,6 +176,15 @@ namespace GradientSignal
         return output;
     }
 
+    void SmoothStepGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+        for (float& value : outValues)
+        {
+            value = m_configuration.m_smoothStep.GetSmoothedValue(AZ::GetClamp(value, 0.0f, 1.0f));
+        }
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
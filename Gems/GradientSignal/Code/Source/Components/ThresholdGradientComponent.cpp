@@ -145,6 +145,15 @@ namespace GradientSignal
         return output;
     }
 
+    void ThresholdGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+        for (float& value : outValues)
+        {
+            value = value <= m_configuration.m_threshold ? 0.0f : 1.0f;
+        }
+    }
+
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include "Tests/GradientSignalTestMocks.h"
+
+#include <benchmark/benchmark.h>
+#include <GradientSignal/GradientSampler.h>
+#include <Source/Components/GradientTransformComponent.h>
+#include <Source/Components/LevelsGradientComponent.h>
+#include <Source/Components/MixedGradientComponent.h>
+#include <Source/Components/PerlinGradientComponent.h>
+#include <Source/Components/RandomGradientComponent.h>
+#include <Source/Components/ReferenceGradientComponent.h>
+#include <Source/Components/SmoothStepGradientComponent.h>
+
+namespace UnitTest
+{
+    //! Builds a chain of gradients that's typical for vegetation and terrain setups:
+    //! Reference -> SmoothStep -> Mixed(Levels -> Perlin, Random)
+    class GradientSignalBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            const float regionSize = aznumeric_cast<float>(state.range(0));
+
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            m_systemEntity = m_app->Create(appDesc);
+            m_app->AddEntity(m_systemEntity);
+
+            m_app->RegisterComponentDescriptor(GradientSignal::GradientTransformComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(GradientSignal::LevelsGradientComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(GradientSignal::MixedGradientComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(GradientSignal::PerlinGradientComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(GradientSignal::RandomGradientComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(GradientSignal::ReferenceGradientComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(GradientSignal::SmoothStepGradientComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(MockShapeComponent::CreateDescriptor());
+
+            const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3(regionSize, regionSize, 1.0f));
+
+            GradientSignal::PerlinGradientConfig perlinConfig;
+            perlinConfig.m_octave = 4;
+            AZ::Entity* perlinEntity = CreateGeneratorEntity(bounds);
+            perlinEntity->CreateComponent<GradientSignal::PerlinGradientComponent>(perlinConfig);
+
+            AZ::Entity* randomEntity = CreateGeneratorEntity(bounds);
+            randomEntity->CreateComponent<GradientSignal::RandomGradientComponent>(GradientSignal::RandomGradientConfig());
+
+            GradientSignal::LevelsGradientConfig levelsConfig;
+            levelsConfig.m_gradientSampler.m_gradientId = perlinEntity->GetId();
+            levelsConfig.m_inputMin = 0.2f;
+            levelsConfig.m_inputMax = 0.8f;
+            AZ::Entity* levelsEntity = CreateEntity();
+            levelsEntity->CreateComponent<GradientSignal::LevelsGradientComponent>(levelsConfig);
+
+            GradientSignal::MixedGradientConfig mixedConfig;
+            GradientSignal::MixedGradientLayer layer;
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Initialize;
+            layer.m_gradientSampler.m_gradientId = levelsEntity->GetId();
+            mixedConfig.m_layers.push_back(layer);
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Multiply;
+            layer.m_gradientSampler.m_gradientId = randomEntity->GetId();
+            layer.m_gradientSampler.m_opacity = 0.5f;
+            mixedConfig.m_layers.push_back(layer);
+            AZ::Entity* mixedEntity = CreateEntity();
+            mixedEntity->CreateComponent<GradientSignal::MixedGradientComponent>(mixedConfig);
+
+            GradientSignal::SmoothStepGradientConfig smoothStepConfig;
+            smoothStepConfig.m_gradientSampler.m_gradientId = mixedEntity->GetId();
+            AZ::Entity* smoothStepEntity = CreateEntity();
+            smoothStepEntity->CreateComponent<GradientSignal::SmoothStepGradientComponent>(smoothStepConfig);
+
+            GradientSignal::ReferenceGradientConfig referenceConfig;
+            referenceConfig.m_gradientSampler.m_gradientId = smoothStepEntity->GetId();
+            AZ::Entity* referenceEntity = CreateEntity();
+            referenceEntity->CreateComponent<GradientSignal::ReferenceGradientComponent>(referenceConfig);
+
+            for (AZStd::unique_ptr<AZ::Entity>& entity : m_entities)
+            {
+                entity->Init();
+                entity->Activate();
+            }
+
+            m_gradientSampler.m_gradientId = referenceEntity->GetId();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            m_gradientSampler = {};
+            m_entities = {};
+            m_shapeHandlers = {};
+            m_app->Destroy();
+            m_app.reset();
+            m_systemEntity = nullptr;
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        AZ::Entity* CreateEntity()
+        {
+            m_entities.push_back(AZStd::make_unique<AZ::Entity>());
+            return m_entities.back().get();
+        }
+
+        AZ::Entity* CreateGeneratorEntity(const AZ::Aabb& bounds)
+        {
+            AZ::Entity* entity = CreateEntity();
+            entity->CreateComponent<GradientSignal::GradientTransformComponent>(GradientSignal::GradientTransformConfig());
+            entity->CreateComponent<MockShapeComponent>();
+
+            m_shapeHandlers.push_back(AZStd::make_unique<MockShapeComponentHandler>(entity->GetId()));
+            m_shapeHandlers.back()->m_GetLocalBounds = bounds;
+            m_shapeHandlers.back()->m_GetEncompassingAabb = bounds;
+            return entity;
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::vector<AZStd::unique_ptr<MockShapeComponentHandler>> m_shapeHandlers;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        GradientSignal::GradientSampler m_gradientSampler;
+    };
+
+    BENCHMARK_DEFINE_F(GradientSignalBenchmarkFixture, SampleRegion_GetValue)(::benchmark::State& state)
+    {
+        const int64_t regionSize = state.range(0);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int64_t y = 0; y < regionSize; ++y)
+            {
+                for (int64_t x = 0; x < regionSize; ++x)
+                {
+                    GradientSignal::GradientSampleParams params(AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), 0.0f));
+                    float value = m_gradientSampler.GetValue(params);
+                    ::benchmark::DoNotOptimize(value);
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * regionSize * regionSize);
+    }
+    BENCHMARK_REGISTER_F(GradientSignalBenchmarkFixture, SampleRegion_GetValue)->Arg(1024)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(GradientSignalBenchmarkFixture, SampleRegion_GetValues)(::benchmark::State& state)
+    {
+        // Sample one row of the region per request, which is how region queries hand out their positions.
+        const int64_t regionSize = state.range(0);
+        AZStd::vector<AZ::Vector3> positions(aznumeric_cast<size_t>(regionSize));
+        AZStd::vector<float> values(aznumeric_cast<size_t>(regionSize));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int64_t y = 0; y < regionSize; ++y)
+            {
+                for (int64_t x = 0; x < regionSize; ++x)
+                {
+                    positions[x] = AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), 0.0f);
+                }
+                m_gradientSampler.GetValues(positions, values);
+                ::benchmark::DoNotOptimize(values.data());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * regionSize * regionSize);
+    }
+    BENCHMARK_REGISTER_F(GradientSignalBenchmarkFixture, SampleRegion_GetValues)->Arg(1024)->Unit(::benchmark::kMillisecond);
+}
+
+#endif // HAVE_BENCHMARK
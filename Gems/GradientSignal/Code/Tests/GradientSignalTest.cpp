@@ -147,6 +147,55 @@ namespace UnitTest
         EXPECT_EQ(expectedOutput, gradientSampler.GetValue({}));
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, GradientSampler_GetValuesWithSamplerSettings_MatchesGetValue)
+    {
+        // Verify that the batched request applies the sampler's transform, inversion, levels and opacity the same way
+        // as requesting the values one at a time.
+
+        GradientSignal::RandomGradientConfig config;
+        config.m_randomSeed = 1234;
+
+        auto entity = CreateEntity();
+        CreateComponent<GradientSignal::RandomGradientComponent>(entity.get(), config);
+
+        GradientSignal::GradientTransformConfig gradientTransformConfig;
+        CreateComponent<GradientSignal::GradientTransformComponent>(entity.get(), gradientTransformConfig);
+        CreateComponent<MockShapeComponent>(entity.get());
+        MockShapeComponentHandler mockShapeHandler(entity->GetId());
+
+        ActivateEntity(entity.get());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        gradientSampler.m_opacity = 0.75f;
+        gradientSampler.m_invertInput = true;
+        gradientSampler.m_enableTransform = true;
+        gradientSampler.m_translate = AZ::Vector3(3.0f, -2.0f, 0.0f);
+        gradientSampler.m_scale = AZ::Vector3(2.0f, 0.5f, 1.0f);
+        gradientSampler.m_rotate = AZ::Vector3(0.0f, 0.0f, 30.0f);
+        gradientSampler.m_enableLevels = true;
+        gradientSampler.m_inputMin = 0.1f;
+        gradientSampler.m_inputMax = 0.9f;
+        gradientSampler.m_outputMax = 0.8f;
+
+        constexpr int dataSize = 8;
+        AZStd::vector<AZ::Vector3> positions;
+        for (int y = 0; y < dataSize; ++y)
+        {
+            for (int x = 0; x < dataSize; ++x)
+            {
+                positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+            }
+        }
+
+        AZStd::vector<float> values(positions.size());
+        gradientSampler.GetValues(positions, values);
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            EXPECT_FLOAT_EQ(gradientSampler.GetValue(GradientSignal::GradientSampleParams(positions[index])), values[index]);
+        }
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_GRADIENT_SIGNAL_TESTS
     TEST_F(GradientSignalTestGeneratorFixture, DISABLED_PerlinGradientComponent_GoldenTest)
 #else
@@ -7,6 +7,7 @@
 #
 
 set(FILES
+    Tests/GradientSignalBenchmarks.cpp
     Tests/GradientSignalImageTests.cpp
     Tests/GradientSignalReferencesTests.cpp
     Tests/GradientSignalServicesTests.cpp
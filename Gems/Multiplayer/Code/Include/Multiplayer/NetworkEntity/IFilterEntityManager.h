@@ -39,11 +39,21 @@ namespace Multiplayer
         //! Return true if a given entity should be filtered out, false otherwise.
         //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
         //! Ideally, this method should be implemented as a quick look up.
+        //! This is only called from the main thread, unless SupportsConcurrentFiltering returns true.
         //!
         //! @param entity the entity to be considered for filtering
         //! @param controllerEntity player's entity for the associated connection
         //! @param connectionId the affected connection should the entity be filtered out.
         //! @return if false the given entity will be not be replicated to the connection
         virtual bool IsEntityFiltered(AZ::Entity* entity, ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) = 0;
+
+        //! Return true if IsEntityFiltered may be called concurrently from task graph workers for different connections.
+        //! Replication windows are only updated in parallel (sv_ParallelReplicationWindowUpdates) when the filter opts in,
+        //! implementations that do must not modify shared state without synchronization.
+        //! @return true if IsEntityFiltered is safe to call from multiple threads at once
+        virtual bool SupportsConcurrentFiltering() const
+        {
+            return false;
+        }
     };
 }
@@ -387,7 +387,8 @@ namespace Multiplayer
         stats.m_serverConnectionCount = 0;
         stats.m_clientConnectionCount = 0;
 
-        // Send out the game state update to all connections
+        // Send out the game state update to all connections, the packets for all connections are transmitted together at the end of the tick
+        m_networkInterface->BeginSendBatch();
         {
             auto sendNetworkUpdates = [&stats](IConnection& connection)
             {
@@ -436,6 +437,7 @@ namespace Multiplayer
         {
             m_networkInterface->GetConnectionSet().VisitConnections(visitor);
         }
+        m_networkInterface->EndSendBatch();
     }
 
     int MultiplayerSystemComponent::GetTickOrder()
@@ -519,7 +521,7 @@ namespace Multiplayer
             EnableAutonomousControl(controlledEntity, connection->GetConnectionId());
 
             ServerToClientConnectionData* connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData());
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, &m_replicationWindowUpdater);
             connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
             connectionData->SetControlledEntity(controlledEntity);
 
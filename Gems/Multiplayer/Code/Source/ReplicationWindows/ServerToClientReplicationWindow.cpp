@@ -7,12 +7,14 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindowUpdater.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/std/sort.h>
 
 namespace Multiplayer
@@ -52,7 +54,12 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow
+    (
+        NetworkEntityHandle controlledEntity,
+        AzNetworking::IConnection* connection,
+        ServerToClientReplicationWindowUpdater* updater
+    )
         : m_controlledEntity(controlledEntity)
         , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
         , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
@@ -60,18 +67,34 @@ namespace Multiplayer
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
         , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to client replication window update event"))
+        , m_updater(updater)
     {
         AZ::Entity* entity = m_controlledEntity.GetEntity();
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
         m_controlledEntityTransform = entity ? entity->GetTransform() : nullptr;
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
 
-        m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        if (m_updater != nullptr)
+        {
+            m_updater->AddWindow(this);
+        }
+        else
+        {
+            m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        }
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        if (m_updater != nullptr)
+        {
+            m_updater->RemoveWindow(this);
+        }
+    }
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
@@ -100,6 +123,31 @@ namespace Multiplayer
     }
 
     void ServerToClientReplicationWindow::UpdateWindow()
+    {
+        if (!BeginUpdate())
+        {
+            return;
+        }
+
+        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(m_awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                    {
+                        gatheredEntries.push_back(visEntry);
+                    }
+                }
+            }
+        );
+
+        GatherCandidates(gatheredEntries);
+        EndUpdate();
+    }
+
+    bool ServerToClientReplicationWindow::BeginUpdate()
     {
         // Clear the candidate queue, we're going to rebuild it
         ReplicationCandidateQueue::container_type clearQueueContainer;
@@ -113,35 +161,36 @@ namespace Multiplayer
         if (!netBindComponent || !netBindComponent->HasController())
         {
             // If we don't have a controlled entity, or we no longer have control of the entity, don't run the update
-            return;
+            return false;
         }
 
         EvaluateConnection();
 
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
-        const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
+        m_awarenessSphere = AZ::Sphere(transformInterface->GetWorldTranslation(), sv_ClientAwarenessRadius);
+        return true;
+    }
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-            {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                    {
-                        gatheredEntries.push_back(visEntry);
-                    }
-                }
-            }
-        );
+    const AZ::Sphere& ServerToClientReplicationWindow::GetAwarenessSphere() const
+    {
+        return m_awarenessSphere;
+    }
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+    void ServerToClientReplicationWindow::GatherCandidates(const AZStd::vector<AzFramework::VisibilityEntry*>& gatheredEntries)
+    {
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
+        const AZ::Vector3 controlledEntityPosition = m_awarenessSphere.GetCenter();
 
         // Add all the neighbours
         for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
         {
+            // The gathered entries may come from a query shared with nearby windows, so reject anything outside our own awareness sphere
+            if (!AZ::ShapeIntersection::Overlaps(m_awarenessSphere, visEntry->m_boundingVolume))
+            {
+                continue;
+            }
+
             AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
             NetworkEntityHandle entityHandle(entity, networkEntityTracker);
             if (entityHandle.GetNetBindComponent() == nullptr)
@@ -163,7 +212,10 @@ namespace Multiplayer
                 
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
+    }
 
+    void ServerToClientReplicationWindow::EndUpdate()
+    {
         // Add in Autonomous Entities
         // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
         m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
@@ -15,12 +15,19 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Sphere.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
+namespace AzFramework
+{
+    struct VisibilityEntry;
+}
+
 namespace Multiplayer
 {
     class NetSystemComponent;
     class NetworkHierarchyRootComponent;
+    class ServerToClientReplicationWindowUpdater;
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
@@ -39,7 +46,17 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        //! Constructs a replication window for the provided connection.
+        //! @param controlledEntity the entity controlled by the connection's player
+        //! @param connection       the connection to replicate to
+        //! @param updater          shared updater to register with, if nullptr the window schedules its own updates
+        ServerToClientReplicationWindow
+        (
+            NetworkEntityHandle controlledEntity,
+            AzNetworking::IConnection* connection,
+            ServerToClientReplicationWindowUpdater* updater = nullptr
+        );
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -54,6 +71,17 @@ namespace Multiplayer
         //! @}
 
     private:
+        friend class ServerToClientReplicationWindowUpdater;
+
+        //! Update phases, UpdateWindow() runs them in order for a single window.
+        //! BeginUpdate and EndUpdate must run on the main thread, GatherCandidates may run concurrently for different windows.
+        //! @{
+        bool BeginUpdate();
+        const AZ::Sphere& GetAwarenessSphere() const;
+        void GatherCandidates(const AZStd::vector<AzFramework::VisibilityEntry*>& gatheredEntries);
+        void EndUpdate();
+        //! @}
+
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
 
@@ -69,6 +97,10 @@ namespace Multiplayer
         ReplicationSet m_replicationSet;
 
         AZ::ScheduledEvent m_updateWindowEvent;
+        ServerToClientReplicationWindowUpdater* m_updater = nullptr;
+
+        // Awareness sphere of the controlled entity, captured by BeginUpdate()
+        AZ::Sphere m_awarenessSphere = AZ::Sphere::CreateUnitSphere();
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
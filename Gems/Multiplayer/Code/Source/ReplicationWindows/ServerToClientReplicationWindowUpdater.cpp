@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ServerToClientReplicationWindowUpdater.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs);
+
+    AZ_CVAR(bool, sv_ParallelReplicationWindowUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Gather replication window candidates in parallel on the task graph when it is active, only used when the entity filter supports concurrent filtering");
+    AZ_CVAR(float, sv_ClientAwarenessQueryCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Size of the grid cells used to share visibility queries between nearby clients, 0 disables sharing");
+
+    uint64_t ServerToClientReplicationWindowUpdater::GetCellKey(const AZ::Vector3& position, float cellSize)
+    {
+        constexpr uint64_t CellCoordinateBits = 21;
+        constexpr uint64_t CellCoordinateMask = (uint64_t{ 1 } << CellCoordinateBits) - 1;
+
+        const AZ::Vector3 cell = (position / cellSize).GetFloor();
+        const uint64_t x = static_cast<uint64_t>(static_cast<int64_t>(cell.GetX())) & CellCoordinateMask;
+        const uint64_t y = static_cast<uint64_t>(static_cast<int64_t>(cell.GetY())) & CellCoordinateMask;
+        const uint64_t z = static_cast<uint64_t>(static_cast<int64_t>(cell.GetZ())) & CellCoordinateMask;
+        return x | (y << CellCoordinateBits) | (z << (CellCoordinateBits * 2));
+    }
+
+    ServerToClientReplicationWindowUpdater::ServerToClientReplicationWindowUpdater()
+        : m_updateWindowsEvent([this]() { UpdateWindows(); }, AZ::Name("Server to client replication window updater event"))
+    {
+        ;
+    }
+
+    ServerToClientReplicationWindowUpdater::~ServerToClientReplicationWindowUpdater()
+    {
+        // Windows that outlive the updater fall back to not being updated rather than referencing a dangling updater
+        for (ServerToClientReplicationWindow* window : m_windows)
+        {
+            window->m_updater = nullptr;
+        }
+    }
+
+    void ServerToClientReplicationWindowUpdater::AddWindow(ServerToClientReplicationWindow* window)
+    {
+        AZ_Assert(AZStd::find(m_windows.begin(), m_windows.end(), window) == m_windows.end(), "Replication window was added twice");
+        m_windows.push_back(window);
+        if (!m_updateWindowsEvent.IsScheduled())
+        {
+            m_updateWindowsEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        }
+    }
+
+    void ServerToClientReplicationWindowUpdater::RemoveWindow(ServerToClientReplicationWindow* window)
+    {
+        auto windowIter = AZStd::find(m_windows.begin(), m_windows.end(), window);
+        if (windowIter != m_windows.end())
+        {
+            // Order doesn't matter, swap with the back to avoid shifting the remaining windows
+            *windowIter = m_windows.back();
+            m_windows.pop_back();
+        }
+
+        if (m_windows.empty())
+        {
+            m_updateWindowsEvent.RemoveFromQueue();
+        }
+    }
+
+    void ServerToClientReplicationWindowUpdater::UpdateWindows()
+    {
+        m_activeWindows.clear();
+        for (ServerToClientReplicationWindow* window : m_windows)
+        {
+            if (window->BeginUpdate())
+            {
+                m_activeWindows.push_back(window);
+            }
+        }
+
+        if (m_activeWindows.empty())
+        {
+            return;
+        }
+
+        BuildGroups();
+
+        AzFramework::IVisibilityScene* visibilityScene = AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene();
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        // Filters are called from the gather tasks, so they have to opt in to being called concurrently
+        IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
+        const bool useTaskGraph = sv_ParallelReplicationWindowUpdates && (m_activeWindows.size() > 1)
+            && ((filterEntityManager == nullptr) || filterEntityManager->SupportsConcurrentFiltering())
+            && (taskGraphActiveInterface != nullptr) && taskGraphActiveInterface->IsTaskGraphActive();
+        if (useTaskGraph)
+        {
+            UpdateGroupsParallel(visibilityScene);
+        }
+        else
+        {
+            UpdateGroupsSerial(visibilityScene);
+        }
+
+        for (ServerToClientReplicationWindow* window : m_activeWindows)
+        {
+            window->EndUpdate();
+        }
+    }
+
+    size_t ServerToClientReplicationWindowUpdater::GetWindowCount() const
+    {
+        return m_windows.size();
+    }
+
+    size_t ServerToClientReplicationWindowUpdater::GetQueryCount() const
+    {
+        return m_activeGroupCount;
+    }
+
+    void ServerToClientReplicationWindowUpdater::BuildGroups()
+    {
+        for (size_t groupIndex = 0; groupIndex < m_activeGroupCount; ++groupIndex)
+        {
+            WindowGroup& group = m_groups[groupIndex];
+            group.m_queryBounds = AZ::Aabb::CreateNull();
+            group.m_windows.clear();
+            group.m_gatheredEntries.clear();
+        }
+        m_cellToGroupIndex.clear();
+        m_activeGroupCount = 0;
+
+        const float cellSize = sv_ClientAwarenessQueryCellSize;
+        for (ServerToClientReplicationWindow* window : m_activeWindows)
+        {
+            const AZ::Sphere& awarenessSphere = window->GetAwarenessSphere();
+
+            size_t groupIndex = m_activeGroupCount;
+            if (cellSize > 0.0f)
+            {
+                groupIndex = m_cellToGroupIndex.emplace(GetCellKey(awarenessSphere.GetCenter(), cellSize), m_activeGroupCount).first->second;
+            }
+
+            if (groupIndex == m_activeGroupCount)
+            {
+                if (m_groups.size() <= groupIndex)
+                {
+                    m_groups.emplace_back();
+                }
+                ++m_activeGroupCount;
+            }
+
+            WindowGroup& group = m_groups[groupIndex];
+            group.m_queryBounds.AddAabb(AZ::Aabb::CreateCenterRadius(awarenessSphere.GetCenter(), awarenessSphere.GetRadius()));
+            group.m_windows.push_back(window);
+        }
+    }
+
+    void ServerToClientReplicationWindowUpdater::UpdateGroupsSerial(AzFramework::IVisibilityScene* visibilityScene)
+    {
+        for (size_t groupIndex = 0; groupIndex < m_activeGroupCount; ++groupIndex)
+        {
+            WindowGroup& group = m_groups[groupIndex];
+            QueryGroup(visibilityScene, group);
+            for (ServerToClientReplicationWindow* window : group.m_windows)
+            {
+                window->GatherCandidates(group.m_gatheredEntries);
+            }
+        }
+    }
+
+    void ServerToClientReplicationWindowUpdater::UpdateGroupsParallel(AzFramework::IVisibilityScene* visibilityScene)
+    {
+        static const AZ::TaskDescriptor queryDescriptor{ "Multiplayer::ReplicationWindowQuery", "Multiplayer" };
+        static const AZ::TaskDescriptor gatherDescriptor{ "Multiplayer::ReplicationWindowGather", "Multiplayer" };
+
+        AZ::TaskGraph taskGraph;
+        for (size_t groupIndex = 0; groupIndex < m_activeGroupCount; ++groupIndex)
+        {
+            WindowGroup& group = m_groups[groupIndex];
+            AZ::TaskToken queryToken = taskGraph.AddTask(queryDescriptor, [visibilityScene, &group]()
+                {
+                    QueryGroup(visibilityScene, group);
+                });
+
+            // Each window only writes to its own candidate queue and replication set, so windows sharing a query gather concurrently
+            for (ServerToClientReplicationWindow* window : group.m_windows)
+            {
+                AZ::TaskToken gatherToken = taskGraph.AddTask(gatherDescriptor, [window, &group]()
+                    {
+                        window->GatherCandidates(group.m_gatheredEntries);
+                    });
+                queryToken.Precedes(gatherToken);
+            }
+        }
+
+        // Blocking the main thread until the gather tasks finish is intended. The windows are also modified from the main thread
+        // by the entity activation callbacks, and EndUpdate and the replication that follows need the complete candidate sets.
+        AZ::TaskGraphEvent finishedEvent;
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+    void ServerToClientReplicationWindowUpdater::QueryGroup(AzFramework::IVisibilityScene* visibilityScene, WindowGroup& group)
+    {
+        auto gatherEntries = [&group](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            group.m_gatheredEntries.reserve(group.m_gatheredEntries.size() + nodeData.m_entries.size());
+            for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+            {
+                if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                {
+                    group.m_gatheredEntries.push_back(visEntry);
+                }
+            }
+        };
+
+        if (group.m_windows.size() == 1)
+        {
+            // A lone window can use its exact awareness sphere rather than the enclosing box
+            visibilityScene->Enumerate(group.m_windows.front()->GetAwarenessSphere(), gatherEntries);
+        }
+        else
+        {
+            visibilityScene->Enumerate(group.m_queryBounds, gatherEntries);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzFramework
+{
+    class IVisibilityScene;
+    struct VisibilityEntry;
+}
+
+namespace Multiplayer
+{
+    class ServerToClientReplicationWindow;
+
+    //! Updates all server to client replication windows together instead of each window scheduling its own update.
+    //! Windows whose controlled entities are close to each other share a single visibility scene query. When
+    //! sv_ParallelReplicationWindowUpdates is enabled, the task graph is active and the entity filter, if any, supports
+    //! concurrent filtering, the per-window candidate gathering runs in parallel.
+    class ServerToClientReplicationWindowUpdater
+    {
+    public:
+        ServerToClientReplicationWindowUpdater();
+        ~ServerToClientReplicationWindowUpdater();
+
+        //! Adds a window to the set of windows updated by this updater.
+        //! @param window the window to add, must remain valid until RemoveWindow is called
+        void AddWindow(ServerToClientReplicationWindow* window);
+
+        //! Removes a window previously added with AddWindow.
+        //! @param window the window to remove
+        void RemoveWindow(ServerToClientReplicationWindow* window);
+
+        //! Updates every registered window, this is invoked automatically every sv_ClientReplicationWindowUpdateMs.
+        void UpdateWindows();
+
+        //! Returns the number of windows registered with this updater.
+        //! @return the number of registered windows
+        size_t GetWindowCount() const;
+
+        //! Returns the number of visibility scene queries run by the last update, one per group of windows sharing a query.
+        //! @return the number of queries of the last update
+        size_t GetQueryCount() const;
+
+        //! Returns a key identifying the grid cell containing the given position, windows in the same cell share a query.
+        //! @param position   the position to get the cell of
+        //! @param cellSize   the size of the grid cells, must be greater than 0
+        //! @return the key of the cell containing the position
+        static uint64_t GetCellKey(const AZ::Vector3& position, float cellSize);
+
+    private:
+        //! A set of windows whose awareness spheres are covered by one visibility scene query.
+        struct WindowGroup
+        {
+            AZ::Aabb m_queryBounds = AZ::Aabb::CreateNull();
+            AZStd::vector<ServerToClientReplicationWindow*> m_windows;
+            AZStd::vector<AzFramework::VisibilityEntry*> m_gatheredEntries;
+        };
+
+        void BuildGroups();
+        void UpdateGroupsSerial(AzFramework::IVisibilityScene* visibilityScene);
+        void UpdateGroupsParallel(AzFramework::IVisibilityScene* visibilityScene);
+
+        static void QueryGroup(AzFramework::IVisibilityScene* visibilityScene, WindowGroup& group);
+
+        AZStd::vector<ServerToClientReplicationWindow*> m_windows;
+
+        // Retained between updates so the containers keep their reserved memory
+        AZStd::vector<ServerToClientReplicationWindow*> m_activeWindows;
+        AZStd::vector<WindowGroup> m_groups;
+        AZStd::unordered_map<uint64_t, size_t> m_cellToGroupIndex;
+        size_t m_activeGroupCount = 0;
+
+        AZ::ScheduledEvent m_updateWindowsEvent;
+    };
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindowUpdater.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#include <random>
+
+namespace Multiplayer
+{
+    class BenchmarkTaskGraphActive : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    /*
+     * A server with range(0) client connections and range(1) networked entities.
+     * Players are spread around a handful of hotspots, the way players tend to gather in a level, while the other entities
+     * are spread uniformly over the whole world.
+     */
+    class ServerReplicationWindowBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        static constexpr float WorldExtents = 2000.0f;
+        static constexpr float HotspotExtents = 150.0f;
+        static constexpr uint32_t HotspotCount = 8;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp();
+            CreateServer(aznumeric_cast<uint32_t>(state.range(0)), aznumeric_cast<uint32_t>(state.range(1)));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp();
+            CreateServer(aznumeric_cast<uint32_t>(state.range(0)), aznumeric_cast<uint32_t>(state.range(1)));
+        }
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+            AZ::TaskExecutor::SetInstance(m_taskExecutor.get());
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+
+            m_updater = AZStd::make_unique<ServerToClientReplicationWindowUpdater>();
+        }
+
+        void internalTearDown() override
+        {
+            m_windows.clear();
+            m_connections.clear();
+            m_updater.reset();
+
+            AzFramework::IVisibilityScene* visibilityScene = m_octreeSystemComponent->GetDefaultVisibilityScene();
+            for (AzFramework::VisibilityEntry& visibilityEntry : m_visibilityEntries)
+            {
+                visibilityScene->RemoveEntry(visibilityEntry);
+            }
+            m_visibilityEntries.clear();
+            m_entities.clear();
+            m_octreeSystemComponent.reset();
+
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            m_taskExecutor.reset();
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        void CreateServer(uint32_t connectionCount, uint32_t entityCount)
+        {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> world(-WorldExtents, WorldExtents);
+            std::uniform_real_distribution<float> hotspot(-HotspotExtents, HotspotExtents);
+
+            AZStd::vector<AZ::Vector3> hotspots;
+            for (uint32_t i = 0; i < HotspotCount; ++i)
+            {
+                hotspots.push_back(AZ::Vector3(world(rng), world(rng), 0.0f));
+            }
+
+            // Players come first so their entity ids match their connection ids
+            const uint32_t totalEntityCount = connectionCount + entityCount;
+            m_entities.reserve(totalEntityCount);
+            m_visibilityEntries.resize(totalEntityCount);
+            for (uint32_t i = 0; i < totalEntityCount; ++i)
+            {
+                const bool isPlayer = i < connectionCount;
+                const AZ::Vector3 position = isPlayer
+                    ? hotspots[i % HotspotCount] + AZ::Vector3(hotspot(rng), hotspot(rng), 0.0f)
+                    : AZ::Vector3(world(rng), world(rng), 0.0f);
+
+                m_entities.push_back(AZStd::make_unique<EntityInfo>(i + 1, "entity", NetEntityId{ i + 1 }, EntityInfo::Role::None));
+                CreateParent(*m_entities.back());
+                m_entities.back()->m_entity->GetTransform()->SetWorldTranslation(position);
+
+                AzFramework::VisibilityEntry& visibilityEntry = m_visibilityEntries[i];
+                visibilityEntry.m_boundingVolume = AZ::Aabb::CreateCenterRadius(position, 1.0f);
+                visibilityEntry.m_userData = m_entities.back()->m_entity.get();
+                visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_Entity;
+                m_octreeSystemComponent->GetDefaultVisibilityScene()->InsertOrUpdateEntry(visibilityEntry);
+            }
+
+            for (uint32_t i = 0; i < connectionCount; ++i)
+            {
+                const IpAddress address("localhost", aznumeric_cast<uint16_t>(i + 1), ProtocolType::Udp);
+                m_connections.push_back(AZStd::make_unique<BenchmarkMultiplayerConnection>(ConnectionId{ i + 1 }, address, ConnectionRole::Acceptor));
+
+                const NetworkEntityHandle controlledEntity(m_entities[i]->m_entity.get(), m_NetworkEntityManager->GetNetworkEntityTracker());
+                m_windows.push_back(AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, m_connections.back().get(), m_updater.get()));
+            }
+        }
+
+        BenchmarkTaskGraphActive m_taskGraphActive;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        AZStd::unique_ptr<ServerToClientReplicationWindowUpdater> m_updater;
+
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entities;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visibilityEntries;
+        AZStd::vector<AZStd::unique_ptr<BenchmarkMultiplayerConnection>> m_connections;
+        AZStd::vector<AZStd::unique_ptr<ServerToClientReplicationWindow>> m_windows;
+    };
+
+    // Every window runs its own query and gathers its own candidates, this is how windows updated before they were batched
+    BENCHMARK_DEFINE_F(ServerReplicationWindowBenchmark, UpdateWindowsIndividually)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (AZStd::unique_ptr<ServerToClientReplicationWindow>& window : m_windows)
+            {
+                window->UpdateWindow();
+            }
+        }
+    }
+
+    BENCHMARK_DEFINE_F(ServerReplicationWindowBenchmark, UpdateWindowsSharedQueries)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            m_updater->UpdateWindows();
+        }
+    }
+
+    BENCHMARK_DEFINE_F(ServerReplicationWindowBenchmark, UpdateWindowsSharedQueriesParallel)(benchmark::State& state)
+    {
+        m_console->PerformCommand("sv_ParallelReplicationWindowUpdates true");
+        for ([[maybe_unused]] auto value : state)
+        {
+            m_updater->UpdateWindows();
+        }
+        m_console->PerformCommand("sv_ParallelReplicationWindowUpdates false");
+    }
+
+    BENCHMARK_REGISTER_F(ServerReplicationWindowBenchmark, UpdateWindowsIndividually)
+        ->Ranges({ { 16, 256 }, { 1024, 16384 } })
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ServerReplicationWindowBenchmark, UpdateWindowsSharedQueries)
+        ->Ranges({ { 16, 256 }, { 1024, 16384 } })
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    BENCHMARK_REGISTER_F(ServerReplicationWindowBenchmark, UpdateWindowsSharedQueriesParallel)
+        ->Ranges({ { 16, 256 }, { 1024, 16384 } })
+        ->Unit(benchmark::kMillisecond)
+        ;
+}
+
+#endif
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindowUpdater.h>
+#include <AzCore/std/containers/set.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    class TestTaskGraphActive : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    //! Filters nothing, and records the threads it was called from.
+    class ThreadRecordingFilterEntityManager : public IFilterEntityManager
+    {
+    public:
+        explicit ThreadRecordingFilterEntityManager(bool supportsConcurrentFiltering)
+            : m_supportsConcurrentFiltering(supportsConcurrentFiltering)
+        {
+        }
+
+        bool IsEntityFiltered([[maybe_unused]] AZ::Entity* entity, [[maybe_unused]] ConstNetworkEntityHandle controllerEntity,
+            [[maybe_unused]] AzNetworking::ConnectionId connectionId) override
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_callingThreads.insert(AZStd::this_thread::get_id());
+            return false;
+        }
+
+        bool SupportsConcurrentFiltering() const override
+        {
+            return m_supportsConcurrentFiltering;
+        }
+
+        AZStd::mutex m_mutex;
+        AZStd::set<AZStd::thread_id> m_callingThreads;
+        bool m_supportsConcurrentFiltering;
+    };
+
+    /*
+     * Players around two spots far apart, with the other networked entities spread around the same spots.
+     */
+    class ServerReplicationWindowUpdaterTests : public HierarchyTests
+    {
+    public:
+        static constexpr uint32_t PlayersPerSpot = 3;
+        static constexpr uint32_t EntitiesPerSpot = 20;
+
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            m_octreeSystemComponent = AZStd::make_unique<AzFramework::OctreeSystemComponent>();
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+            AZ::TaskExecutor::SetInstance(m_taskExecutor.get());
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+
+            m_updater = AZStd::make_unique<ServerToClientReplicationWindowUpdater>();
+
+            const AZ::Vector3 spots[] = { AZ::Vector3(10.0f, 10.0f, 0.0f), AZ::Vector3(5000.0f, -5000.0f, 0.0f) };
+            uint32_t entityCount = 0;
+            for (const AZ::Vector3& spot : spots)
+            {
+                for (uint32_t i = 0; i < PlayersPerSpot; ++i)
+                {
+                    m_playerEntityIndices.push_back(entityCount++);
+                    CreateNetworkedEntity(spot + AZ::Vector3(aznumeric_cast<float>(i) * 7.0f, 3.0f, 0.0f));
+                }
+                for (uint32_t i = 0; i < EntitiesPerSpot; ++i)
+                {
+                    ++entityCount;
+                    CreateNetworkedEntity(spot + AZ::Vector3(aznumeric_cast<float>(i) * 29.0f - 250.0f, aznumeric_cast<float>(i % 5) * 41.0f, 0.0f));
+                }
+            }
+
+            // The scene keeps pointers to the entries, so they are only inserted once all of them exist
+            for (AzFramework::VisibilityEntry& visibilityEntry : m_visibilityEntries)
+            {
+                m_octreeSystemComponent->GetDefaultVisibilityScene()->InsertOrUpdateEntry(visibilityEntry);
+            }
+
+            for (uint32_t playerIndex = 0; playerIndex < m_playerEntityIndices.size(); ++playerIndex)
+            {
+                const IpAddress address("localhost", aznumeric_cast<uint16_t>(playerIndex + 1), ProtocolType::Udp);
+                m_connections.push_back(AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(ConnectionId{ playerIndex + 1 }, address, ConnectionRole::Acceptor));
+
+                const NetworkEntityHandle controlledEntity(m_entityInfos[m_playerEntityIndices[playerIndex]]->m_entity.get(), m_networkEntityTracker.get());
+                m_windows.push_back(AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, m_connections.back().get(), m_updater.get()));
+            }
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand("sv_ParallelReplicationWindowUpdates false");
+            m_console->PerformCommand("sv_ClientAwarenessQueryCellSize 100");
+
+            m_windows.clear();
+            m_connections.clear();
+            m_updater.reset();
+
+            AzFramework::IVisibilityScene* visibilityScene = m_octreeSystemComponent->GetDefaultVisibilityScene();
+            for (AzFramework::VisibilityEntry& visibilityEntry : m_visibilityEntries)
+            {
+                visibilityScene->RemoveEntry(visibilityEntry);
+            }
+            m_visibilityEntries.clear();
+            m_entityInfos.clear();
+            m_octreeSystemComponent.reset();
+
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            m_taskExecutor.reset();
+
+            HierarchyTests::TearDown();
+        }
+
+        void CreateNetworkedEntity(const AZ::Vector3& position)
+        {
+            const uint32_t index = aznumeric_cast<uint32_t>(m_entityInfos.size());
+            m_entityInfos.push_back(AZStd::make_unique<EntityInfo>(index + 1, "entity", NetEntityId{ index + 1 }, EntityInfo::Role::None));
+            EntityInfo& entityInfo = *m_entityInfos.back();
+
+            PopulateHierarchicalEntity(entityInfo);
+            SetupEntity(entityInfo.m_entity, entityInfo.m_netId, NetEntityRole::Authority);
+            const NetworkEntityHandle entityHandle(entityInfo.m_entity.get(), m_networkEntityTracker.get());
+            entityInfo.m_replicator = AZStd::make_unique<EntityReplicator>(*m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Client, entityHandle);
+            entityInfo.m_replicator->Initialize(entityHandle);
+            entityInfo.m_entity->Activate();
+            entityInfo.m_entity->GetTransform()->SetWorldTranslation(position);
+
+            AzFramework::VisibilityEntry visibilityEntry;
+            visibilityEntry.m_boundingVolume = AZ::Aabb::CreateCenterRadius(position, 1.0f);
+            visibilityEntry.m_userData = entityInfo.m_entity.get();
+            visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_Entity;
+            m_visibilityEntries.push_back(visibilityEntry);
+        }
+
+        AZStd::vector<ReplicationSet> GetReplicationSets() const
+        {
+            AZStd::vector<ReplicationSet> replicationSets;
+            for (const AZStd::unique_ptr<ServerToClientReplicationWindow>& window : m_windows)
+            {
+                replicationSets.push_back(window->GetReplicationSet());
+            }
+            return replicationSets;
+        }
+
+        static void ExpectEqualReplicationSets(const AZStd::vector<ReplicationSet>& expected, const AZStd::vector<ReplicationSet>& actual)
+        {
+            ASSERT_EQ(expected.size(), actual.size());
+            for (size_t windowIndex = 0; windowIndex < expected.size(); ++windowIndex)
+            {
+                ASSERT_EQ(expected[windowIndex].size(), actual[windowIndex].size());
+                auto actualIter = actual[windowIndex].begin();
+                for (const auto& [entityHandle, replicationData] : expected[windowIndex])
+                {
+                    EXPECT_EQ(entityHandle, actualIter->first);
+                    EXPECT_EQ(replicationData.m_netEntityRole, actualIter->second.m_netEntityRole);
+                    EXPECT_EQ(replicationData.m_priority, actualIter->second.m_priority);
+                    ++actualIter;
+                }
+            }
+        }
+
+        TestTaskGraphActive m_taskGraphActive;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        AZStd::unique_ptr<AzFramework::OctreeSystemComponent> m_octreeSystemComponent;
+        AZStd::unique_ptr<ServerToClientReplicationWindowUpdater> m_updater;
+
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+        AZStd::vector<uint32_t> m_playerEntityIndices;
+        AZStd::vector<AzFramework::VisibilityEntry> m_visibilityEntries;
+        AZStd::vector<AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>>> m_connections;
+        AZStd::vector<AZStd::unique_ptr<ServerToClientReplicationWindow>> m_windows;
+    };
+
+    TEST_F(ServerReplicationWindowUpdaterTests, GetCellKey_PositionsInTheSameCell_ShareTheKey)
+    {
+        EXPECT_EQ(ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(1.0f, 2.0f, 3.0f), 100.0f),
+            ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(99.0f, 50.0f, 0.0f), 100.0f));
+        EXPECT_EQ(ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(-1.0f, -2.0f, -3.0f), 100.0f),
+            ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(-99.0f, -50.0f, -0.5f), 100.0f));
+    }
+
+    TEST_F(ServerReplicationWindowUpdaterTests, GetCellKey_PositionsInDifferentCells_HaveDifferentKeys)
+    {
+        const uint64_t originKey = ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(1.0f, 1.0f, 1.0f), 100.0f);
+
+        // Each axis, on both sides of the origin, which would collide if negative cells were not told apart
+        EXPECT_NE(originKey, ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(101.0f, 1.0f, 1.0f), 100.0f));
+        EXPECT_NE(originKey, ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(1.0f, 101.0f, 1.0f), 100.0f));
+        EXPECT_NE(originKey, ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(1.0f, 1.0f, 101.0f), 100.0f));
+        EXPECT_NE(originKey, ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(-1.0f, 1.0f, 1.0f), 100.0f));
+        EXPECT_NE(originKey, ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(1.0f, -1.0f, 1.0f), 100.0f));
+        EXPECT_NE(originKey, ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(1.0f, 1.0f, -1.0f), 100.0f));
+
+        // The same coordinates on different axes
+        EXPECT_NE(ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(250.0f, 0.0f, 0.0f), 100.0f),
+            ServerToClientReplicationWindowUpdater::GetCellKey(AZ::Vector3(0.0f, 250.0f, 0.0f), 100.0f));
+    }
+
+    TEST_F(ServerReplicationWindowUpdaterTests, UpdateWindows_PlayersInTheSameCell_ShareAQuery)
+    {
+        ASSERT_EQ(2 * PlayersPerSpot, m_updater->GetWindowCount());
+
+        m_updater->UpdateWindows();
+        EXPECT_EQ(2u, m_updater->GetQueryCount());
+
+        m_console->PerformCommand("sv_ClientAwarenessQueryCellSize 0");
+        m_updater->UpdateWindows();
+        EXPECT_EQ(m_windows.size(), m_updater->GetQueryCount());
+    }
+
+    TEST_F(ServerReplicationWindowUpdaterTests, UpdateWindows_SharedQueries_MatchIndividualUpdates)
+    {
+        for (AZStd::unique_ptr<ServerToClientReplicationWindow>& window : m_windows)
+        {
+            window->UpdateWindow();
+        }
+        const AZStd::vector<ReplicationSet> individualSets = GetReplicationSets();
+
+        // Each window sees the other players at its spot and the entities around it, but nothing from the other spot
+        for (const ReplicationSet& replicationSet : individualSets)
+        {
+            EXPECT_GT(replicationSet.size(), PlayersPerSpot);
+            EXPECT_LE(replicationSet.size(), PlayersPerSpot + EntitiesPerSpot);
+        }
+
+        m_updater->UpdateWindows();
+        ExpectEqualReplicationSets(individualSets, GetReplicationSets());
+    }
+
+    TEST_F(ServerReplicationWindowUpdaterTests, UpdateWindows_Parallel_MatchesSerial)
+    {
+        m_updater->UpdateWindows();
+        const AZStd::vector<ReplicationSet> serialSets = GetReplicationSets();
+
+        m_console->PerformCommand("sv_ParallelReplicationWindowUpdates true");
+        m_updater->UpdateWindows();
+        ExpectEqualReplicationSets(serialSets, GetReplicationSets());
+    }
+
+    TEST_F(ServerReplicationWindowUpdaterTests, UpdateWindows_FilterWithoutConcurrentSupport_IsOnlyCalledFromTheMainThread)
+    {
+        ThreadRecordingFilterEntityManager filter(false);
+        ON_CALL(*m_mockMultiplayer, GetFilterEntityManager()).WillByDefault(Return(&filter));
+
+        m_updater->UpdateWindows();
+        const AZStd::vector<ReplicationSet> serialSets = GetReplicationSets();
+
+        m_console->PerformCommand("sv_ParallelReplicationWindowUpdates true");
+        m_updater->UpdateWindows();
+        ExpectEqualReplicationSets(serialSets, GetReplicationSets());
+
+        ASSERT_EQ(1u, filter.m_callingThreads.size());
+        EXPECT_EQ(AZStd::this_thread::get_id(), *filter.m_callingThreads.begin());
+    }
+
+    TEST_F(ServerReplicationWindowUpdaterTests, UpdateWindows_FilterWithConcurrentSupport_MatchesSerial)
+    {
+        ThreadRecordingFilterEntityManager filter(true);
+        ON_CALL(*m_mockMultiplayer, GetFilterEntityManager()).WillByDefault(Return(&filter));
+
+        m_updater->UpdateWindows();
+        const AZStd::vector<ReplicationSet> serialSets = GetReplicationSets();
+
+        m_console->PerformCommand("sv_ParallelReplicationWindowUpdates true");
+        m_updater->UpdateWindows();
+        ExpectEqualReplicationSets(serialSets, GetReplicationSets());
+    }
+}
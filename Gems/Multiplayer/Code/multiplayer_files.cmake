@@ -132,4 +132,6 @@ set(FILES
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
+    Source/ReplicationWindows/ServerToClientReplicationWindowUpdater.cpp
+    Source/ReplicationWindows/ServerToClientReplicationWindowUpdater.h
 )
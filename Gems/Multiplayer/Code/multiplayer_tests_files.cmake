@@ -15,6 +15,8 @@ set(FILES
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
+    Tests/ServerReplicationWindowBenchmarks.cpp
+    Tests/ServerReplicationWindowUpdaterTests.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonBenchmarkSetup.h
     Tests/IMultiplayerConnectionMock.h
@@ -74,6 +74,15 @@ namespace Profiler
 
         virtual bool IsContinuousCaptureInProgress() const = 0;
 
+        //! Begin streaming the regions of all threads to a binary trace file, see CpuTraceCapture.
+        //! Unlike the continuous capture, the regions aren't kept in memory, so the trace capture can run for hours.
+        [[nodiscard]] virtual bool BeginTraceCapture(const char* traceFilePath) = 0;
+
+        //! Write the remaining regions and close the trace file.
+        virtual bool EndTraceCapture() = 0;
+
+        virtual bool IsTraceCaptureInProgress() const = 0;
+
         //! Enable/Disable the CpuProfiler
         virtual void SetProfilerEnabled(bool enabled) = 0;
 
@@ -82,6 +82,8 @@ namespace Profiler
         AZ::Interface<CpuProfiler>::Unregister(this);
         AZ::Interface<AZ::Debug::Profiler>::Unregister(this);
 
+        EndTraceCapture();
+
         // Wait for the remaining threads that might still be processing its profiling calls
         AZStd::unique_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
 
@@ -101,6 +103,16 @@ namespace Profiler
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
+            if (m_traceCapture.IsRecording())
+            {
+                // Checked again under the lock, EndTraceCapture waits for the threads that got past this check
+                AZStd::shared_lock<AZStd::shared_mutex> traceRecordingLock(m_traceRecordingMutex);
+                if (m_traceCapture.IsRecording())
+                {
+                    m_traceCapture.RecordBegin(budget->Name(), eventName);
+                }
+            }
+
             if (m_enabled)
             {
                 // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
@@ -120,6 +132,15 @@ namespace Profiler
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
+            if (m_traceCapture.IsRecording())
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> traceRecordingLock(m_traceRecordingMutex);
+                if (m_traceCapture.IsRecording())
+                {
+                    m_traceCapture.RecordEnd();
+                }
+            }
+
             // guard against enabling mid-marker
             if (m_enabled && ms_threadLocalStorage != nullptr)
             {
@@ -177,6 +198,34 @@ namespace Profiler
         return m_continuousCaptureInProgress.load();
     }
 
+    bool CpuProfilerImpl::BeginTraceCapture(const char* traceFilePath)
+    {
+        AZStd::scoped_lock lock(m_traceCaptureMutex);
+        return m_initialized && m_traceCapture.Begin(traceFilePath);
+    }
+
+    bool CpuProfilerImpl::EndTraceCapture()
+    {
+        AZStd::scoped_lock lock(m_traceCaptureMutex);
+        if (!m_traceCapture.IsInProgress())
+        {
+            return false;
+        }
+
+        m_traceCapture.StopRecording();
+        {
+            // Wait for the threads that are still recording a region into their trace buffers, the ones that lock after this
+            // see that the capture stopped recording
+            AZStd::unique_lock<AZStd::shared_mutex> traceRecordingLock(m_traceRecordingMutex);
+        }
+        return m_traceCapture.End();
+    }
+
+    bool CpuProfilerImpl::IsTraceCaptureInProgress() const
+    {
+        return m_traceCapture.IsInProgress();
+    }
+
     void CpuProfilerImpl::SetProfilerEnabled(bool enabled)
     {
         AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
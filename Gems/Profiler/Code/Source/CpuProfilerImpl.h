@@ -8,6 +8,7 @@
 #pragma once
 
 #include <CpuProfiler.h>
+#include <CpuTraceCapture.h>
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -119,6 +120,9 @@ namespace Profiler
         bool BeginContinuousCapture() final override;
         bool EndContinuousCapture(AZStd::ring_buffer<TimeRegionMap>& flushTarget) final override;
         bool IsContinuousCaptureInProgress() const final override;
+        bool BeginTraceCapture(const char* traceFilePath) final override;
+        bool EndTraceCapture() final override;
+        bool IsTraceCaptureInProgress() const final override;
         void SetProfilerEnabled(bool enabled) final override;
         bool IsProfilerEnabled() const final override;
 
@@ -155,6 +159,14 @@ namespace Profiler
         // Stores multiple frames of profiling data, size is controlled by MaxFramesToSave. Flushed when EndContinuousCapture is called.
         // Ring buffer so that we can have fast append of new data + removal of old profiling data with good cache locality.
         AZStd::ring_buffer<TimeRegionMap> m_continuousCaptureData;
+
+        // Serializes beginning and ending the trace capture
+        AZStd::mutex m_traceCaptureMutex;
+        // Only guards the calls into the trace capture, so ending a capture waits for the threads that are recording into it
+        // without affecting the regular profiler regions
+        AZStd::shared_mutex m_traceRecordingMutex;
+
+        CpuTraceCapture m_traceCapture;
     };
 
     // Intermediate class to serialize Cpu TimedRegion data.
@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuTraceCapture.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/time.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+
+namespace Profiler
+{
+    thread_local CpuTraceThreadBuffer* CpuTraceCapture::ms_threadBuffer = nullptr;
+    thread_local AZ::u32 CpuTraceCapture::ms_threadCaptureId = 0;
+    CpuTraceCapture* CpuTraceCapture::ms_activeCaptures = nullptr;
+
+    // Tells the capture of a thread that the thread exited, see CpuTraceCapture::OnThreadExit
+    struct CpuTraceThreadExit
+    {
+        ~CpuTraceThreadExit()
+        {
+            if (m_isRegistered)
+            {
+                CpuTraceCapture::OnThreadExit();
+            }
+        }
+
+        static AZStd::mutex& GetMutex()
+        {
+            // Never destroyed, threads can exit and captures can end during static destruction
+            static AZStd::aligned_storage<sizeof(AZStd::mutex), alignof(AZStd::mutex)>::type s_mutexStorage;
+            static AZStd::mutex* s_mutex = new (&s_mutexStorage) AZStd::mutex();
+            return *s_mutex;
+        }
+
+        bool m_isRegistered = false;
+    };
+
+    static thread_local CpuTraceThreadExit s_cpuTraceThreadExit;
+
+    namespace
+    {
+        // Shared by all profiler instances, since the thread local buffer pointers are.
+        AZStd::atomic<AZ::u32> s_lastCaptureId{ 0 };
+
+        template<class T, class Allocator>
+        void AppendBytes(AZStd::vector<char, Allocator>& buffer, const T& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<class Allocator>
+        void AppendRecordHeader(AZStd::vector<char, Allocator>& buffer, CpuTrace::RecordType type, size_t size)
+        {
+            AppendBytes(buffer, CpuTrace::RecordHeader{ type, aznumeric_cast<AZ::u32>(size) });
+        }
+
+        void AppendJsonString(AZStd::string& json, const char* text, size_t length)
+        {
+            json.push_back('"');
+            for (size_t i = 0; i < length; ++i)
+            {
+                const char c = text[i];
+                if (c == '"' || c == '\\')
+                {
+                    json.push_back('\\');
+                    json.push_back(c);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    json.append(AZStd::string::format("\\u%04x", c));
+                }
+                else
+                {
+                    json.push_back(c);
+                }
+            }
+            json.push_back('"');
+        }
+
+        class ChromeTraceWriter
+        {
+        public:
+            // Written to the file whenever the buffered JSON grows past this size.
+            static constexpr size_t FlushSize = 1024 * 1024;
+
+            bool Open(const char* jsonFilePath)
+            {
+                if (!m_file.Open(jsonFilePath,
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    return false;
+                }
+                m_json.reserve(FlushSize + 4096);
+                m_json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+                return true;
+            }
+
+            bool Close()
+            {
+                m_json.append("\n]}\n");
+                const bool succeeded = Flush();
+                m_file.Close();
+                return succeeded;
+            }
+
+            //! Starts a new event and returns the buffer to append its content to.
+            AZStd::string& BeginEvent()
+            {
+                m_json.append(m_isFirstEvent ? "\n{" : ",\n{");
+                m_isFirstEvent = false;
+                return m_json;
+            }
+
+            bool EndEvent()
+            {
+                m_json.push_back('}');
+                return m_json.size() < FlushSize || Flush();
+            }
+
+        private:
+            bool Flush()
+            {
+                const bool succeeded = m_file.Write(m_json.data(), m_json.size()) == m_json.size();
+                m_json.clear();
+                return succeeded;
+            }
+
+            AZ::IO::SystemFile m_file;
+            AZStd::string m_json;
+            bool m_isFirstEvent = true;
+        };
+    } // namespace
+
+    // --- CpuTrace ---
+
+    bool CpuTrace::ConvertToChromeTrace(const char* traceFilePath, const char* jsonFilePath)
+    {
+        AZ::IO::SystemFile traceFile;
+        if (!traceFile.Open(traceFilePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to open trace file '%s'", traceFilePath);
+            return false;
+        }
+
+        FileHeader header;
+        if (traceFile.Read(sizeof(header), &header) != sizeof(header) || header.m_magic != Magic)
+        {
+            AZ_Warning("Profiler", false, "'%s' isn't a trace file", traceFilePath);
+            return false;
+        }
+        if (header.m_version != Version)
+        {
+            AZ_Warning("Profiler", false, "Trace file '%s' has version %u, only version %u is supported", traceFilePath, header.m_version, Version);
+            return false;
+        }
+
+        ChromeTraceWriter writer;
+        if (!writer.Open(jsonFilePath))
+        {
+            AZ_Warning("Profiler", false, "Failed to open '%s' for writing", jsonFilePath);
+            return false;
+        }
+
+        // The name and category of every region, already formatted as JSON members
+        AZStd::unordered_map<AZ::u32, AZStd::string> regionMembers;
+        // The open regions of every thread and whether their begin event was written, to skip the end events that don't match one
+        AZStd::unordered_map<AZ::u32, AZStd::vector<bool>> threadOpenRegions;
+        AZStd::vector<char> record;
+        char eventMembers[128];
+        const double microsecondsPerTick = 1000000.0 / aznumeric_cast<double>(header.m_ticksPerSecond);
+        AZ::u64 unknownRegionCount = 0;
+        bool succeeded = true;
+
+        auto reportCorruption = [traceFilePath, &succeeded]()
+        {
+            AZ_Warning("Profiler", false, "Trace file '%s' is corrupted", traceFilePath);
+            succeeded = false;
+        };
+
+        RecordHeader recordHeader;
+        while (succeeded && traceFile.Read(sizeof(recordHeader), &recordHeader) == sizeof(recordHeader))
+        {
+            record.resize_no_construct(recordHeader.m_size);
+            if (traceFile.Read(recordHeader.m_size, record.data()) != recordHeader.m_size)
+            {
+                // The capture didn't finish writing this record, keep what was converted so far
+                AZ_Warning("Profiler", false, "Trace file '%s' is truncated", traceFilePath);
+                break;
+            }
+
+            switch (recordHeader.m_type)
+            {
+            case RecordType::Region:
+            {
+                RegionRecord region;
+                if (record.size() < sizeof(region))
+                {
+                    reportCorruption();
+                    break;
+                }
+                memcpy(&region, record.data(), sizeof(region));
+                if (record.size() < sizeof(region) + aznumeric_cast<size_t>(region.m_groupNameLength) + region.m_regionNameLength)
+                {
+                    reportCorruption();
+                    break;
+                }
+                const char* names = record.data() + sizeof(region);
+                AZStd::string& members = regionMembers[region.m_regionId];
+                members = "\"name\":";
+                AppendJsonString(members, names + region.m_groupNameLength, region.m_regionNameLength);
+                members.append(",\"cat\":");
+                AppendJsonString(members, names, region.m_groupNameLength);
+                break;
+            }
+            case RecordType::Thread:
+            {
+                ThreadRecord thread;
+                if (record.size() < sizeof(thread))
+                {
+                    reportCorruption();
+                    break;
+                }
+                memcpy(&thread, record.data(), sizeof(thread));
+                threadOpenRegions[thread.m_threadIndex].clear();
+                writer.BeginEvent().append(AZStd::string::format(
+                    "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Thread %llu\"}",
+                    thread.m_threadIndex, static_cast<unsigned long long>(thread.m_threadId)));
+                succeeded = writer.EndEvent();
+                break;
+            }
+            case RecordType::Events:
+            {
+                EventsRecord events;
+                if (record.size() < sizeof(events))
+                {
+                    reportCorruption();
+                    break;
+                }
+                memcpy(&events, record.data(), sizeof(events));
+                if (record.size() < sizeof(events) + aznumeric_cast<size_t>(events.m_eventCount) * sizeof(Event))
+                {
+                    reportCorruption();
+                    break;
+                }
+                AZStd::vector<bool>& openRegions = threadOpenRegions[events.m_threadIndex];
+                for (AZ::u32 i = 0; i < events.m_eventCount && succeeded; ++i)
+                {
+                    Event event;
+                    memcpy(&event, record.data() + sizeof(events) + i * sizeof(Event), sizeof(event));
+                    const double timestamp = aznumeric_cast<double>(event.m_tick - header.m_startTick) * microsecondsPerTick;
+                    if (event.m_regionId != EndRegionId)
+                    {
+                        // Regions without a region record are skipped together with their end event
+                        auto regionIt = regionMembers.find(event.m_regionId);
+                        openRegions.push_back(regionIt != regionMembers.end());
+                        if (regionIt == regionMembers.end())
+                        {
+                            ++unknownRegionCount;
+                            continue;
+                        }
+                        azsnprintf(eventMembers, sizeof(eventMembers), ",\"ph\":\"B\",\"pid\":0,\"tid\":%u,\"ts\":%.3f", events.m_threadIndex, timestamp);
+                        writer.BeginEvent().append(regionIt->second).append(eventMembers);
+                        succeeded = writer.EndEvent();
+                    }
+                    else if (!openRegions.empty())
+                    {
+                        const bool beginWritten = openRegions.back();
+                        openRegions.pop_back();
+                        if (beginWritten)
+                        {
+                            azsnprintf(eventMembers, sizeof(eventMembers), "\"ph\":\"E\",\"pid\":0,\"tid\":%u,\"ts\":%.3f", events.m_threadIndex, timestamp);
+                            writer.BeginEvent().append(eventMembers);
+                            succeeded = writer.EndEvent();
+                        }
+                    }
+                }
+                break;
+            }
+            default:
+                AZ_Warning("Profiler", false, "Skipping a record of unknown type %u in trace file '%s'", recordHeader.m_type, traceFilePath);
+                break;
+            }
+        }
+
+        AZ_Warning("Profiler", unknownRegionCount == 0, "Skipped %llu regions with an unknown id in trace file '%s'",
+            static_cast<unsigned long long>(unknownRegionCount), traceFilePath);
+        succeeded = writer.Close() && succeeded;
+        AZ_Warning("Profiler", succeeded, "Failed to write the converted trace to '%s'", jsonFilePath);
+        return succeeded;
+    }
+
+    // --- CpuTraceThreadBuffer ---
+
+    CpuTraceThreadBuffer::CpuTraceThreadBuffer(AZ::u32 threadIndex)
+        : m_threadIndex(threadIndex)
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "The capacity of the trace buffers must be a power of two.");
+        m_events.resize_no_construct(Capacity);
+    }
+
+    void CpuTraceThreadBuffer::RecordBegin(AZ::u32 regionId, AZ::u64 tick)
+    {
+        const AZ::u64 writeIndex = m_writeIndex.load(AZStd::memory_order_relaxed);
+        const AZ::u64 freeSlots = Capacity - (writeIndex - m_readIndex.load(AZStd::memory_order_acquire));
+
+        // Once a region is dropped, so are all the regions nested in it
+        if (m_droppedRegionDepth > 0 || freeSlots <= EndEventReserve || m_openRegionCount >= EndEventReserve)
+        {
+            ++m_droppedRegionDepth;
+            m_droppedEventCount.fetch_add(1, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        m_events[writeIndex & (Capacity - 1)] = CpuTrace::Event{ tick, regionId, 0 };
+        m_writeIndex.store(writeIndex + 1, AZStd::memory_order_release);
+        ++m_openRegionCount;
+    }
+
+    void CpuTraceThreadBuffer::RecordEnd(AZ::u64 tick)
+    {
+        if (m_droppedRegionDepth > 0)
+        {
+            --m_droppedRegionDepth;
+            return;
+        }
+
+        // Regions that began before the capture have no begin event in the trace
+        if (m_openRegionCount == 0)
+        {
+            return;
+        }
+
+        // There is always room for the end event, see EndEventReserve
+        const AZ::u64 writeIndex = m_writeIndex.load(AZStd::memory_order_relaxed);
+        m_events[writeIndex & (Capacity - 1)] = CpuTrace::Event{ tick, CpuTrace::EndRegionId, 0 };
+        m_writeIndex.store(writeIndex + 1, AZStd::memory_order_release);
+        --m_openRegionCount;
+    }
+
+    void CpuTraceThreadBuffer::Drain(AZStd::vector<CpuTrace::Event, AZ::OSStdAllocator>& events)
+    {
+        const AZ::u64 readIndex = m_readIndex.load(AZStd::memory_order_relaxed);
+        const AZ::u64 writeIndex = m_writeIndex.load(AZStd::memory_order_acquire);
+
+        // Copy in at most two parts, the second one being the part that wrapped around
+        const AZ::u64 begin = readIndex & (Capacity - 1);
+        const AZ::u64 count = writeIndex - readIndex;
+        const AZ::u64 firstCount = AZStd::min(count, Capacity - begin);
+        events.insert(events.end(), m_events.begin() + begin, m_events.begin() + begin + firstCount);
+        events.insert(events.end(), m_events.begin(), m_events.begin() + (count - firstCount));
+
+        m_readIndex.store(writeIndex, AZStd::memory_order_release);
+    }
+
+    // --- CpuTraceCapture ---
+
+    CpuTraceCapture::~CpuTraceCapture()
+    {
+        if (IsInProgress())
+        {
+            StopRecording();
+            End();
+        }
+    }
+
+    bool CpuTraceCapture::Begin(const char* traceFilePath)
+    {
+        if (IsInProgress())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to start a trace capture while one is already in progress\n");
+            return false;
+        }
+
+        if (!m_file.Open(traceFilePath,
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to open trace capture file '%s'", traceFilePath);
+            return false;
+        }
+
+        const CpuTrace::FileHeader header{ CpuTrace::Magic, CpuTrace::Version,
+            aznumeric_cast<AZ::u64>(AZStd::GetTimeTicksPerSecond()), aznumeric_cast<AZ::u64>(AZStd::GetTimeNowTicks()) };
+        m_writeFailed = m_file.Write(&header, sizeof(header)) != sizeof(header);
+
+        m_captureId = ++s_lastCaptureId;
+        {
+            AZStd::scoped_lock lock(CpuTraceThreadExit::GetMutex());
+            m_nextActiveCapture = ms_activeCaptures;
+            ms_activeCaptures = this;
+        }
+        m_isRecording.store(true, AZStd::memory_order_release);
+        m_writerThread = AZStd::thread(
+            [this]()
+            {
+                WriterThreadMain();
+            });
+
+        AZ_TracePrintf("Profiler", "Trace capture started, writing to '%s'\n", traceFilePath);
+        return true;
+    }
+
+    void CpuTraceCapture::StopRecording()
+    {
+        m_isRecording.store(false, AZStd::memory_order_release);
+    }
+
+    bool CpuTraceCapture::End()
+    {
+        if (!IsInProgress())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to end a trace capture while one is not in progress\n");
+            return false;
+        }
+
+        AZ_Assert(!IsRecording(), "StopRecording must be called before ending the trace capture.");
+        if (m_writerThread.joinable())
+        {
+            m_writerThread.join();
+        }
+        Flush();
+
+        {
+            // Once removed, exiting threads no longer touch the buffers of this capture
+            AZStd::scoped_lock lock(CpuTraceThreadExit::GetMutex());
+            CpuTraceCapture** capture = &ms_activeCaptures;
+            while (*capture != this)
+            {
+                capture = &(*capture)->m_nextActiveCapture;
+            }
+            *capture = m_nextActiveCapture;
+            m_nextActiveCapture = nullptr;
+        }
+
+        AZ::u64 droppedEventCount = m_releasedDroppedEventCount;
+        for (const auto& threadBuffer : m_threadBuffers)
+        {
+            droppedEventCount += threadBuffer->GetDroppedEventCount();
+        }
+        AZ_Warning("Profiler", droppedEventCount == 0,
+            "%llu regions were dropped because the writer thread couldn't keep up with the recording threads.", droppedEventCount);
+
+        const bool succeeded = !m_writeFailed;
+        AZ_TracePrintf("Profiler", "Trace capture ended, %u threads were recorded\n", m_threadCount);
+
+        m_file.Close();
+        m_threadBuffers.clear();
+        m_threadCount = 0;
+        m_releasedDroppedEventCount = 0;
+        m_regionIds.clear();
+        m_pendingRecords.clear();
+        m_eventScratch = {};
+        m_writeScratch = {};
+        return succeeded;
+    }
+
+    void CpuTraceCapture::RecordBegin(const char* groupName, const char* regionName)
+    {
+        if (CpuTraceThreadBuffer* threadBuffer = GetThreadBuffer())
+        {
+            const CachedTimeRegion::GroupRegionName groupRegionName(groupName, regionName);
+            auto regionIt = threadBuffer->m_regionIds.find(groupRegionName);
+            if (regionIt == threadBuffer->m_regionIds.end())
+            {
+                regionIt = threadBuffer->m_regionIds.emplace(groupRegionName, RegisterRegion(groupRegionName)).first;
+            }
+
+            // Take the time last, to avoid recording the overhead
+            threadBuffer->RecordBegin(regionIt->second, AZStd::GetTimeNowTicks());
+        }
+    }
+
+    void CpuTraceCapture::RecordEnd()
+    {
+        const AZ::u64 endTick = AZStd::GetTimeNowTicks();
+        if (CpuTraceThreadBuffer* threadBuffer = GetThreadBuffer())
+        {
+            threadBuffer->RecordEnd(endTick);
+        }
+    }
+
+    CpuTraceThreadBuffer* CpuTraceCapture::GetThreadBuffer()
+    {
+        if (ms_threadCaptureId == m_captureId)
+        {
+            return ms_threadBuffer;
+        }
+
+        // First region of this thread in this capture
+        AZStd::scoped_lock lock(m_registryMutex);
+        const AZ::u32 threadIndex = m_threadCount++;
+        ms_threadBuffer = m_threadBuffers.emplace_back(AZStd::make_unique<CpuTraceThreadBuffer>(threadIndex)).get();
+        ms_threadCaptureId = m_captureId;
+        s_cpuTraceThreadExit.m_isRegistered = true;
+
+        AppendRecordHeader(m_pendingRecords, CpuTrace::RecordType::Thread, sizeof(CpuTrace::ThreadRecord));
+        AppendBytes(m_pendingRecords,
+            CpuTrace::ThreadRecord{ threadIndex, 0, AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id()) });
+        return ms_threadBuffer;
+    }
+
+    void CpuTraceCapture::OnThreadExit()
+    {
+        AZStd::scoped_lock lock(CpuTraceThreadExit::GetMutex());
+        for (CpuTraceCapture* capture = ms_activeCaptures; capture; capture = capture->m_nextActiveCapture)
+        {
+            if (capture->m_captureId == ms_threadCaptureId)
+            {
+                // The buffer stays alive until it is flagged, only Flush releases buffers before the capture ends
+                ms_threadBuffer->MarkThreadExited();
+                break;
+            }
+        }
+    }
+
+    AZ::u32 CpuTraceCapture::RegisterRegion(const CachedTimeRegion::GroupRegionName& groupRegionName)
+    {
+        AZStd::scoped_lock lock(m_registryMutex);
+        auto [regionIt, inserted] = m_regionIds.emplace(groupRegionName, aznumeric_cast<AZ::u32>(m_regionIds.size()));
+        if (inserted)
+        {
+            // The names are copied, the modules owning them may be unloaded before the trace is converted
+            const size_t groupNameLength = strlen(groupRegionName.m_groupName);
+            const size_t regionNameLength = strlen(groupRegionName.m_regionName);
+            AppendRecordHeader(m_pendingRecords, CpuTrace::RecordType::Region,
+                sizeof(CpuTrace::RegionRecord) + groupNameLength + regionNameLength);
+            AppendBytes(m_pendingRecords, CpuTrace::RegionRecord{ regionIt->second,
+                aznumeric_cast<AZ::u32>(groupNameLength), aznumeric_cast<AZ::u32>(regionNameLength), 0 });
+            m_pendingRecords.insert(m_pendingRecords.end(), groupRegionName.m_groupName, groupRegionName.m_groupName + groupNameLength);
+            m_pendingRecords.insert(m_pendingRecords.end(), groupRegionName.m_regionName, groupRegionName.m_regionName + regionNameLength);
+        }
+        return regionIt->second;
+    }
+
+    void CpuTraceCapture::WriterThreadMain()
+    {
+        while (IsRecording())
+        {
+            AZStd::this_thread::sleep_for(FlushInterval);
+            Flush();
+        }
+    }
+
+    void CpuTraceCapture::Flush()
+    {
+        AZStd::vector<CpuTraceThreadBuffer*, AZ::OSStdAllocator> threadBuffers;
+        {
+            AZStd::scoped_lock lock(m_registryMutex);
+            threadBuffers.reserve(m_threadBuffers.size());
+            for (const auto& threadBuffer : m_threadBuffers)
+            {
+                threadBuffers.push_back(threadBuffer.get());
+            }
+        }
+
+        // Drain the events before taking the pending records, so the regions and threads of all drained events are registered
+        m_writeScratch.clear();
+        AZStd::vector<CpuTraceThreadBuffer*, AZ::OSStdAllocator> exitedThreadBuffers;
+        for (CpuTraceThreadBuffer* threadBuffer : threadBuffers)
+        {
+            // Checked before draining, so the events recorded right before the thread exited are part of this drain
+            if (threadBuffer->HasThreadExited())
+            {
+                exitedThreadBuffers.push_back(threadBuffer);
+            }
+
+            m_eventScratch.clear();
+            threadBuffer->Drain(m_eventScratch);
+            if (!m_eventScratch.empty())
+            {
+                const size_t eventsSize = m_eventScratch.size() * sizeof(CpuTrace::Event);
+                AppendRecordHeader(m_writeScratch, CpuTrace::RecordType::Events, sizeof(CpuTrace::EventsRecord) + eventsSize);
+                AppendBytes(m_writeScratch, CpuTrace::EventsRecord{ threadBuffer->GetThreadIndex(), aznumeric_cast<AZ::u32>(m_eventScratch.size()) });
+                const char* eventBytes = reinterpret_cast<const char*>(m_eventScratch.data());
+                m_writeScratch.insert(m_writeScratch.end(), eventBytes, eventBytes + eventsSize);
+            }
+        }
+
+        AZStd::vector<char, AZ::OSStdAllocator> pendingRecords;
+        {
+            AZStd::scoped_lock lock(m_registryMutex);
+            pendingRecords.swap(m_pendingRecords);
+
+            // The buffers of exited threads are fully drained now and can't receive any more events
+            for (auto threadBufferIt = m_threadBuffers.begin(); threadBufferIt != m_threadBuffers.end();)
+            {
+                if (AZStd::find(exitedThreadBuffers.begin(), exitedThreadBuffers.end(), threadBufferIt->get()) != exitedThreadBuffers.end())
+                {
+                    m_releasedDroppedEventCount += (*threadBufferIt)->GetDroppedEventCount();
+                    threadBufferIt = m_threadBuffers.erase(threadBufferIt);
+                }
+                else
+                {
+                    ++threadBufferIt;
+                }
+            }
+        }
+
+        for (const auto* records : { &pendingRecords, &m_writeScratch })
+        {
+            if (!records->empty() && m_file.Write(records->data(), records->size()) != records->size() && !m_writeFailed)
+            {
+                AZ_Warning("Profiler", false, "Failed to write to the trace capture file '%s', the trace is incomplete.", m_file.Name());
+                m_writeFailed = true;
+            }
+        }
+    }
+} // namespace Profiler
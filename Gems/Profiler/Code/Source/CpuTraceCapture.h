@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <CpuProfiler.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace Profiler
+{
+    //! Layout of the binary trace files written by CpuTraceCapture.
+    //! A file starts with a FileHeader, followed by records that each start with a RecordHeader. Region and thread records
+    //! are always written before the first event that refers to them. All values are stored in the native byte order.
+    namespace CpuTrace
+    {
+        //! The characters "AZPT" when read from the start of the file.
+        static constexpr AZ::u32 Magic = 0x54505A41;
+        static constexpr AZ::u32 Version = 1;
+        //! The region id of the events that end the innermost region of their thread.
+        static constexpr AZ::u32 EndRegionId = 0xFFFFFFFF;
+
+        struct FileHeader
+        {
+            AZ::u32 m_magic;
+            AZ::u32 m_version;
+            AZ::u64 m_ticksPerSecond;
+            //! The tick at which the capture began, the timestamps of the converted trace are relative to it.
+            AZ::u64 m_startTick;
+        };
+
+        enum class RecordType : AZ::u32
+        {
+            Region = 1, //!< RegionRecord followed by the group name and the region name, without terminators.
+            Thread = 2, //!< ThreadRecord
+            Events = 3, //!< EventsRecord followed by m_eventCount Events.
+        };
+
+        struct RecordHeader
+        {
+            RecordType m_type;
+            //! The size of the record in bytes, not including this header.
+            AZ::u32 m_size;
+        };
+
+        struct RegionRecord
+        {
+            AZ::u32 m_regionId;
+            AZ::u32 m_groupNameLength;
+            AZ::u32 m_regionNameLength;
+            AZ::u32 m_padding;
+        };
+
+        struct ThreadRecord
+        {
+            AZ::u32 m_threadIndex;
+            AZ::u32 m_padding;
+            AZ::u64 m_threadId;
+        };
+
+        struct EventsRecord
+        {
+            AZ::u32 m_threadIndex;
+            AZ::u32 m_eventCount;
+        };
+
+        struct Event
+        {
+            AZ::u64 m_tick;
+            //! The id of the region that begins, or EndRegionId.
+            AZ::u32 m_regionId;
+            AZ::u32 m_padding;
+        };
+
+        //! Converts a binary trace into the Chrome trace event JSON format, which is also loaded by Perfetto.
+        //! The trace is streamed, so the size of the trace isn't limited by the available memory.
+        bool ConvertToChromeTrace(const char* traceFilePath, const char* jsonFilePath);
+    } // namespace CpuTrace
+
+    //! Events recorded by one thread, waiting for the writer thread.
+    //! Single producer, single consumer ring buffer: only the owning thread pushes and only the writer thread pops.
+    class CpuTraceThreadBuffer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CpuTraceThreadBuffer, AZ::OSAllocator, 0);
+
+        //! Must be a power of two.
+        static constexpr AZ::u64 Capacity = 64 * 1024;
+        //! Begin events leave this many slots free, so the end of every recorded region always fits into the buffer.
+        static constexpr AZ::u64 EndEventReserve = 2048;
+
+        explicit CpuTraceThreadBuffer(AZ::u32 threadIndex);
+
+        //! Called by the owning thread.
+        void RecordBegin(AZ::u32 regionId, AZ::u64 tick);
+        void RecordEnd(AZ::u64 tick);
+
+        //! Called by the writer thread, appends all events recorded so far.
+        void Drain(AZStd::vector<CpuTrace::Event, AZ::OSStdAllocator>& events);
+
+        AZ::u32 GetThreadIndex() const { return m_threadIndex; }
+        AZ::u64 GetDroppedEventCount() const { return m_droppedEventCount.load(AZStd::memory_order_relaxed); }
+
+        //! Called when the owning thread exits, after its last event.
+        void MarkThreadExited() { m_threadExited.store(true, AZStd::memory_order_release); }
+        //! Once this returns true, the next Drain returns the last events of the buffer.
+        bool HasThreadExited() const { return m_threadExited.load(AZStd::memory_order_acquire); }
+
+        //! Region ids already resolved by the owning thread, so only the first use of a region needs the shared lock.
+        AZStd::unordered_map<CachedTimeRegion::GroupRegionName, AZ::u32, CachedTimeRegion::GroupRegionName::Hash,
+            AZStd::equal_to<CachedTimeRegion::GroupRegionName>, AZ::OSStdAllocator> m_regionIds;
+
+    private:
+        AZStd::vector<CpuTrace::Event, AZ::OSStdAllocator> m_events;
+
+        // Only written by the owning thread.
+        alignas(64) AZStd::atomic<AZ::u64> m_writeIndex{ 0 };
+        AZ::u32 m_openRegionCount = 0;
+        // Regions that began while the buffer was full, their ends are dropped as well to keep the nesting intact.
+        AZ::u32 m_droppedRegionDepth = 0;
+        AZStd::atomic<AZ::u64> m_droppedEventCount{ 0 };
+        AZStd::atomic_bool m_threadExited{ false };
+
+        // Only written by the writer thread.
+        alignas(64) AZStd::atomic<AZ::u64> m_readIndex{ 0 };
+
+        AZ::u32 m_threadIndex;
+    };
+
+    //! Streams the regions of all threads to a binary trace file for as long as the capture runs.
+    //! Recording a region costs a lookup of its id in a per thread map and a write into a per thread ring buffer, no locks are
+    //! taken after the first use of a region by a thread. A writer thread moves the events to the file in the background,
+    //! so the capture can run for hours with constant memory. The buffers of threads that exit are released once they are drained,
+    //! so threads that come and go don't add up either. Use CpuTrace::ConvertToChromeTrace to view the trace.
+    class CpuTraceCapture
+    {
+        friend struct CpuTraceThreadExit;
+
+    public:
+        //! How often the writer thread moves the recorded events to the file.
+        static constexpr AZStd::chrono::milliseconds FlushInterval{ 5 };
+
+        CpuTraceCapture() = default;
+        ~CpuTraceCapture();
+
+        AZ_DISABLE_COPY_MOVE(CpuTraceCapture);
+
+        //! Opens the file and starts the writer thread.
+        bool Begin(const char* traceFilePath);
+        //! Stops recording new regions. Threads may still be recording when this returns, see End.
+        void StopRecording();
+        //! Writes the remaining events and closes the file. Must only be called after StopRecording, once no thread is recording anymore.
+        bool End();
+
+        bool IsRecording() const { return m_isRecording.load(AZStd::memory_order_acquire); }
+        bool IsInProgress() const { return m_file.IsOpen(); }
+
+        void RecordBegin(const char* groupName, const char* regionName);
+        void RecordEnd();
+
+    private:
+        CpuTraceThreadBuffer* GetThreadBuffer();
+        // Flags the buffer of the exiting thread, if its capture is still in progress, so Flush releases it once it is drained.
+        static void OnThreadExit();
+        AZ::u32 RegisterRegion(const CachedTimeRegion::GroupRegionName& groupRegionName);
+
+        void WriterThreadMain();
+        // Moves the recorded events of all threads to the file, only called by the writer thread or once it has finished.
+        void Flush();
+
+        // Unique for every capture, so the thread local buffer pointers of previous captures are ignored.
+        AZ::u32 m_captureId = 0;
+        AZStd::atomic_bool m_isRecording{ false };
+        // The captures in progress, guarded by the mutex of CpuTraceThreadExit, which looks up the capture of an exiting thread.
+        CpuTraceCapture* m_nextActiveCapture = nullptr;
+        static CpuTraceCapture* ms_activeCaptures;
+
+        // Guards the buffer list, the region ids and the pending records.
+        AZStd::mutex m_registryMutex;
+        AZStd::vector<AZStd::unique_ptr<CpuTraceThreadBuffer>, AZ::OSStdAllocator> m_threadBuffers;
+        // The number of threads recorded so far, including the ones whose buffers were released.
+        AZ::u32 m_threadCount = 0;
+        // The regions dropped by the threads whose buffers were released.
+        AZ::u64 m_releasedDroppedEventCount = 0;
+        AZStd::unordered_map<CachedTimeRegion::GroupRegionName, AZ::u32, CachedTimeRegion::GroupRegionName::Hash,
+            AZStd::equal_to<CachedTimeRegion::GroupRegionName>, AZ::OSStdAllocator> m_regionIds;
+        // Region and thread records that still need to be written to the file.
+        AZStd::vector<char, AZ::OSStdAllocator> m_pendingRecords;
+
+        AZ::IO::SystemFile m_file;
+        AZStd::thread m_writerThread;
+        AZStd::vector<CpuTrace::Event, AZ::OSStdAllocator> m_eventScratch;
+        AZStd::vector<char, AZ::OSStdAllocator> m_writeScratch;
+        bool m_writeFailed = false;
+
+        static thread_local CpuTraceThreadBuffer* ms_threadBuffer;
+        static thread_local AZ::u32 ms_threadCaptureId;
+    };
+} // namespace Profiler
@@ -8,6 +8,9 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -89,6 +92,79 @@ namespace Profiler
         return saveResult.IsSuccess();
     }
 
+    AZ::IO::FixedMaxPath ResolveCapturePath(AZStd::string_view path)
+    {
+        AZ::IO::FixedMaxPath resolvedPath(path);
+        if (auto* fileIo = AZ::IO::FileIOBase::GetInstance())
+        {
+            fileIo->ResolvePath(resolvedPath, AZ::IO::PathView(path));
+        }
+        return resolvedPath;
+    }
+
+    void profiler_beginTraceCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        CpuProfiler* cpuProfiler = CpuProfiler::Get();
+        if (!cpuProfiler)
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "The Cpu profiler isn't active\n");
+            return;
+        }
+
+        AZ::IO::FixedMaxPath traceFilePath;
+        if (arguments.empty())
+        {
+            const AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
+            traceFilePath = ResolveCapturePath(
+                AZ::IO::FixedMaxPathString::format("%s/cpu_trace_%lld.aztrace", captureOutput.c_str(), AZStd::GetTimeNowSecond()));
+        }
+        else
+        {
+            traceFilePath = ResolveCapturePath(arguments.front());
+        }
+
+        [[maybe_unused]] const bool started = cpuProfiler->BeginTraceCapture(traceFilePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(profiler_beginTraceCapture, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Streams all profiler regions to a binary trace file until profiler_endTraceCapture. Optional argument: the trace file");
+
+    void profiler_endTraceCapture([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (CpuProfiler* cpuProfiler = CpuProfiler::Get())
+        {
+            cpuProfiler->EndTraceCapture();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(profiler_endTraceCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Ends the trace capture started by profiler_beginTraceCapture");
+
+    void profiler_convertTrace(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "profiler_convertTrace expects the trace file and optionally the JSON file to write\n");
+            return;
+        }
+
+        const AZ::IO::FixedMaxPath traceFilePath = ResolveCapturePath(arguments[0]);
+        AZ::IO::FixedMaxPath jsonFilePath;
+        if (arguments.size() > 1)
+        {
+            jsonFilePath = ResolveCapturePath(arguments[1]);
+        }
+        else
+        {
+            jsonFilePath = traceFilePath;
+            jsonFilePath.ReplaceExtension(".json");
+        }
+
+        if (CpuTrace::ConvertToChromeTrace(traceFilePath.c_str(), jsonFilePath.c_str()))
+        {
+            AZ_Printf("ProfilerSystemComponent", "Trace converted to [%s]\n", jsonFilePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(profiler_convertTrace, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Converts a binary trace file to the Chrome trace JSON format, which can be viewed with Perfetto or chrome://tracing");
+
     void ProfilerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <CpuTraceCapture.h>
+
+namespace Benchmark
+{
+    //! Measures the overhead a trace capture adds to every profiler region.
+    //! The argument is the number of distinct regions that are recorded, to include the cost of the region id lookups.
+    class CpuTraceCaptureBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_regionNames = AZStd::make_unique<AZStd::vector<AZStd::string>>();
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                m_regionNames->push_back(AZStd::string::format("Region%lld", static_cast<long long>(i)));
+            }
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_regionNames.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        const char* GetRegionName(size_t index) const
+        {
+            return (*m_regionNames)[index % m_regionNames->size()].c_str();
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDir;
+        AZStd::unique_ptr<AZStd::vector<AZStd::string>> m_regionNames;
+    };
+
+    //! The full cost of a region, including the region id lookup and the timestamps. When the writer thread falls behind,
+    //! regions are dropped, which is part of the cost of a capture as well.
+    BENCHMARK_DEFINE_F(CpuTraceCaptureBenchmarkFixture, BM_CpuTraceCapture_RecordRegion)(benchmark::State& state)
+    {
+        Profiler::CpuTraceCapture capture;
+        capture.Begin(m_tempDir.Resolve("Benchmark.azpt").c_str());
+
+        size_t regionIndex = 0;
+        for (auto _ : state)
+        {
+            capture.RecordBegin("Benchmark", GetRegionName(regionIndex++));
+            capture.RecordEnd();
+        }
+
+        capture.StopRecording();
+        capture.End();
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_REGISTER_F(CpuTraceCaptureBenchmarkFixture, BM_CpuTraceCapture_RecordRegion)
+        ->Arg(1)
+        ->Arg(64)
+        ->Unit(::benchmark::kNanosecond);
+
+    //! Only the cost of writing the events to the ring buffer, the buffer is drained outside of the measured time so no region is dropped.
+    BENCHMARK_DEFINE_F(CpuTraceCaptureBenchmarkFixture, BM_CpuTraceThreadBuffer_RecordRegion)(benchmark::State& state)
+    {
+        using Profiler::CpuTraceThreadBuffer;
+        CpuTraceThreadBuffer buffer(0);
+        AZStd::vector<Profiler::CpuTrace::Event, AZ::OSStdAllocator> events;
+        events.reserve(CpuTraceThreadBuffer::Capacity);
+
+        AZ::u64 regionCount = 0;
+        for (auto _ : state)
+        {
+            buffer.RecordBegin(aznumeric_cast<AZ::u32>(regionCount % m_regionNames->size()), regionCount);
+            buffer.RecordEnd(regionCount);
+
+            if (++regionCount % (CpuTraceThreadBuffer::Capacity / 4) == 0)
+            {
+                state.PauseTiming();
+                events.clear();
+                buffer.Drain(events);
+                state.ResumeTiming();
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_REGISTER_F(CpuTraceCaptureBenchmarkFixture, BM_CpuTraceThreadBuffer_RecordRegion)
+        ->Arg(1)
+        ->Unit(::benchmark::kNanosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
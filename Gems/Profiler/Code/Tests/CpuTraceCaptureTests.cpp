@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/Utils.h>
+
+#include <CpuTraceCapture.h>
+
+namespace UnitTest
+{
+    class CpuTraceCaptureTests
+        : public AllocatorsTestFixture
+    {
+    public:
+        //! Builds trace files by hand, to test the conversion of files the capture doesn't write.
+        class TraceFileBuilder
+        {
+        public:
+            TraceFileBuilder()
+            {
+                Append(Profiler::CpuTrace::FileHeader{ Profiler::CpuTrace::Magic, Profiler::CpuTrace::Version, 1000000, 0 });
+            }
+
+            void AddRegion(AZ::u32 regionId, const char* groupName, const char* regionName)
+            {
+                const AZ::u32 groupNameLength = aznumeric_cast<AZ::u32>(strlen(groupName));
+                const AZ::u32 regionNameLength = aznumeric_cast<AZ::u32>(strlen(regionName));
+                AddRegionRecord(
+                    Profiler::CpuTrace::RegionRecord{ regionId, groupNameLength, regionNameLength, 0 },
+                    sizeof(Profiler::CpuTrace::RegionRecord) + groupNameLength + regionNameLength);
+                m_bytes.append(groupName).append(regionName);
+            }
+
+            void AddRegionRecord(const Profiler::CpuTrace::RegionRecord& region, size_t recordSize)
+            {
+                Append(Profiler::CpuTrace::RecordHeader{ Profiler::CpuTrace::RecordType::Region, aznumeric_cast<AZ::u32>(recordSize) });
+                Append(region);
+            }
+
+            void AddThread(AZ::u32 threadIndex)
+            {
+                Append(Profiler::CpuTrace::RecordHeader{ Profiler::CpuTrace::RecordType::Thread, sizeof(Profiler::CpuTrace::ThreadRecord) });
+                Append(Profiler::CpuTrace::ThreadRecord{ threadIndex, 0, threadIndex });
+            }
+
+            void AddEvents(AZ::u32 threadIndex, AZStd::initializer_list<Profiler::CpuTrace::Event> events)
+            {
+                Append(Profiler::CpuTrace::RecordHeader{ Profiler::CpuTrace::RecordType::Events,
+                    aznumeric_cast<AZ::u32>(sizeof(Profiler::CpuTrace::EventsRecord) + events.size() * sizeof(Profiler::CpuTrace::Event)) });
+                Append(Profiler::CpuTrace::EventsRecord{ threadIndex, aznumeric_cast<AZ::u32>(events.size()) });
+                for (const Profiler::CpuTrace::Event& event : events)
+                {
+                    Append(event);
+                }
+            }
+
+            template<class T>
+            void Append(const T& value)
+            {
+                m_bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            AZStd::string m_bytes;
+        };
+
+        static Profiler::CpuTrace::Event Begin(AZ::u64 tick, AZ::u32 regionId)
+        {
+            return Profiler::CpuTrace::Event{ tick, regionId, 0 };
+        }
+
+        static Profiler::CpuTrace::Event End(AZ::u64 tick)
+        {
+            return Profiler::CpuTrace::Event{ tick, Profiler::CpuTrace::EndRegionId, 0 };
+        }
+
+        AZStd::string WriteTraceFile(const AZStd::string& bytes)
+        {
+            const AZStd::string tracePath = m_tempDir.Resolve("Trace.azpt");
+            EXPECT_TRUE(AZ::Utils::WriteFile(bytes, tracePath).IsSuccess());
+            return tracePath;
+        }
+
+        //! Converts the trace and parses the result, the converted trace must be valid JSON even if the conversion failed.
+        bool ConvertToChromeTrace(const AZStd::string& tracePath, rapidjson::Document& document)
+        {
+            const AZStd::string jsonPath = m_tempDir.Resolve("Trace.json");
+            const bool succeeded = Profiler::CpuTrace::ConvertToChromeTrace(tracePath.c_str(), jsonPath.c_str());
+
+            auto json = AZ::Utils::ReadFile(jsonPath);
+            EXPECT_TRUE(json.IsSuccess());
+            document.Parse(json.GetValue().c_str());
+            EXPECT_FALSE(document.HasParseError());
+            EXPECT_TRUE(document.IsObject() && document.HasMember("traceEvents") && document["traceEvents"].IsArray());
+            return succeeded;
+        }
+
+        //! Returns the events of the given phase, optionally only the ones of one thread.
+        static AZStd::vector<const rapidjson::Value*> GetEvents(const rapidjson::Document& document, const char* phase, int threadIndex = -1)
+        {
+            AZStd::vector<const rapidjson::Value*> events;
+            for (const rapidjson::Value& event : document["traceEvents"].GetArray())
+            {
+                if (strcmp(event["ph"].GetString(), phase) == 0 && (threadIndex < 0 || event["tid"].GetInt() == threadIndex))
+                {
+                    events.push_back(&event);
+                }
+            }
+            return events;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDir;
+    };
+
+    TEST_F(CpuTraceCaptureTests, Capture_NestedRegionsOnTwoThreads_ConvertedTraceHasAllRegions)
+    {
+        constexpr size_t RegionCount = 100;
+        const AZStd::string tracePath = m_tempDir.Resolve("Capture.azpt");
+
+        Profiler::CpuTraceCapture capture;
+        ASSERT_TRUE(capture.Begin(tracePath.c_str()));
+
+        // The threads exit before the capture ends, so their buffers are released while it is in progress
+        auto recordRegions = [&capture]()
+        {
+            for (size_t i = 0; i < RegionCount; ++i)
+            {
+                capture.RecordBegin("Group", "Outer");
+                capture.RecordBegin("Group", "Inner \"quoted\"");
+                capture.RecordEnd();
+                capture.RecordEnd();
+            }
+        };
+        AZStd::thread firstThread(recordRegions);
+        AZStd::thread secondThread(recordRegions);
+        firstThread.join();
+        secondThread.join();
+
+        capture.StopRecording();
+        EXPECT_TRUE(capture.End());
+
+        rapidjson::Document document;
+        ASSERT_TRUE(ConvertToChromeTrace(tracePath, document));
+        EXPECT_EQ(2u, GetEvents(document, "M").size());
+
+        for (int threadIndex = 0; threadIndex < 2; ++threadIndex)
+        {
+            const AZStd::vector<const rapidjson::Value*> beginEvents = GetEvents(document, "B", threadIndex);
+            ASSERT_EQ(2 * RegionCount, beginEvents.size());
+            EXPECT_EQ(2 * RegionCount, GetEvents(document, "E", threadIndex).size());
+            for (size_t i = 0; i < beginEvents.size(); ++i)
+            {
+                EXPECT_STREQ("Group", (*beginEvents[i])["cat"].GetString());
+                EXPECT_STREQ(i % 2 == 0 ? "Outer" : "Inner \"quoted\"", (*beginEvents[i])["name"].GetString());
+            }
+        }
+    }
+
+    TEST_F(CpuTraceCaptureTests, RecordBegin_BufferFull_DroppedRegionsKeepNesting)
+    {
+        using Profiler::CpuTraceThreadBuffer;
+        CpuTraceThreadBuffer buffer(0);
+        AZ::u64 tick = 0;
+
+        // Fill the buffer until only the room reserved for end events is left
+        for (AZ::u64 i = 0; i < (CpuTraceThreadBuffer::Capacity - CpuTraceThreadBuffer::EndEventReserve) / 2; ++i)
+        {
+            buffer.RecordBegin(0, ++tick);
+            buffer.RecordEnd(++tick);
+        }
+
+        // A region and the region nested in it are dropped as a whole
+        buffer.RecordBegin(1, ++tick);
+        buffer.RecordBegin(2, ++tick);
+        buffer.RecordEnd(++tick);
+        buffer.RecordEnd(++tick);
+        EXPECT_EQ(2u, buffer.GetDroppedEventCount());
+
+        AZStd::vector<Profiler::CpuTrace::Event, AZ::OSStdAllocator> events;
+        buffer.Drain(events);
+        ASSERT_EQ(CpuTraceThreadBuffer::Capacity - CpuTraceThreadBuffer::EndEventReserve, events.size());
+        for (size_t i = 0; i < events.size(); ++i)
+        {
+            EXPECT_EQ(i % 2 == 0 ? 0u : Profiler::CpuTrace::EndRegionId, events[i].m_regionId);
+        }
+
+        // Once drained, regions are recorded again
+        events.clear();
+        buffer.RecordBegin(3, ++tick);
+        buffer.RecordEnd(++tick);
+        buffer.Drain(events);
+        ASSERT_EQ(2u, events.size());
+        EXPECT_EQ(3u, events[0].m_regionId);
+        EXPECT_EQ(Profiler::CpuTrace::EndRegionId, events[1].m_regionId);
+    }
+
+    TEST_F(CpuTraceCaptureTests, RecordBegin_TooManyOpenRegions_InnermostRegionsDropped)
+    {
+        using Profiler::CpuTraceThreadBuffer;
+        constexpr AZ::u64 ExtraRegionCount = 5;
+        CpuTraceThreadBuffer buffer(0);
+
+        for (AZ::u64 i = 0; i < CpuTraceThreadBuffer::EndEventReserve + ExtraRegionCount; ++i)
+        {
+            buffer.RecordBegin(0, i);
+        }
+        for (AZ::u64 i = 0; i < CpuTraceThreadBuffer::EndEventReserve + ExtraRegionCount; ++i)
+        {
+            buffer.RecordEnd(i);
+        }
+        EXPECT_EQ(ExtraRegionCount, buffer.GetDroppedEventCount());
+
+        AZStd::vector<Profiler::CpuTrace::Event, AZ::OSStdAllocator> events;
+        buffer.Drain(events);
+        ASSERT_EQ(2 * CpuTraceThreadBuffer::EndEventReserve, events.size());
+        for (size_t i = 0; i < events.size(); ++i)
+        {
+            EXPECT_EQ(i < CpuTraceThreadBuffer::EndEventReserve ? 0u : Profiler::CpuTrace::EndRegionId, events[i].m_regionId);
+        }
+    }
+
+    TEST_F(CpuTraceCaptureTests, ConvertToChromeTrace_TruncatedFile_KeepsCompleteRecords)
+    {
+        TraceFileBuilder builder;
+        builder.AddRegion(0, "Group", "Region");
+        builder.AddThread(0);
+        builder.AddEvents(0, { Begin(10, 0), End(20) });
+        builder.AddEvents(0, { Begin(30, 0), End(40) });
+        builder.m_bytes.resize(builder.m_bytes.size() - sizeof(Profiler::CpuTrace::Event) / 2);
+
+        rapidjson::Document document;
+        EXPECT_TRUE(ConvertToChromeTrace(WriteTraceFile(builder.m_bytes), document));
+        EXPECT_EQ(1u, GetEvents(document, "B").size());
+        EXPECT_EQ(1u, GetEvents(document, "E").size());
+    }
+
+    TEST_F(CpuTraceCaptureTests, ConvertToChromeTrace_TruncatedFileHeader_Fails)
+    {
+        TraceFileBuilder builder;
+        builder.m_bytes.resize(sizeof(Profiler::CpuTrace::FileHeader) - 1);
+        const AZStd::string tracePath = WriteTraceFile(builder.m_bytes);
+        EXPECT_FALSE(Profiler::CpuTrace::ConvertToChromeTrace(tracePath.c_str(), m_tempDir.Resolve("Trace.json").c_str()));
+    }
+
+    TEST_F(CpuTraceCaptureTests, ConvertToChromeTrace_RegionNamesPastRecordEnd_Fails)
+    {
+        TraceFileBuilder builder;
+        builder.AddRegionRecord(Profiler::CpuTrace::RegionRecord{ 0, 5, 0xFFFFFF00, 0 }, sizeof(Profiler::CpuTrace::RegionRecord) + 5);
+        builder.m_bytes.append("Group");
+        builder.AddThread(0);
+        builder.AddEvents(0, { Begin(10, 0), End(20) });
+
+        rapidjson::Document document;
+        EXPECT_FALSE(ConvertToChromeTrace(WriteTraceFile(builder.m_bytes), document));
+        EXPECT_TRUE(GetEvents(document, "B").empty());
+    }
+
+    TEST_F(CpuTraceCaptureTests, ConvertToChromeTrace_EventsRecordSmallerThanItsHeader_Fails)
+    {
+        TraceFileBuilder builder;
+        builder.AddRegion(0, "Group", "Region");
+        builder.AddThread(0);
+        builder.Append(Profiler::CpuTrace::RecordHeader{ Profiler::CpuTrace::RecordType::Events, sizeof(AZ::u32) });
+        builder.Append(AZ::u32{ 0 });
+
+        rapidjson::Document document;
+        EXPECT_FALSE(ConvertToChromeTrace(WriteTraceFile(builder.m_bytes), document));
+    }
+
+    TEST_F(CpuTraceCaptureTests, ConvertToChromeTrace_UnknownRegionId_RegionSkippedWithItsEnd)
+    {
+        TraceFileBuilder builder;
+        builder.AddRegion(0, "Group", "Region");
+        builder.AddThread(0);
+        builder.AddEvents(0, { Begin(10, 0), Begin(20, 7), End(30), End(40) });
+
+        rapidjson::Document document;
+        EXPECT_TRUE(ConvertToChromeTrace(WriteTraceFile(builder.m_bytes), document));
+
+        const AZStd::vector<const rapidjson::Value*> beginEvents = GetEvents(document, "B");
+        const AZStd::vector<const rapidjson::Value*> endEvents = GetEvents(document, "E");
+        ASSERT_EQ(1u, beginEvents.size());
+        ASSERT_EQ(1u, endEvents.size());
+        EXPECT_STREQ("Region", (*beginEvents[0])["name"].GetString());
+        // The end of the known region is the last end event, the one before ends the skipped region
+        EXPECT_DOUBLE_EQ(40.0, (*endEvents[0])["ts"].GetDouble());
+    }
+} // namespace UnitTest
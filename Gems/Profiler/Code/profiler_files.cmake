@@ -11,6 +11,8 @@ set(FILES
     Source/CpuProfiler.h
     Source/CpuProfilerImpl.cpp
     Source/CpuProfilerImpl.h
+    Source/CpuTraceCapture.cpp
+    Source/CpuTraceCapture.h
     Source/ProfilerSystemComponent.cpp
     Source/ProfilerSystemComponent.h
 )
@@ -11,6 +11,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointLists.h>
 
 namespace SurfaceData
 {
@@ -32,6 +33,44 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Add the modifier's tag weights to every point in surfacePointLists that it applies to, using AddSurfaceTagWeight.
+        //! The points are still being built when this is called, so only their entity ids, positions and normals are available.
+        //! The default implementation runs ModifySurfacePoints on a copy of the points of the input positions inside the modifier's
+        //! registered bounds and adds the tag weights it produced, so modifiers should override this to avoid the copy.
+        virtual void ModifySurfacePointLists(SurfacePointLists& surfacePointLists) const
+        {
+            const size_t pointCount = surfacePointLists.GetPointCount();
+            AZStd::vector<size_t> pointIndices;
+            pointIndices.reserve(pointCount);
+            for (size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+            {
+                if (surfacePointLists.IsInHandlerBounds(surfacePointLists.GetInputPositionIndex(pointIndex)))
+                {
+                    pointIndices.push_back(pointIndex);
+                }
+            }
+
+            if (pointIndices.empty())
+            {
+                return;
+            }
+
+            SurfacePointList surfacePointList(pointIndices.size());
+            for (size_t listIndex = 0; listIndex < pointIndices.size(); ++listIndex)
+            {
+                surfacePointList[listIndex].m_entityId = surfacePointLists.GetEntityId(pointIndices[listIndex]);
+                surfacePointList[listIndex].m_position = surfacePointLists.GetPosition(pointIndices[listIndex]);
+                surfacePointList[listIndex].m_normal = surfacePointLists.GetNormal(pointIndices[listIndex]);
+            }
+
+            ModifySurfacePoints(surfacePointList);
+
+            for (size_t listIndex = 0; listIndex < pointIndices.size(); ++listIndex)
+            {
+                surfacePointLists.AddSurfaceTagWeights(pointIndices[listIndex], surfacePointList[listIndex].m_masks);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
@@ -10,6 +10,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointLists.h>
 
 namespace SurfaceData
 {
@@ -31,6 +32,30 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Get the surface points for every position in inPositions and add them to surfacePointLists, using the index of each
+        //! position in inPositions as its input position index.  Only the XY components of the positions are used, and positions
+        //! outside of the provider's bounds are expected to produce no points.
+        //! The default implementation calls GetSurfacePoints once per position inside the provider's registered bounds, so providers
+        //! should override this to query the whole list at once.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointLists& surfacePointLists) const
+        {
+            SurfacePointList surfacePointList;
+            for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+            {
+                if (!surfacePointLists.IsInHandlerBounds(inPositionIndex))
+                {
+                    continue;
+                }
+
+                surfacePointList.clear();
+                GetSurfacePoints(inPositions[inPositionIndex], surfacePointList);
+                for (const SurfacePoint& surfacePoint : surfacePointList)
+                {
+                    surfacePointLists.AddSurfacePoint(inPositionIndex, surfacePoint);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
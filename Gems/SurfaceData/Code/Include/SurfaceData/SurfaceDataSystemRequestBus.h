@@ -13,6 +13,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector2.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointLists.h>
 
 namespace SurfaceData
 {
@@ -41,6 +42,13 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Get all surface points for every position in inPositions.  Only the XY components of the positions are used.
+        // The overlapping providers and modifiers are looked up once for the whole list and each of them processes the whole list
+        // in a single request.  The results are stored in surfacePointLists, with one list per input position in the same order
+        // as inPositions.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags,
+                                              SurfacePointLists& surfacePointLists) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
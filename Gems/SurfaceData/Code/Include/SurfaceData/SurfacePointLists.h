@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+namespace SurfaceData
+{
+    using SurfaceTagWeight = AzFramework::SurfaceData::SurfaceTagWeight;
+
+    //! Flat storage for the surface points of a list of input positions, as filled in by GetSurfacePointsFromList.
+    //! The points of every input position are stored together as a structure of arrays, and the tag weights of every point are stored
+    //! in one shared array. Filling the lists doesn't need any per-position or per-point allocations, and reusing the same lists for
+    //! several queries reuses their storage.
+    //! The lists get built in three steps:
+    //! - StartListConstruction() clears the lists and sets the input positions.
+    //! - Surface data providers add points with AddSurfacePoint(), and surface data modifiers add tag weights to the points with
+    //!   AddSurfaceTagWeight(). During this step, points are indexed in the order they were added.
+    //! - EndListConstruction() sorts the points of each input position by decreasing height, combines points that are close together
+    //!   and removes the points that don't match the desired tags, the same way GetSurfacePoints does. Afterwards, the points of each
+    //!   input position are stored contiguously, starting at GetFirstPointIndex().
+    class SurfacePointLists
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfacePointLists, AZ::SystemAllocator, 0);
+
+        //! Clears the lists and prepares them to receive points for the given input positions.
+        void StartListConstruction(const AZStd::vector<AZ::Vector3>& inPositions);
+
+        //! Adds a point for the input position at the given index and returns the index of the new point.
+        size_t AddSurfacePoint(size_t inPositionIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal);
+        size_t AddSurfacePoint(size_t inPositionIndex, const SurfacePoint& surfacePoint);
+
+        //! Adds tag weights to a point. If the point already has one of the tags, the larger of the two weights is kept.
+        void AddSurfaceTagWeight(size_t pointIndex, AZ::Crc32 tag, float weight);
+        void AddSurfaceTagWeights(size_t pointIndex, const SurfaceTagVector& tags, float weight);
+        void AddSurfaceTagWeights(size_t pointIndex, const SurfaceTagWeightMap& masks);
+
+        //! Sorts, combines and filters the points of every input position. Points without any of the desired tags are removed, unless
+        //! desiredTags doesn't contain any valid tags.
+        void EndListConstruction(const SurfaceTagVector& desiredTags);
+
+        //! Clears the lists, but keeps their storage for reuse.
+        void Clear();
+
+        size_t GetInputPositionCount() const;
+        const AZ::Vector3& GetInputPosition(size_t inPositionIndex) const;
+
+        //! The registered bounds of the provider or modifier that is currently being called, set by the surface data system.
+        //! The default list implementations on the provider and modifier buses skip the input positions outside of these bounds,
+        //! the same way the system does for GetSurfacePoints. A null Aabb means the provider or modifier applies everywhere.
+        void SetHandlerBounds(const AZ::Aabb& bounds);
+        bool IsInHandlerBounds(size_t inPositionIndex) const;
+
+        //! Returns the total number of points for all input positions.
+        size_t GetPointCount() const;
+        //! Returns the number of points for the input position. Only valid after EndListConstruction().
+        size_t GetPointCount(size_t inPositionIndex) const;
+        //! Returns the index of the first point for the input position. Only valid after EndListConstruction().
+        size_t GetFirstPointIndex(size_t inPositionIndex) const;
+        bool IsEmpty(size_t inPositionIndex) const;
+
+        size_t GetInputPositionIndex(size_t pointIndex) const;
+        const AZ::EntityId& GetEntityId(size_t pointIndex) const;
+        const AZ::Vector3& GetPosition(size_t pointIndex) const;
+        const AZ::Vector3& GetNormal(size_t pointIndex) const;
+
+        //! Tag weight accessors. Only valid after EndListConstruction().
+        size_t GetTagWeightCount(size_t pointIndex) const;
+        const SurfaceTagWeight& GetTagWeight(size_t pointIndex, size_t tagWeightIndex) const;
+        bool HasMatchingTags(size_t pointIndex, const SurfaceTagVector& sampleTags) const;
+
+        //! Copies a point and its tag weights into the SurfacePoint and SurfacePointList formats. Only valid after EndListConstruction().
+        void GetSurfaceTagWeights(size_t pointIndex, SurfaceTagWeightMap& masks) const;
+        void GetSurfacePoint(size_t pointIndex, SurfacePoint& surfacePoint) const;
+        void GetSurfacePointList(size_t inPositionIndex, SurfacePointList& surfacePointList) const;
+
+    private:
+        void MergeTagWeights(size_t firstTagWeightIndex, size_t sourcePointIndex);
+
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+        AZ::Aabb m_handlerBounds = AZ::Aabb::CreateNull();
+
+        // Per point data.
+        AZStd::vector<size_t> m_inputPositionIndices;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+
+        // Tag weights of all the points. While the lists are being built, m_tagWeightPointIndices holds the point of each tag weight.
+        // Afterwards, the tag weights of each point are contiguous and m_tagWeightOffsets holds the first tag weight of each point.
+        AZStd::vector<SurfaceTagWeight> m_tagWeights;
+        AZStd::vector<size_t> m_tagWeightPointIndices;
+        AZStd::vector<size_t> m_tagWeightOffsets;
+
+        // The first point of each input position, with one extra entry for the total point count.
+        AZStd::vector<size_t> m_pointOffsets;
+
+        // Scratch storage used by EndListConstruction(), kept around so that rebuilding the lists doesn't reallocate.
+        AZStd::vector<size_t> m_sortedPointIndices;
+        AZStd::vector<size_t> m_scratchOffsets;
+        AZStd::vector<size_t> m_scratchTagWeightOffsets;
+        AZStd::vector<SurfaceTagWeight> m_scratchTagWeights;
+        AZStd::vector<size_t> m_scratchInputPositionIndices;
+        AZStd::vector<AZ::EntityId> m_scratchEntityIds;
+        AZStd::vector<AZ::Vector3> m_scratchPositions;
+        AZStd::vector<AZ::Vector3> m_scratchNormals;
+
+        bool m_isConstructing = false;
+    };
+
+    AZ_INLINE void SurfacePointLists::StartListConstruction(const AZStd::vector<AZ::Vector3>& inPositions)
+    {
+        Clear();
+        m_inputPositions.assign(inPositions.begin(), inPositions.end());
+        m_isConstructing = true;
+    }
+
+    AZ_INLINE size_t SurfacePointLists::AddSurfacePoint(
+        size_t inPositionIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal)
+    {
+        AZ_Assert(m_isConstructing, "Surface points can only be added between StartListConstruction and EndListConstruction.");
+        AZ_Assert(inPositionIndex < m_inputPositions.size(), "Input position index %zu is out of range.", inPositionIndex);
+
+        m_inputPositionIndices.push_back(inPositionIndex);
+        m_entityIds.push_back(entityId);
+        m_positions.push_back(position);
+        m_normals.push_back(normal);
+        return m_positions.size() - 1;
+    }
+
+    AZ_INLINE size_t SurfacePointLists::AddSurfacePoint(size_t inPositionIndex, const SurfacePoint& surfacePoint)
+    {
+        const size_t pointIndex = AddSurfacePoint(inPositionIndex, surfacePoint.m_entityId, surfacePoint.m_position, surfacePoint.m_normal);
+        AddSurfaceTagWeights(pointIndex, surfacePoint.m_masks);
+        return pointIndex;
+    }
+
+    AZ_INLINE void SurfacePointLists::AddSurfaceTagWeight(size_t pointIndex, AZ::Crc32 tag, float weight)
+    {
+        AZ_Assert(m_isConstructing, "Surface tag weights can only be added between StartListConstruction and EndListConstruction.");
+        AZ_Assert(pointIndex < m_positions.size(), "Point index %zu is out of range.", pointIndex);
+
+        m_tagWeights.emplace_back(tag, weight);
+        m_tagWeightPointIndices.push_back(pointIndex);
+    }
+
+    AZ_INLINE void SurfacePointLists::AddSurfaceTagWeights(size_t pointIndex, const SurfaceTagVector& tags, float weight)
+    {
+        for (const auto& tag : tags)
+        {
+            AddSurfaceTagWeight(pointIndex, tag, weight);
+        }
+    }
+
+    AZ_INLINE void SurfacePointLists::AddSurfaceTagWeights(size_t pointIndex, const SurfaceTagWeightMap& masks)
+    {
+        for (const auto& mask : masks)
+        {
+            AddSurfaceTagWeight(pointIndex, mask.first, mask.second);
+        }
+    }
+
+    AZ_INLINE void SurfacePointLists::MergeTagWeights(size_t firstTagWeightIndex, size_t sourcePointIndex)
+    {
+        // Adds the tag weights of a source point to the last point in m_tagWeights, keeping the largest weight for each tag.
+        // This matches AddMaxValueForMasks, including clamping new weights to a minimum of 0.
+        for (size_t sourceIndex = m_scratchTagWeightOffsets[sourcePointIndex]; sourceIndex < m_scratchTagWeightOffsets[sourcePointIndex + 1];
+             ++sourceIndex)
+        {
+            const SurfaceTagWeight& sourceTagWeight = m_scratchTagWeights[sourceIndex];
+            bool found = false;
+            for (size_t targetIndex = firstTagWeightIndex; targetIndex < m_tagWeights.size(); ++targetIndex)
+            {
+                if (m_tagWeights[targetIndex].m_surfaceType == sourceTagWeight.m_surfaceType)
+                {
+                    m_tagWeights[targetIndex].m_weight = AZ::GetMax(m_tagWeights[targetIndex].m_weight, sourceTagWeight.m_weight);
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found)
+            {
+                m_tagWeights.emplace_back(sourceTagWeight.m_surfaceType, AZ::GetMax(sourceTagWeight.m_weight, 0.0f));
+            }
+        }
+    }
+
+    AZ_INLINE void SurfacePointLists::EndListConstruction(const SurfaceTagVector& desiredTags)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(m_isConstructing, "EndListConstruction called without a matching StartListConstruction.");
+        m_isConstructing = false;
+
+        const bool hasDesiredTags = HasValidTags(desiredTags);
+        const size_t inputPositionCount = m_inputPositions.size();
+        const size_t sourcePointCount = m_positions.size();
+
+        // Group the tag weights by point with a counting sort, so that the weights of each source point are contiguous.
+        m_scratchTagWeightOffsets.assign(sourcePointCount + 1, 0);
+        for (size_t pointIndex : m_tagWeightPointIndices)
+        {
+            ++m_scratchTagWeightOffsets[pointIndex + 1];
+        }
+        for (size_t pointIndex = 0; pointIndex < sourcePointCount; ++pointIndex)
+        {
+            m_scratchTagWeightOffsets[pointIndex + 1] += m_scratchTagWeightOffsets[pointIndex];
+        }
+        m_scratchOffsets.assign(m_scratchTagWeightOffsets.begin(), m_scratchTagWeightOffsets.end());
+        m_scratchTagWeights.resize(m_tagWeights.size());
+        for (size_t tagWeightIndex = 0; tagWeightIndex < m_tagWeights.size(); ++tagWeightIndex)
+        {
+            m_scratchTagWeights[m_scratchOffsets[m_tagWeightPointIndices[tagWeightIndex]]++] = m_tagWeights[tagWeightIndex];
+        }
+
+        // Group the points by input position the same way. Points of the same input position stay in the order they were added.
+        m_pointOffsets.assign(inputPositionCount + 1, 0);
+        for (size_t inPositionIndex : m_inputPositionIndices)
+        {
+            ++m_pointOffsets[inPositionIndex + 1];
+        }
+        for (size_t inPositionIndex = 0; inPositionIndex < inputPositionCount; ++inPositionIndex)
+        {
+            m_pointOffsets[inPositionIndex + 1] += m_pointOffsets[inPositionIndex];
+        }
+        m_scratchOffsets.assign(m_pointOffsets.begin(), m_pointOffsets.end());
+        m_sortedPointIndices.resize(sourcePointCount);
+        for (size_t pointIndex = 0; pointIndex < sourcePointCount; ++pointIndex)
+        {
+            m_sortedPointIndices[m_scratchOffsets[m_inputPositionIndices[pointIndex]]++] = pointIndex;
+        }
+
+        // Move the source points into the scratch arrays, and rebuild the lists from them.
+        AZStd::swap(m_inputPositionIndices, m_scratchInputPositionIndices);
+        AZStd::swap(m_entityIds, m_scratchEntityIds);
+        AZStd::swap(m_positions, m_scratchPositions);
+        AZStd::swap(m_normals, m_scratchNormals);
+        m_inputPositionIndices.clear();
+        m_entityIds.clear();
+        m_positions.clear();
+        m_normals.clear();
+        m_tagWeights.clear();
+        m_tagWeightPointIndices.clear();
+        m_tagWeightOffsets.clear();
+
+        auto sourceHasMatchingTags = [this, &desiredTags](size_t sourcePointIndex)
+        {
+            for (size_t sourceIndex = m_scratchTagWeightOffsets[sourcePointIndex];
+                 sourceIndex < m_scratchTagWeightOffsets[sourcePointIndex + 1]; ++sourceIndex)
+            {
+                if (HasMatchingTag(desiredTags, m_scratchTagWeights[sourceIndex].m_surfaceType))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for (size_t inPositionIndex = 0; inPositionIndex < inputPositionCount; ++inPositionIndex)
+        {
+            const size_t sourceBegin = m_pointOffsets[inPositionIndex];
+            const size_t sourceEnd = m_pointOffsets[inPositionIndex + 1];
+            m_pointOffsets[inPositionIndex] = m_positions.size();
+
+            // Sort by decreasing height before combining points. Equal heights keep the order the points were added in, so that
+            // the results don't depend on the sort implementation.
+            if (sourceEnd - sourceBegin > 1)
+            {
+                AZStd::sort(m_sortedPointIndices.begin() + sourceBegin, m_sortedPointIndices.begin() + sourceEnd,
+                    [this](size_t a, size_t b)
+                    {
+                        const float heightA = m_scratchPositions[a].GetZ();
+                        const float heightB = m_scratchPositions[b].GetZ();
+                        return (heightA != heightB) ? (heightA > heightB) : (a < b);
+                    });
+            }
+
+            // Efficient point consolidation requires the points to be pre-sorted so we are only comparing/combining neighbors.
+            bool hasTargetPoint = false;
+            for (size_t sortedIndex = sourceBegin; sortedIndex < sourceEnd; ++sortedIndex)
+            {
+                const size_t sourcePointIndex = m_sortedPointIndices[sortedIndex];
+                if (hasDesiredTags && !sourceHasMatchingTags(sourcePointIndex))
+                {
+                    continue;
+                }
+
+                // [LY-90907] need to add a configurable tolerance for comparison
+                if (hasTargetPoint && m_positions.back().IsClose(m_scratchPositions[sourcePointIndex]) &&
+                    m_normals.back().IsClose(m_scratchNormals[sourcePointIndex]))
+                {
+                    // Consolidate points with similar attributes by adding the tag weights to the target point and ignoring the source.
+                    MergeTagWeights(m_tagWeightOffsets.back(), sourcePointIndex);
+                    continue;
+                }
+
+                m_inputPositionIndices.push_back(inPositionIndex);
+                m_entityIds.push_back(m_scratchEntityIds[sourcePointIndex]);
+                m_positions.push_back(m_scratchPositions[sourcePointIndex]);
+                m_normals.push_back(m_scratchNormals[sourcePointIndex]);
+                m_tagWeightOffsets.push_back(m_tagWeights.size());
+                MergeTagWeights(m_tagWeightOffsets.back(), sourcePointIndex);
+                hasTargetPoint = true;
+            }
+        }
+        m_pointOffsets[inputPositionCount] = m_positions.size();
+        m_tagWeightOffsets.push_back(m_tagWeights.size());
+    }
+
+    AZ_INLINE void SurfacePointLists::Clear()
+    {
+        m_inputPositions.clear();
+        m_inputPositionIndices.clear();
+        m_entityIds.clear();
+        m_positions.clear();
+        m_normals.clear();
+        m_tagWeights.clear();
+        m_tagWeightPointIndices.clear();
+        m_tagWeightOffsets.clear();
+        m_pointOffsets.clear();
+        m_handlerBounds = AZ::Aabb::CreateNull();
+        m_isConstructing = false;
+    }
+
+    AZ_INLINE size_t SurfacePointLists::GetInputPositionCount() const
+    {
+        return m_inputPositions.size();
+    }
+
+    AZ_INLINE const AZ::Vector3& SurfacePointLists::GetInputPosition(size_t inPositionIndex) const
+    {
+        return m_inputPositions[inPositionIndex];
+    }
+
+    AZ_INLINE void SurfacePointLists::SetHandlerBounds(const AZ::Aabb& bounds)
+    {
+        m_handlerBounds = bounds;
+    }
+
+    AZ_INLINE bool SurfacePointLists::IsInHandlerBounds(size_t inPositionIndex) const
+    {
+        if (!m_handlerBounds.IsValid())
+        {
+            return true;
+        }
+
+        const AZ::Vector3& inPosition = m_inputPositions[inPositionIndex];
+        return m_handlerBounds.Contains(AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_handlerBounds.GetMax().GetZ()));
+    }
+
+    AZ_INLINE size_t SurfacePointLists::GetPointCount() const
+    {
+        return m_positions.size();
+    }
+
+    AZ_INLINE size_t SurfacePointLists::GetPointCount(size_t inPositionIndex) const
+    {
+        AZ_Assert(!m_isConstructing, "Points per input position are only available after EndListConstruction.");
+        return (inPositionIndex + 1 < m_pointOffsets.size()) ? (m_pointOffsets[inPositionIndex + 1] - m_pointOffsets[inPositionIndex]) : 0;
+    }
+
+    AZ_INLINE size_t SurfacePointLists::GetFirstPointIndex(size_t inPositionIndex) const
+    {
+        AZ_Assert(!m_isConstructing, "Points per input position are only available after EndListConstruction.");
+        return (inPositionIndex < m_pointOffsets.size()) ? m_pointOffsets[inPositionIndex] : m_positions.size();
+    }
+
+    AZ_INLINE bool SurfacePointLists::IsEmpty(size_t inPositionIndex) const
+    {
+        return GetPointCount(inPositionIndex) == 0;
+    }
+
+    AZ_INLINE size_t SurfacePointLists::GetInputPositionIndex(size_t pointIndex) const
+    {
+        return m_inputPositionIndices[pointIndex];
+    }
+
+    AZ_INLINE const AZ::EntityId& SurfacePointLists::GetEntityId(size_t pointIndex) const
+    {
+        return m_entityIds[pointIndex];
+    }
+
+    AZ_INLINE const AZ::Vector3& SurfacePointLists::GetPosition(size_t pointIndex) const
+    {
+        return m_positions[pointIndex];
+    }
+
+    AZ_INLINE const AZ::Vector3& SurfacePointLists::GetNormal(size_t pointIndex) const
+    {
+        return m_normals[pointIndex];
+    }
+
+    AZ_INLINE size_t SurfacePointLists::GetTagWeightCount(size_t pointIndex) const
+    {
+        AZ_Assert(!m_isConstructing, "Tag weights are only available after EndListConstruction.");
+        return m_tagWeightOffsets[pointIndex + 1] - m_tagWeightOffsets[pointIndex];
+    }
+
+    AZ_INLINE const SurfaceTagWeight& SurfacePointLists::GetTagWeight(size_t pointIndex, size_t tagWeightIndex) const
+    {
+        AZ_Assert(!m_isConstructing, "Tag weights are only available after EndListConstruction.");
+        return m_tagWeights[m_tagWeightOffsets[pointIndex] + tagWeightIndex];
+    }
+
+    AZ_INLINE bool SurfacePointLists::HasMatchingTags(size_t pointIndex, const SurfaceTagVector& sampleTags) const
+    {
+        AZ_Assert(!m_isConstructing, "Tag weights are only available after EndListConstruction.");
+        for (size_t tagWeightIndex = m_tagWeightOffsets[pointIndex]; tagWeightIndex < m_tagWeightOffsets[pointIndex + 1]; ++tagWeightIndex)
+        {
+            if (HasMatchingTag(sampleTags, m_tagWeights[tagWeightIndex].m_surfaceType))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    AZ_INLINE void SurfacePointLists::GetSurfaceTagWeights(size_t pointIndex, SurfaceTagWeightMap& masks) const
+    {
+        AZ_Assert(!m_isConstructing, "Tag weights are only available after EndListConstruction.");
+        masks.clear();
+        for (size_t tagWeightIndex = m_tagWeightOffsets[pointIndex]; tagWeightIndex < m_tagWeightOffsets[pointIndex + 1]; ++tagWeightIndex)
+        {
+            masks[m_tagWeights[tagWeightIndex].m_surfaceType] = m_tagWeights[tagWeightIndex].m_weight;
+        }
+    }
+
+    AZ_INLINE void SurfacePointLists::GetSurfacePoint(size_t pointIndex, SurfacePoint& surfacePoint) const
+    {
+        surfacePoint.m_entityId = m_entityIds[pointIndex];
+        surfacePoint.m_position = m_positions[pointIndex];
+        surfacePoint.m_normal = m_normals[pointIndex];
+        GetSurfaceTagWeights(pointIndex, surfacePoint.m_masks);
+    }
+
+    AZ_INLINE void SurfacePointLists::GetSurfacePointList(size_t inPositionIndex, SurfacePointList& surfacePointList) const
+    {
+        const size_t firstPointIndex = GetFirstPointIndex(inPositionIndex);
+        const size_t pointCount = GetPointCount(inPositionIndex);
+        surfacePointList.resize(pointCount);
+        for (size_t index = 0; index < pointCount; ++index)
+        {
+            GetSurfacePoint(firstPointIndex + index, surfacePointList[index]);
+        }
+    }
+}
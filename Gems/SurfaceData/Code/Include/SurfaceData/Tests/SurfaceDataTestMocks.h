@@ -204,6 +204,25 @@ namespace UnitTest
         {
         }
 
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointLists& surfacePointLists) const override
+        {
+            surfacePointLists.StartListConstruction(inPositions);
+            for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+            {
+                auto surfacePoints = m_GetSurfacePoints.find(AZStd::make_pair(inPositions[inPositionIndex].GetX(), inPositions[inPositionIndex].GetY()));
+
+                if (surfacePoints != m_GetSurfacePoints.end())
+                {
+                    for (const auto& surfacePoint : surfacePoints->second)
+                    {
+                        surfacePointLists.AddSurfacePoint(inPositionIndex, surfacePoint);
+                    }
+                }
+            }
+            surfacePointLists.EndListConstruction(SurfaceData::SurfaceTagVector());
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             return RegisterEntry(entry, m_providers);
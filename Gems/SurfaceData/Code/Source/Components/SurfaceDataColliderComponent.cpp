@@ -245,6 +245,28 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        // We want a full raycast, so don't just query the start point.
+        constexpr bool queryPointOnly = false;
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+        {
+            AZ::Vector3 hitPosition;
+            AZ::Vector3 hitNormal;
+            if (DoRayTrace(inPositions[inPositionIndex], queryPointOnly, hitPosition, hitNormal))
+            {
+                const size_t pointIndex = surfacePointLists.AddSurfacePoint(inPositionIndex, entityId, hitPosition, hitNormal);
+                surfacePointLists.AddSurfaceTagWeights(pointIndex, m_configuration.m_providerTags, 1.0f);
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -270,6 +292,32 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::ModifySurfacePointLists(SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid() && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            for (size_t pointIndex = 0; pointIndex < surfacePointLists.GetPointCount(); ++pointIndex)
+            {
+                const AZ::Vector3& position = surfacePointLists.GetPosition(pointIndex);
+                if (surfacePointLists.GetEntityId(pointIndex) != entityId && m_colliderBounds.Contains(position))
+                {
+                    AZ::Vector3 hitPosition;
+                    AZ::Vector3 hitNormal;
+                    constexpr bool queryPointOnly = true;
+                    if (DoRayTrace(position, queryPointOnly, hitPosition, hitNormal))
+                    {
+                        surfacePointLists.AddSurfaceTagWeights(pointIndex, m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::OnCompositionChanged()
     {
         if (!m_refresh)
@@ -81,10 +81,12 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointLists& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointLists(SurfacePointLists& surfacePointLists) const override;
 
     private:
         bool DoRayTrace(const AZ::Vector3& inPosition, bool queryPointOnly, AZ::Vector3& outPosition, AZ::Vector3& outNormal) const;
@@ -166,6 +166,42 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+
+            // Look up the shape once and cast all of the rays against it, instead of sending one bus event per position.
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(entityId, [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+                {
+                    const AZ::Vector3& inPosition = inPositions[inPositionIndex];
+                    if (!AabbContains2D(m_shapeBounds, inPosition))
+                    {
+                        continue;
+                    }
+
+                    const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
+                    float intersectionDistance = 0.0f;
+                    if (shape->IntersectRay(rayOrigin, rayDirection, intersectionDistance))
+                    {
+                        const size_t pointIndex = surfacePointLists.AddSurfacePoint(
+                            inPositionIndex, entityId, rayOrigin + intersectionDistance * rayDirection, AZ::Vector3::CreateAxisZ());
+                        surfacePointLists.AddSurfaceTagWeights(pointIndex, m_configuration.m_providerTags, 1.0f);
+                    }
+                }
+                return false;
+            });
+        }
+    }
+
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -190,6 +226,31 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::ModifySurfacePointLists(SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(entityId, [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t pointIndex = 0; pointIndex < surfacePointLists.GetPointCount(); ++pointIndex)
+                {
+                    const AZ::Vector3& position = surfacePointLists.GetPosition(pointIndex);
+                    if (surfacePointLists.GetEntityId(pointIndex) != entityId && m_shapeBounds.Contains(position) &&
+                        shape->IsPointInside(position))
+                    {
+                        surfacePointLists.AddSurfaceTagWeights(pointIndex, m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+                return false;
+            });
+        }
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
@@ -65,10 +65,12 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointLists& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointLists(SurfacePointLists& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::TransformNotificationBus
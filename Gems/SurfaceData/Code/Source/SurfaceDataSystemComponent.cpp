@@ -229,45 +229,68 @@ namespace SurfaceData
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
     {
+        AZ_PROFILE_FUNCTION(Entity);
+
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
         surfacePointListPerPosition.clear();
-        surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+        m_regionPositions.clear();
+        m_regionPositions.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
 
-        // Initialize our list-per-position list with every input position to query from the region.
+        // Build the list of every input position to query from the region.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
         for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
         {
             for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                m_regionPositions.emplace_back(x, y, AZ::Constants::FloatMax);
             }
         }
 
+        GetSurfacePointsFromList(m_regionPositions, desiredTags, m_regionPointLists);
+
+        // Copy the flat results into one list per position.
+        surfacePointListPerPosition.resize(m_regionPositions.size());
+        for (size_t inPositionIndex = 0; inPositionIndex < m_regionPositions.size(); ++inPositionIndex)
+        {
+            surfacePointListPerPosition[inPositionIndex].first = m_regionPositions[inPositionIndex];
+            m_regionPointLists.GetSurfacePointList(inPositionIndex, surfacePointListPerPosition[inPositionIndex].second);
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        surfacePointLists.StartListConstruction(inPositions);
+
+        AZ::Aabb inBounds = AZ::Aabb::CreateNull();
+        for (const auto& inPosition : inPositions)
+        {
+            inBounds.AddPoint(inPosition);
+        }
+
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
-        for (const auto& entryPair : m_registeredSurfaceDataProviders)
+        // Loop through each data provider, and send it the whole list of points.  This allows us to check the tags and the overall
+        // AABB bounds just once per provider, instead of once per point, and lets each provider look up whatever it needs for the
+        // query just once as well.  The provider's bounds are passed along with the lists, so that the default implementation can
+        // still skip the positions outside of them.
+        if (inBounds.IsValid())
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
-                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
-                )
+            for (const auto& entryPair : m_registeredSurfaceDataProviders)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                const bool alwaysApplies = !entry.m_bounds.IsValid();
+
+                if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
+                    (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inBounds)))
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                    if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                    {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
-                    }
+                    surfacePointLists.SetHandlerBounds(entry.m_bounds);
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, inPositions, surfacePointLists);
                 }
             }
         }
@@ -277,41 +300,27 @@ namespace SurfaceData
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        if (surfacePointLists.GetPointCount() > 0)
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                const bool alwaysApplies = !entry.m_bounds.IsValid();
+
+                if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inBounds))
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
-                    {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                        if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                        {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
-                        }
-                    }
+                    surfacePointLists.SetHandlerBounds(entry.m_bounds);
+                    SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointLists, surfacePointLists);
                 }
             }
         }
+        surfacePointLists.SetHandlerBounds(AZ::Aabb::CreateNull());
 
         // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
         // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
-        {
-            auto& surfacePointList = surfacePointListAndPoint.second;
-            if (!surfacePointList.empty())
-            {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
-            }
-        }
+        surfacePointLists.EndListConstruction(desiredTags);
     }
 
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
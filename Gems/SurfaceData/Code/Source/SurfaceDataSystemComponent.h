@@ -40,6 +40,7 @@ namespace SurfaceData
         // SurfaceDataSystemRequestBus implementation
         void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const override;
         void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const override;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointLists& surfacePointLists) const override;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) override;
         void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) override;
@@ -70,5 +71,9 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //region positions and point lists reserved for reuse
+        mutable AZStd::vector<AZ::Vector3> m_regionPositions;
+        mutable SurfacePointLists m_regionPointLists;
     };
 }
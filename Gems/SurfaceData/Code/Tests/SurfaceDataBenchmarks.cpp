@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <benchmark/benchmark.h>
+
+#include <SurfaceDataSystemComponent.h>
+#include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <SurfaceData/SurfaceDataProviderRequestBus.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+namespace UnitTest
+{
+    //! Surface provider with a cheap height function, so that the benchmarks mostly measure the cost of the surface data system.
+    //! It adds one point per position, and a second point below it at every other position so that points get sorted.
+    class BenchmarkSurfaceProvider
+        : public SurfaceData::SurfaceDataProviderRequestBus::Handler
+    {
+    public:
+        BenchmarkSurfaceProvider(const AZ::Aabb& bounds, const SurfaceData::SurfaceTagVector& tags)
+            : m_tags(tags)
+        {
+            SurfaceData::SurfaceDataRegistryEntry registryEntry;
+            registryEntry.m_entityId = m_entityId;
+            registryEntry.m_bounds = bounds;
+            registryEntry.m_tags = tags;
+
+            SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(
+                m_handle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataProvider, registryEntry);
+            SurfaceData::SurfaceDataProviderRequestBus::Handler::BusConnect(m_handle);
+        }
+
+        ~BenchmarkSurfaceProvider()
+        {
+            SurfaceData::SurfaceDataProviderRequestBus::Handler::BusDisconnect();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataProvider, m_handle);
+        }
+
+        void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            const size_t pointCount = GetPointCount(inPosition);
+            for (size_t index = 0; index < pointCount; ++index)
+            {
+                SurfaceData::SurfacePoint point;
+                point.m_entityId = m_entityId;
+                point.m_position = GetPosition(inPosition, index);
+                point.m_normal = AZ::Vector3::CreateAxisZ();
+                SurfaceData::AddMaxValueForMasks(point.m_masks, m_tags, 1.0f);
+                surfacePointList.push_back(point);
+            }
+        }
+
+        void GetSurfacePointsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointLists& surfacePointLists) const override
+        {
+            for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+            {
+                const size_t pointCount = GetPointCount(inPositions[inPositionIndex]);
+                for (size_t index = 0; index < pointCount; ++index)
+                {
+                    const size_t pointIndex = surfacePointLists.AddSurfacePoint(
+                        inPositionIndex, m_entityId, GetPosition(inPositions[inPositionIndex], index), AZ::Vector3::CreateAxisZ());
+                    surfacePointLists.AddSurfaceTagWeights(pointIndex, m_tags, 1.0f);
+                }
+            }
+        }
+
+    private:
+        static size_t GetPointCount(const AZ::Vector3& inPosition)
+        {
+            return (aznumeric_cast<int64_t>(inPosition.GetX()) & 1) ? 2 : 1;
+        }
+
+        static AZ::Vector3 GetPosition(const AZ::Vector3& inPosition, size_t index)
+        {
+            const float height = 16.0f * sinf(inPosition.GetX() * 0.01f) * cosf(inPosition.GetY() * 0.01f) - (index * 4.0f);
+            return AZ::Vector3(inPosition.GetX(), inPosition.GetY(), height);
+        }
+
+        AZ::EntityId m_entityId{ 0x12345678 };
+        SurfaceData::SurfaceTagVector m_tags;
+        SurfaceData::SurfaceDataRegistryHandle m_handle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+    };
+
+    //! Surface modifier that adds its tags to every point above a fixed height, like a water volume would.
+    class BenchmarkSurfaceModifier
+        : public SurfaceData::SurfaceDataModifierRequestBus::Handler
+    {
+    public:
+        BenchmarkSurfaceModifier(const AZ::Aabb& bounds, const SurfaceData::SurfaceTagVector& tags)
+            : m_tags(tags)
+        {
+            SurfaceData::SurfaceDataRegistryEntry registryEntry;
+            registryEntry.m_entityId = m_entityId;
+            registryEntry.m_bounds = bounds;
+            registryEntry.m_tags = tags;
+
+            SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(
+                m_handle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier, registryEntry);
+            SurfaceData::SurfaceDataModifierRequestBus::Handler::BusConnect(m_handle);
+        }
+
+        ~BenchmarkSurfaceModifier()
+        {
+            SurfaceData::SurfaceDataModifierRequestBus::Handler::BusDisconnect();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataModifier, m_handle);
+        }
+
+        void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            for (auto& point : surfacePointList)
+            {
+                if (point.m_position.GetZ() > 0.0f)
+                {
+                    SurfaceData::AddMaxValueForMasks(point.m_masks, m_tags, 1.0f);
+                }
+            }
+        }
+
+        void ModifySurfacePointLists(SurfaceData::SurfacePointLists& surfacePointLists) const override
+        {
+            for (size_t pointIndex = 0; pointIndex < surfacePointLists.GetPointCount(); ++pointIndex)
+            {
+                if (surfacePointLists.GetPosition(pointIndex).GetZ() > 0.0f)
+                {
+                    surfacePointLists.AddSurfaceTagWeights(pointIndex, m_tags, 1.0f);
+                }
+            }
+        }
+
+    private:
+        AZ::EntityId m_entityId{ 0x87654321 };
+        SurfaceData::SurfaceTagVector m_tags;
+        SurfaceData::SurfaceDataRegistryHandle m_handle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+    };
+
+    //! Creates a surface data system with one provider and one modifier covering the whole queried region.
+    //! The benchmarks report the number of allocations per iteration when allocation records are enabled.
+    class SurfaceDataBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            const float regionSize = aznumeric_cast<float>(state.range(0));
+            m_regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, -32.0f), AZ::Vector3(regionSize, regionSize, 32.0f));
+
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 512 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(appDesc);
+            m_app->RegisterComponentDescriptor(SurfaceData::SurfaceDataSystemComponent::CreateDescriptor());
+            systemEntity->CreateComponent<SurfaceData::SurfaceDataSystemComponent>();
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            m_provider = AZStd::make_unique<BenchmarkSurfaceProvider>(
+                m_regionBounds, SurfaceData::SurfaceTagVector{ SurfaceData::SurfaceTag(AZ::Crc32("benchmark_surface")) });
+            m_modifier = AZStd::make_unique<BenchmarkSurfaceModifier>(
+                m_regionBounds, SurfaceData::SurfaceTagVector{ SurfaceData::SurfaceTag(AZ::Crc32("benchmark_modifier")) });
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            m_modifier.reset();
+            m_provider.reset();
+            m_app->Destroy();
+            m_app.reset();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        static size_t GetAllocationCount()
+        {
+            AZ::Debug::AllocationRecords* records = AZ::AllocatorInstance<AZ::SystemAllocator>::GetAllocator().GetRecords();
+            return records ? records->RequestedAllocs() : 0;
+        }
+
+        static void ReportCounters(::benchmark::State& state, size_t allocationCount)
+        {
+            const int64_t pointCount = state.range(0) * state.range(0);
+            state.SetItemsProcessed(state.iterations() * pointCount);
+            state.counters["AllocationsPerMillionPoints"] = ::benchmark::Counter(
+                aznumeric_cast<double>(allocationCount) * 1000000.0 / aznumeric_cast<double>(state.iterations() * pointCount));
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<BenchmarkSurfaceProvider> m_provider;
+        AZStd::unique_ptr<BenchmarkSurfaceModifier> m_modifier;
+        AZ::Aabb m_regionBounds;
+    };
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmarkFixture, GetSurfacePoints_PerPosition)(::benchmark::State& state)
+    {
+        const int64_t regionSize = state.range(0);
+        SurfaceData::SurfacePointList points;
+        size_t allocationCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t startAllocationCount = GetAllocationCount();
+            for (int64_t y = 0; y < regionSize; ++y)
+            {
+                for (int64_t x = 0; x < regionSize; ++x)
+                {
+                    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
+                        AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), 0.0f), SurfaceData::SurfaceTagVector(), points);
+                    ::benchmark::DoNotOptimize(points.data());
+                }
+            }
+            allocationCount += GetAllocationCount() - startAllocationCount;
+        }
+        ReportCounters(state, allocationCount);
+    }
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmarkFixture, GetSurfacePoints_PerPosition)->Arg(1024)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmarkFixture, GetSurfacePointsFromRegion)(::benchmark::State& state)
+    {
+        SurfaceData::SurfacePointListPerPosition pointsPerPosition;
+        size_t allocationCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t startAllocationCount = GetAllocationCount();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, m_regionBounds, AZ::Vector2(1.0f),
+                SurfaceData::SurfaceTagVector(), pointsPerPosition);
+            ::benchmark::DoNotOptimize(pointsPerPosition.data());
+            allocationCount += GetAllocationCount() - startAllocationCount;
+        }
+        ReportCounters(state, allocationCount);
+    }
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmarkFixture, GetSurfacePointsFromRegion)->Arg(1024)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmarkFixture, GetSurfacePointsFromList)(::benchmark::State& state)
+    {
+        const int64_t regionSize = state.range(0);
+        AZStd::vector<AZ::Vector3> inPositions;
+        inPositions.reserve(aznumeric_cast<size_t>(regionSize * regionSize));
+        for (int64_t y = 0; y < regionSize; ++y)
+        {
+            for (int64_t x = 0; x < regionSize; ++x)
+            {
+                inPositions.emplace_back(aznumeric_cast<float>(x), aznumeric_cast<float>(y), 0.0f);
+            }
+        }
+
+        // The lists are reused between iterations, the same way a caller that queries repeatedly would use them.
+        SurfaceData::SurfacePointLists surfacePointLists;
+        size_t allocationCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t startAllocationCount = GetAllocationCount();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList, inPositions,
+                SurfaceData::SurfaceTagVector(), surfacePointLists);
+            ::benchmark::DoNotOptimize(surfacePointLists.GetPointCount());
+            allocationCount += GetAllocationCount() - startAllocationCount;
+        }
+        ReportCounters(state, allocationCount);
+    }
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmarkFixture, GetSurfacePointsFromList)->Arg(1024)->Unit(::benchmark::kMillisecond);
+}
+
+#endif // HAVE_BENCHMARK
@@ -64,11 +64,12 @@ class MockSurfaceProvider
 
         MockSurfaceProvider(ProviderType providerType, const SurfaceData::SurfaceTagVector& surfaceTags,
                             AZ::Vector3 start, AZ::Vector3 end, AZ::Vector3 stepSize,
-                            AZ::EntityId id = AZ::EntityId(0x12345678))
+                            AZ::EntityId id = AZ::EntityId(0x12345678), const AZ::Aabb& registeredBounds = AZ::Aabb::CreateNull())
         {
             m_tags = surfaceTags;
             m_providerType = providerType;
             m_id = id;
+            m_registeredBounds = registeredBounds;
             SetPoints(start, end, stepSize);
             Register();
         }
@@ -83,6 +84,8 @@ class MockSurfaceProvider
         SurfaceData::SurfaceTagVector m_tags;
         ProviderType m_providerType;
         AZ::EntityId m_id;
+        // If valid, registered instead of the bounds of the points, for providers that don't check their bounds themselves.
+        AZ::Aabb m_registeredBounds;
 
         void SetPoints(AZ::Vector3 start, AZ::Vector3 end, AZ::Vector3 stepSize)
         {
@@ -131,7 +134,7 @@ class MockSurfaceProvider
         {
             SurfaceData::SurfaceDataRegistryEntry registryEntry;
             registryEntry.m_entityId = m_id;
-            registryEntry.m_bounds = GetBounds();
+            registryEntry.m_bounds = m_registeredBounds.IsValid() ? m_registeredBounds : GetBounds();
             registryEntry.m_tags = m_tags;
 
             m_providerHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
@@ -740,4 +743,119 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromList_MatchesGetSurfacePoints)
+{
+    // This test verifies that GetSurfacePointsFromList produces the same points, in the same order and with the same tags,
+    // as querying each position individually with GetSurfacePoints.  It uses a provider and a modifier that only implement
+    // the single-point requests, so it also covers the default list implementations on both buses.
+
+    // Create a mock Surface Provider that covers from (0, 0) - (8, 8) in space, with heights of 0 and 4 and the tag "test_surface1".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Create a mock Surface Modifier that only covers from (0, 0) - (2, 2) and adds the tag "test_surface2".
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(2.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Query positions both inside and outside of the provider, in an arbitrary order.
+    AZStd::vector<AZ::Vector3> inPositions =
+    {
+        AZ::Vector3(3.0f, 1.0f, 0.0f),
+        AZ::Vector3(1.0f, 1.0f, 0.0f),
+        AZ::Vector3(12.0f, 12.0f, 0.0f),
+        AZ::Vector3(0.0f, 5.0f, 0.0f),
+    };
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfacePointLists surfacePointLists;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList, inPositions, testTags, surfacePointLists);
+
+    ASSERT_EQ(surfacePointLists.GetInputPositionCount(), inPositions.size());
+    for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+    {
+        SurfaceData::SurfacePointList expectedPoints;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints, inPositions[inPositionIndex], testTags, expectedPoints);
+
+        SurfaceData::SurfacePointList listPoints;
+        surfacePointLists.GetSurfacePointList(inPositionIndex, listPoints);
+
+        ASSERT_EQ(listPoints.size(), expectedPoints.size());
+        EXPECT_EQ(surfacePointLists.GetPointCount(inPositionIndex), expectedPoints.size());
+        for (size_t pointIndex = 0; pointIndex < listPoints.size(); ++pointIndex)
+        {
+            EXPECT_EQ(listPoints[pointIndex].m_entityId, expectedPoints[pointIndex].m_entityId);
+            EXPECT_TRUE(listPoints[pointIndex].m_position.IsClose(expectedPoints[pointIndex].m_position));
+            EXPECT_TRUE(listPoints[pointIndex].m_normal.IsClose(expectedPoints[pointIndex].m_normal));
+            EXPECT_EQ(listPoints[pointIndex].m_masks, expectedPoints[pointIndex].m_masks);
+        }
+    }
+
+    // Spot-check the expected results: points in the modifier have both tags, points outside of the provider don't exist.
+    EXPECT_EQ(surfacePointLists.GetPointCount(1), 2u);
+    EXPECT_EQ(surfacePointLists.GetTagWeightCount(surfacePointLists.GetFirstPointIndex(1)), 2u);
+    EXPECT_EQ(surfacePointLists.GetTagWeightCount(surfacePointLists.GetFirstPointIndex(0)), 1u);
+    EXPECT_TRUE(surfacePointLists.IsEmpty(2));
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromList_DefaultImplementationsRespectRegisteredBounds)
+{
+    // This test verifies that the default list implementations of providers and modifiers that don't check their own bounds
+    // only produce and modify points inside of their registered bounds, the same as GetSurfacePoints.
+
+    // Create a mock Surface Provider with points from (0, 0) - (8, 8) in space, but only registered for (0, 0) - (4, 4).
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f), AZ::EntityId(0x12345678),
+                                     AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f, 4.0f, 8.0f)));
+
+    // Create a mock Surface Modifier with points from (0, 0) - (8, 8) in space, but only registered for (0, 0) - (2, 2).
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f), AZ::EntityId(0x87654321),
+                                     AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(2.0f, 2.0f, 8.0f)));
+
+    AZStd::vector<AZ::Vector3> inPositions =
+    {
+        AZ::Vector3(1.0f, 1.0f, 0.0f),
+        AZ::Vector3(3.0f, 3.0f, 0.0f),
+        AZ::Vector3(6.0f, 6.0f, 0.0f),
+    };
+
+    SurfaceData::SurfacePointLists surfacePointLists;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList, inPositions, SurfaceData::SurfaceTagVector(),
+        surfacePointLists);
+
+    ASSERT_EQ(surfacePointLists.GetInputPositionCount(), inPositions.size());
+    for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+    {
+        SurfaceData::SurfacePointList expectedPoints;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints, inPositions[inPositionIndex],
+            SurfaceData::SurfaceTagVector(), expectedPoints);
+
+        SurfaceData::SurfacePointList listPoints;
+        surfacePointLists.GetSurfacePointList(inPositionIndex, listPoints);
+
+        ASSERT_EQ(listPoints.size(), expectedPoints.size());
+        for (size_t pointIndex = 0; pointIndex < listPoints.size(); ++pointIndex)
+        {
+            EXPECT_TRUE(listPoints[pointIndex].m_position.IsClose(expectedPoints[pointIndex].m_position));
+            EXPECT_EQ(listPoints[pointIndex].m_masks, expectedPoints[pointIndex].m_masks);
+        }
+    }
+
+    // Inside both bounds, points have both tags. Inside the provider only, points only have the provider tag.
+    // Outside of the provider's bounds there are no points, even though the provider would return some.
+    ASSERT_EQ(surfacePointLists.GetPointCount(0), 2u);
+    EXPECT_EQ(surfacePointLists.GetTagWeightCount(surfacePointLists.GetFirstPointIndex(0)), 2u);
+    ASSERT_EQ(surfacePointLists.GetPointCount(1), 2u);
+    EXPECT_EQ(surfacePointLists.GetTagWeightCount(surfacePointLists.GetFirstPointIndex(1)), 1u);
+    EXPECT_TRUE(surfacePointLists.IsEmpty(2));
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
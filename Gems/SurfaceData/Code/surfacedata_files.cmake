@@ -15,6 +15,7 @@ set(FILES
     Include/SurfaceData/SurfaceDataTagProviderRequestBus.h
     Include/SurfaceData/SurfaceDataProviderRequestBus.h
     Include/SurfaceData/SurfaceDataModifierRequestBus.h
+    Include/SurfaceData/SurfacePointLists.h
     Include/SurfaceData/SurfaceTag.h
     Include/SurfaceData/Utility/SurfaceDataUtility.h
     Source/SurfaceDataSystemComponent.cpp
@@ -264,24 +264,27 @@ namespace Terrain
         int32_t gridWidth, gridHeight;
         GetHeightfieldGridSize(gridWidth, gridHeight);
 
+        const size_t numColumns = aznumeric_cast<size_t>(AZStd::max(gridWidth, 0));
+        const size_t numRows = aznumeric_cast<size_t>(AZStd::max(gridHeight, 0));
+
+        // Positions that don't get processed keep the height they'd have if there was no terrain.
         heights.clear();
-        heights.reserve(gridWidth * gridHeight);
+        heights.resize(numColumns * numRows, -worldCenterZ);
 
-        for (int32_t row = 0; row < gridHeight; row++)
+        // Query the whole grid with one region request so that the terrain system can process it in parallel.
+        // Every grid position is only passed to the callback once, so it can write to its own entry without locking.
+        auto perPositionCallback = [&heights, numColumns, numRows, worldCenterZ](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
         {
-            const float y = row * gridResolution.GetY() + worldSize.GetMin().GetY();
-            for (int32_t col = 0; col < gridWidth; col++)
+            if ((xIndex < numColumns) && (yIndex < numRows))
             {
-                const float x = col * gridResolution.GetX() + worldSize.GetMin().GetX();
-                float height = 0.0f;
-
-                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
-                    height, &AzFramework::Terrain::TerrainDataRequests::GetHeightFromFloats, x, y,
-                    AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, nullptr);
-
-                heights.emplace_back(height - worldCenterZ);
+                heights[(yIndex * numColumns) + xIndex] = surfacePoint.m_position.GetZ() - worldCenterZ;
             }
-        }
+        };
+
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegion, worldSize, gridResolution, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     uint8_t TerrainPhysicsColliderComponent::GetMaterialIdIndex(const Physics::MaterialId& materialId, const AZStd::vector<Physics::MaterialId>& materialList) const
@@ -326,47 +329,65 @@ namespace Terrain
         int32_t gridWidth, gridHeight;
         GetHeightfieldGridSize(gridWidth, gridHeight);
 
+        const size_t numColumns = aznumeric_cast<size_t>(AZStd::max(gridWidth, 0));
+        const size_t numRows = aznumeric_cast<size_t>(AZStd::max(gridHeight, 0));
+
+        const AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
+
+        // Positions that don't get processed are holes with the default material.
+        Physics::HeightMaterialPoint defaultPoint;
+        defaultPoint.m_height = worldHeightBoundsMin - worldCenterZ;
+        defaultPoint.m_quadMeshType = Physics::QuadMeshType::Hole;
+        defaultPoint.m_materialIndex = GetMaterialIdIndex(Physics::MaterialId(), materialList);
+
         heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        heightMaterials.resize(numColumns * numRows, defaultPoint);
+
+        // Query the heights and surface weights for the whole grid with region requests so that the terrain system can process them
+        // in parallel. Every grid position is only passed to the callbacks once, so they can write to their own entry without locking.
+        auto perPositionHeightCallback = [&heightMaterials, numColumns, numRows, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            if ((xIndex >= numColumns) || (yIndex >= numRows))
+            {
+                return;
+            }
+
+            float height = surfacePoint.m_position.GetZ();
 
-        AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
+            // Any heights that fall outside the range of our bounding box will get turned into holes.
+            if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
+            {
+                height = worldHeightBoundsMin;
+                terrainExists = false;
+            }
 
-        for (int32_t row = 0; row < gridHeight; row++)
+            Physics::HeightMaterialPoint& point = heightMaterials[(yIndex * numColumns) + xIndex];
+            point.m_height = height - worldCenterZ;
+            point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
+        };
+
+        auto perPositionSurfaceCallback = [this, &heightMaterials, &materialList, numColumns, numRows](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
         {
-            const float y = row * gridResolution.GetY() + worldSize.GetMin().GetY();
-            for (int32_t col = 0; col < gridWidth; col++)
+            if ((xIndex >= numColumns) || (yIndex >= numRows))
             {
-                const float x = col * gridResolution.GetX() + worldSize.GetMin().GetX();
-                float height = 0.0f;
-
-                bool terrainExists = true;
-                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
-                    height, &AzFramework::Terrain::TerrainDataRequests::GetHeightFromFloats, x, y,
-                    AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, &terrainExists);
-
-                // Any heights that fall outside the range of our bounding box will get turned into holes.
-                if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
-                {
-                    height = worldHeightBoundsMin;
-                    terrainExists = false;
-                }
-
-                // Find the best surface tag at this point.
-                AzFramework::SurfaceData::SurfaceTagWeight surfaceWeight;
-                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
-                    surfaceWeight, &AzFramework::Terrain::TerrainDataRequests::GetMaxSurfaceWeightFromFloats, x, y,
-                    AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, nullptr);
-
-                Physics::HeightMaterialPoint point;
-                point.m_height = height - worldCenterZ;
-                point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
-
-                Physics::MaterialId materialId = FindMaterialIdForSurfaceTag(surfaceWeight.m_surfaceType);
-                point.m_materialIndex = GetMaterialIdIndex(materialId, materialList);
-
-                heightMaterials.emplace_back(point);
+                return;
             }
-        }
+
+            // The surface weights are sorted, so the first one is the best surface tag at this point.
+            const Physics::MaterialId materialId = surfacePoint.m_surfaceTags.empty()
+                ? Physics::MaterialId()
+                : FindMaterialIdForSurfaceTag(surfacePoint.m_surfaceTags.front().m_surfaceType);
+            heightMaterials[(yIndex * numColumns) + xIndex].m_materialIndex = GetMaterialIdIndex(materialId, materialList);
+        };
+
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegion, worldSize, gridResolution, perPositionHeightCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::ProcessSurfaceWeightsFromRegion, worldSize, gridResolution,
+            perPositionSurfaceCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     AZ::Vector2 TerrainPhysicsColliderComponent::GetHeightfieldGridSpacing() const
@@ -180,6 +180,55 @@ namespace Terrain
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointLists& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (m_terrainBoundsIsValid)
+        {
+            // Look up the terrain system once for the whole list instead of once per position.
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+                const AZ::EntityId entityId = GetEntityId();
+                AzFramework::SurfaceData::SurfacePoint terrainSurfacePoint;
+
+                for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); ++inPositionIndex)
+                {
+                    const AZ::Vector3& inPosition = inPositions[inPositionIndex];
+                    if (!SurfaceData::AabbContains2D(terrainAabb, inPosition))
+                    {
+                        continue;
+                    }
+
+                    bool isTerrainValidAtPoint = false;
+                    terrain->GetSurfacePoint(
+                        inPosition, terrainSurfacePoint, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+                        &isTerrainValidAtPoint);
+
+                    const bool isHole = !isTerrainValidAtPoint;
+                    const size_t pointIndex = surfacePointLists.AddSurfacePoint(
+                        inPositionIndex, entityId, terrainSurfacePoint.m_position, terrainSurfacePoint.m_normal);
+
+                    // Always add a "terrain" or "terrainHole" tag.
+                    const AZ::Crc32 terrainTag =
+                        isHole ? SurfaceData::Constants::s_terrainHoleTagCrc : SurfaceData::Constants::s_terrainTagCrc;
+                    surfacePointLists.AddSurfaceTagWeight(pointIndex, terrainTag, 1.0f);
+
+                    // Add all of the surface tags that the terrain has at this point.
+                    for (auto& tag : terrainSurfacePoint.m_surfaceTags)
+                    {
+                        surfacePointLists.AddSurfaceTagWeight(pointIndex, tag.m_surfaceType, tag.m_weight);
+                    }
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
@@ -57,6 +57,8 @@ namespace Terrain
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointLists& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AzFramework::Terrain::TerrainDataNotificationBus
@@ -7,7 +7,12 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
@@ -527,9 +532,11 @@ const char* TerrainSystem::GetMaxSurfaceName(
     return "";
 }
 
-/*
-
-void TerrainSystem::ProcessHeightsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, Sampler sampleFilter, SurfacePointRegionFillCallback perPositionCallback, TerrainDataReadyCallback onComplete)
+void TerrainSystem::ProcessRegion(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    const SurfacePointRegionFillCallback& perPositionCallback,
+    const RegionSampleFunction& sampleFunction) const
 {
     // Don't bother processing if we don't have a callback
     if (!perPositionCallback)
@@ -537,59 +544,128 @@ void TerrainSystem::ProcessHeightsFromRegion(const AZ::Aabb& inRegion, const AZ:
         return;
     }
 
-    uint32_t numSamplesX = static_cast<uint32_t>((inRegion.GetMax().GetX() - inRegion.GetMin().GetX()) / stepSize.GetX());
-    uint32_t numSamplesY = static_cast<uint32_t>((inRegion.GetMax().GetY() - inRegion.GetMin().GetY()) / stepSize.GetY());
+    const auto [numSamplesX, numSamplesY] = GetNumSamplesFromRegion(inRegion, stepSize);
+    if ((numSamplesX == 0) || (numSamplesY == 0))
+    {
+        return;
+    }
 
-    for (uint32_t y = 0; y < numSamplesY; y++)
+    auto processRows = [&inRegion, &stepSize, &perPositionCallback, &sampleFunction, numSamplesX = numSamplesX](
+                           size_t firstRow, size_t lastRow)
     {
-        for (uint32_t x = 0; x < numSamplesX; x++)
+        AzFramework::SurfaceData::SurfacePoint surfacePoint;
+        for (size_t y = firstRow; y < lastRow; y++)
         {
-            float fx = (float)(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            float fy = (float)(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
-
-            SurfaceData::SurfacePoint surfacePoint;
-            GetHeight(AZ::Vector3(fx, fy, 0.0f), sampleFilter, surfacePoint.m_position);
-            perPositionCallback(surfacePoint, x, y);
+            const float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
+            for (size_t x = 0; x < numSamplesX; x++)
+            {
+                const float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
+                bool terrainExists = false;
+                surfacePoint.m_position.Set(fx, fy, inRegion.GetMin().GetZ());
+                sampleFunction(fx, fy, surfacePoint, terrainExists);
+                perPositionCallback(x, y, surfacePoint, terrainExists);
+            }
         }
-    }
+    };
+
+    // Small regions aren't worth the overhead of scheduling work. Larger regions are split into a few bands of rows per thread so
+    // that threads that finish early can pick up more work.
+    constexpr size_t MinSamplesPerBand = 4096;
+    constexpr size_t BandsPerThread = 4;
+    const size_t maxBands = AZStd::max(AZStd::thread::hardware_concurrency(), 1u) * BandsPerThread;
+    const size_t numBands = AZStd::min(AZStd::min(numSamplesY, maxBands), (numSamplesX * numSamplesY) / MinSamplesPerBand);
+    const size_t rowsPerBand = (numBands > 1) ? (numSamplesY + numBands - 1) / numBands : numSamplesY;
 
-    if (onComplete)
+    const AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+    if (numBands <= 1)
     {
-        onComplete();
+        processRows(0, numSamplesY);
     }
-}
+    else if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+    {
+        static const AZ::TaskDescriptor processRegionDescriptor{ "Terrain::TerrainSystem::ProcessRegion", "Terrain" };
+        AZ::TaskGraph taskGraph;
+        for (size_t firstRow = 0; firstRow < numSamplesY; firstRow += rowsPerBand)
+        {
+            const size_t lastRow = AZStd::min(firstRow + rowsPerBand, numSamplesY);
+            taskGraph.AddTask(
+                processRegionDescriptor,
+                [&processRows, firstRow, lastRow]()
+                {
+                    processRows(firstRow, lastRow);
+                });
+        }
 
+        // Waiting blocks the calling thread, which would deadlock if all task graph workers end up waiting here.
+        AZ::TaskGraphEvent waitForCompletion;
+        taskGraph.Submit(&waitForCompletion);
+        waitForCompletion.Wait();
+    }
+    else if (AZ::JobContext::GetGlobalContext())
+    {
+        AZ::JobCompletion processRegionCompletion;
+        for (size_t firstRow = 0; firstRow < numSamplesY; firstRow += rowsPerBand)
+        {
+            const size_t lastRow = AZStd::min(firstRow + rowsPerBand, numSamplesY);
+            AZ::Job* processRegionJob = AZ::CreateJobFunction(
+                [&processRows, firstRow, lastRow]()
+                {
+                    processRows(firstRow, lastRow);
+                },
+                true, nullptr);
+            processRegionJob->SetDependent(&processRegionCompletion);
+            processRegionJob->Start();
+        }
 
-void TerrainSystem::ProcessSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, Sampler sampleFilter, SurfacePointRegionFillCallback perPositionCallback, TerrainDataReadyCallback onComplete)
-{
-    // Don't bother processing if we don't have a callback
-    if (!perPositionCallback)
+        processRegionCompletion.StartAndWaitForCompletion();
+    }
+    else
     {
-        return;
+        processRows(0, numSamplesY);
     }
+}
 
-    uint32_t numSamplesX = static_cast<uint32_t>((inRegion.GetMax().GetX() - inRegion.GetMin().GetX()) / stepSize.GetX());
-    uint32_t numSamplesY = static_cast<uint32_t>((inRegion.GetMax().GetY() - inRegion.GetMin().GetY()) / stepSize.GetY());
+void TerrainSystem::ProcessHeightsFromRegion(
+    const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+{
+    ProcessRegion(inRegion, stepSize, perPositionCallback,
+        [this, sampleFilter](float x, float y, AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+        {
+            surfacePoint.m_position.SetZ(GetHeightSynchronous(x, y, sampleFilter, &terrainExists));
+        });
+}
 
-    for (uint32_t y = 0; y < numSamplesY; y++)
-    {
-        for (uint32_t x = 0; x < numSamplesX; x++)
+void TerrainSystem::ProcessNormalsFromRegion(
+    const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+{
+    ProcessRegion(inRegion, stepSize, perPositionCallback,
+        [this, sampleFilter](float x, float y, AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
         {
-            float fx = (float)(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            float fy = (float)(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
+            surfacePoint.m_normal = GetNormalSynchronous(x, y, sampleFilter, &terrainExists);
+        });
+}
 
-            SurfaceData::SurfacePoint surfacePoint;
-            GetSurfacePoint(AZ::Vector3(fx, fy, inRegion.GetMin().GetZ()), sampleFilter, surfacePoint);
-            perPositionCallback(surfacePoint, x, y);
-        }
-    }
+void TerrainSystem::ProcessSurfaceWeightsFromRegion(
+    const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+{
+    ProcessRegion(inRegion, stepSize, perPositionCallback,
+        [this, sampleFilter](float x, float y, AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+        {
+            GetOrderedSurfaceWeights(x, y, sampleFilter, surfacePoint.m_surfaceTags, &terrainExists);
+        });
+}
 
-    if (onComplete)
-    {
-        onComplete();
-    }
+void TerrainSystem::ProcessSurfacePointsFromRegion(
+    const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+{
+    ProcessRegion(inRegion, stepSize, perPositionCallback,
+        [this, sampleFilter](float x, float y, AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)
+        {
+            surfacePoint.m_position.SetZ(GetHeightSynchronous(x, y, sampleFilter, &terrainExists));
+            surfacePoint.m_normal = GetNormalSynchronous(x, y, sampleFilter, nullptr);
+            GetOrderedSurfaceWeights(x, y, sampleFilter, surfacePoint.m_surfaceTags, nullptr);
+        });
 }
-*/
 
 void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 {
@@ -135,8 +135,43 @@ namespace Terrain
             Sampler sampleFilter = Sampler::DEFAULT,
             bool* terrainExistsPtr = nullptr) const override;
 
+        //! Region queries split the region into bands of rows and process the bands in parallel on the task graph or the job manager.
+        void ProcessHeightsFromRegion(
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+        void ProcessNormalsFromRegion(
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+        void ProcessSurfaceWeightsFromRegion(
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+        void ProcessSurfacePointsFromRegion(
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
 
     private:
+        //! Fills in the surface point for the position x,y and sets terrainExists.
+        using RegionSampleFunction =
+            AZStd::function<void(float x, float y, AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool& terrainExists)>;
+
+        //! Runs sampleFunction and perPositionCallback for every position in the region. Large regions are split into bands of rows
+        //! that run on the task graph or job system, so the callback can be called concurrently for different positions.
+        //! Blocks until all bands are processed. The task graph path waits on a TaskGraphEvent, which doesn't process other tasks
+        //! while waiting, so this must not be called from a task graph worker.
+        void ProcessRegion(
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            const SurfacePointRegionFillCallback& perPositionCallback,
+            const RegionSampleFunction& sampleFunction) const;
+
         void ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ::Vector2& normalizedDelta) const;
         bool InWorldBounds(float x, float y) const;
 
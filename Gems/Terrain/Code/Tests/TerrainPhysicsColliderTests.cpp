@@ -417,18 +417,15 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderGetHeightsAndM
     NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
     ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
     ON_CALL(terrainListener, GetHeightFromFloats).WillByDefault(Return(mockHeight));
-    ON_CALL(terrainListener, GetMaxSurfaceWeightFromFloats)
+    ON_CALL(terrainListener, GetSurfaceWeightsFromFloats)
         .WillByDefault(
             [return1, return2](
-                [[maybe_unused]] float x, [[maybe_unused]] float y,
+                [[maybe_unused]] float x, [[maybe_unused]] float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
                 [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter, [[maybe_unused]] bool* terrainExistsPtr)
             {
                 // return tag1 for the first half of the rows, tag2 for the rest.
-                if (y < 128.0)
-                {
-                    return return1;
-                }
-                return return2;
+                outSurfaceWeights.clear();
+                outSurfaceWeights.push_back((y < 128.0) ? return1 : return2);
             });
 
     AZStd::vector<Physics::HeightMaterialPoint> heightsAndMaterials;
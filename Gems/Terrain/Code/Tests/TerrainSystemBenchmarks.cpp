@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Jobs/JobManagerComponent.h>
+#include <AzCore/Math/MathUtils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <TerrainSystem/TerrainSystem.h>
+#include <Components/TerrainLayerSpawnerComponent.h>
+
+#include <Terrain/MockTerrain.h>
+#include <MockAxisAlignedBoxShapeComponent.h>
+
+namespace UnitTest
+{
+    //! Height provider with a cheap height function, so that the benchmarks mostly measure the cost of the terrain queries.
+    class BenchmarkTerrainAreaHeightProvider : public Terrain::TerrainAreaHeightRequestBus::Handler
+    {
+    public:
+        BenchmarkTerrainAreaHeightProvider(AZ::EntityId entityId)
+        {
+            Terrain::TerrainAreaHeightRequestBus::Handler::BusConnect(entityId);
+        }
+
+        ~BenchmarkTerrainAreaHeightProvider()
+        {
+            Terrain::TerrainAreaHeightRequestBus::Handler::BusDisconnect();
+        }
+
+        void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, bool& terrainExists) override
+        {
+            outPosition = inPosition;
+            outPosition.SetZ(16.0f * sinf(inPosition.GetX() * 0.01f) * cosf(inPosition.GetY() * 0.01f));
+            terrainExists = true;
+        }
+    };
+
+    //! Creates a terrain system with a single terrain layer spawner covering the whole heightfield, the way a physics heightfield
+    //! rebuild sees it.
+    class TerrainSystemBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            const float heightfieldSize = aznumeric_cast<float>(state.range(0));
+            m_heightfieldBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, -32.0f), AZ::Vector3(heightfieldSize, heightfieldSize, 32.0f));
+
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(appDesc);
+            systemEntity->AddComponent(aznew AZ::JobManagerComponent());
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            m_app->RegisterComponentDescriptor(MockAxisAlignedBoxShapeComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Terrain::TerrainLayerSpawnerComponent::CreateDescriptor());
+
+            m_spawnerEntity = AZStd::make_unique<AZ::Entity>();
+            m_spawnerEntity->CreateComponent<MockAxisAlignedBoxShapeComponent>();
+            m_spawnerEntity->CreateComponent<Terrain::TerrainLayerSpawnerComponent>();
+
+            m_shapeRequests = AZStd::make_unique<::testing::NiceMock<MockShapeComponentRequests>>(m_spawnerEntity->GetId());
+            ON_CALL(*m_shapeRequests, GetEncompassingAabb).WillByDefault(::testing::Return(m_heightfieldBounds));
+            m_heightProvider = AZStd::make_unique<BenchmarkTerrainAreaHeightProvider>(m_spawnerEntity->GetId());
+
+            m_spawnerEntity->Init();
+            m_spawnerEntity->Activate();
+
+            m_terrainSystem = AZStd::make_unique<Terrain::TerrainSystem>();
+            m_terrainSystem->SetTerrainAabb(m_heightfieldBounds);
+            m_terrainSystem->SetTerrainHeightQueryResolution(AZ::Vector2(1.0f));
+            m_terrainSystem->Activate();
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+
+            m_heights.resize(aznumeric_cast<size_t>(state.range(0) * state.range(0)));
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            m_heights = {};
+            m_terrainSystem->Deactivate();
+            m_terrainSystem.reset();
+            m_spawnerEntity.reset();
+            m_heightProvider.reset();
+            m_shapeRequests.reset();
+            m_app->Destroy();
+            m_app.reset();
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<AZ::Entity> m_spawnerEntity;
+        AZStd::unique_ptr<::testing::NiceMock<MockShapeComponentRequests>> m_shapeRequests;
+        AZStd::unique_ptr<BenchmarkTerrainAreaHeightProvider> m_heightProvider;
+        AZStd::unique_ptr<Terrain::TerrainSystem> m_terrainSystem;
+        AZ::Aabb m_heightfieldBounds;
+        AZStd::vector<float> m_heights;
+    };
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, RebuildHeightfield_PerPosition)(::benchmark::State& state)
+    {
+        // Query one position at a time, which is how the physics heightfield used to get rebuilt.
+        const size_t heightfieldSize = aznumeric_cast<size_t>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t y = 0; y < heightfieldSize; y++)
+            {
+                for (size_t x = 0; x < heightfieldSize; x++)
+                {
+                    float height = 0.0f;
+                    AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+                        height, &AzFramework::Terrain::TerrainDataRequests::GetHeightFromFloats, aznumeric_cast<float>(x),
+                        aznumeric_cast<float>(y), AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, nullptr);
+                    m_heights[(y * heightfieldSize) + x] = height;
+                }
+            }
+            ::benchmark::DoNotOptimize(m_heights.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, RebuildHeightfield_PerPosition)
+        ->Arg(1024)->Arg(4096)->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, RebuildHeightfield_Region)(::benchmark::State& state)
+    {
+        const size_t heightfieldSize = aznumeric_cast<size_t>(state.range(0));
+        auto perPositionCallback = [this, heightfieldSize](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            m_heights[(yIndex * heightfieldSize) + xIndex] = surfacePoint.m_position.GetZ();
+        };
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegion, m_heightfieldBounds, AZ::Vector2(1.0f),
+                perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+            ::benchmark::DoNotOptimize(m_heights.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, RebuildHeightfield_Region)
+        ->Arg(1024)->Arg(4096)->Unit(::benchmark::kMillisecond);
+}
+
+#endif // HAVE_BENCHMARK
@@ -7,7 +7,12 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/MemoryComponent.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <AzTest/AzTest.h>
 
@@ -31,6 +36,27 @@ using ::testing::SetArgReferee;
 
 namespace UnitTest
 {
+    // Makes ProcessRegion use the task graph for the lifetime of the object.
+    class TaskGraphActive
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        TaskGraphActive()
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+        }
+
+        ~TaskGraphActive() override
+        {
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
     class TerrainSystemTest : public ::testing::Test
     {
     protected:
@@ -138,6 +164,62 @@ namespace UnitTest
             ActivateEntity(entity.get());
             return entity;
         }
+
+        // Verify that the region query processes every position in the region exactly once and returns the same heights as querying
+        // each position separately. The region is large enough to get split into multiple bands, which run in parallel if a task graph
+        // or job context is available. Results are stored per index so that concurrent bands don't write to shared data.
+        void ProcessHeightsFromRegionAndCompareWithPerPositionQueries()
+        {
+            const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, -20.0f, 100.0f, 100.0f, 20.0f);
+            auto entity = CreateAndActivateMockTerrainLayerSpawner(
+                spawnerBox,
+                [](AZ::Vector3& position, bool& terrainExists)
+                {
+                    position.SetZ(10.0f * sin(position.GetX() * 0.1f) * cos(position.GetY() * 0.1f));
+                    terrainExists = position.GetX() < 80.0f;
+                });
+
+            auto terrainSystem = CreateAndActivateTerrainSystem(
+                AZ::Vector2(1.0f), AZ::Aabb::CreateFromMinMax(AZ::Vector3(-128.0f), AZ::Vector3(128.0f)));
+
+            const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 90.0f, 90.0f, 0.0f);
+            const AZ::Vector2 stepSize(0.5f);
+            const auto [numSamplesX, numSamplesY] = AzFramework::Terrain::TerrainDataRequests::GetNumSamplesFromRegion(region, stepSize);
+            ASSERT_EQ(numSamplesX, 180);
+            ASSERT_EQ(numSamplesY, 180);
+
+            AZStd::vector<float> heights(numSamplesX * numSamplesY, 0.0f);
+            AZStd::vector<uint8_t> exists(numSamplesX * numSamplesY, 0);
+            AZStd::vector<int> timesProcessed(numSamplesX * numSamplesY, 0);
+
+            terrainSystem->ProcessHeightsFromRegion(
+                region, stepSize,
+                [&heights, &exists, &timesProcessed, numSamplesX = numSamplesX](
+                    size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    const size_t index = (yIndex * numSamplesX) + xIndex;
+                    heights[index] = surfacePoint.m_position.GetZ();
+                    exists[index] = terrainExists;
+                    timesProcessed[index]++;
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+
+            for (size_t y = 0; y < numSamplesY; y++)
+            {
+                for (size_t x = 0; x < numSamplesX; x++)
+                {
+                    const size_t index = (y * numSamplesX) + x;
+                    bool expectedTerrainExists = false;
+                    const float expectedHeight = terrainSystem->GetHeightFromFloats(
+                        x * stepSize.GetX(), y * stepSize.GetY(), AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+                        &expectedTerrainExists);
+
+                    EXPECT_EQ(timesProcessed[index], 1);
+                    EXPECT_NEAR(heights[index], expectedHeight, 0.0001f);
+                    EXPECT_EQ(exists[index] != 0, expectedTerrainExists);
+                }
+            }
+        }
     };
 
     TEST_F(TerrainSystemTest, TrivialCreateDestroy)
@@ -572,4 +654,109 @@ namespace UnitTest
         EXPECT_EQ(tagWeight.m_surfaceType, tagWeight1.m_surfaceType);
         EXPECT_NEAR(tagWeight.m_weight, tagWeight1.m_weight, 0.01f);
     }
+
+    TEST_F(TerrainSystemTest, ProcessHeightsFromRegionMatchesPerPositionQueries)
+    {
+        ProcessHeightsFromRegionAndCompareWithPerPositionQueries();
+    }
+
+    TEST_F(TerrainSystemTest, ProcessHeightsFromRegionWithTaskGraphMatchesPerPositionQueries)
+    {
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+        {
+            AZ::TaskExecutor executor(2);
+            AZ::TaskExecutor::SetInstance(&executor);
+            TaskGraphActive taskGraphActive;
+
+            ProcessHeightsFromRegionAndCompareWithPerPositionQueries();
+
+            AZ::TaskExecutor::SetInstance(nullptr);
+        }
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+    }
+
+    TEST_F(TerrainSystemTest, ProcessHeightsFromRegionWithJobContextMatchesPerPositionQueries)
+    {
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+        {
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            desc.m_workerThreads.push_back(threadDesc);
+            desc.m_workerThreads.push_back(threadDesc);
+            AZ::JobManager jobManager(desc);
+            AZ::JobContext jobContext(jobManager);
+            AZ::JobContext::SetGlobalContext(&jobContext);
+
+            ProcessHeightsFromRegionAndCompareWithPerPositionQueries();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+        }
+        AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+    }
+
+    TEST_F(TerrainSystemTest, ProcessSurfacePointsFromRegionMatchesPerPositionQueries)
+    {
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 8.0f, 8.0f, 10.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + position.GetY() * 0.5f);
+                terrainExists = true;
+            });
+
+        AzFramework::SurfaceData::SurfaceTagWeight tagWeight;
+        tagWeight.m_surfaceType = AZ::Crc32("tag1");
+        tagWeight.m_weight = 1.0f;
+        const AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights{ tagWeight };
+
+        NiceMock<UnitTest::MockTerrainAreaSurfaceRequestBus> mockSurfaceRequests(entity->GetId());
+        ON_CALL(mockSurfaceRequests, GetSurfaceWeights).WillByDefault(SetArgReferee<1>(surfaceWeights));
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // The region extends past the spawner so that positions without terrain are covered too.
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 12.0f, 12.0f, 0.0f);
+        const AZ::Vector2 stepSize(1.0f);
+        const auto [numSamplesX, numSamplesY] = AzFramework::Terrain::TerrainDataRequests::GetNumSamplesFromRegion(region, stepSize);
+
+        AZStd::vector<AzFramework::SurfaceData::SurfacePoint> surfacePoints(numSamplesX * numSamplesY);
+        AZStd::vector<uint8_t> exists(numSamplesX * numSamplesY, 0);
+
+        terrainSystem->ProcessSurfacePointsFromRegion(
+            region, stepSize,
+            [&surfacePoints, &exists, numSamplesX = numSamplesX](
+                size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                surfacePoints[(yIndex * numSamplesX) + xIndex] = surfacePoint;
+                exists[(yIndex * numSamplesX) + xIndex] = terrainExists;
+            });
+
+        for (size_t y = 0; y < numSamplesY; y++)
+        {
+            for (size_t x = 0; x < numSamplesX; x++)
+            {
+                const size_t index = (y * numSamplesX) + x;
+                AzFramework::SurfaceData::SurfacePoint expectedSurfacePoint;
+                bool expectedTerrainExists = false;
+                terrainSystem->GetSurfacePointFromFloats(
+                    x * stepSize.GetX(), y * stepSize.GetY(), expectedSurfacePoint,
+                    AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, &expectedTerrainExists);
+
+                EXPECT_EQ(exists[index] != 0, expectedTerrainExists);
+                EXPECT_NEAR(surfacePoints[index].m_position.GetX(), expectedSurfacePoint.m_position.GetX(), 0.0001f);
+                EXPECT_NEAR(surfacePoints[index].m_position.GetY(), expectedSurfacePoint.m_position.GetY(), 0.0001f);
+                EXPECT_NEAR(surfacePoints[index].m_position.GetZ(), expectedSurfacePoint.m_position.GetZ(), 0.0001f);
+                EXPECT_TRUE(surfacePoints[index].m_normal.IsClose(expectedSurfacePoint.m_normal));
+                ASSERT_EQ(surfacePoints[index].m_surfaceTags.size(), expectedSurfacePoint.m_surfaceTags.size());
+                for (size_t tagIndex = 0; tagIndex < expectedSurfacePoint.m_surfaceTags.size(); tagIndex++)
+                {
+                    EXPECT_EQ(surfacePoints[index].m_surfaceTags[tagIndex].m_surfaceType,
+                        expectedSurfacePoint.m_surfaceTags[tagIndex].m_surfaceType);
+                }
+            }
+        }
+    }
 } // namespace UnitTest
@@ -9,6 +9,7 @@
 set(FILES
     Tests/TerrainTest.cpp
     Tests/TerrainSystemTest.cpp
+    Tests/TerrainSystemBenchmarks.cpp
     Tests/LayerSpawnerTests.cpp
     Tests/TerrainPhysicsColliderTests.cpp
     Tests/SurfaceMaterialsListTest.cpp
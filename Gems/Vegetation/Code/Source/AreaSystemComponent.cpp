@@ -1099,8 +1099,6 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
-        AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
         regionBounds.SetMin(regionBounds.GetMin() + regionOffset);
@@ -1113,29 +1111,44 @@ namespace Vegetation
         regionBounds.SetMax(regionBounds.GetMin() + AZ::Vector3(vegStep * (sectorDensity - 0.5f),
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
-        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
-            regionBounds,
-            stepSize,
-            SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+        // Build the list of positions to query the same way a region query steps through its bounds, so that the points are
+        // identical.  This is inclusive on the min sides of regionBounds, and exclusive on the max sides.
+        AZStd::vector<AZ::Vector3> inPositions;
+        inPositions.reserve(sectorDensity * sectorDensity);
+        for (float y = regionBounds.GetMin().GetY(); y < regionBounds.GetMax().GetY(); y += vegStep)
+        {
+            for (float x = regionBounds.GetMin().GetX(); x < regionBounds.GetMax().GetX(); x += vegStep)
+            {
+                inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
+            }
+        }
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(inPositions.size() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", inPositions.size(),
             (sectorDensity * sectorDensity));
 
+        // Query all of the positions at once.  The results come back in flat arrays, so no lists get allocated per position.
+        SurfaceData::SurfacePointLists availablePoints;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList,
+            inPositions,
+            SurfaceData::SurfaceTagVector(),
+            availablePoints);
+
         uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
+        for (size_t inPositionIndex = 0; inPositionIndex < availablePoints.GetInputPositionCount(); ++inPositionIndex)
         {
-            for (auto& surfacePoint : availablePoints.second)
+            const size_t firstPointIndex = availablePoints.GetFirstPointIndex(inPositionIndex);
+            const size_t endPointIndex = firstPointIndex + availablePoints.GetPointCount(inPositionIndex);
+            for (size_t pointIndex = firstPointIndex; pointIndex < endPointIndex; ++pointIndex)
             {
                 sectorInfo.m_baseContext.m_availablePoints.push_back();
                 ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
                 claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
+                claimPoint.m_position = availablePoints.GetPosition(pointIndex);
+                claimPoint.m_normal = availablePoints.GetNormal(pointIndex);
+                availablePoints.GetSurfaceTagWeights(pointIndex, claimPoint.m_masks);
+                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, claimPoint.m_masks);
             }
         }
     }